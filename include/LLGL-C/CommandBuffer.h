@@ -15,6 +15,40 @@
 #include <stdbool.h>
 
 
+/*
+Opcodes of the command stream that is executed by llglExecuteCommandStream.
+Each record starts with a header word (see LLGL_COMMAND_STREAM_HEADER) followed by the payload words listed for each opcode.
+Object handles take two words (low and high word of the 'internal' pointer), floats are stored with their IEEE-754 bit pattern.
+*/
+typedef enum LLGLCommandStreamOpcode
+{
+    LLGLCommandStreamOpcodeSetViewport,             /* x, y, width, height, minDepth, maxDepth (float) */
+    LLGLCommandStreamOpcodeSetScissor,              /* x, y, width, height (int32_t) */
+    LLGLCommandStreamOpcodeSetVertexBuffer,         /* buffer (handle) */
+    LLGLCommandStreamOpcodeSetIndexBuffer,          /* buffer (handle) */
+    LLGLCommandStreamOpcodeSetIndexBufferExt,       /* buffer (handle), format (LLGLFormat), offset (uint64_t) */
+    LLGLCommandStreamOpcodeSetResourceHeap,         /* resourceHeap (handle), descriptorSet */
+    LLGLCommandStreamOpcodeSetResource,             /* descriptor, resource (handle) */
+    LLGLCommandStreamOpcodeSetPipelineState,        /* pipelineState (handle) */
+    LLGLCommandStreamOpcodeSetBlendFactor,          /* r, g, b, a (float) */
+    LLGLCommandStreamOpcodeSetStencilReference,     /* reference, stencilFace (LLGLStencilFace) */
+    LLGLCommandStreamOpcodeSetUniforms,             /* first, dataSize (in bytes), data padded to whole words */
+    LLGLCommandStreamOpcodeUpdateBuffer,            /* dstBuffer (handle), dstOffset (uint64_t), dataSize (in bytes), data padded to whole words */
+    LLGLCommandStreamOpcodeDraw,                    /* numVertices, firstVertex */
+    LLGLCommandStreamOpcodeDrawIndexed,             /* numIndices, firstIndex, vertexOffset (int32_t) */
+    LLGLCommandStreamOpcodeDrawInstanced,           /* numVertices, firstVertex, numInstances, firstInstance */
+    LLGLCommandStreamOpcodeDrawIndexedInstanced,    /* numIndices, numInstances, firstIndex, vertexOffset (int32_t), firstInstance */
+    LLGLCommandStreamOpcodeDrawIndirect,            /* buffer (handle), offset (uint64_t), numCommands, stride */
+    LLGLCommandStreamOpcodeDrawIndexedIndirect,     /* buffer (handle), offset (uint64_t), numCommands, stride */
+    LLGLCommandStreamOpcodeDispatch,                /* numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ */
+}
+LLGLCommandStreamOpcode;
+
+/* Returns the header word of a command stream record with the specified opcode and number of payload words. */
+#define LLGL_COMMAND_STREAM_HEADER(OPCODE, NUM_WORDS) \
+    ((uint32_t)(OPCODE) | ((uint32_t)(NUM_WORDS) << 16))
+
+
 LLGL_C_EXPORT void llglBegin(LLGLCommandBuffer commandBuffer);
 LLGL_C_EXPORT void llglEnd();
 LLGL_C_EXPORT void llglExecute(LLGLCommandBuffer deferredCommandBuffer);
@@ -64,12 +98,15 @@ LLGL_C_EXPORT void llglDrawIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglDrawIndirectExt(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
 LLGL_C_EXPORT void llglDrawIndexedIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglDrawIndexedIndirectExt(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawIndirectCount(LLGLBuffer argsBuffer, uint64_t argsOffset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawIndexedIndirectCount(LLGLBuffer argsBuffer, uint64_t argsOffset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride);
 LLGL_C_EXPORT void llglDispatch(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ);
 LLGL_C_EXPORT void llglDispatchIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglPushDebugGroup(const char* name);
 LLGL_C_EXPORT void llglPopDebugGroup();
 LLGL_C_EXPORT void llglDoNativeCommand(const void* nativeCommand, size_t nativeCommandSize);
 LLGL_C_EXPORT bool llglGetNativeHandle(void* nativeHandle, size_t nativeHandleSize);
+LLGL_C_EXPORT void llglExecuteCommandStream(const uint32_t* words, size_t numWords);
 
 
 #endif
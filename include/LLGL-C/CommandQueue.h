@@ -20,6 +20,9 @@ LLGL_C_EXPORT void llglSubmitCommandBuffer(LLGLCommandBuffer commandBuffer);
 LLGL_C_EXPORT bool llglQueryResult(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, void* data, size_t dataSize);
 LLGL_C_EXPORT void llglSubmitFence(LLGLFence fence);
 LLGL_C_EXPORT bool llglWaitFence(LLGLFence fence, uint64_t timeout);
+LLGL_C_EXPORT void llglSubmitFenceSignal(LLGLFence fence, uint64_t value);
+LLGL_C_EXPORT bool llglWaitFenceValue(LLGLFence fence, uint64_t value, uint64_t timeout);
+LLGL_C_EXPORT bool llglWaitFenceValues(uint32_t numFences, const LLGLFence* fences, const uint64_t* values, uint64_t timeout);
 LLGL_C_EXPORT void llglWaitIdle();
 
 
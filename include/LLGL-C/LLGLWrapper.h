@@ -61,6 +61,14 @@ typedef enum LLGLStencilFace
 }
 LLGLStencilFace;
 
+typedef enum LLGLCommandQueueType
+{
+    LLGLCommandQueueTypeGraphics,
+    LLGLCommandQueueTypeCompute,
+    LLGLCommandQueueTypeTransfer,
+}
+LLGLCommandQueueType;
+
 typedef enum LLGLFormat
 {
     LLGLFormatUndefined,
@@ -142,6 +150,8 @@ typedef enum LLGLFormat
     LLGLFormatBC4SNorm,
     LLGLFormatBC5UNorm,
     LLGLFormatBC5SNorm,
+    LLGLFormatBC7UNorm,
+    LLGLFormatBC7UNorm_sRGB,
 }
 LLGLFormat;
 
@@ -164,6 +174,7 @@ typedef enum LLGLImageFormat
     LLGLImageFormatBC3,
     LLGLImageFormatBC4,
     LLGLImageFormatBC5,
+    LLGLImageFormatBC7,
 }
 LLGLImageFormat;
 
@@ -959,11 +970,13 @@ LLGLClearValue;
 
 typedef struct LLGLCommandBufferDescriptor
 {
-    const char*    debugName;          /* = NULL */
-    long           flags;              /* = 0 */
-    uint32_t       numNativeBuffers;   /* = 2 */
-    uint64_t       minStagingPoolSize; /* = (0xFFFF+1) */
-    LLGLRenderPass renderPass;         /* = LLGL_NULL_OBJECT */
+    const char*          debugName;           /* = NULL */
+    long                 flags;               /* = 0 */
+    uint32_t             numNativeBuffers;    /* = 2 */
+    uint32_t             maxNumNativeBuffers; /* = 8 */
+    uint64_t             minStagingPoolSize;  /* = (0xFFFF+1) */
+    LLGLRenderPass       renderPass;          /* = LLGL_NULL_OBJECT */
+    LLGLCommandQueueType queueType;           /* = LLGLCommandQueueTypeGraphics */
 }
 LLGLCommandBufferDescriptor;
 
@@ -1062,8 +1075,12 @@ LLGLQueryPipelineStatistics;
 
 typedef struct LLGLProfileTimeRecord
 {
-    const char* annotation;  /* = "" */
-    uint64_t    elapsedTime; /* = 0 */
+    const char* annotation;    /* = "" */
+    uint64_t    elapsedTime;   /* = 0 */
+    uint64_t    cpuTicksStart; /* = 0 */
+    uint64_t    cpuTicksEnd;   /* = 0 */
+    uint32_t    threadID;      /* = 0 */
+    uint32_t    nestingLevel;  /* = 0 */
 }
 LLGLProfileTimeRecord;
 
@@ -1152,6 +1169,8 @@ typedef struct LLGLRenderingFeatures
     bool hasPipelineCaching;           /* = false */
     bool hasPipelineStatistics;        /* = false */
     bool hasRenderCondition;           /* = false */
+    bool hasBindlessResources;         /* = false */
+    bool hasIndirectDrawCount;         /* = false */
 }
 LLGLRenderingFeatures;
 
@@ -1667,6 +1686,7 @@ typedef struct LLGLPipelineLayoutDescriptor
     const LLGLStaticSamplerDescriptor* staticSamplers;    /* = NULL */
     size_t                             numUniforms;       /* = 0 */
     const LLGLUniformDescriptor*       uniforms;          /* = NULL */
+    uint32_t                           bindlessSet;       /* = ~0u */
 }
 LLGLPipelineLayoutDescriptor;
 
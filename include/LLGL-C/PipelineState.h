@@ -12,9 +12,11 @@
 
 #include <LLGL-C/Export.h>
 #include <LLGL-C/Types.h>
+#include <stdbool.h>
 
 
 LLGL_C_EXPORT LLGLReport llglGetPipelineStateReport(LLGLPipelineState pipelineState);
+LLGL_C_EXPORT bool llglIsPipelineStateReady(LLGLPipelineState pipelineState);
 
 
 #endif
@@ -16,6 +16,7 @@
 LLGL_C_EXPORT LLGLReport llglGetShaderReport(LLGLShader shader);
 LLGL_C_EXPORT bool llglReflectShader(LLGLShader shader, LLGLShaderReflection* reflection);
 LLGL_C_EXPORT LLGLShaderType llglGetShaderType(LLGLShader shader);
+LLGL_C_EXPORT bool llglIsShaderReady(LLGLShader shader);
 
 
 #endif
@@ -81,6 +81,24 @@ virtual void DrawIndexedIndirect(
     std::uint32_t   stride
 ) override final;
 
+virtual void DrawIndirectCount(
+    LLGL::Buffer&   argsBuffer,
+    std::uint64_t   argsOffset,
+    LLGL::Buffer&   countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride
+) override final;
+
+virtual void DrawIndexedIndirectCount(
+    LLGL::Buffer&   argsBuffer,
+    std::uint64_t   argsOffset,
+    LLGL::Buffer&   countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride
+) override final;
+
 
 
 // ================================================================================
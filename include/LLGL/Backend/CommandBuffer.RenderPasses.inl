@@ -15,6 +15,14 @@ virtual void BeginRenderPass(
     std::uint32_t                   swapBufferIndex = LLGL_CURRENT_SWAP_INDEX
 ) override final;
 
+virtual void BeginParallelRenderPass(
+    LLGL::RenderTarget&             renderTarget,
+    const LLGL::RenderPass*         renderPass      = nullptr,
+    std::uint32_t                   numClearValues  = 0,
+    const LLGL::ClearValue*         clearValues     = nullptr,
+    std::uint32_t                   swapBufferIndex = LLGL_CURRENT_SWAP_INDEX
+) override final;
+
 virtual void EndRenderPass(
     void
 ) override final;
@@ -23,6 +23,43 @@
 #   include <LLGL/Backend/OpenGL/Android/AndroidNativeHandle.h>
 #endif
 
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace OpenGL
+{
+
+
+/**
+\brief Native command buffer statistics for the OpenGL render system.
+\remarks This can be queried with CommandBuffer::GetNativeHandle by passing a pointer to this structure and its size.
+For deferred command buffers, the uniform counters are accumulated when the command buffer is executed.
+\see CommandBuffer::SetUniforms
+*/
+struct CommandBufferStatistics
+{
+    //! Number of uniforms that have been submitted with a \c glUniform* call.
+    std::uint64_t   numUniformUploads;
+
+    //! Number of \c glUniform* calls that have been skipped, because the uniform values did not change.
+    std::uint64_t   numUniformUploadsSkipped;
+
+    //! Number of \c glBufferSubData calls for uniforms that are packed into a uniform buffer, i.e. uniforms declared inside a uniform block.
+    std::uint64_t   numUniformBufferUpdates;
+
+    //! Number of \c glBufferSubData calls that have been skipped, because none of the packed uniform values changed.
+    std::uint64_t   numUniformBufferUpdatesSkipped;
+};
+
+
+} // /namespace OpenGL
+
+} // /namespace LLGL
+
+
 
 #endif
 
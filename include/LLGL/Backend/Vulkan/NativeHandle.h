@@ -52,6 +52,27 @@ struct CommandBufferNativeHandle
     VkCommandBuffer commandBuffer;
 };
 
+/**
+\brief Native command buffer statistics for the Vulkan render system.
+\remarks This can be queried with CommandBuffer::GetNativeHandle by passing a pointer to this structure and its size.
+\see CommandBufferDescriptor::maxNumNativeBuffers
+*/
+struct CommandBufferStatistics
+{
+    //! Number of native command buffers that are currently allocated.
+    std::uint32_t   numNativeBuffers;
+
+    //! Soft limit of native command buffers the command buffer can grow to.
+    std::uint32_t   maxNumNativeBuffers;
+
+    /**
+    \brief Number of times CommandBuffer::Begin had to wait for the GPU.
+    \remarks This happens when all native command buffers were in flight and the limit was reached,
+    or when a multi-submit command buffer has been submitted more than once since it was last encoded.
+    */
+    std::uint64_t   recordingStalls;
+};
+
 
 } // /namespace Vulkan
 
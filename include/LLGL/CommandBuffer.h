@@ -573,9 +573,36 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             std::uint32_t       swapBufferIndex = LLGL_CURRENT_SWAP_INDEX
         ) = 0;
 
+        /**
+        \brief Begins a new render pass whose commands are encoded by secondary command buffers.
+        \param[in] renderTarget Specifies the render target in which to render. See BeginRenderPass.
+        \param[in] renderPass Optional pointer to a render pass object. See BeginRenderPass.
+        \param[in] numClearValues Specifies the number of clear values that are specified in \c clearValues. See BeginRenderPass.
+        \param[in] clearValues Optional pointer to the array of clear values. See BeginRenderPass.
+        \param[in] swapBufferIndex Specifies the swap-chain buffer index. See BeginRenderPass.
+        \remarks This is equivalent to BeginRenderPass except that the only command allowed within this render pass section is \c Execute.
+        All draw commands must be encoded by secondary command buffers that have been created with the CommandBufferFlags::Secondary flag
+        and a render pass (see CommandBufferDescriptor::renderPass) that is compatible with the render pass of this section.
+        Those secondary command buffers can be encoded concurrently on multiple threads and they are executed in the order of the \c Execute calls.
+        Since no state is inherited from the primary command buffer, each secondary command buffer must set its own viewports, pipeline state, and resources.
+        \remarks The backends without native support for secondary command buffers replay them in order, i.e. OpenGL and the Null backend record the commands on any thread
+        and the commands are executed on the thread that encodes the primary command buffer.
+        \see ParallelRenderPassEncoder
+        \see Execute
+        \see EndRenderPass
+        */
+        virtual void BeginParallelRenderPass(
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass      = nullptr,
+            std::uint32_t       numClearValues  = 0,
+            const ClearValue*   clearValues     = nullptr,
+            std::uint32_t       swapBufferIndex = LLGL_CURRENT_SWAP_INDEX
+        ) = 0;
+
         /**
         \brief Ends the current render pass.
         \see BeginRenderPass
+        \see BeginParallelRenderPass
         */
         virtual void EndRenderPass() = 0;
 
@@ -920,6 +947,61 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
 
+        /**
+        \brief Draws primitives whose draw command arguments and number of draw commands are taken from buffer objects.
+
+        \param[in] argsBuffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] argsOffset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] countOffset Specifies an offset within the count buffer from which the number of draw commands is to be taken. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands. The number of draw commands that are taken from the count buffer is clamped to this value.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \remarks This allows the GPU to determine the number of draw commands, e.g. with a compute shader that culls objects and compacts their draw arguments (see IndirectDrawCuller).
+        \remarks This is natively supported by OpenGL (with \c GL_ARB_indirect_parameters), Vulkan (with \c VK_KHR_draw_indirect_count), and Direct3D 12.
+        For Direct3D 12, the stride must be equal to the size of the respective argument structure.
+        The Null backend emulates this command by reading the argument and count buffers on the CPU.
+
+        \see DrawIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawCount
+        */
+        virtual void DrawIndirectCount(
+            Buffer&         argsBuffer,
+            std::uint64_t   argsOffset,
+            Buffer&         countBuffer,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
+        /**
+        \brief Draws indexed primitives whose draw command arguments and number of draw commands are taken from buffer objects.
+
+        \param[in] argsBuffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] argsOffset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] countOffset Specifies an offset within the count buffer from which the number of draw commands is to be taken. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands. The number of draw commands that are taken from the count buffer is clamped to this value.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndexedIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \remarks See DrawIndirectCount for the backend support.
+
+        \see DrawIndexedIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawCount
+        */
+        virtual void DrawIndexedIndirectCount(
+            Buffer&         argsBuffer,
+            std::uint64_t   argsOffset,
+            Buffer&         countBuffer,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
         /* ----- Compute ----- */
 
         /**
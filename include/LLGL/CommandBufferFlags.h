@@ -60,6 +60,25 @@ enum class StencilFace
     Back,
 };
 
+/**
+\brief Command queue type enumeration.
+\remarks Work on different command queues may overlap on the GPU.
+Cross-queue dependencies must be expressed with fences, i.e. CommandQueue::Submit(Fence&) on the producing queue and CommandQueue::SubmitWait on the consuming queue.
+\see RenderSystem::GetDedicatedCommandQueue
+\see CommandBufferDescriptor::queueType
+*/
+enum class CommandQueueType
+{
+    //! Command queue that supports all commands. This is the queue returned by RenderSystem::GetCommandQueue.
+    Graphics,
+
+    //! Command queue that only supports compute and copy commands, i.e. no render passes and no draw commands.
+    Compute,
+
+    //! Command queue that only supports copy commands, e.g. CommandBuffer::CopyBuffer and CommandBuffer::CopyTextureFromBuffer.
+    Transfer,
+};
+
 
 /* ----- Flags ----- */
 
@@ -282,10 +301,25 @@ struct CommandBufferDescriptor
     These native command buffers are then switched everytime encoding begins with the CommandBuffer::Begin function.
     The benefit of having multiple native command buffers is that it reduces the time the GPU is idle
     because it waits for a command buffer to be completed before it can be reused.
+    \remarks Secondary command buffers (see CommandBufferFlags::Secondary) are never submitted on their own and therefore cycle through
+    their native command buffers without waiting for the GPU. For those, this must be at least the number of frames
+    the primary command buffers they are executed in can have in flight.
     \see CommandBuffer::Begin
     */
     std::uint32_t       numNativeBuffers    = 2;
 
+    /**
+    \brief Specifies the soft limit of internal native command buffers the command buffer can grow to. By default 8.
+    \remarks This is only a hint to the framework and only used by backends that cycle through multiple native command buffers (i.e. Vulkan).
+    If all native command buffers are still in flight when encoding begins, a new native command buffer is allocated until this limit is reached.
+    Only then will CommandBuffer::Begin block until the oldest native command buffer has been completed by the GPU.
+    If this is less than \c numNativeBuffers, the number of native command buffers is fixed.
+    Secondary command buffers are in flight for as long as any primary command buffer that executed them.
+    This field is ignored for command buffers with the CommandBufferFlags::MultiSubmit flag.
+    \see numNativeBuffers
+    */
+    std::uint32_t       maxNumNativeBuffers = 8;
+
     /**
     \brief Specifies the minimum size (in bytes) for the staging pool (if supported). By default 65536 (or <tt>0xFFFF + 1</tt>).
     \remarks This is only a hint to the framework, since not all rendering APIs support command buffers natively.
@@ -305,6 +339,14 @@ struct CommandBufferDescriptor
     \see CommandBufferFlags::Secondary
     */
     const RenderPass*   renderPass          = nullptr;
+
+    /**
+    \brief Specifies the type of command queue this command buffer will be submitted to. By default CommandQueueType::Graphics.
+    \remarks If the render system has no dedicated command queue of this type, the command buffer is submitted to the graphics command queue instead.
+    A command buffer must only be submitted to the command queue of the type it was created for.
+    \see RenderSystem::GetDedicatedCommandQueue
+    */
+    CommandQueueType    queueType           = CommandQueueType::Graphics;
 };
 
 
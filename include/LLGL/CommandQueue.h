@@ -11,6 +11,7 @@
 
 #include <LLGL/RenderSystemChild.h>
 #include <LLGL/ForwardDecls.h>
+#include <LLGL/CommandBufferFlags.h>
 #include <cstdint>
 #include <cstddef>
 
@@ -123,10 +124,75 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void WaitIdle() = 0;
 
+        /**
+        \brief Makes this command queue wait until the specified fence has been signaled before it executes subsequently submitted command buffers.
+        \param[in] fence Specifies the fence that has been submitted to another command queue via Submit(Fence&).
+        \remarks This is used to express dependencies between command queues without blocking the CPU.
+        The default implementation blocks the CPU until the fence has been signaled.
+        \see RenderSystem::GetDedicatedCommandQueue
+        */
+        virtual void SubmitWait(Fence& fence);
+
+        /**
+        \brief Submits a signal operation that sets the specified fence to the specified value once all previously submitted commands have been completed.
+        \param[in] fence Specifies the fence whose value is to be signaled.
+        \param[in] value Specifies the new value of the fence. This must be greater than any value this fence has been signaled with before.
+        \remarks This allows a single fence to track multiple points in the command queue, e.g. one value per frame for frame pacing:
+        \code
+        // Signal frame index and wait until the GPU is at most N frames behind
+        myCmdQueue->SubmitSignal(*myFrameFence, frameIndex);
+        if (frameIndex >= N)
+            myCmdQueue->WaitFenceValue(*myFrameFence, frameIndex - N + 1, ~0ull);
+        \endcode
+        A fence must either be used with Submit(Fence&) or with SubmitSignal but not both.
+        The default implementation submits the fence like Submit(Fence&),
+        i.e. waiting for any value afterwards waits for the most recent signal operation.
+        \note Natively supported with: Vulkan (if \c VK_KHR_timeline_semaphore is available), OpenGL (emulated with sync objects), Null.
+        \see WaitFenceValue
+        \see WaitFenceValues
+        */
+        virtual void SubmitSignal(Fence& fence, std::uint64_t value);
+
+        /**
+        \brief Blocks the CPU execution until the specified fence has reached at least the specified value.
+        \param[in] fence Specifies the fence that has been submitted via SubmitSignal.
+        \param[in] value Specifies the minimum value the fence must have reached.
+        \param[in] timeout Specifies the waiting timeout (in nanoseconds).
+        \return True if the fence has reached the value, or false if a timeout occurred or the device is lost.
+        \remarks Use a timeout of zero to poll the fence without blocking.
+        \see SubmitSignal
+        */
+        virtual bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout);
+
+        /**
+        \brief Blocks the CPU execution until all specified fences have reached at least their respective values.
+        \param[in] numFences Specifies the number of fences.
+        \param[in] fences Pointer to an array of \c numFences fences that have been submitted via SubmitSignal.
+        \param[in] values Pointer to an array of \c numFences minimum values, one for each fence.
+        \param[in] timeout Specifies the waiting timeout (in nanoseconds) for all fences together.
+        \return True if all fences have reached their values, or false if a timeout occurred or the device is lost.
+        \remarks This is more efficient than waiting for each fence individually, since backends can batch the wait into a single operation.
+        \see WaitFenceValue
+        */
+        virtual bool WaitFenceValues(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, std::uint64_t timeout);
+
+        //! Returns the type of this command queue. By default CommandQueueType::Graphics.
+        inline CommandQueueType GetType() const
+        {
+            return type_;
+        }
+
     protected:
 
         CommandQueue() = default;
 
+        //! Initializes the command queue with the specified type.
+        CommandQueue(const CommandQueueType type);
+
+    private:
+
+        CommandQueueType type_ = CommandQueueType::Graphics;
+
 };
 
 
@@ -57,6 +57,12 @@
 */
 #define LLGL_CURRENT_SWAP_INDEX             ( static_cast<std::uint32_t>(-1) )
 
+/**
+\brief Specifies an invalid index into the bindless descriptor arrays.
+\see RenderSystem::GetBindlessIndex
+*/
+#define LLGL_INVALID_BINDLESS_INDEX         ( static_cast<std::uint32_t>(-1) )
+
 
 namespace LLGL
 {
@@ -25,6 +25,46 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Image resampling filter enumeration.
+\see ResampleImageBuffer
+\see Image::Resample
+*/
+enum class ResampleFilter
+{
+    //! Box filter. Averages all source pixels a destination pixel covers when downsampling and selects the nearest pixel when upsampling.
+    Box,
+
+    //! Bilinear (or tent) filter with a radius of one source pixel.
+    Bilinear,
+
+    //! Bicubic Catmull-Rom filter with a radius of two source pixels.
+    Bicubic,
+
+    //! Lanczos filter with a radius of three source pixels. This is the sharpest filter but can produce ringing artifacts at hard edges.
+    Lanczos3,
+};
+
+/**
+\brief Image compression quality enumeration.
+\remarks This trades encoding speed for image quality.
+\see CompressImageBuffer
+*/
+enum class CompressionQuality
+{
+    //! Fastest compression. Endpoints are derived from the bounding box of the block colors.
+    Fast,
+
+    //! Balanced compression. Endpoints are derived from the principal axis of the block colors.
+    Default,
+
+    //! Best compression. Tries multiple endpoint candidates and refines them iteratively.
+    High,
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -208,6 +248,33 @@ LLGL_EXPORT bool ConvertImageBuffer(
     unsigned                threadCount = 0
 );
 
+/**
+\brief Converts or copies the source image row by row into the destination image, where each image may have its own row stride.
+\param[in] srcImageView Specifies the source image view.
+The last row of the source image does not need to be padded, i.e. \c dataSize may end right after the last texel.
+\param[in] srcRowStride Specifies the distance (in bytes) between two rows in the source image. If this is zero, the rows are tightly packed.
+\param[out] dstImageView Specifies the destination image view. This must be large enough to hold all rows of the source image with the destination row stride.
+\param[in] dstRowStride Specifies the distance (in bytes) between two rows in the destination image. If this is zero, the rows are tightly packed.
+\param[in] rowLength Specifies the number of texels in each row.
+\param[in] threadCount Specifies the number of threads to use for conversion.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\return True if any conversion was necessary. Otherwise, the rows have been copied bitwise.
+\remarks In contrast to the other overloads, the destination buffer is always written to.
+Each texel is read and written only once, which allows to convert image data straight into mapped GPU memory, e.g. a staging buffer with aligned rows.
+\note Compressed images cannot be converted.
+\see LLGL_MAX_THREAD_COUNT
+\see GetMemoryFootprint
+*/
+LLGL_EXPORT bool ConvertImageBuffer(
+    const ImageView&        srcImageView,
+    std::uint32_t           srcRowStride,
+    const MutableImageView& dstImageView,
+    std::uint32_t           dstRowStride,
+    std::uint32_t           rowLength,
+    unsigned                threadCount = 0
+);
+
 /**
 \brief Converst the image format and data type of the source image (only uncompressed color formats) and returns the new generated image buffer.
 \param[in] srcImageView Specifies the source image view.
@@ -248,6 +315,33 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     unsigned            threadCount = 0
 );
 
+/**
+\brief Compresses the specified image buffer into a block compression format.
+\param[in] srcImageView Specifies the source image view. This must be an uncompressed color image.
+If the source image is not in ImageFormat::RGBA format with DataType::UInt8, it is converted first.
+\param[in] extent Specifies the image extent. This does not need to be a multiple of the block size; partial blocks are padded with the texels at the image edge.
+\param[in] dstFormat Specifies the destination block compression format. This must be ImageFormat::BC1, ImageFormat::BC2, ImageFormat::BC3, ImageFormat::BC4, ImageFormat::BC5, or ImageFormat::BC7.
+BC4 compresses only the red channel and BC5 compresses the red and green channels.
+For BC1, texels with an alpha value less than 128 are encoded as transparent.
+BC7 is always encoded in mode 6, i.e. a single subset with 7-bit RGBA endpoints and 4-bit indices.
+\param[in] quality Specifies the compression quality. By default CompressionQuality::Default.
+\param[in] threadCount Specifies the number of threads to use for compression.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\return Byte buffer with the compressed blocks in row-major order or null if the destination format is not supported for compression.
+The output can be uploaded to a texture with the respective format, e.g. Format::BC1UNorm or Format::BC1UNorm_sRGB for ImageFormat::BC1.
+\throw std::invalid_argument If the source image is compressed or has a depth-stencil format.
+\throw std::invalid_argument If the source buffer is too small for the image extent.
+\see DecompressImageBufferToRGBA8UNorm
+*/
+LLGL_EXPORT DynamicByteArray CompressImageBuffer(
+    const ImageView&    srcImageView,
+    const Extent2D&     extent,
+    ImageFormat         dstFormat,
+    CompressionQuality  quality     = CompressionQuality::Default,
+    unsigned            threadCount = 0
+);
+
 /**
 \brief Copies an image buffer region from the source buffer to the destination buffer.
 \param[out] dstImageView Specifies the destination image view.
@@ -312,6 +406,35 @@ LLGL_EXPORT DynamicByteArray GenerateImageBuffer(
     const float fillColor[4]
 );
 
+/**
+\brief Resamples the source image (only uncompressed color formats) to a new extent and returns the new generated image buffer.
+\param[in] srcImageView Specifies the source image view.
+\param[in] srcExtent Specifies the extent of the source image.
+\param[in] dstExtent Specifies the extent of the destination image. Each dimension must be greater than zero.
+\param[in] filter Specifies the filter kernel that is used to reconstruct the source image.
+\param[in] isSRGB Specifies whether the color components (but not alpha) are encoded in sRGB space.
+If true, the image is resampled in linear space and encoded in sRGB space again afterwards. By default false.
+\param[in] threadCount Specifies the number of threads to use for resampling.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\return Byte buffer with the resampled image data in the same format and data type as the source image or null if the source and destination extents are equal.
+\remarks The image is resampled with one separable pass for each dimension that changes and pixels outside the source image are clamped to its edge.
+All passes operate on 32-bit floating-point RGBA values, so every data type is supported.
+Values of normalized integer data types are clamped to their range since the Bicubic and Lanczos3 filters can overshoot.
+\throw std::invalid_argument If a compressed image format or a depth-stencil format is specified.
+\throw std::invalid_argument If the source buffer is too small for the source extent.
+\see ResampleFilter
+\see LLGL_MAX_THREAD_COUNT
+*/
+LLGL_EXPORT DynamicByteArray ResampleImageBuffer(
+    const ImageView&    srcImageView,
+    const Extent3D&     srcExtent,
+    const Extent3D&     dstExtent,
+    ResampleFilter      filter,
+    bool                isSRGB      = false,
+    unsigned            threadCount = 0
+);
+
 /** @} */
 
 
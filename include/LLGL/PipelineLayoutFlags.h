@@ -14,6 +14,7 @@
 #include <LLGL/BufferFlags.h>
 #include <LLGL/SamplerFlags.h>
 #include <LLGL/ShaderFlags.h>
+#include <LLGL/Constants.h>
 #include <LLGL/Container/StringView.h>
 #include <vector>
 
@@ -375,6 +376,20 @@ struct PipelineLayoutDescriptor
     \see CommandBuffer::SetUniforms
     */
     std::vector<UniformDescriptor>          uniforms;
+
+    /**
+    \brief Specifies the descriptor set in the shaders, i.e. <code>layout(set = N)</code>, that accesses the bindless descriptor arrays. By default LLGL_INVALID_SLOT.
+    \remarks If this is not LLGL_INVALID_SLOT and the render system supports bindless resources, the shaders can access the following arrays in this descriptor set:
+    - Binding 0: Array of all textures, e.g. <code>layout(set = N, binding = 0) uniform texture2D textures[];</code>
+    - Binding 1: Array of all samplers, e.g. <code>layout(set = N, binding = 1) uniform sampler samplers[];</code>
+    - Binding 2: Array of all storage buffers, e.g. <code>layout(set = N, binding = 2) buffer Data { vec4 data[]; } buffers[];</code>
+    \remarks The indices into these arrays are queried with RenderSystem::GetBindlessIndex and are usually passed to the shaders via uniforms (see \c uniforms),
+    so that switching materials does not require any descriptor sets to be rebound.
+    \remarks This is ignored if the render system does not support bindless resources.
+    \see RenderingFeatures::hasBindlessResources
+    \see RenderSystem::GetBindlessIndex
+    */
+    std::uint32_t                           bindlessSet     = LLGL_INVALID_SLOT;
 };
 
 
@@ -32,10 +32,21 @@ class LLGL_EXPORT PipelineState : public RenderSystemChild
         /**
         \brief Returns a pointer to the report or null if there is none.
         \remarks If there is a report, it might contain warnings and/or errors from the PSO and shader compilation process.
+        \remarks If shaders are linked asynchronously (see IsReady), this blocks until linking has finished.
+        Hence, this must be called on the rendering thread and not on a thread that only records secondary command buffers.
         \see Report
         */
         virtual const Report* GetReport() const = 0;
 
+        /**
+        \brief Returns true if this pipeline state has finished compiling and linking its shaders, i.e. querying its report or binding it will not block.
+        \remarks Some backends link shader programs asynchronously, e.g. the OpenGL backend with \c GL_KHR_parallel_shader_compile.
+        This allows the driver to compile many pipeline states concurrently when they are all created before any of them is used.
+        \remarks The default implementation always returns true.
+        \see Shader::IsReady
+        */
+        virtual bool IsReady() const;
+
 };
 
 
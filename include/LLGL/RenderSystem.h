@@ -234,9 +234,30 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         /* ----- Command queues ----- */
 
-        //! Returns the single instance of the command queue.
+        //! Returns the single instance of the graphics command queue.
         virtual CommandQueue* GetCommandQueue() = 0;
 
+        /**
+        \brief Returns the dedicated command queue of the specified type or null if the render system has no such queue.
+        \param[in] type Specifies the type of command queue. For CommandQueueType::Graphics, this is equivalent to GetCommandQueue.
+        \remarks Dedicated compute and transfer queues allow GPGPU work and resource streaming to overlap with the graphics command queue.
+        Command buffers for a dedicated queue must be created with the respective CommandBufferDescriptor::queueType.
+        Dependencies between queues are expressed with fences:
+        \code
+        // Upload data on the transfer queue and let the graphics queue wait for it
+        if (LLGL::CommandQueue* transferQueue = myRenderer->GetDedicatedCommandQueue(LLGL::CommandQueueType::Transfer))
+        {
+            transferQueue->Submit(*myTransferCmdBuffer);
+            transferQueue->Submit(*myUploadFence);
+            myRenderer->GetCommandQueue()->SubmitWait(*myUploadFence);
+        }
+        \endcode
+        \note Only supported with: Vulkan, Null (emulated with worker threads).
+        \see CommandQueue::GetType
+        \see CommandQueue::SubmitWait
+        */
+        virtual CommandQueue* GetDedicatedCommandQueue(const CommandQueueType type);
+
         /* ----- Command buffers ----- */
 
         /**
@@ -407,6 +428,46 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView) = 0;
 
+        /**
+        \brief Requests to read the image data from the specified texture asynchronously.
+        \param[in] texture Specifies the texture object to read from. This texture must not be released before the request has been resolved.
+        \param[in] textureRegion Specifies the region where the texture data is to be read.
+        \return Non-zero identifier of the new readback request. This must be passed to ResolveTextureRead to retrieve the image data.
+        \remarks The GPU copies the texture data into an intermediate buffer without blocking the CPU.
+        Backends that do not support asynchronous readback read the texture synchronously into intermediate storage when the request is created,
+        so the resolved image data always reflects the texture content at the time of this request.
+        \remarks The image data is converted on the CPU when the request is resolved.
+        For depth-stencil and compressed textures, the destination image view must therefore match the image format and data type of the texture format.
+        \see GetFormatAttribs
+        \remarks Each request must eventually be resolved, otherwise its intermediate storage is not released before the render system is unloaded.
+        \note Only supported with: OpenGL 4.5+ (or GL_ARB_buffer_storage and GL_ARB_get_texture_sub_image extensions).
+        \see ResolveTextureRead
+        \see ReadTexture
+        */
+        virtual std::uint64_t RequestTextureRead(Texture& texture, const TextureRegion& textureRegion);
+
+        /**
+        \brief Resolves a readback request that was previously created with RequestTextureRead.
+        \param[in] requestID Specifies the identifier of the readback request.
+        \param[out] dstImageView Specifies the destination image view to write the texture data to. The same requirements apply as for ReadTexture.
+        \param[in] wait Specifies whether to block until the GPU has finished the copy. If this is false, the function returns immediately when the data is not yet available.
+        \return True if the image data has been written to the destination and the request has been released.
+        Otherwise, the request is still pending (only if \c wait is false), the identifier is invalid, or waiting for the GPU failed.
+        If waiting for the GPU failed, an error is logged and the request is released as well.
+        \remarks Typical use is to request the readback of a frame and poll it once per frame until it succeeds:
+        \code
+        // Request screenshot after the frame has been submitted
+        if (myScreenshotRequest == 0)
+            myScreenshotRequest = myRenderSystem->RequestTextureRead(*myTexture, myTextureRegion);
+
+        // Poll screenshot in one of the next frames
+        if (myRenderSystem->ResolveTextureRead(myScreenshotRequest, myImageView))
+            myScreenshotRequest = 0;
+        \endcode
+        \see RequestTextureRead
+        */
+        virtual bool ResolveTextureRead(std::uint64_t requestID, const MutableImageView& dstImageView, bool wait = false);
+
         /* ----- Samplers ---- */
 
         /**
@@ -586,6 +647,72 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified Fence object. After this call, the specified object must no longer be used.
         virtual void Release(Fence& fence) = 0;
 
+        /* ----- Loader threads ----- */
+
+        /**
+        \brief Turns the calling thread into a loader thread, which can create resources concurrently with the rendering thread.
+        \return True if the calling thread is now a loader thread. If this returns false, the render system does not support loader threads
+        and all resources must be created on the rendering thread.
+        \remarks Between BeginLoaderThread and EndLoaderThread, the calling thread can create and release buffers, textures, samplers, and shaders
+        (see CreateBuffer, CreateTexture, CreateSampler, and CreateShader) while other threads, including other loader threads, use this render system.
+        All other functions must still be called on the rendering thread only.
+        \remarks A resource that has been created on a loader thread must not be used by another thread until FlushLoaderThread or EndLoaderThread has returned.
+        Resources must be released on the thread that uses them for rendering unless they have never been handed over by the loader thread.
+        \remarks For OpenGL, each loader thread has its own GL context that shares its objects with the primary GL context, so a swap-chain must have been created first.
+        Vertex buffers that have been created on a loader thread build their vertex array object on first use by the rendering thread.
+        For Vulkan, device memory allocations and staging uploads are serialized with the graphics command queue.
+        \code
+        std::thread myLoaderThread(
+            [myRenderer, &myTextureDesc, &myImageView, &myTexture]()
+            {
+                if (myRenderer->BeginLoaderThread())
+                {
+                    myTexture = myRenderer->CreateTexture(myTextureDesc, &myImageView);
+                    myRenderer->EndLoaderThread();
+                }
+            }
+        );
+        \endcode
+        \note Only supported with: OpenGL (on Windows and Linux), Vulkan, Null.
+        \see EndLoaderThread
+        \see FlushLoaderThread
+        \see ResourceLoader
+        */
+        virtual bool BeginLoaderThread();
+
+        /**
+        \brief Flushes all resources that have been created on the calling loader thread and releases its loader context.
+        \remarks This must only be called on a thread for which BeginLoaderThread has returned true.
+        \see BeginLoaderThread
+        */
+        virtual void EndLoaderThread();
+
+        /**
+        \brief Blocks until all resources that have been created on the calling loader thread are ready to be used by other threads.
+        \remarks For OpenGL, this waits until the commands of the loader context have been completed.
+        For Vulkan, this submits and waits for the pending staging uploads.
+        \see BeginLoaderThread
+        */
+        virtual void FlushLoaderThread();
+
+        /* ----- Bindless resources ----- */
+
+        /**
+        \brief Returns the stable index of the specified resource into the bindless descriptor arrays.
+        \param[in] resource Specifies the resource whose index is to be returned. This must be a Texture, Sampler, or Buffer.
+        \return Index into the bindless descriptor array of the respective resource type, or LLGL_INVALID_BINDLESS_INDEX if the resource cannot be accessed as bindless resource.
+        \remarks The index is allocated on the first call for the respective resource and remains valid until the resource is released.
+        Indices of released resources are recycled for resources that are queried later.
+        Textures must have been created with BindFlags::Sampled and buffers with BindFlags::Sampled or BindFlags::Storage.
+        \remarks The index can be passed to the shaders via uniforms (see CommandBuffer::SetUniforms) or per-instance vertex data.
+        The shaders access the resources with this index in the descriptor set that is specified by PipelineLayoutDescriptor::bindlessSet.
+        \remarks This function is thread-safe with loader threads (see BeginLoaderThread).
+        \note Only supported with: Vulkan.
+        \see RenderingFeatures::hasBindlessResources
+        \see PipelineLayoutDescriptor::bindlessSet
+        */
+        virtual std::uint32_t GetBindlessIndex(Resource& resource);
+
         /* ----- Extensions ----- */
 
         /**
@@ -661,6 +661,20 @@ struct RenderingFeatures
     \see CommandBuffer:BeginRenderCondition
     */
     bool hasRenderCondition             = false;
+
+    /**
+    \brief Specifies whether bindless resources are supported, i.e. textures, samplers, and storage buffers can be accessed by an index into a global descriptor array.
+    \see RenderSystem::GetBindlessIndex
+    \see PipelineLayoutDescriptor::bindlessSet
+    */
+    bool hasBindlessResources           = false;
+
+    /**
+    \brief Specifies whether indirect draw commands with a draw count from a buffer object are supported.
+    \see CommandBuffer::DrawIndirectCount
+    \see CommandBuffer::DrawIndexedIndirectCount
+    */
+    bool hasIndirectDrawCount           = false;
 };
 
 /**
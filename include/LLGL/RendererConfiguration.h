@@ -128,6 +128,27 @@ struct RendererConfigurationOpenGL
     the repesctive extension and procedure name is printed to standard error output.
     */
     bool                    suppressFailedExtensions    = false;
+
+    /**
+    \brief Specifies an optional directory for the global shader program binary cache. By default null.
+    \remarks If this is not null, every shader program that is created without an explicit PipelineCache is first looked up in this directory
+    and stored there after it has been linked successfully. The key of each entry is derived from the shader sources,
+    the shader permutation, and the \c GL_RENDERER and \c GL_VERSION strings, so entries of a different driver are never loaded.
+    \remarks The directory must already exist and be writable. This is ignored if the GL implementation does not support program binaries,
+    i.e. RenderingFeatures::hasPipelineCaching is false. Separable shader programs are not cached.
+    \see PipelineCache
+    */
+    const char*             programBinaryCacheDir       = nullptr;
+
+    /**
+    \brief Specifies whether dynamic uniforms that are declared inside a uniform block are packed into a uniform buffer that is owned by each PSO. By default false.
+    \remarks If this is false, only uniforms of the default uniform block can be set with CommandBuffer::SetUniforms.
+    If this is true, the uniforms of one uniform block per PSO (see PipelineLayoutDescriptor::uniforms) are written into a uniform buffer
+    that is updated with a single \c glBufferSubData per call to CommandBuffer::SetUniforms.
+    \remarks This reserves the highest uniform buffer binding point that is not used by the pipeline layout of the respective PSO.
+    If all binding points are used by the pipeline layout, the uniforms of that PSO are not packed.
+    */
+    bool                    packBlockUniforms           = false;
 };
 
 /**
@@ -59,6 +59,48 @@ class LLGL_EXPORT RenderingDebugger
         //! \retrun Returns whether time recording is enabled.
         bool GetTimeRecording() const;
 
+        /**
+        \brief Sets the sampling of command validation to reduce the CPU overhead of the debug layer.
+        \remarks This can be used to leave the debug layer enabled in production with a low validation budget.
+        The new sampling takes effect with the next call to CommandBuffer::Begin.
+        \see ValidationSampling
+        */
+        void SetValidationSampling(const ValidationSampling& sampling);
+
+        //! Returns the current sampling of command validation. By default, every command is validated.
+        const ValidationSampling& GetValidationSampling() const;
+
+        /**
+        \brief Sets the analysis mode for render pass load and store operations.
+        \remarks The analysis assumes that command buffers are submitted in the same order as they are encoded.
+        The new mode takes effect with the next call to CommandBuffer::Begin.
+        \see LoadStoreAnalysis
+        */
+        void SetLoadStoreAnalysis(const LoadStoreAnalysis mode);
+
+        //! Returns the current analysis mode for render pass load and store operations. By default LoadStoreAnalysis::Disabled.
+        LoadStoreAnalysis GetLoadStoreAnalysis() const;
+
+        /**
+        \brief Starts streaming all time records into a trace file in the Chrome Trace Event Format.
+        \param[in] filename Specifies the output filename, e.g. \c "Capture.trace.json".
+        \remarks This also enables time recording. Each call to FlushProfile appends the time records of the current frame to the output file.
+        The CPU timeline is split into one track per thread with debug groups nested around their commands.
+        The GPU timeline is laid out from the elapsed times of the timer queries, since those queries don't provide absolute time stamps.
+        The output can be inspected with \c chrome://tracing or the Perfetto UI (https://ui.perfetto.dev).
+        \return True if the output file has been opened successfully. Otherwise, the previous trace (if any) is closed and the return value is false.
+        \see EndTrace
+        \see SetTimeRecording
+        */
+        bool BeginTrace(const char* filename);
+
+        /**
+        \brief Finalizes and closes the trace file that was opened with BeginTrace. This has no effect if no trace is active.
+        \remarks This is also done automatically when the rendering debugger is destroyed.
+        \see BeginTrace
+        */
+        void EndTrace();
+
         /**
         \brief Posts an error message.
         \param[in] type Specifies the type of error.
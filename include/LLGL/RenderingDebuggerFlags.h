@@ -39,20 +39,100 @@ enum class WarningType
     VaryingBehavior,    //!< Warning due to a varying behavior between the native APIs (e.g. \c SV_VertexID in HLSL behaves different to \c gl_VertexID in GLSL or \c gl_VertexIndex in SPIRV).
 };
 
+/**
+\brief Rendering debugger analysis modes for the load and store operations of render pass attachments.
+\remarks The analysis tracks how the attachment textures of each render target are read across render passes.
+A store operation is unnecessary if the stored content is overwritten before it is read, e.g. by a subsequent render pass that clears the attachment.
+A load operation is unnecessary if the attachment is cleared with CommandBuffer::Clear or CommandBuffer::ClearAttachments before anything is drawn into it.
+Swap-chains and attachments without a texture are not analyzed.
+\see RenderingDebugger::SetLoadStoreAnalysis
+*/
+enum class LoadStoreAnalysis
+{
+    //! Load and store operations are not analyzed. This is the default.
+    Disabled,
+
+    //! Unnecessary load and store operations are reported as warnings of type WarningType::PointlessOperation.
+    Report,
+
+    /**
+    \brief Unnecessary load and store operations are reported and unnecessary load operations are downgraded to AttachmentLoadOp::Undefined.
+    \remarks The downgrade is learned from previous frames and takes effect with the next call to SwapChain::Present.
+    A load operation that turns out to be necessary in a later frame is permanently restored.
+    Store operations are never downgraded, since stored content that is only read occasionally (e.g. for a screenshot) would otherwise be lost.
+    Command buffers with the CommandBufferFlags::MultiSubmit flag always use the original render pass.
+    */
+    Downgrade,
+};
+
 
 /* ----- Structures ----- */
 
+/**
+\brief Rendering debugger validation sampling structure.
+\remarks Only sampled draw and dispatch commands are validated by the debug layer. Unsampled draw and dispatch commands skip all validation,
+including inexpensive state checks such as whether a pipeline state is bound. Profile counters and the load/store analysis remain active for every command.
+\see RenderingDebugger::SetValidationSampling
+*/
+struct ValidationSampling
+{
+    /**
+    \brief Specifies that only every N-th draw and dispatch command is validated. By default 1.
+    \remarks A value of 0 or 1 validates every command.
+    Copy commands are always validated, but their expensive checks such as buffer and texture bounds are limited to sampled commands.
+    Each encoding of a command buffer starts sampling at a different phase, so the same commands are not skipped in every frame.
+    \remarks Hazard tracking between submitted command buffers and CPU access to resources is sampled with the same interval, but for entire encodings,
+    i.e. only every N-th encoding of a command buffer records its resource accesses and hazards of the other encodings are not reported.
+    */
+    std::uint32_t   interval    = 1;
+
+    /**
+    \brief Specifies whether commands are sampled randomly with a probability of 1/interval instead of every N-th command. By default false.
+    */
+    bool            randomized  = false;
+};
+
 /**
 \brief Structure with annotation and elapsed time for a timer profile.
 \see FrameProfile::timeRecords
 */
 struct ProfileTimeRecord
 {
-    //! Time record annotation, e.g. function name that was recorded from the CommandBuffer.
-    const char*     annotation  = "";
+    /**
+    \brief Time record annotation, e.g. function name that was recorded from the CommandBuffer.
+    \remarks Debug group names are copied into internal storage of the debug layer, which is only retained until the end of the frame after the one they were recorded in.
+    Copy this string if the profile is kept for longer than that.
+    */
+    const char*     annotation      = "";
+
+    /**
+    \brief Elapsed GPU time (in nanoseconds) to execute the respective command.
+    \remarks This is zero for records that are only measured on the CPU, e.g. command buffer submissions.
+    */
+    std::uint64_t   elapsedTime     = 0;
+
+    /**
+    \brief CPU time stamp (in ticks) when the command started to be encoded or submitted.
+    \see Timer::Tick
+    */
+    std::uint64_t   cpuTicksStart   = 0;
+
+    /**
+    \brief CPU time stamp (in ticks) when the command finished to be encoded or submitted.
+    \see Timer::Tick
+    */
+    std::uint64_t   cpuTicksEnd     = 0;
+
+    //! Process unique identifier of the CPU thread that encoded or submitted the command.
+    std::uint32_t   threadID        = 0;
 
-    //! Elapsed time (in nanoseconds) to execute the respective command.
-    std::uint64_t   elapsedTime = 0;
+    /**
+    \brief Nesting level of debug groups this record belongs to. Zero for top-level records.
+    \remarks A record for a debug group encloses all subsequent records with a higher nesting level
+    and its elapsed time is the sum of the elapsed times of its immediate children.
+    \see CommandBuffer::PushDebugGroup
+    */
+    std::uint32_t   nestingLevel    = 0;
 };
 
 struct ProfileCommandQueueRecord
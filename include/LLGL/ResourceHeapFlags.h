@@ -37,7 +37,10 @@ struct BarrierFlags
         /**
         \brief Memory barrier for Buffer resources that were created with the BindFlags::Storage bind flags.
         \remarks Shader access to the buffer will reflect all data written to by previous shaders.
+        \remarks If such a buffer was also created with the BindFlags::IndirectBuffer flag, indirect draw and dispatch commands
+        will reflect all data written to by previous compute shaders as well.
         \see BindFlags::Storage
+        \see BindFlags::IndirectBuffer
         */
         StorageBuffer   = (1 << 0),
 
@@ -63,6 +63,16 @@ class LLGL_EXPORT Shader : public RenderSystemChild
         */
         virtual bool Reflect(ShaderReflection& reflection) const = 0;
 
+        /**
+        \brief Returns true if this shader has finished compiling, i.e. querying its report will not block.
+        \remarks Some backends compile shaders asynchronously, e.g. the OpenGL backend with \c GL_KHR_parallel_shader_compile.
+        Such a shader can be used immediately after creation, but the first call to GetReport or the first pipeline state that is bound with this shader
+        may wait for the compilation to complete. This function can be polled to avoid such stalls, e.g. while showing a loading screen.
+        \remarks The default implementation always returns true.
+        \see PipelineState::IsReady
+        */
+        virtual bool IsReady() const;
+
     public:
 
         //! Returns the type of this shader.
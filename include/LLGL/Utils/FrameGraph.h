@@ -0,0 +1,272 @@
+/*
+ * FrameGraph.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FRAME_GRAPH_H
+#define LLGL_FRAME_GRAPH_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include <functional>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Handle of a virtual resource within a FrameGraph.
+\see FrameGraph::CreateTexture
+\see FrameGraph::ImportTexture
+\see FrameGraph::ImportRenderTarget
+*/
+using FrameGraphResource = std::uint32_t;
+
+//! Handle of a pass within a FrameGraph.
+using FrameGraphPass = std::uint32_t;
+
+//! Invalid FrameGraph resource or pass handle.
+#define LLGL_INVALID_FRAME_GRAPH_HANDLE (~0u)
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Frame graph resource access enumeration.
+\remarks This determines the state a resource is expected to be in while a pass is executed.
+\see FrameGraph::AddRead
+\see FrameGraph::AddWrite
+*/
+enum class FrameGraphAccess
+{
+    //! Resource has not been accessed yet within the frame.
+    Undefined,
+
+    /**
+    \brief Resource is written as color attachment of the render pass the FrameGraph begins for this pass.
+    \remarks Only valid for writes to textures with the BindFlags::ColorAttachment flag or to imported render targets.
+    */
+    ColorAttachment,
+
+    /**
+    \brief Resource is written as depth-stencil attachment of the render pass the FrameGraph begins for this pass.
+    \remarks Only valid for writes to textures with the BindFlags::DepthStencilAttachment flag.
+    */
+    DepthStencilAttachment,
+
+    //! Resource is read as sampled texture in a shader.
+    Sampled,
+
+    //! Resource is read or written as storage texture (aka. UAV) in a shader.
+    Storage,
+
+    //! Resource is read as source of a copy command.
+    CopySource,
+
+    //! Resource is written as destination of a copy command.
+    CopyDestination,
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Frame graph barrier structure.
+\remarks Each barrier describes a state transition of a single resource that happens before a pass is executed.
+\see FrameGraph::GetBarriers
+*/
+struct FrameGraphBarrier
+{
+    //! Resource that is transitioned.
+    FrameGraphResource  resource    = LLGL_INVALID_FRAME_GRAPH_HANDLE;
+
+    //! Access of the resource by the previous pass or FrameGraphAccess::Undefined if this is the first access within the frame.
+    FrameGraphAccess    before      = FrameGraphAccess::Undefined;
+
+    //! Access of the resource by the pass this barrier belongs to.
+    FrameGraphAccess    after       = FrameGraphAccess::Undefined;
+};
+
+/**
+\brief Frame graph statistics structure.
+\see FrameGraph::GetStatistics
+*/
+struct FrameGraphStatistics
+{
+    //! Number of passes that have been added to the frame graph.
+    std::uint32_t   numPasses               = 0;
+
+    //! Number of passes that have been culled because their output is never consumed.
+    std::uint32_t   numCulledPasses         = 0;
+
+    //! Number of transient textures that are used by at least one pass that has not been culled.
+    std::uint32_t   numTransientTextures    = 0;
+
+    //! Number of hardware textures that back the transient textures after aliasing.
+    std::uint32_t   numPhysicalTextures     = 0;
+
+    //! Number of barriers (i.e. resource state transitions) across all scheduled passes.
+    std::uint32_t   numBarriers             = 0;
+
+    /**
+    \brief Memory footprint (in bytes) that all used transient textures would require without aliasing.
+    \see GetMemoryFootprint
+    */
+    std::uint64_t   transientMemory         = 0;
+
+    //! Memory footprint (in bytes) of the hardware textures that back the transient textures after aliasing.
+    std::uint64_t   physicalMemory          = 0;
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Utility class to build a frame out of passes that declare which resources they read and write.
+
+This class is not required for any interaction with the render system.
+It schedules the passes of a frame, culls passes whose output is never consumed,
+and aliases transient textures whose lifetimes do not overlap, i.e. they share the same hardware texture.
+Passes that write to attachments are automatically wrapped into a render pass (see CommandBuffer::BeginRenderPass)
+whose load and store operations are derived from the resource lifetimes.
+\remarks Each resource must only be accessed once per pass. All passes are scheduled in the order they were added,
+so a pass must be added after all the passes that produce the resources it reads.
+\remarks The backends transition native resource states when render passes begin and resources are bound.
+The barriers that are computed by the FrameGraph describe those transitions and can be queried for each pass with GetBarriers.
+\see RenderSystem::CreateTexture
+\see CommandBuffer::BeginRenderPass
+*/
+class LLGL_EXPORT FrameGraph : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Callback interface to record the commands of a pass.
+        \param[in] commandBuffer Specifies the command buffer the commands are recorded into.
+        If the pass writes to attachments, this callback is invoked inside the render pass the FrameGraph has begun.
+        \param[in] frameGraph Specifies the frame graph to retrieve the textures of the virtual resources (see GetTexture).
+        */
+        using ExecuteFunction = std::function<void(CommandBuffer& commandBuffer, const FrameGraph& frameGraph)>;
+
+    public:
+
+        //! Initializes the frame graph for the specified render system. All textures and render targets will be created by this render system.
+        FrameGraph(RenderSystem& renderSystem);
+
+        //! Releases all hardware resources that have been created by this frame graph.
+        ~FrameGraph();
+
+        /* ----- Resources ----- */
+
+        /**
+        \brief Declares a transient texture that only exists within the frame.
+        \param[in] name Specifies the name of the resource for debugging and error reports. This must not be null.
+        \param[in] textureDesc Specifies the descriptor of the texture.
+        The \c clearValue field is used to clear the texture when it is first written as attachment within the frame.
+        \remarks The hardware texture is created by Compile and may be shared with other transient textures with an identical descriptor.
+        Hence, the content of a transient texture is undefined before its first write within the frame.
+        */
+        FrameGraphResource CreateTexture(const char* name, const TextureDescriptor& textureDesc);
+
+        /**
+        \brief Imports an existing texture into the frame graph.
+        \remarks Imported textures are never aliased and passes that write to them are never culled.
+        */
+        FrameGraphResource ImportTexture(const char* name, Texture& texture);
+
+        /**
+        \brief Imports an existing render target or swap-chain into the frame graph.
+        \param[in] renderPass Optional render pass that is used when a pass writes to this render target. By default null.
+        \remarks A pass that writes to an imported render target must not write to any other attachment.
+        */
+        FrameGraphResource ImportRenderTarget(const char* name, RenderTarget& renderTarget, const RenderPass* renderPass = nullptr);
+
+        /* ----- Passes ----- */
+
+        /**
+        \brief Adds a new pass to the frame graph.
+        \param[in] name Specifies the name of the pass for debugging and error reports. This must not be null.
+        \param[in] execute Specifies the callback that records the commands of this pass.
+        \param[in] hasSideEffects Specifies whether the pass must never be culled, e.g. because it reads back data. By default false.
+        */
+        FrameGraphPass AddPass(const char* name, const ExecuteFunction& execute, bool hasSideEffects = false);
+
+        //! Declares that the specified pass reads the specified resource. By default FrameGraphAccess::Sampled.
+        void AddRead(FrameGraphPass pass, FrameGraphResource resource, FrameGraphAccess access = FrameGraphAccess::Sampled);
+
+        /**
+        \brief Declares that the specified pass writes the specified resource. By default FrameGraphAccess::ColorAttachment.
+        \remarks Writes are considered partial, i.e. the previous content of a resource is preserved for the next writer.
+        */
+        void AddWrite(FrameGraphPass pass, FrameGraphResource resource, FrameGraphAccess access = FrameGraphAccess::ColorAttachment);
+
+        /* ----- Compilation and execution ----- */
+
+        /**
+        \brief Culls unused passes, schedules the remaining ones, aliases the transient textures, and computes the barriers.
+        \return True on success. Otherwise, the errors can be queried with GetReport.
+        \remarks Hardware textures, render targets, and render passes are created on demand and reused across compilations if possible.
+        */
+        bool Compile();
+
+        /**
+        \brief Records all scheduled passes into the specified command buffer.
+        \remarks This must be called between CommandBuffer::Begin and CommandBuffer::End and outside of a render pass.
+        The frame graph must have been compiled successfully before.
+        */
+        void Execute(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Removes all passes and resources from the frame graph to build the next frame.
+        \remarks The hardware resources are kept until the next compilation and reused if the new frame declares compatible resources.
+        */
+        void Reset();
+
+        /* ----- Queries ----- */
+
+        /**
+        \brief Returns the texture of the specified resource or null if the resource is an imported render target.
+        \remarks For transient textures, this is only valid after a successful compilation and if the resource is used by at least one scheduled pass.
+        */
+        Texture* GetTexture(FrameGraphResource resource) const;
+
+        //! Returns the scheduled passes in execution order. This does not include culled passes.
+        ArrayView<FrameGraphPass> GetSchedule() const;
+
+        //! Returns the barriers that precede the specified pass. This is empty for culled passes.
+        ArrayView<FrameGraphBarrier> GetBarriers(FrameGraphPass pass) const;
+
+        //! Returns true if the specified pass has been culled by the last compilation.
+        bool IsPassCulled(FrameGraphPass pass) const;
+
+        //! Returns the statistics of the last compilation.
+        FrameGraphStatistics GetStatistics() const;
+
+        //! Returns the report of the last compilation or null if there is none.
+        const Report* GetReport() const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -107,6 +107,17 @@ class LLGL_EXPORT Image
         */
         void Resize(const Extent3D& extent, const ColorRGBAf& fillColor, const Offset3D& offset);
 
+        /**
+        \brief Resamples the image content to the new extent with the specified filter.
+        \param[in] extent Specifies the new image size. Each dimension must be greater than zero.
+        \param[in] filter Specifies the resampling filter. By default ResampleFilter::Bilinear.
+        \param[in] isSRGB Specifies whether the color components are encoded in sRGB space, in which case they are resampled in linear space. By default false.
+        \param[in] threadCount Specifies the number of threads to use for resampling. By default 0.
+        \remarks In contrast to Resize, this scales the pixel content. Format and data type of the image remain unchanged.
+        \see ResampleImageBuffer
+        */
+        void Resample(const Extent3D& extent, const ResampleFilter filter = ResampleFilter::Bilinear, bool isSRGB = false, unsigned threadCount = 0);
+
         //! Swaps all attributes with the specified image.
         void Swap(Image& rhs);
 
@@ -0,0 +1,191 @@
+/*
+ * IndirectDrawCuller.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_INDIRECT_DRAW_CULLER_H
+#define LLGL_INDIRECT_DRAW_CULLER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/IndirectArguments.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Indirect draw culler descriptor structure.
+\see IndirectDrawCuller::IndirectDrawCuller
+*/
+struct IndirectDrawCullerDescriptor
+{
+    //! Maximum number of objects that can be culled with a single call to IndirectDrawCuller::Cull. This must be greater than zero.
+    std::uint32_t   maxNumObjects   = 0;
+
+    /**
+    \brief Optional compute shader that replaces the built-in culling shader. By default null.
+    \remarks Built-in shaders are only available for GLSL (4.30 and later) and HLSL (Shader Model 5.0 and later).
+    For all other shading languages, most notably SPIR-V for the Vulkan backend, this shader must be specified.
+    It must implement the same interface as the built-in shaders with a work group size of 64 threads:
+    - Slot 0: Constant buffer with six frustum planes (<code>float4[6]</code>) followed by the number of objects (<code>uint</code>).
+    - Slot 1: Storage buffer of input objects, each 48 bytes: bounding sphere (<code>float4</code>), draw arguments (<code>uint[5]</code>), padding (<code>uint[3]</code>).
+    - Slot 2: Storage buffer of output draw arguments (<code>uint[5]</code> per object).
+    - Slot 3: Storage buffer with the number of output draw arguments (<code>uint</code>), which is incremented atomically.
+    - Slot 4: Hi-Z texture (see \c hiZTexture).
+    \remarks The constant buffer continues with the view-projection matrix (<code>float4x4</code>, column-major),
+    followed by the number of Hi-Z mip levels, the Hi-Z width and height, a flag to flip the Y coordinate of the Hi-Z texture,
+    and a flag for a normalized device Z range of [-1, 1] (six <code>uint</code> values in total). The number of Hi-Z mip levels is zero if occlusion culling is disabled.
+    */
+    Shader*         computeShader   = nullptr;
+
+    /**
+    \brief Optional hierarchical depth (Hi-Z) texture for occlusion culling. By default null.
+    \remarks This must be a 2D texture with format Format::R32Float, binding flag BindFlags::Sampled, and a complete MIP-map chain.
+    The first MIP level contains the depth buffer of the previous frame, or of a depth pre-pass, and each subsequent MIP level must contain
+    the farthest depth value of the respective 2x2 texels of the previous MIP level. Dimensions that are a power of two avoid uncovered texels at the borders.
+    The Hi-Z texture is generated by the client and must be in the same screen space as the view-projection matrix that is passed to IndirectDrawCuller::Cull.
+    \remarks Depth values must increase with the distance to the viewer, i.e. reversed depth buffers are not supported.
+    \remarks If this is null, only frustum culling can be performed.
+    */
+    Texture*        hiZTexture      = nullptr;
+};
+
+/**
+\brief Input object for the indirect draw culler.
+\see IndirectDrawCuller::WriteObjects
+*/
+struct IndirectDrawCullerObject
+{
+    /**
+    \brief Bounding sphere of the object in the same coordinate space as the frustum planes.
+    \remarks The first three components specify the center and the fourth component specifies the radius.
+    */
+    float                           boundingSphere[4]   = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    //! Draw arguments that are written to the output argument buffer if the object is not culled.
+    DrawIndexedIndirectArguments    drawArgs            = {};
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Utility class for GPU driven frustum and occlusion culling of indexed draw commands.
+
+This class is not required for any interaction with the render system.
+It owns a set of objects, each with a bounding sphere and the arguments of an indexed draw command.
+The Cull function dispatches a compute shader that tests each object against the view frustum and optionally against a hierarchical depth (Hi-Z) texture,
+and compacts the arguments of all visible objects
+into an indirect argument buffer and writes their number into a count buffer. These buffers are consumed by CommandBuffer::DrawIndexedIndirectCount,
+so the CPU never has to read back the number of visible objects.
+\code
+LLGL::IndirectDrawCuller culler{ *renderer, cullerDesc };
+culler.WriteObjects(0, numObjects, objects);
+cmdBuffer->Begin();
+{
+    culler.Cull(*cmdBuffer, frustumPlanes, numObjects);
+    cmdBuffer->BeginRenderPass(*swapChain);
+    {
+        // Set pipeline state, vertex and index buffers etc. ...
+        culler.Draw(*cmdBuffer);
+    }
+    cmdBuffer->EndRenderPass();
+}
+cmdBuffer->End();
+\endcode
+\remarks This requires RenderingFeatures::hasComputeShaders and RenderingFeatures::hasIndirectDrawCount.
+\remarks Occlusion culling is only performed if a Hi-Z texture is specified and the view-projection matrix is passed to Cull.
+The Hi-Z texture is not generated by this class. The order of the visible objects in the argument buffer is undefined.
+\see CommandBuffer::DrawIndexedIndirectCount
+*/
+class LLGL_EXPORT IndirectDrawCuller : public NonCopyable
+{
+
+    public:
+
+        //! Creates the buffers, the compute pipeline, and the resource heap for the culling pass.
+        IndirectDrawCuller(RenderSystem& renderSystem, const IndirectDrawCullerDescriptor& cullerDesc);
+
+        //! Releases all resources of this culler. The compute shader that was passed by the descriptor is not released.
+        ~IndirectDrawCuller();
+
+        /**
+        \brief Writes the specified objects into the input buffer of this culler.
+        \param[in] firstObject Specifies the index of the first object that is to be written.
+        \param[in] numObjects Specifies the number of objects that are to be written.
+        \param[in] objects Pointer to an array of \c numObjects objects.
+        \remarks The range <code>[firstObject, firstObject + numObjects)</code> must not exceed IndirectDrawCullerDescriptor::maxNumObjects.
+        \remarks This is written immediately with RenderSystem::WriteBuffer, i.e. it must not be called while the GPU is still culling a previous frame.
+        */
+        void WriteObjects(std::uint32_t firstObject, std::uint32_t numObjects, const IndirectDrawCullerObject* objects);
+
+        /**
+        \brief Encodes the culling pass into the specified command buffer.
+        \param[in] commandBuffer Specifies the command buffer to encode the culling pass. This must be outside of a render pass.
+        \param[in] frustumPlanes Specifies the six frustum planes with their normal vectors pointing inwards.
+        The first three components specify the normal vector and the fourth component specifies the distance, i.e. a point \c p is inside of plane \c i
+        if <code>dot(frustumPlanes[i].xyz, p) + frustumPlanes[i].w >= 0</code>.
+        \param[in] numObjects Specifies the number of objects, starting with the first one, that are to be culled.
+        This must not exceed IndirectDrawCullerDescriptor::maxNumObjects.
+        \remarks This resets the count buffer to zero, so the culling pass must be encoded once per frame before the argument buffers are consumed.
+        \remarks The output buffers are bound with BarrierFlags::StorageBuffer, so the subsequent Draw command is ordered after the culling pass.
+        */
+        void Cull(CommandBuffer& commandBuffer, const float frustumPlanes[6][4], std::uint32_t numObjects);
+
+        /**
+        \brief Encodes the culling pass with an additional occlusion test against the Hi-Z texture.
+        \param[in] commandBuffer Specifies the command buffer to encode the culling pass. This must be outside of a render pass.
+        \param[in] frustumPlanes Specifies the six frustum planes; See the other overload of this function.
+        \param[in] viewProjection Specifies the column-major view-projection matrix that transforms the bounding spheres into clip space.
+        This must be the same transformation that the Hi-Z texture was rendered with.
+        \param[in] numObjects Specifies the number of objects, starting with the first one, that are to be culled.
+        This must not exceed IndirectDrawCullerDescriptor::maxNumObjects.
+        \remarks An object is occluded if the nearest depth of its projected bounding box is farther away than all Hi-Z texels it covers.
+        Objects that intersect the near clipping plane are never occluded.
+        \remarks This requires IndirectDrawCullerDescriptor::hiZTexture.
+        */
+        void Cull(
+            CommandBuffer&  commandBuffer,
+            const float     frustumPlanes[6][4],
+            const float     viewProjection[4][4],
+            std::uint32_t   numObjects
+        );
+
+        /**
+        \brief Encodes an indexed indirect draw command with the output of the last culling pass.
+        \remarks This is equivalent to calling CommandBuffer::DrawIndexedIndirectCount with GetDrawArgsBuffer and GetDrawCountBuffer.
+        The graphics pipeline, vertex, and index buffers must be bound before.
+        */
+        void Draw(CommandBuffer& commandBuffer);
+
+        //! Returns the buffer with the compacted draw arguments. This is an array of DrawIndexedIndirectArguments.
+        Buffer* GetDrawArgsBuffer() const;
+
+        //! Returns the buffer with the number of visible objects as 32-bit unsigned integer.
+        Buffer* GetDrawCountBuffer() const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
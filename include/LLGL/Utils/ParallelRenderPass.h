@@ -0,0 +1,108 @@
+/*
+ * ParallelRenderPass.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PARALLEL_RENDER_PASS_H
+#define LLGL_PARALLEL_RENDER_PASS_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/Constants.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Utility class to encode a single render pass with multiple secondary command buffers on multiple threads.
+
+This class is not required for any interaction with the render system.
+It owns a fixed set of secondary command buffers (see CommandBufferFlags::Secondary) that inherit the specified render pass,
+so each encoder can be handed to a separate thread to encode a disjoint subset of the draw calls of one render pass.
+When all threads are done, the encoders are executed by the primary command buffer in the order of their indices.
+\code
+LLGL::ParallelRenderPassEncoder parallelPass{ *renderer, *swapChain->GetRenderPass(), numThreads };
+cmdBuffer->Begin();
+{
+    parallelPass.Begin(*cmdBuffer, *swapChain, 1, &clearValue);
+    {
+        // Encode draw calls with parallelPass.GetEncoder(i) on worker thread i and join all threads ...
+    }
+    parallelPass.End();
+}
+cmdBuffer->End();
+\endcode
+\remarks Each encoder starts with an undefined state, i.e. viewports, pipeline states, and resources must be set by each encoder individually.
+\see CommandBuffer::BeginParallelRenderPass
+\see CommandBuffer::Execute
+*/
+class LLGL_EXPORT ParallelRenderPassEncoder : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Creates the specified number of secondary command buffers that inherit the specified render pass.
+        \param[in] renderSystem Specifies the render system that is used to create and release the command buffers.
+        \param[in] renderPass Specifies the render pass the encoders render into. This must be compatible with the render pass
+        that is passed to Begin. For a swap-chain, this is typically the return value of SwapChain::GetRenderPass.
+        \param[in] numEncoders Specifies the number of secondary command buffers. This is usually the number of worker threads.
+        */
+        ParallelRenderPassEncoder(RenderSystem& renderSystem, const RenderPass& renderPass, std::uint32_t numEncoders);
+
+        //! Releases all secondary command buffers.
+        ~ParallelRenderPassEncoder();
+
+        /**
+        \brief Begins the parallel render pass with the primary command buffer and begins encoding all secondary command buffers.
+        \param[in] primaryCommandBuffer Specifies the primary command buffer. This must be in recording mode, i.e. between CommandBuffer::Begin and CommandBuffer::End.
+        \remarks The remaining parameters are forwarded to CommandBuffer::BeginParallelRenderPass together with the render pass of this encoder.
+        After this call, each encoder can be used on a separate thread until End is called.
+        */
+        void Begin(
+            CommandBuffer&      primaryCommandBuffer,
+            RenderTarget&       renderTarget,
+            std::uint32_t       numClearValues  = 0,
+            const ClearValue*   clearValues     = nullptr,
+            std::uint32_t       swapBufferIndex = LLGL_CURRENT_SWAP_INDEX
+        );
+
+        /**
+        \brief Ends encoding all secondary command buffers, executes them in order, and ends the parallel render pass.
+        \remarks This must be called on the thread that encodes the primary command buffer and only after all worker threads have finished encoding.
+        */
+        void End();
+
+        /**
+        \brief Returns the secondary command buffer with the specified index.
+        \remarks Each encoder must only be used by a single thread at a time.
+        */
+        CommandBuffer* GetEncoder(std::uint32_t index) const;
+
+        //! Returns the number of secondary command buffers.
+        std::uint32_t GetNumEncoders() const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
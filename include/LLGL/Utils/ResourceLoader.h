@@ -0,0 +1,132 @@
+/*
+ * ResourceLoader.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_RESOURCE_LOADER_H
+#define LLGL_RESOURCE_LOADER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <functional>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Completion handle of a job that has been enqueued into a ResourceLoader.
+\see ResourceLoader::Enqueue
+*/
+using ResourceLoadTicket = std::uint64_t;
+
+//! Invalid ResourceLoader ticket.
+#define LLGL_INVALID_RESOURCE_LOAD_TICKET (0)
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Resource loader descriptor structure.
+\see ResourceLoader::ResourceLoader
+*/
+struct ResourceLoaderDescriptor
+{
+    /**
+    \brief Number of loader threads that process the enqueued jobs. By default 2.
+    \remarks If this is zero or the render system does not support loader threads (see RenderSystem::BeginLoaderThread),
+    jobs are processed synchronously within ResourceLoader::Enqueue.
+    */
+    std::uint32_t numLoaderThreads = 2;
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Utility class to create resources on background loader threads.
+
+This class is not required for any interaction with the render system.
+Each loader thread is registered with RenderSystem::BeginLoaderThread, so the enqueued jobs can create and initialize
+buffers, textures, samplers, and shaders concurrently with the rendering thread.
+A job is complete once the resources it has created are ready to be used by any other thread (see RenderSystem::FlushLoaderThread).
+\remarks The resource loader must be created on the rendering thread after the first swap-chain has been created,
+since the OpenGL backend creates the shared GL contexts for the loader threads from the primary GL context.
+\remarks Example:
+\code
+LLGL::ResourceLoader myLoader{ *myRenderer };
+LLGL::Texture* myTexture = nullptr;
+LLGL::ResourceLoadTicket myTicket = myLoader.Enqueue(
+    [&myTexture, &myTextureDesc, &myImageView](LLGL::RenderSystem& renderer)
+    {
+        myTexture = renderer.CreateTexture(myTextureDesc, &myImageView);
+    }
+);
+//...
+if (myLoader.IsComplete(myTicket))
+{
+    // myTexture can be used now
+}
+\endcode
+\see RenderSystem::BeginLoaderThread
+*/
+class LLGL_EXPORT ResourceLoader : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Callback interface of a job that creates resources.
+        \param[in] renderSystem Specifies the render system the resource loader has been created with.
+        \remarks This is invoked from one of the loader threads, or from the thread that calls Enqueue if the jobs are processed synchronously.
+        */
+        using LoadFunction = std::function<void(RenderSystem& renderSystem)>;
+
+    public:
+
+        //! Initializes the resource loader for the specified render system and starts the loader threads.
+        ResourceLoader(RenderSystem& renderSystem, const ResourceLoaderDescriptor& loaderDesc = {});
+
+        //! Waits for all enqueued jobs and stops the loader threads.
+        ~ResourceLoader();
+
+        /**
+        \brief Enqueues the specified job and returns its completion handle.
+        \remarks If the jobs are processed synchronously, this returns after the job has been completed.
+        */
+        ResourceLoadTicket Enqueue(const LoadFunction& loadFunction);
+
+        //! Returns true if the job of the specified ticket has been completed and its resources can be used by other threads.
+        bool IsComplete(ResourceLoadTicket ticket) const;
+
+        //! Blocks until the job of the specified ticket has been completed.
+        void Wait(ResourceLoadTicket ticket);
+
+        //! Blocks until all enqueued jobs have been completed.
+        void WaitIdle();
+
+        //! Returns true if the jobs are processed by loader threads, or false if they are processed synchronously within Enqueue.
+        bool IsAsynchronous() const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,221 @@
+/*
+ * TextureStreamer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TEXTURE_STREAMER_H
+#define LLGL_TEXTURE_STREAMER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <functional>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Handle of a texture that is managed by a TextureStreamer.
+\see TextureStreamer::Register
+*/
+using StreamingTexture = std::uint32_t;
+
+//! Invalid TextureStreamer texture handle.
+#define LLGL_INVALID_STREAMING_TEXTURE (~0u)
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Texture streamer descriptor structure.
+\see TextureStreamer::TextureStreamer
+*/
+struct TextureStreamerDescriptor
+{
+    /**
+    \brief Memory budget (in bytes) for all streamed MIP-maps. By default 256 MB.
+    \remarks The MIP-map tails (see \c mipTailSize) are always resident and may exceed this budget on their own.
+    The streamer only loads a finer MIP-map if it fits into this budget after evicting MIP-maps of textures with lower priority.
+    */
+    std::uint64_t   memoryBudget            = (256ull << 20);
+
+    /**
+    \brief Maximum number of bytes that are uploaded per frame, i.e. per call to TextureStreamer::Update. By default 8 MB.
+    \remarks At least one MIP-map is uploaded per frame if any is ready, even if it exceeds this limit on its own.
+    */
+    std::uint64_t   maxUploadSizePerFrame   = (8ull << 20);
+
+    /**
+    \brief Maximum width and height (in texels) of the MIP-maps that form the MIP-map tail of each texture. By default 64.
+    \remarks The MIP-map tail is loaded when a texture is registered and is never evicted.
+    */
+    std::uint32_t   mipTailSize             = 64;
+
+    /**
+    \brief Number of frames the GPU can process concurrently. By default 2.
+    \remarks This determines when replaced textures and staging memory can be reused or released,
+    i.e. the application must not record and submit more than this number of frames ahead of the GPU.
+    */
+    std::uint32_t   numFramesInFlight       = 2;
+
+    /**
+    \brief Number of background threads that invoke the load function. By default 1.
+    \remarks If this is zero, MIP-maps are loaded synchronously within TextureStreamer::Update.
+    */
+    std::uint32_t   numLoaderThreads        = 1;
+};
+
+/**
+\brief Texture streamer statistics structure.
+\see TextureStreamer::GetStatistics
+*/
+struct TextureStreamerStatistics
+{
+    //! Number of registered textures.
+    std::uint32_t   numTextures         = 0;
+
+    //! Number of MIP-map loads that are queued or currently processed by the load function.
+    std::uint32_t   numPendingLoads     = 0;
+
+    //! Number of MIP-maps that have been made resident by the last update.
+    std::uint32_t   numLoadedMips       = 0;
+
+    //! Number of MIP-maps that have been evicted by the last update.
+    std::uint32_t   numEvictedMips      = 0;
+
+    //! Number of failed MIP-map loads since the streamer has been created.
+    std::uint32_t   numFailedLoads      = 0;
+
+    //! Number of bytes that have been uploaded by the last update.
+    std::uint64_t   uploadedSize        = 0;
+
+    //! Memory footprint (in bytes) of all resident MIP-maps including the MIP-map tails.
+    std::uint64_t   residentMemory      = 0;
+
+    /**
+    \brief Memory footprint (in bytes) all textures would require at their requested MIP-map levels.
+    \remarks If this is greater than the memory budget, the streamer is under memory pressure and textures with lower priority stay at coarser MIP-maps.
+    */
+    std::uint64_t   requestedMemory     = 0;
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Utility class to keep large texture sets partially resident under a memory budget.
+
+This class is not required for any interaction with the render system.
+The application reports which MIP-map level each texture needs (e.g. from feedback of the previous frame) with RequestMipLevel,
+and the streamer loads the missing MIP-maps asynchronously and uploads them with CommandBuffer::CopyTextureFromBuffer.
+Loads are prioritized by the requested priority and coarser MIP-maps are always loaded before finer ones.
+If the memory budget is exceeded, MIP-maps of textures that are resident beyond their request or have lower priority are evicted.
+\remarks Each streamed texture only holds the resident MIP-maps, i.e. its hardware texture is replaced by a larger or smaller one
+whenever a MIP-map is loaded or evicted. Therefore, GetTexture must be queried after each update to bind the current texture.
+Since all MIP-maps scale relative to the texture size, normalized texture coordinates are not affected by this.
+\remarks Only 2D textures (TextureType::Texture2D) with uncompressed or block compressed formats are supported.
+\see RenderSystem::CreateTexture
+\see CommandBuffer::CopyTextureFromBuffer
+*/
+class LLGL_EXPORT TextureStreamer : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Callback interface to load the texels of a single MIP-map.
+        \param[in] texture Specifies the texture whose MIP-map is to be loaded.
+        \param[in] mipLevel Specifies the MIP-map level with respect to the descriptor the texture has been registered with.
+        \param[in] extent Specifies the extent of the MIP-map.
+        \param[out] outData Specifies the output buffer for the texels. They must be tightly packed in the format of the texture,
+        i.e. the size must be at least <code>GetMemoryFootprint(format, extent.width * extent.height)</code>.
+        \return True on success. If the load fails, the streamer stops requesting MIP-maps of that texture at this level or finer.
+        \remarks This is invoked from the background loader threads (see TextureStreamerDescriptor::numLoaderThreads),
+        except for the MIP-map tail, which is loaded on the thread that calls Register.
+        */
+        using LoadFunction = std::function<bool(StreamingTexture texture, std::uint32_t mipLevel, const Extent3D& extent, DynamicByteArray& outData)>;
+
+    public:
+
+        //! Initializes the texture streamer for the specified render system and starts the background loader threads.
+        TextureStreamer(RenderSystem& renderSystem, const LoadFunction& loadFunction, const TextureStreamerDescriptor& streamerDesc = {});
+
+        //! Stops the background loader threads and releases all textures and staging buffers.
+        ~TextureStreamer();
+
+        /* ----- Textures ----- */
+
+        /**
+        \brief Registers a new texture with the specified descriptor and loads its MIP-map tail.
+        \param[in] textureDesc Specifies the descriptor of the full texture with all its MIP-maps.
+        The texture type must be TextureType::Texture2D. The binding flags BindFlags::CopySrc and BindFlags::CopyDst are added implicitly.
+        \return Handle of the new texture or LLGL_INVALID_STREAMING_TEXTURE if the MIP-map tail could not be loaded.
+        */
+        StreamingTexture Register(const TextureDescriptor& textureDesc);
+
+        /**
+        \brief Releases the specified texture.
+        \remarks The hardware texture is kept alive until the GPU no longer uses it (see TextureStreamerDescriptor::numFramesInFlight).
+        */
+        void Release(StreamingTexture texture);
+
+        /**
+        \brief Requests the specified texture to be resident down to the specified MIP-map level.
+        \param[in] mipLevel Specifies the finest MIP-map level that is requested. This is clamped to the MIP-map tail.
+        \param[in] priority Specifies the priority relative to other textures. Textures with higher priority are loaded first and evicted last. By default 1.
+        \remarks Requests remain valid until they are replaced by a new request for the same texture.
+        */
+        void RequestMipLevel(StreamingTexture texture, std::uint32_t mipLevel, float priority = 1.0f);
+
+        /* ----- Streaming ----- */
+
+        /**
+        \brief Uploads loaded MIP-maps, evicts MIP-maps to stay within the memory budget, and schedules new loads.
+        \remarks This must be called once per frame between CommandBuffer::Begin and CommandBuffer::End and outside of a render pass.
+        */
+        void Update(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Blocks until all scheduled loads have been processed by the background loader threads.
+        \remarks The loaded MIP-maps are uploaded by the next call to Update.
+        */
+        void WaitIdle();
+
+        /* ----- Queries ----- */
+
+        /**
+        \brief Returns the hardware texture that currently holds the resident MIP-maps of the specified texture.
+        \remarks This may change with every call to Update. MIP-map level 0 of the returned texture corresponds to GetResidentMipLevel.
+        */
+        Texture* GetTexture(StreamingTexture texture) const;
+
+        //! Returns the finest resident MIP-map level of the specified texture with respect to the descriptor it has been registered with.
+        std::uint32_t GetResidentMipLevel(StreamingTexture texture) const;
+
+        //! Returns the statistics of the streamer.
+        TextureStreamerStatistics GetStatistics() const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
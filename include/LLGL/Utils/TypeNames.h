@@ -21,6 +21,7 @@ THIS HEADER MUST BE EXPLICITLY INCLUDED
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/PipelineStateFlags.h>
+#include <LLGL/CommandBufferFlags.h>
 
 
 namespace LLGL
@@ -87,6 +88,12 @@ LLGL_EXPORT const char* ToString(const BlendOp val);
 */
 LLGL_EXPORT const char* ToString(const ResourceType val);
 
+/**
+\brief Returns a string representation for the specified CommandQueueType value, or null if the input type is invalid.
+\remarks Return value examples are \c "graphics", \c "transfer".
+*/
+LLGL_EXPORT const char* ToString(const CommandQueueType val);
+
 /** @} */
 
 
@@ -0,0 +1,942 @@
+/*
+ * BCCompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "BCCompressor.h"
+#include "Threading.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// 4x4 block of RGBA8 texels in row-major order.
+struct RGBA8Block
+{
+    std::uint8_t texels[16][4];
+};
+
+// Encoded BC1 color block and its squared error to the source texels.
+struct BC1Encoding
+{
+    std::uint16_t color0    = 0;
+    std::uint16_t color1    = 0;
+    std::uint32_t indices   = 0;
+    std::uint32_t error     = ~0u;
+};
+
+// Encoded BC7 mode 6 block with 7-bit RGBA endpoints, one p-bit per endpoint, and 4-bit indices.
+struct BC7Mode6Encoding
+{
+    std::uint8_t  endpoints[2][4] = {};
+    std::uint8_t  pBits[2]        = {};
+    std::uint8_t  indices[16]     = {};
+    std::uint32_t error           = ~0u;
+};
+
+
+/* ----- Internal functions ----- */
+
+// Reads the 4x4 block at the specified block coordinate. Texels outside the image are clamped to the edge.
+static void FetchRGBA8Block(RGBA8Block& block, const std::uint8_t* data, const Extent2D& extent, std::uint32_t blockX, std::uint32_t blockY)
+{
+    for_range(y, 4u)
+    {
+        const std::uint32_t srcY = std::min(blockY * 4u + y, extent.height - 1u);
+        for_range(x, 4u)
+        {
+            const std::uint32_t srcX = std::min(blockX * 4u + x, extent.width - 1u);
+            ::memcpy(block.texels[y * 4u + x], data + (static_cast<std::size_t>(srcY) * extent.width + srcX) * 4u, 4u);
+        }
+    }
+}
+
+static void WriteUInt16LE(std::uint8_t* dst, std::uint16_t value)
+{
+    dst[0] = static_cast<std::uint8_t>(value & 0xFF);
+    dst[1] = static_cast<std::uint8_t>(value >> 8);
+}
+
+static void WriteUInt32LE(std::uint8_t* dst, std::uint32_t value)
+{
+    WriteUInt16LE(dst,     static_cast<std::uint16_t>(value & 0xFFFF));
+    WriteUInt16LE(dst + 2, static_cast<std::uint16_t>(value >> 16));
+}
+
+static void WriteUInt64LE(std::uint8_t* dst, std::uint64_t value)
+{
+    WriteUInt32LE(dst,     static_cast<std::uint32_t>(value & 0xFFFFFFFF));
+    WriteUInt32LE(dst + 4, static_cast<std::uint32_t>(value >> 32));
+}
+
+static int ClampInt(int value, int minValue, int maxValue)
+{
+    return std::max(minValue, std::min(value, maxValue));
+}
+
+static std::uint16_t PackRGB565(const float (&rgb)[3])
+{
+    const int r = ClampInt(static_cast<int>(rgb[0] * (31.0f / 255.0f) + 0.5f), 0, 31);
+    const int g = ClampInt(static_cast<int>(rgb[1] * (63.0f / 255.0f) + 0.5f), 0, 63);
+    const int b = ClampInt(static_cast<int>(rgb[2] * (31.0f / 255.0f) + 0.5f), 0, 31);
+    return static_cast<std::uint16_t>((r << 11) | (g << 5) | b);
+}
+
+static void UnpackRGB565(std::uint16_t color, int (&rgb)[3])
+{
+    const int r = (color >> 11) & 0x1F;
+    const int g = (color >>  5) & 0x3F;
+    const int b = (color      ) & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Builds the BC1 palette. If color0 is not greater than color1, the block is in 3-color mode and the last entry is transparent black.
+static void BuildBC1Palette(std::uint16_t color0, std::uint16_t color1, int (&palette)[4][3])
+{
+    UnpackRGB565(color0, palette[0]);
+    UnpackRGB565(color1, palette[1]);
+    for_range(c, 3)
+    {
+        if (color0 > color1)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+        }
+        else
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c] + 1) / 2;
+            palette[3][c] = 0;
+        }
+    }
+}
+
+static std::uint32_t SquaredDistanceRGB(const std::uint8_t* texel, const int (&color)[3])
+{
+    const int dr = static_cast<int>(texel[0]) - color[0];
+    const int dg = static_cast<int>(texel[1]) - color[1];
+    const int db = static_cast<int>(texel[2]) - color[2];
+    return static_cast<std::uint32_t>(dr*dr + dg*dg + db*db);
+}
+
+/*
+Quantizes the endpoints, selects the nearest palette entry for each texel, and returns the encoding with its squared error.
+Texels in the transparent mask always select the transparent palette entry, which requires 3-color mode.
+*/
+static BC1Encoding EncodeBC1Endpoints(
+    const RGBA8Block&   block,
+    const float         (&endpoint0)[3],
+    const float         (&endpoint1)[3],
+    bool                threeColorMode,
+    std::uint32_t       transparentMask)
+{
+    BC1Encoding enc;
+    enc.color0 = PackRGB565(endpoint0);
+    enc.color1 = PackRGB565(endpoint1);
+
+    /* Order endpoints for the respective mode: color0 > color1 selects 4-color mode */
+    if ((threeColorMode && enc.color0 > enc.color1) || (!threeColorMode && enc.color0 < enc.color1))
+        std::swap(enc.color0, enc.color1);
+
+    int palette[4][3];
+    BuildBC1Palette(enc.color0, enc.color1, palette);
+
+    /* Equal endpoints only need the first palette entry, which is valid in either mode */
+    const int numColors = (enc.color0 == enc.color1 ? 1 : (threeColorMode ? 3 : 4));
+
+    enc.indices = 0;
+    enc.error   = 0;
+
+    for_range(i, 16u)
+    {
+        std::uint32_t index = 3;
+        if ((transparentMask & (1u << i)) == 0)
+        {
+            std::uint32_t minDist = ~0u;
+            for_range(j, numColors)
+            {
+                const std::uint32_t dist = SquaredDistanceRGB(block.texels[i], palette[j]);
+                if (dist < minDist)
+                {
+                    minDist = dist;
+                    index   = static_cast<std::uint32_t>(j);
+                }
+            }
+            enc.error += minDist;
+        }
+        enc.indices |= (index << (i * 2u));
+    }
+
+    return enc;
+}
+
+// Selects the corners of the bounding box of all opaque texels as endpoints, inset by 1/16 of the range.
+static void ComputeBoundingBoxEndpoints(const RGBA8Block& block, std::uint32_t transparentMask, float (&endpoint0)[3], float (&endpoint1)[3])
+{
+    int minColor[3] = { 255, 255, 255 };
+    int maxColor[3] = { 0, 0, 0 };
+
+    for_range(i, 16u)
+    {
+        if ((transparentMask & (1u << i)) == 0)
+        {
+            for_range(c, 3)
+            {
+                minColor[c] = std::min(minColor[c], static_cast<int>(block.texels[i][c]));
+                maxColor[c] = std::max(maxColor[c], static_cast<int>(block.texels[i][c]));
+            }
+        }
+    }
+
+    for_range(c, 3)
+    {
+        const float inset = static_cast<float>(maxColor[c] - minColor[c]) / 16.0f;
+        endpoint0[c] = static_cast<float>(maxColor[c]) - inset;
+        endpoint1[c] = static_cast<float>(minColor[c]) + inset;
+    }
+}
+
+// Selects the extremes of all opaque texels along the principal axis of their color distribution as endpoints.
+static void ComputePrincipalAxisEndpoints(const RGBA8Block& block, std::uint32_t transparentMask, float (&endpoint0)[3], float (&endpoint1)[3])
+{
+    /* Compute mean color */
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    int numTexels = 0;
+
+    for_range(i, 16u)
+    {
+        if ((transparentMask & (1u << i)) == 0)
+        {
+            for_range(c, 3)
+                mean[c] += static_cast<float>(block.texels[i][c]);
+            ++numTexels;
+        }
+    }
+
+    for_range(c, 3)
+        mean[c] /= static_cast<float>(numTexels);
+
+    /* Compute covariance matrix: xx, xy, xz, yy, yz, zz */
+    float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    for_range(i, 16u)
+    {
+        if ((transparentMask & (1u << i)) == 0)
+        {
+            const float r = static_cast<float>(block.texels[i][0]) - mean[0];
+            const float g = static_cast<float>(block.texels[i][1]) - mean[1];
+            const float b = static_cast<float>(block.texels[i][2]) - mean[2];
+            cov[0] += r*r;
+            cov[1] += r*g;
+            cov[2] += r*b;
+            cov[3] += g*g;
+            cov[4] += g*b;
+            cov[5] += b*b;
+        }
+    }
+
+    /* Find principal axis with power iteration */
+    float axis[3] = { 1.0f, 1.0f, 1.0f };
+
+    for_range(iteration, 8)
+    {
+        const float x = cov[0]*axis[0] + cov[1]*axis[1] + cov[2]*axis[2];
+        const float y = cov[1]*axis[0] + cov[3]*axis[1] + cov[4]*axis[2];
+        const float z = cov[2]*axis[0] + cov[4]*axis[1] + cov[5]*axis[2];
+
+        const float maxComponent = std::max(std::abs(x), std::max(std::abs(y), std::abs(z)));
+        if (maxComponent < 1.0e-6f)
+            break;
+
+        axis[0] = x / maxComponent;
+        axis[1] = y / maxComponent;
+        axis[2] = z / maxComponent;
+    }
+
+    const float axisLengthSq = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+
+    /* Project texels onto principal axis */
+    float minProj = 0.0f, maxProj = 0.0f;
+
+    for_range(i, 16u)
+    {
+        if ((transparentMask & (1u << i)) == 0)
+        {
+            const float proj =
+            (
+                (static_cast<float>(block.texels[i][0]) - mean[0]) * axis[0] +
+                (static_cast<float>(block.texels[i][1]) - mean[1]) * axis[1] +
+                (static_cast<float>(block.texels[i][2]) - mean[2]) * axis[2]
+            ) / axisLengthSq;
+            minProj = std::min(minProj, proj);
+            maxProj = std::max(maxProj, proj);
+        }
+    }
+
+    for_range(c, 3)
+    {
+        endpoint0[c] = mean[c] + axis[c] * maxProj;
+        endpoint1[c] = mean[c] + axis[c] * minProj;
+    }
+}
+
+/*
+Solves the least squares problem for the endpoints of a 4-color block with fixed indices.
+Returns false if the indices do not determine the endpoints, e.g. if all texels select the same entry.
+*/
+static bool OptimizeBC1Endpoints(const RGBA8Block& block, std::uint32_t indices, float (&endpoint0)[3], float (&endpoint1)[3])
+{
+    static const float weightTable[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float ax[3] = { 0.0f, 0.0f, 0.0f };
+    float bx[3] = { 0.0f, 0.0f, 0.0f };
+
+    for_range(i, 16u)
+    {
+        const float a = weightTable[(indices >> (i * 2u)) & 0x3];
+        const float b = 1.0f - a;
+
+        aa += a*a;
+        ab += a*b;
+        bb += b*b;
+
+        for_range(c, 3)
+        {
+            ax[c] += a * static_cast<float>(block.texels[i][c]);
+            bx[c] += b * static_cast<float>(block.texels[i][c]);
+        }
+    }
+
+    const float det = aa*bb - ab*ab;
+    if (std::abs(det) < 1.0e-6f)
+        return false;
+
+    const float invDet = 1.0f / det;
+    for_range(c, 3)
+    {
+        endpoint0[c] = std::max(0.0f, std::min((ax[c]*bb - bx[c]*ab) * invDet, 255.0f));
+        endpoint1[c] = std::max(0.0f, std::min((bx[c]*aa - ax[c]*ab) * invDet, 255.0f));
+    }
+
+    return true;
+}
+
+/*
+Encodes the RGB components of the block into an 8-byte BC1 color block.
+If 'allowTransparency' is true, texels with alpha below 128 are encoded as transparent (only valid for BC1).
+*/
+static void EncodeBC1Block(std::uint8_t* dst, const RGBA8Block& block, const CompressionQuality quality, bool allowTransparency)
+{
+    std::uint32_t transparentMask = 0;
+    if (allowTransparency)
+    {
+        for_range(i, 16u)
+        {
+            if (block.texels[i][3] < 128)
+                transparentMask |= (1u << i);
+        }
+    }
+
+    BC1Encoding best;
+
+    if (transparentMask == 0xFFFF)
+    {
+        /* Encode fully transparent block in 3-color mode */
+        best.indices = 0xFFFFFFFF;
+    }
+    else
+    {
+        const bool threeColorMode = (transparentMask != 0);
+        float endpoint0[3], endpoint1[3];
+
+        if (quality == CompressionQuality::Fast)
+        {
+            ComputeBoundingBoxEndpoints(block, transparentMask, endpoint0, endpoint1);
+            best = EncodeBC1Endpoints(block, endpoint0, endpoint1, threeColorMode, transparentMask);
+        }
+        else
+        {
+            ComputePrincipalAxisEndpoints(block, transparentMask, endpoint0, endpoint1);
+            best = EncodeBC1Endpoints(block, endpoint0, endpoint1, threeColorMode, transparentMask);
+
+            if (quality == CompressionQuality::High)
+            {
+                /* Try bounding box as alternative starting point */
+                ComputeBoundingBoxEndpoints(block, transparentMask, endpoint0, endpoint1);
+                const BC1Encoding enc = EncodeBC1Endpoints(block, endpoint0, endpoint1, threeColorMode, transparentMask);
+                if (enc.error < best.error)
+                    best = enc;
+
+                /* Refine endpoints iteratively for the selected indices */
+                if (!threeColorMode && best.color0 != best.color1)
+                {
+                    for_range(iteration, 2)
+                    {
+                        if (best.error == 0 || !OptimizeBC1Endpoints(block, best.indices, endpoint0, endpoint1))
+                            break;
+                        const BC1Encoding refined = EncodeBC1Endpoints(block, endpoint0, endpoint1, false, 0);
+                        if (refined.error >= best.error)
+                            break;
+                        best = refined;
+                    }
+                }
+            }
+        }
+    }
+
+    WriteUInt16LE(dst,     best.color0);
+    WriteUInt16LE(dst + 2, best.color1);
+    WriteUInt32LE(dst + 4, best.indices);
+}
+
+// Builds the BC4 palette. If value0 is not greater than value1, the block is in 6-value mode and the last two entries are 0 and 255.
+static void BuildBC4Palette(int value0, int value1, int (&palette)[8])
+{
+    palette[0] = value0;
+    palette[1] = value1;
+    if (value0 > value1)
+    {
+        for_range(i, 6)
+            palette[i + 2] = ((6 - i) * value0 + (i + 1) * value1 + 3) / 7;
+    }
+    else
+    {
+        for_range(i, 4)
+            palette[i + 2] = ((4 - i) * value0 + (i + 1) * value1 + 2) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Encodes the block with the specified endpoints into 'outBits' and returns the squared error.
+static std::uint32_t EncodeBC4Endpoints(const std::uint8_t (&values)[16], int value0, int value1, std::uint64_t& outBits)
+{
+    int palette[8];
+    BuildBC4Palette(value0, value1, palette);
+
+    std::uint32_t error = 0;
+    outBits = static_cast<std::uint64_t>(value0) | (static_cast<std::uint64_t>(value1) << 8);
+
+    for_range(i, 16u)
+    {
+        std::uint32_t   index   = 0;
+        std::uint32_t   minDist = ~0u;
+        for_range(j, 8u)
+        {
+            const int           diff = static_cast<int>(values[i]) - palette[j];
+            const std::uint32_t dist = static_cast<std::uint32_t>(diff * diff);
+            if (dist < minDist)
+            {
+                minDist = dist;
+                index   = j;
+            }
+        }
+        error += minDist;
+        outBits |= (static_cast<std::uint64_t>(index) << (16u + i * 3u));
+    }
+
+    return error;
+}
+
+// Encodes 16 single-channel values into an 8-byte BC4 block. This is also used for the alpha block of BC3 and for each channel of BC5.
+static void EncodeBC4Block(std::uint8_t* dst, const std::uint8_t (&values)[16], const CompressionQuality quality)
+{
+    int minValue = 255, maxValue = 0;
+    int minInner = 255, maxInner = 0;
+
+    for (std::uint8_t value : values)
+    {
+        minValue = std::min(minValue, static_cast<int>(value));
+        maxValue = std::max(maxValue, static_cast<int>(value));
+        if (value > 0 && value < 255)
+        {
+            minInner = std::min(minInner, static_cast<int>(value));
+            maxInner = std::max(maxInner, static_cast<int>(value));
+        }
+    }
+
+    /* Encode in 8-value mode with the value range as endpoints */
+    std::uint64_t bestBits  = 0;
+    std::uint32_t bestError = EncodeBC4Endpoints(values, maxValue, minValue, bestBits);
+
+    if (quality != CompressionQuality::Fast && bestError > 0)
+    {
+        /* Try 6-value mode, which encodes 0 and 255 exactly and only interpolates the inner values */
+        if (minInner <= maxInner)
+        {
+            std::uint64_t bits = 0;
+            const std::uint32_t error = EncodeBC4Endpoints(values, minInner, maxInner, bits);
+            if (error < bestError)
+            {
+                bestError   = error;
+                bestBits    = bits;
+            }
+        }
+
+        if (quality == CompressionQuality::High)
+        {
+            /* Search the neighborhood of the value range for better 8-value mode endpoints */
+            for (int delta0 = -2; delta0 <= 2 && bestError > 0; ++delta0)
+            {
+                for (int delta1 = -2; delta1 <= 2 && bestError > 0; ++delta1)
+                {
+                    const int value0 = ClampInt(maxValue + delta0, 0, 255);
+                    const int value1 = ClampInt(minValue + delta1, 0, 255);
+                    if (value0 <= value1)
+                        continue;
+
+                    std::uint64_t bits = 0;
+                    const std::uint32_t error = EncodeBC4Endpoints(values, value0, value1, bits);
+                    if (error < bestError)
+                    {
+                        bestError   = error;
+                        bestBits    = bits;
+                    }
+                }
+            }
+        }
+    }
+
+    WriteUInt64LE(dst, bestBits);
+}
+
+static void ExtractChannel(const RGBA8Block& block, int channel, std::uint8_t (&values)[16])
+{
+    for_range(i, 16u)
+        values[i] = block.texels[i][channel];
+}
+
+// Encodes the alpha channel with 4 bits per texel into an 8-byte BC2 alpha block.
+static void EncodeBC2AlphaBlock(std::uint8_t* dst, const RGBA8Block& block)
+{
+    std::uint64_t bits = 0;
+    for_range(i, 16u)
+    {
+        const std::uint64_t alpha = (static_cast<std::uint32_t>(block.texels[i][3]) * 15u + 127u) / 255u;
+        bits |= (alpha << (i * 4u));
+    }
+    WriteUInt64LE(dst, bits);
+}
+
+// Interpolation weights of BC7 for 4-bit indices.
+static const int g_bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+static std::uint32_t SquaredDistanceRGBA(const std::uint8_t* texel, const int (&color)[4])
+{
+    std::uint32_t dist = 0;
+    for_range(c, 4)
+    {
+        const int d = static_cast<int>(texel[c]) - color[c];
+        dist += static_cast<std::uint32_t>(d*d);
+    }
+    return dist;
+}
+
+// Returns the 7-bit component that reconstructs the specified value most closely with the specified p-bit.
+static int QuantizeBC7Mode6Component(float value, int pBit)
+{
+    return ClampInt(static_cast<int>((value - static_cast<float>(pBit)) * 0.5f + 0.5f), 0, 127);
+}
+
+// Selects the p-bit with the smaller quantization error for the specified endpoint.
+static int SelectBC7Mode6PBit(const float (&endpoint)[4])
+{
+    float error[2] = { 0.0f, 0.0f };
+    for_range(pBit, 2)
+    {
+        for_range(c, 4)
+        {
+            const float d = endpoint[c] - static_cast<float>((QuantizeBC7Mode6Component(endpoint[c], pBit) << 1) | pBit);
+            error[pBit] += d*d;
+        }
+    }
+    return (error[1] < error[0] ? 1 : 0);
+}
+
+/*
+Quantizes the endpoints with the specified p-bits, selects the nearest palette entry for each texel, and returns the encoding with its squared error.
+Each endpoint component is reconstructed as 8-bit value from its 7-bit component and the p-bit as least significant bit.
+*/
+static BC7Mode6Encoding EncodeBC7Mode6Endpoints(
+    const RGBA8Block&   block,
+    const float         (&endpoint0)[4],
+    const float         (&endpoint1)[4],
+    int                 pBit0,
+    int                 pBit1)
+{
+    BC7Mode6Encoding enc;
+    enc.pBits[0] = static_cast<std::uint8_t>(pBit0);
+    enc.pBits[1] = static_cast<std::uint8_t>(pBit1);
+
+    int palette[16][4];
+
+    for_range(c, 4)
+    {
+        enc.endpoints[0][c] = static_cast<std::uint8_t>(QuantizeBC7Mode6Component(endpoint0[c], pBit0));
+        enc.endpoints[1][c] = static_cast<std::uint8_t>(QuantizeBC7Mode6Component(endpoint1[c], pBit1));
+
+        const int value0 = (enc.endpoints[0][c] << 1) | pBit0;
+        const int value1 = (enc.endpoints[1][c] << 1) | pBit1;
+
+        for_range(j, 16)
+            palette[j][c] = (value0 * (64 - g_bc7Weights4[j]) + value1 * g_bc7Weights4[j] + 32) >> 6;
+    }
+
+    enc.error = 0;
+
+    for_range(i, 16u)
+    {
+        std::uint32_t minDist = ~0u;
+        for_range(j, 16)
+        {
+            const std::uint32_t dist = SquaredDistanceRGBA(block.texels[i], palette[j]);
+            if (dist < minDist)
+            {
+                minDist         = dist;
+                enc.indices[i]  = static_cast<std::uint8_t>(j);
+            }
+        }
+        enc.error += minDist;
+    }
+
+    return enc;
+}
+
+// Encodes the endpoints with all four p-bit combinations and returns the encoding with the smallest error.
+static BC7Mode6Encoding EncodeBC7Mode6EndpointsWithBestPBits(const RGBA8Block& block, const float (&endpoint0)[4], const float (&endpoint1)[4])
+{
+    BC7Mode6Encoding best;
+    for_range(pBits, 4)
+    {
+        const BC7Mode6Encoding enc = EncodeBC7Mode6Endpoints(block, endpoint0, endpoint1, pBits & 1, pBits >> 1);
+        if (enc.error < best.error)
+            best = enc;
+    }
+    return best;
+}
+
+// Selects the corners of the RGBA bounding box as endpoints.
+static void ComputeBoundingBoxEndpointsRGBA(const RGBA8Block& block, float (&endpoint0)[4], float (&endpoint1)[4])
+{
+    for_range(c, 4)
+    {
+        int minValue = 255, maxValue = 0;
+        for_range(i, 16u)
+        {
+            minValue = std::min(minValue, static_cast<int>(block.texels[i][c]));
+            maxValue = std::max(maxValue, static_cast<int>(block.texels[i][c]));
+        }
+        endpoint0[c] = static_cast<float>(minValue);
+        endpoint1[c] = static_cast<float>(maxValue);
+    }
+}
+
+// Selects the extremes of all texels along the principal axis of their RGBA distribution as endpoints.
+static void ComputePrincipalAxisEndpointsRGBA(const RGBA8Block& block, float (&endpoint0)[4], float (&endpoint1)[4])
+{
+    /* Compute mean color */
+    float mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    for_range(i, 16u)
+    {
+        for_range(c, 4)
+            mean[c] += static_cast<float>(block.texels[i][c]);
+    }
+
+    for_range(c, 4)
+        mean[c] /= 16.0f;
+
+    /* Compute symmetric covariance matrix */
+    float cov[4][4] = {};
+
+    for_range(i, 16u)
+    {
+        float d[4];
+        for_range(c, 4)
+            d[c] = static_cast<float>(block.texels[i][c]) - mean[c];
+        for_range(row, 4)
+        {
+            for_range(col, 4)
+                cov[row][col] += d[row] * d[col];
+        }
+    }
+
+    /* Find principal axis with power iteration */
+    float axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    for_range(iteration, 8)
+    {
+        float v[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for_range(row, 4)
+        {
+            for_range(col, 4)
+                v[row] += cov[row][col] * axis[col];
+        }
+
+        const float maxComponent = std::max(std::max(std::abs(v[0]), std::abs(v[1])), std::max(std::abs(v[2]), std::abs(v[3])));
+        if (maxComponent < 1.0e-6f)
+            break;
+
+        for_range(c, 4)
+            axis[c] = v[c] / maxComponent;
+    }
+
+    const float axisLengthSq = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2] + axis[3]*axis[3];
+
+    /* Project texels onto principal axis */
+    float minProj = 0.0f, maxProj = 0.0f;
+
+    for_range(i, 16u)
+    {
+        float proj = 0.0f;
+        for_range(c, 4)
+            proj += (static_cast<float>(block.texels[i][c]) - mean[c]) * axis[c];
+        proj /= axisLengthSq;
+        minProj = std::min(minProj, proj);
+        maxProj = std::max(maxProj, proj);
+    }
+
+    for_range(c, 4)
+    {
+        endpoint0[c] = std::max(0.0f, std::min(mean[c] + axis[c] * minProj, 255.0f));
+        endpoint1[c] = std::max(0.0f, std::min(mean[c] + axis[c] * maxProj, 255.0f));
+    }
+}
+
+/*
+Solves the least squares problem for the RGBA endpoints of a BC7 mode 6 block with fixed indices.
+Returns false if the indices do not determine the endpoints, e.g. if all texels select the same entry.
+*/
+static bool OptimizeBC7Mode6Endpoints(const RGBA8Block& block, const std::uint8_t (&indices)[16], float (&endpoint0)[4], float (&endpoint1)[4])
+{
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float ax[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    float bx[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    for_range(i, 16u)
+    {
+        const float b = static_cast<float>(g_bc7Weights4[indices[i]]) / 64.0f;
+        const float a = 1.0f - b;
+
+        aa += a*a;
+        ab += a*b;
+        bb += b*b;
+
+        for_range(c, 4)
+        {
+            ax[c] += a * static_cast<float>(block.texels[i][c]);
+            bx[c] += b * static_cast<float>(block.texels[i][c]);
+        }
+    }
+
+    const float det = aa*bb - ab*ab;
+    if (std::abs(det) < 1.0e-6f)
+        return false;
+
+    const float invDet = 1.0f / det;
+    for_range(c, 4)
+    {
+        endpoint0[c] = std::max(0.0f, std::min((ax[c]*bb - bx[c]*ab) * invDet, 255.0f));
+        endpoint1[c] = std::max(0.0f, std::min((bx[c]*aa - ax[c]*ab) * invDet, 255.0f));
+    }
+
+    return true;
+}
+
+static void WriteBits(std::uint64_t (&bits)[2], std::uint32_t& bitOffset, std::uint32_t value, std::uint32_t numBits)
+{
+    for_range(i, numBits)
+    {
+        const std::uint32_t pos = bitOffset + i;
+        bits[pos / 64u] |= (static_cast<std::uint64_t>((value >> i) & 1u) << (pos % 64u));
+    }
+    bitOffset += numBits;
+}
+
+/*
+Encodes the RGBA components of the block into a 16-byte BC7 block in mode 6, i.e. a single subset with 7-bit RGBA endpoints,
+one p-bit per endpoint, and 4-bit indices. This mode does not have partitions or rotations but it handles smooth gradients and alpha well.
+*/
+static void EncodeBC7Block(std::uint8_t* dst, const RGBA8Block& block, const CompressionQuality quality)
+{
+    BC7Mode6Encoding best;
+    float endpoint0[4], endpoint1[4];
+
+    if (quality == CompressionQuality::Fast)
+    {
+        ComputeBoundingBoxEndpointsRGBA(block, endpoint0, endpoint1);
+        best = EncodeBC7Mode6Endpoints(block, endpoint0, endpoint1, SelectBC7Mode6PBit(endpoint0), SelectBC7Mode6PBit(endpoint1));
+    }
+    else
+    {
+        ComputePrincipalAxisEndpointsRGBA(block, endpoint0, endpoint1);
+        best = EncodeBC7Mode6EndpointsWithBestPBits(block, endpoint0, endpoint1);
+
+        if (quality == CompressionQuality::High)
+        {
+            /* Try bounding box as alternative starting point */
+            ComputeBoundingBoxEndpointsRGBA(block, endpoint0, endpoint1);
+            const BC7Mode6Encoding enc = EncodeBC7Mode6EndpointsWithBestPBits(block, endpoint0, endpoint1);
+            if (enc.error < best.error)
+                best = enc;
+
+            /* Refine endpoints iteratively for the selected indices */
+            for_range(iteration, 2)
+            {
+                if (best.error == 0 || !OptimizeBC7Mode6Endpoints(block, best.indices, endpoint0, endpoint1))
+                    break;
+                const BC7Mode6Encoding refined = EncodeBC7Mode6EndpointsWithBestPBits(block, endpoint0, endpoint1);
+                if (refined.error >= best.error)
+                    break;
+                best = refined;
+            }
+        }
+    }
+
+    /* The most significant bit of the anchor index is implicitly zero, so swap endpoints and invert indices if necessary */
+    if ((best.indices[0] & 0x8) != 0)
+    {
+        for_range(c, 4)
+            std::swap(best.endpoints[0][c], best.endpoints[1][c]);
+        std::swap(best.pBits[0], best.pBits[1]);
+        for_range(i, 16u)
+            best.indices[i] = static_cast<std::uint8_t>(15u - best.indices[i]);
+    }
+
+    /* Write mode bits, endpoints per component, p-bits, and indices */
+    std::uint64_t   bits[2]     = { 0, 0 };
+    std::uint32_t   bitOffset   = 0;
+
+    WriteBits(bits, bitOffset, (1u << 6), 7);
+
+    for_range(c, 4)
+    {
+        WriteBits(bits, bitOffset, best.endpoints[0][c], 7);
+        WriteBits(bits, bitOffset, best.endpoints[1][c], 7);
+    }
+
+    WriteBits(bits, bitOffset, best.pBits[0], 1);
+    WriteBits(bits, bitOffset, best.pBits[1], 1);
+
+    for_range(i, 16u)
+        WriteBits(bits, bitOffset, best.indices[i], (i == 0 ? 3u : 4u));
+
+    WriteUInt64LE(dst,     bits[0]);
+    WriteUInt64LE(dst + 8, bits[1]);
+}
+
+static void EncodeBlock(std::uint8_t* dst, const RGBA8Block& block, const ImageFormat format, const CompressionQuality quality)
+{
+    std::uint8_t values[16];
+    switch (format)
+    {
+        case ImageFormat::BC1:
+            EncodeBC1Block(dst, block, quality, true);
+            break;
+
+        case ImageFormat::BC2:
+            EncodeBC2AlphaBlock(dst, block);
+            EncodeBC1Block(dst + 8, block, quality, false);
+            break;
+
+        case ImageFormat::BC3:
+            ExtractChannel(block, 3, values);
+            EncodeBC4Block(dst, values, quality);
+            EncodeBC1Block(dst + 8, block, quality, false);
+            break;
+
+        case ImageFormat::BC4:
+            ExtractChannel(block, 0, values);
+            EncodeBC4Block(dst, values, quality);
+            break;
+
+        case ImageFormat::BC5:
+            ExtractChannel(block, 0, values);
+            EncodeBC4Block(dst, values, quality);
+            ExtractChannel(block, 1, values);
+            EncodeBC4Block(dst + 8, values, quality);
+            break;
+
+        case ImageFormat::BC7:
+            EncodeBC7Block(dst, block, quality);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static std::size_t GetBCBlockSize(const ImageFormat format)
+{
+    switch (format)
+    {
+        case ImageFormat::BC1:  return 8;
+        case ImageFormat::BC2:  return 16;
+        case ImageFormat::BC3:  return 16;
+        case ImageFormat::BC4:  return 8;
+        case ImageFormat::BC5:  return 16;
+        case ImageFormat::BC7:  return 16;
+        default:                return 0;
+    }
+}
+
+
+/* ----- Functions ----- */
+
+DynamicByteArray CompressRGBA8UNormToBC(
+    const ImageFormat           format,
+    const Extent2D&             extent,
+    const std::uint8_t*         data,
+    const CompressionQuality    quality,
+    unsigned                    threadCount)
+{
+    /* Return null on invalid arguments */
+    const std::size_t blockSize = GetBCBlockSize(format);
+    if (blockSize == 0 || extent.width == 0 || extent.height == 0 || data == nullptr)
+        return nullptr;
+
+    const std::uint32_t numBlocksX = (extent.width  + 3u) / 4u;
+    const std::uint32_t numBlocksY = (extent.height + 3u) / 4u;
+
+    DynamicByteArray dstImage{ static_cast<std::size_t>(numBlocksX) * numBlocksY * blockSize, UninitializeTag{} };
+
+    /* Encode each row of blocks independently */
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            RGBA8Block block;
+            for_subrange(blockY, begin, end)
+            {
+                std::uint8_t* dstRow = reinterpret_cast<std::uint8_t*>(dstImage.get()) + blockY * numBlocksX * blockSize;
+                for_range(blockX, numBlocksX)
+                {
+                    FetchRGBA8Block(block, data, extent, blockX, static_cast<std::uint32_t>(blockY));
+                    EncodeBlock(dstRow + blockX * blockSize, block, format, quality);
+                }
+            }
+        },
+        numBlocksY,
+        threadCount,
+        std::max(1u, 64u / numBlocksX)
+    );
+
+    return dstImage;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
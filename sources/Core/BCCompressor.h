@@ -0,0 +1,45 @@
+/*
+ * BCCompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BC_COMPRESSOR_H
+#define LLGL_BC_COMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+/*
+Returns an image buffer with the specified block compression format (BC1 - BC5, or BC7) for the RGBA8UNorm input image, or null on failure.
+Width and height of the input image do not need to be a multiple of 4. Texels of partial blocks are clamped to the image edge.
+BC4 compresses the red channel and BC5 compresses the red and green channels. BC7 is always encoded in mode 6.
+*/
+DynamicByteArray CompressRGBA8UNormToBC(
+    const ImageFormat           format,
+    const Extent2D&             extent,
+    const std::uint8_t*         data,
+    const CompressionQuality    quality,
+    unsigned                    threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
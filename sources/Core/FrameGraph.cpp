@@ -0,0 +1,777 @@
+/*
+ * FrameGraph.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/FrameGraph.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Texture.h>
+#include <LLGL/RenderTarget.h>
+#include <LLGL/RenderPass.h>
+#include <LLGL/Report.h>
+#include <LLGL/Format.h>
+#include "Assertion.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+struct FrameGraphAccessEntry
+{
+    FrameGraphResource  resource;
+    FrameGraphAccess    access;
+    bool                isWrite;
+};
+
+struct FrameGraphResourceEntry
+{
+    std::string         name;
+    TextureDescriptor   textureDesc;
+    Texture*            texture         = nullptr;  // Imported texture or physical texture after aliasing
+    RenderTarget*       renderTarget    = nullptr;  // Imported render target
+    const RenderPass*   renderPass      = nullptr;  // Render pass for imported render target
+    bool                imported        = false;
+
+    // Compilation state
+    std::uint32_t       firstUse        = LLGL_INVALID_FRAME_GRAPH_HANDLE;
+    std::uint32_t       lastUse         = LLGL_INVALID_FRAME_GRAPH_HANDLE;
+};
+
+struct FrameGraphPassEntry
+{
+    std::string                         name;
+    FrameGraph::ExecuteFunction         execute;
+    bool                                hasSideEffects  = false;
+    std::vector<FrameGraphAccessEntry>  accesses;
+
+    // Compilation state
+    bool                                culled          = true;
+    std::vector<FrameGraphBarrier>      barriers;
+    RenderTarget*                       renderTarget    = nullptr;
+    const RenderPass*                   renderPass      = nullptr;
+    std::vector<ClearValue>             clearValues;
+};
+
+// Hardware texture that backs one or more transient textures with non-overlapping lifetimes.
+struct FrameGraphPhysicalTexture
+{
+    TextureDescriptor   textureDesc;
+    Texture*            texture     = nullptr;
+    std::uint32_t       busyUntil   = 0;
+    bool                used        = false;
+};
+
+// Render pass and render target that are cached for a set of attachments.
+struct FrameGraphRenderTargetCache
+{
+    std::vector<Texture*>       attachments;    // Color attachments followed by the depth-stencil attachment (or null)
+    RenderPassDescriptor        renderPassDesc;
+    RenderPass*                 renderPass      = nullptr;
+    RenderTarget*               renderTarget    = nullptr;
+    bool                        used            = false;
+};
+
+struct FrameGraph::Pimpl
+{
+    RenderSystem*                               renderSystem    = nullptr;
+    std::vector<FrameGraphResourceEntry>        resources;
+    std::vector<FrameGraphPassEntry>            passes;
+    std::vector<FrameGraphPass>                 schedule;
+    std::vector<FrameGraphPhysicalTexture>      physicalTextures;
+    std::vector<FrameGraphRenderTargetCache>    renderTargetCache;
+    FrameGraphStatistics                        stats;
+    Report                                      report;
+    bool                                        compiled        = false;
+    bool                                        hasReport       = false;
+};
+
+
+/*
+ * Internal functions
+ */
+
+static bool IsAttachmentAccess(FrameGraphAccess access)
+{
+    return (access == FrameGraphAccess::ColorAttachment || access == FrameGraphAccess::DepthStencilAttachment);
+}
+
+static bool IsWriteAccess(FrameGraphAccess access)
+{
+    switch (access)
+    {
+        case FrameGraphAccess::ColorAttachment:
+        case FrameGraphAccess::DepthStencilAttachment:
+        case FrameGraphAccess::Storage:
+        case FrameGraphAccess::CopyDestination:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool IsTextureDescriptorCompatible(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    return
+    (
+        lhs.type            == rhs.type             &&
+        lhs.bindFlags       == rhs.bindFlags        &&
+        lhs.cpuAccessFlags  == rhs.cpuAccessFlags   &&
+        lhs.miscFlags       == rhs.miscFlags        &&
+        lhs.format          == rhs.format           &&
+        lhs.extent          == rhs.extent           &&
+        lhs.arrayLayers     == rhs.arrayLayers      &&
+        lhs.mipLevels       == rhs.mipLevels        &&
+        lhs.samples         == rhs.samples
+    );
+}
+
+static std::uint64_t GetTextureMemoryFootprint(const TextureDescriptor& textureDesc)
+{
+    return static_cast<std::uint64_t>(GetMemoryFootprint(textureDesc.format, NumMipTexels(textureDesc))) * std::max(1u, textureDesc.samples);
+}
+
+static bool IsRenderPassDescriptorEqual(const RenderPassDescriptor& lhs, const RenderPassDescriptor& rhs)
+{
+    auto IsAttachmentEqual = [](const AttachmentFormatDescriptor& a, const AttachmentFormatDescriptor& b)
+    {
+        return (a.format == b.format && a.loadOp == b.loadOp && a.storeOp == b.storeOp);
+    };
+
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        if (!IsAttachmentEqual(lhs.colorAttachments[i], rhs.colorAttachments[i]))
+            return false;
+    }
+
+    return
+    (
+        IsAttachmentEqual(lhs.depthAttachment, rhs.depthAttachment)     &&
+        IsAttachmentEqual(lhs.stencilAttachment, rhs.stencilAttachment) &&
+        lhs.samples == rhs.samples
+    );
+}
+
+
+/*
+ * FrameGraph class
+ */
+
+FrameGraph::FrameGraph(RenderSystem& renderSystem) :
+    pimpl_ { new Pimpl{} }
+{
+    pimpl_->renderSystem = &renderSystem;
+}
+
+FrameGraph::~FrameGraph()
+{
+    for (FrameGraphRenderTargetCache& cache : pimpl_->renderTargetCache)
+    {
+        pimpl_->renderSystem->Release(*cache.renderTarget);
+        pimpl_->renderSystem->Release(*cache.renderPass);
+    }
+    for (FrameGraphPhysicalTexture& physicalTexture : pimpl_->physicalTextures)
+        pimpl_->renderSystem->Release(*physicalTexture.texture);
+    delete pimpl_;
+}
+
+/* ----- Resources ----- */
+
+FrameGraphResource FrameGraph::CreateTexture(const char* name, const TextureDescriptor& textureDesc)
+{
+    LLGL_ASSERT_PTR(name);
+
+    FrameGraphResourceEntry entry;
+    {
+        entry.name                  = name;
+        entry.textureDesc           = textureDesc;
+        entry.textureDesc.debugName = nullptr;
+    }
+    pimpl_->resources.push_back(std::move(entry));
+    pimpl_->compiled = false;
+
+    return static_cast<FrameGraphResource>(pimpl_->resources.size() - 1);
+}
+
+FrameGraphResource FrameGraph::ImportTexture(const char* name, Texture& texture)
+{
+    LLGL_ASSERT_PTR(name);
+
+    FrameGraphResourceEntry entry;
+    {
+        entry.name                  = name;
+        entry.textureDesc           = texture.GetDesc();
+        entry.textureDesc.debugName = nullptr;
+        entry.texture               = &texture;
+        entry.imported              = true;
+    }
+    pimpl_->resources.push_back(std::move(entry));
+    pimpl_->compiled = false;
+
+    return static_cast<FrameGraphResource>(pimpl_->resources.size() - 1);
+}
+
+FrameGraphResource FrameGraph::ImportRenderTarget(const char* name, RenderTarget& renderTarget, const RenderPass* renderPass)
+{
+    LLGL_ASSERT_PTR(name);
+
+    FrameGraphResourceEntry entry;
+    {
+        entry.name          = name;
+        entry.renderTarget  = &renderTarget;
+        entry.renderPass    = renderPass;
+        entry.imported      = true;
+    }
+    pimpl_->resources.push_back(std::move(entry));
+    pimpl_->compiled = false;
+
+    return static_cast<FrameGraphResource>(pimpl_->resources.size() - 1);
+}
+
+/* ----- Passes ----- */
+
+FrameGraphPass FrameGraph::AddPass(const char* name, const ExecuteFunction& execute, bool hasSideEffects)
+{
+    LLGL_ASSERT_PTR(name);
+
+    FrameGraphPassEntry entry;
+    {
+        entry.name              = name;
+        entry.execute           = execute;
+        entry.hasSideEffects    = hasSideEffects;
+    }
+    pimpl_->passes.push_back(std::move(entry));
+    pimpl_->compiled = false;
+
+    return static_cast<FrameGraphPass>(pimpl_->passes.size() - 1);
+}
+
+void FrameGraph::AddRead(FrameGraphPass pass, FrameGraphResource resource, FrameGraphAccess access)
+{
+    LLGL_ASSERT_UPPER_BOUND(pass, pimpl_->passes.size());
+    LLGL_ASSERT_UPPER_BOUND(resource, pimpl_->resources.size());
+    pimpl_->passes[pass].accesses.push_back(FrameGraphAccessEntry{ resource, access, false });
+    pimpl_->compiled = false;
+}
+
+void FrameGraph::AddWrite(FrameGraphPass pass, FrameGraphResource resource, FrameGraphAccess access)
+{
+    LLGL_ASSERT_UPPER_BOUND(pass, pimpl_->passes.size());
+    LLGL_ASSERT_UPPER_BOUND(resource, pimpl_->resources.size());
+    pimpl_->passes[pass].accesses.push_back(FrameGraphAccessEntry{ resource, access, true });
+    pimpl_->compiled = false;
+}
+
+/* ----- Compilation and execution ----- */
+
+// Validates the accesses of all passes and returns the passes each pass depends on.
+static bool ValidateAndCollectDependencies(
+    const std::vector<FrameGraphResourceEntry>& resources,
+    const std::vector<FrameGraphPassEntry>&     passes,
+    std::vector<std::vector<FrameGraphPass>>&   outDependencies,
+    Report&                                     report)
+{
+    std::vector<FrameGraphPass> lastWriters(resources.size(), LLGL_INVALID_FRAME_GRAPH_HANDLE);
+    bool result = true;
+
+    outDependencies.resize(passes.size());
+
+    for_range(passIndex, passes.size())
+    {
+        const FrameGraphPassEntry& pass = passes[passIndex];
+
+        std::uint32_t   numColorAttachments = 0;
+        std::uint32_t   numDepthAttachments = 0;
+        std::uint32_t   numRenderTargets    = 0;
+
+        for_range(i, pass.accesses.size())
+        {
+            const FrameGraphAccessEntry&    access      = pass.accesses[i];
+            const FrameGraphResourceEntry&  resource    = resources[access.resource];
+
+            /* Each resource must only be accessed once per pass */
+            for_range(j, i)
+            {
+                if (pass.accesses[j].resource == access.resource)
+                {
+                    report.Errorf("pass '%s' accesses resource '%s' more than once\n", pass.name.c_str(), resource.name.c_str());
+                    result = false;
+                    break;
+                }
+            }
+
+            /* Validate access type */
+            if (access.isWrite != IsWriteAccess(access.access) && access.access != FrameGraphAccess::Storage)
+            {
+                report.Errorf(
+                    "pass '%s' declares %s of resource '%s' with incompatible access\n",
+                    pass.name.c_str(), (access.isWrite ? "write" : "read"), resource.name.c_str()
+                );
+                result = false;
+            }
+
+            if (resource.renderTarget != nullptr)
+            {
+                if (access.access != FrameGraphAccess::ColorAttachment)
+                {
+                    report.Errorf("pass '%s' accesses render target '%s' other than as color attachment\n", pass.name.c_str(), resource.name.c_str());
+                    result = false;
+                }
+                ++numRenderTargets;
+            }
+            else if (access.access == FrameGraphAccess::ColorAttachment)
+            {
+                if ((resource.textureDesc.bindFlags & BindFlags::ColorAttachment) == 0)
+                {
+                    report.Errorf("pass '%s' writes texture '%s' as color attachment without BindFlags::ColorAttachment\n", pass.name.c_str(), resource.name.c_str());
+                    result = false;
+                }
+                ++numColorAttachments;
+            }
+            else if (access.access == FrameGraphAccess::DepthStencilAttachment)
+            {
+                if ((resource.textureDesc.bindFlags & BindFlags::DepthStencilAttachment) == 0)
+                {
+                    report.Errorf("pass '%s' writes texture '%s' as depth-stencil attachment without BindFlags::DepthStencilAttachment\n", pass.name.c_str(), resource.name.c_str());
+                    result = false;
+                }
+                ++numDepthAttachments;
+            }
+
+            /* Reads and partial writes depend on the previous writer */
+            const FrameGraphPass lastWriter = lastWriters[access.resource];
+            if (lastWriter != LLGL_INVALID_FRAME_GRAPH_HANDLE)
+                outDependencies[passIndex].push_back(lastWriter);
+            else if (!access.isWrite && !resource.imported)
+            {
+                report.Errorf("pass '%s' reads transient resource '%s' before it is written\n", pass.name.c_str(), resource.name.c_str());
+                result = false;
+            }
+        }
+
+        /* Validate attachments */
+        if (numColorAttachments > LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        {
+            report.Errorf("pass '%s' writes more than %u color attachments\n", pass.name.c_str(), LLGL_MAX_NUM_COLOR_ATTACHMENTS);
+            result = false;
+        }
+        if (numDepthAttachments > 1)
+        {
+            report.Errorf("pass '%s' writes more than one depth-stencil attachment\n", pass.name.c_str());
+            result = false;
+        }
+        if (numRenderTargets > 1 || (numRenderTargets == 1 && numColorAttachments + numDepthAttachments > 0))
+        {
+            report.Errorf("pass '%s' writes an imported render target together with other attachments\n", pass.name.c_str());
+            result = false;
+        }
+
+        /* Make this pass the last writer of its outputs */
+        for (const FrameGraphAccessEntry& access : pass.accesses)
+        {
+            if (access.isWrite)
+                lastWriters[access.resource] = static_cast<FrameGraphPass>(passIndex);
+        }
+    }
+
+    return result;
+}
+
+bool FrameGraph::Compile()
+{
+    std::vector<FrameGraphResourceEntry>&   resources   = pimpl_->resources;
+    std::vector<FrameGraphPassEntry>&       passes      = pimpl_->passes;
+
+    pimpl_->compiled    = false;
+    pimpl_->hasReport   = false;
+    pimpl_->report.Reset("", false);
+    pimpl_->schedule.clear();
+    pimpl_->stats       = FrameGraphStatistics{};
+
+    for (FrameGraphResourceEntry& resource : resources)
+    {
+        resource.firstUse   = LLGL_INVALID_FRAME_GRAPH_HANDLE;
+        resource.lastUse    = LLGL_INVALID_FRAME_GRAPH_HANDLE;
+        if (!resource.imported)
+            resource.texture = nullptr;
+    }
+
+    for (FrameGraphPassEntry& pass : passes)
+    {
+        pass.culled         = true;
+        pass.renderTarget   = nullptr;
+        pass.renderPass     = nullptr;
+        pass.barriers.clear();
+        pass.clearValues.clear();
+    }
+
+    /* Validate passes and build dependency graph */
+    std::vector<std::vector<FrameGraphPass>> dependencies;
+    if (!ValidateAndCollectDependencies(resources, passes, dependencies, pimpl_->report))
+    {
+        pimpl_->hasReport = true;
+        return false;
+    }
+
+    /* Cull passes whose output is neither imported nor consumed by a pass with side effects */
+    for (FrameGraphPassEntry& pass : passes)
+    {
+        if (pass.hasSideEffects)
+            pass.culled = false;
+        else
+        {
+            for (const FrameGraphAccessEntry& access : pass.accesses)
+            {
+                if (access.isWrite && resources[access.resource].imported)
+                {
+                    pass.culled = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (std::size_t passIndex = passes.size(); passIndex-- > 0;)
+    {
+        if (!passes[passIndex].culled)
+        {
+            for (FrameGraphPass dependency : dependencies[passIndex])
+                passes[dependency].culled = false;
+        }
+    }
+
+    /* Schedule passes in declaration order and determine lifetimes of transient resources */
+    for_range(passIndex, passes.size())
+    {
+        if (passes[passIndex].culled)
+        {
+            pimpl_->stats.numCulledPasses++;
+            continue;
+        }
+
+        const std::uint32_t scheduleIndex = static_cast<std::uint32_t>(pimpl_->schedule.size());
+        pimpl_->schedule.push_back(static_cast<FrameGraphPass>(passIndex));
+
+        for (const FrameGraphAccessEntry& access : passes[passIndex].accesses)
+        {
+            FrameGraphResourceEntry& resource = resources[access.resource];
+            if (resource.firstUse == LLGL_INVALID_FRAME_GRAPH_HANDLE)
+                resource.firstUse = scheduleIndex;
+            resource.lastUse = scheduleIndex;
+        }
+    }
+
+    pimpl_->stats.numPasses = static_cast<std::uint32_t>(passes.size());
+
+    /* Alias transient textures with compatible descriptors and non-overlapping lifetimes */
+    for (FrameGraphPhysicalTexture& physicalTexture : pimpl_->physicalTextures)
+    {
+        physicalTexture.busyUntil   = 0;
+        physicalTexture.used        = false;
+    }
+
+    std::vector<FrameGraphResource> transientResources;
+    for_range(resourceIndex, resources.size())
+    {
+        const FrameGraphResourceEntry& resource = resources[resourceIndex];
+        if (!resource.imported && resource.firstUse != LLGL_INVALID_FRAME_GRAPH_HANDLE)
+            transientResources.push_back(static_cast<FrameGraphResource>(resourceIndex));
+    }
+
+    std::stable_sort(
+        transientResources.begin(),
+        transientResources.end(),
+        [&resources](FrameGraphResource lhs, FrameGraphResource rhs)
+        {
+            return (resources[lhs].firstUse < resources[rhs].firstUse);
+        }
+    );
+
+    for (FrameGraphResource resourceIndex : transientResources)
+    {
+        FrameGraphResourceEntry& resource = resources[resourceIndex];
+
+        FrameGraphPhysicalTexture* physicalTexture = nullptr;
+        for (FrameGraphPhysicalTexture& candidate : pimpl_->physicalTextures)
+        {
+            if ((!candidate.used || candidate.busyUntil < resource.firstUse) &&
+                IsTextureDescriptorCompatible(candidate.textureDesc, resource.textureDesc))
+            {
+                physicalTexture = &candidate;
+                break;
+            }
+        }
+
+        if (physicalTexture == nullptr)
+        {
+            FrameGraphPhysicalTexture newPhysicalTexture;
+            {
+                newPhysicalTexture.textureDesc  = resource.textureDesc;
+                newPhysicalTexture.texture      = pimpl_->renderSystem->CreateTexture(resource.textureDesc);
+                newPhysicalTexture.texture->SetDebugName(resource.name.c_str());
+            }
+            pimpl_->physicalTextures.push_back(newPhysicalTexture);
+            physicalTexture = &(pimpl_->physicalTextures.back());
+        }
+
+        physicalTexture->used       = true;
+        physicalTexture->busyUntil  = resource.lastUse;
+        resource.texture            = physicalTexture->texture;
+
+        pimpl_->stats.numTransientTextures++;
+        pimpl_->stats.transientMemory += GetTextureMemoryFootprint(resource.textureDesc);
+    }
+
+    /* Compute barriers from the access transitions of each resource */
+    std::vector<FrameGraphAccess> resourceStates(resources.size(), FrameGraphAccess::Undefined);
+
+    for (FrameGraphPass passIndex : pimpl_->schedule)
+    {
+        FrameGraphPassEntry& pass = passes[passIndex];
+        for (const FrameGraphAccessEntry& access : pass.accesses)
+        {
+            /* Storage accesses require a barrier between consecutive passes to make shader writes visible */
+            FrameGraphAccess& state = resourceStates[access.resource];
+            if (state != access.access || access.access == FrameGraphAccess::Storage)
+            {
+                FrameGraphBarrier barrier;
+                {
+                    barrier.resource    = access.resource;
+                    barrier.before      = state;
+                    barrier.after       = access.access;
+                }
+                pass.barriers.push_back(barrier);
+            }
+            state = access.access;
+        }
+        pimpl_->stats.numBarriers += static_cast<std::uint32_t>(pass.barriers.size());
+    }
+
+    /* Derive render passes and render targets for passes that write to attachments */
+    for (FrameGraphRenderTargetCache& cache : pimpl_->renderTargetCache)
+        cache.used = false;
+
+    std::fill(resourceStates.begin(), resourceStates.end(), FrameGraphAccess::Undefined);
+
+    for_range(scheduleIndex, pimpl_->schedule.size())
+    {
+        FrameGraphPassEntry& pass = passes[pimpl_->schedule[scheduleIndex]];
+
+        std::vector<Texture*>   attachments;
+        RenderPassDescriptor    renderPassDesc;
+        ClearValue              depthStencilClearValue;
+        bool                    hasAttachments          = false;
+        bool                    clearDepthStencil       = false;
+        Texture*                depthStencilAttachment  = nullptr;
+
+        for (const FrameGraphAccessEntry& access : pass.accesses)
+        {
+            const FrameGraphResourceEntry& resource = resources[access.resource];
+
+            if (resource.renderTarget != nullptr)
+            {
+                pass.renderTarget   = resource.renderTarget;
+                pass.renderPass     = resource.renderPass;
+            }
+            else if (IsAttachmentAccess(access.access))
+            {
+                /* Load previous content if the attachment has been accessed before; store the outcome if it is accessed afterwards */
+                const bool              isContentDefined    = (resource.imported || resourceStates[access.resource] != FrameGraphAccess::Undefined);
+                const bool              isContentConsumed   = (resource.imported || resource.lastUse > scheduleIndex);
+                const AttachmentLoadOp  loadOp              = (isContentDefined ? AttachmentLoadOp::Load : AttachmentLoadOp::Clear);
+                const AttachmentStoreOp storeOp             = (isContentConsumed ? AttachmentStoreOp::Store : AttachmentStoreOp::Undefined);
+
+                if (access.access == FrameGraphAccess::ColorAttachment)
+                {
+                    renderPassDesc.colorAttachments[attachments.size()] = AttachmentFormatDescriptor{ resource.textureDesc.format, loadOp, storeOp };
+                    attachments.push_back(resource.texture);
+                    if (loadOp == AttachmentLoadOp::Clear)
+                        pass.clearValues.push_back(resource.textureDesc.clearValue);
+                }
+                else
+                {
+                    if (IsDepthFormat(resource.textureDesc.format))
+                        renderPassDesc.depthAttachment = AttachmentFormatDescriptor{ resource.textureDesc.format, loadOp, storeOp };
+                    if (IsStencilFormat(resource.textureDesc.format))
+                        renderPassDesc.stencilAttachment = AttachmentFormatDescriptor{ resource.textureDesc.format, loadOp, storeOp };
+                    depthStencilAttachment  = resource.texture;
+                    depthStencilClearValue  = resource.textureDesc.clearValue;
+                    clearDepthStencil       = (loadOp == AttachmentLoadOp::Clear);
+                }
+
+                renderPassDesc.samples = resource.textureDesc.samples;
+                hasAttachments = true;
+            }
+        }
+
+        for (const FrameGraphAccessEntry& access : pass.accesses)
+            resourceStates[access.resource] = access.access;
+
+        if (!hasAttachments)
+            continue;
+
+        /* Depth-stencil clear value always appears last */
+        if (clearDepthStencil)
+            pass.clearValues.push_back(depthStencilClearValue);
+
+        attachments.push_back(depthStencilAttachment);
+
+        /* Find cached render target with the same attachments and operations */
+        FrameGraphRenderTargetCache* cache = nullptr;
+        for (FrameGraphRenderTargetCache& candidate : pimpl_->renderTargetCache)
+        {
+            if (candidate.attachments == attachments && IsRenderPassDescriptorEqual(candidate.renderPassDesc, renderPassDesc))
+            {
+                cache = &candidate;
+                break;
+            }
+        }
+
+        if (cache == nullptr)
+        {
+            FrameGraphRenderTargetCache newCache;
+            {
+                newCache.attachments    = attachments;
+                newCache.renderPassDesc = renderPassDesc;
+                newCache.renderPass     = pimpl_->renderSystem->CreateRenderPass(renderPassDesc);
+            }
+
+            RenderTargetDescriptor renderTargetDesc;
+            {
+                renderTargetDesc.renderPass = newCache.renderPass;
+                renderTargetDesc.samples    = renderPassDesc.samples;
+                for_range(i, attachments.size() - 1)
+                    renderTargetDesc.colorAttachments[i].texture = attachments[i];
+                renderTargetDesc.depthStencilAttachment.texture = depthStencilAttachment;
+
+                const Texture* referenceTexture = (attachments.front() != nullptr ? attachments.front() : depthStencilAttachment);
+                const Extent3D extent = referenceTexture->GetMipExtent(0);
+                renderTargetDesc.resolution = Extent2D{ extent.width, extent.height };
+            }
+            newCache.renderTarget = pimpl_->renderSystem->CreateRenderTarget(renderTargetDesc);
+
+            pimpl_->renderTargetCache.push_back(newCache);
+            cache = &(pimpl_->renderTargetCache.back());
+        }
+
+        cache->used         = true;
+        pass.renderTarget   = cache->renderTarget;
+        pass.renderPass     = cache->renderPass;
+    }
+
+    /* Release cached render targets first since they reference the physical textures */
+    for (auto it = pimpl_->renderTargetCache.begin(); it != pimpl_->renderTargetCache.end();)
+    {
+        if (!it->used)
+        {
+            pimpl_->renderSystem->Release(*it->renderTarget);
+            pimpl_->renderSystem->Release(*it->renderPass);
+            it = pimpl_->renderTargetCache.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto it = pimpl_->physicalTextures.begin(); it != pimpl_->physicalTextures.end();)
+    {
+        if (!it->used)
+        {
+            pimpl_->renderSystem->Release(*it->texture);
+            it = pimpl_->physicalTextures.erase(it);
+        }
+        else
+        {
+            pimpl_->stats.numPhysicalTextures++;
+            pimpl_->stats.physicalMemory += GetTextureMemoryFootprint(it->textureDesc);
+            ++it;
+        }
+    }
+
+    pimpl_->compiled = true;
+
+    return true;
+}
+
+void FrameGraph::Execute(CommandBuffer& commandBuffer)
+{
+    LLGL_ASSERT(pimpl_->compiled, "frame graph must be compiled before execution");
+
+    for (FrameGraphPass passIndex : pimpl_->schedule)
+    {
+        FrameGraphPassEntry& pass = pimpl_->passes[passIndex];
+        if (pass.renderTarget != nullptr)
+        {
+            const std::uint32_t numClearValues = static_cast<std::uint32_t>(pass.clearValues.size());
+            commandBuffer.BeginRenderPass(*pass.renderTarget, pass.renderPass, numClearValues, pass.clearValues.data());
+            {
+                if (pass.execute)
+                    pass.execute(commandBuffer, *this);
+            }
+            commandBuffer.EndRenderPass();
+        }
+        else if (pass.execute)
+            pass.execute(commandBuffer, *this);
+    }
+}
+
+void FrameGraph::Reset()
+{
+    pimpl_->resources.clear();
+    pimpl_->passes.clear();
+    pimpl_->schedule.clear();
+    pimpl_->compiled = false;
+}
+
+/* ----- Queries ----- */
+
+Texture* FrameGraph::GetTexture(FrameGraphResource resource) const
+{
+    LLGL_ASSERT_UPPER_BOUND(resource, pimpl_->resources.size());
+    return pimpl_->resources[resource].texture;
+}
+
+ArrayView<FrameGraphPass> FrameGraph::GetSchedule() const
+{
+    return ArrayView<FrameGraphPass>{ pimpl_->schedule.data(), pimpl_->schedule.size() };
+}
+
+ArrayView<FrameGraphBarrier> FrameGraph::GetBarriers(FrameGraphPass pass) const
+{
+    LLGL_ASSERT_UPPER_BOUND(pass, pimpl_->passes.size());
+    const std::vector<FrameGraphBarrier>& barriers = pimpl_->passes[pass].barriers;
+    return ArrayView<FrameGraphBarrier>{ barriers.data(), barriers.size() };
+}
+
+bool FrameGraph::IsPassCulled(FrameGraphPass pass) const
+{
+    LLGL_ASSERT_UPPER_BOUND(pass, pimpl_->passes.size());
+    return pimpl_->passes[pass].culled;
+}
+
+FrameGraphStatistics FrameGraph::GetStatistics() const
+{
+    return pimpl_->stats;
+}
+
+const Report* FrameGraph::GetReport() const
+{
+    return (pimpl_->hasReport ? &(pimpl_->report) : nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
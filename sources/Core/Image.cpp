@@ -150,6 +150,18 @@ void Image::Resize(const Extent3D& extent, const ColorRGBAf& fillColor, const Of
     }
 }
 
+void Image::Resample(const Extent3D& extent, const ResampleFilter filter, bool isSRGB, unsigned threadCount)
+{
+    if (data_ && extent != GetExtent())
+    {
+        if (DynamicByteArray resampledData = ResampleImageBuffer(GetView(), GetExtent(), extent, filter, isSRGB, threadCount))
+        {
+            extent_ = extent;
+            data_   = std::move(resampledData);
+        }
+    }
+}
+
 void Image::Swap(Image& rhs)
 {
     std::swap(extent_,   rhs.extent_  );
@@ -18,6 +18,7 @@
 #include "../Core/Threading.h"
 #include "Float16Compressor.h"
 #include "BCDecompressor.h"
+#include "BCCompressor.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -552,6 +553,140 @@ static void ConvertImageBufferFormat(
     );
 }
 
+static void TransferNormalizedComponent(DataType dataType, const VariantConstBuffer& buffer, std::size_t idx, double& value)
+{
+    value = ReadNormalizedTypedVariant(dataType, buffer, idx);
+}
+
+static void TransferNormalizedComponent(DataType dataType, VariantBuffer& buffer, std::size_t idx, const double& value)
+{
+    WriteNormalizedTypedVariant(dataType, buffer, idx, value);
+}
+
+template <typename TBuf, typename TVal>
+void TransferNormalizedRGBA(ImageFormat format, DataType dataType, TBuf& buffer, std::size_t idx, TVal (&rgba)[4])
+{
+    switch (format)
+    {
+        case ImageFormat::Alpha:
+            TransferNormalizedComponent(dataType, buffer, idx    , rgba[3]);
+            break;
+        case ImageFormat::R:
+            TransferNormalizedComponent(dataType, buffer, idx    , rgba[0]);
+            break;
+        case ImageFormat::RG:
+            TransferNormalizedComponent(dataType, buffer, idx*2    , rgba[0]);
+            TransferNormalizedComponent(dataType, buffer, idx*2 + 1, rgba[1]);
+            break;
+        case ImageFormat::RGB:
+            TransferNormalizedComponent(dataType, buffer, idx*3    , rgba[0]);
+            TransferNormalizedComponent(dataType, buffer, idx*3 + 1, rgba[1]);
+            TransferNormalizedComponent(dataType, buffer, idx*3 + 2, rgba[2]);
+            break;
+        case ImageFormat::BGR:
+            TransferNormalizedComponent(dataType, buffer, idx*3    , rgba[2]);
+            TransferNormalizedComponent(dataType, buffer, idx*3 + 1, rgba[1]);
+            TransferNormalizedComponent(dataType, buffer, idx*3 + 2, rgba[0]);
+            break;
+        case ImageFormat::RGBA:
+            TransferNormalizedComponent(dataType, buffer, idx*4    , rgba[0]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 1, rgba[1]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 2, rgba[2]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 3, rgba[3]);
+            break;
+        case ImageFormat::BGRA:
+            TransferNormalizedComponent(dataType, buffer, idx*4    , rgba[2]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 1, rgba[1]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 2, rgba[0]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 3, rgba[3]);
+            break;
+        case ImageFormat::ARGB:
+            TransferNormalizedComponent(dataType, buffer, idx*4    , rgba[3]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 1, rgba[0]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 2, rgba[1]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 3, rgba[2]);
+            break;
+        case ImageFormat::ABGR:
+            TransferNormalizedComponent(dataType, buffer, idx*4    , rgba[3]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 1, rgba[2]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 2, rgba[1]);
+            TransferNormalizedComponent(dataType, buffer, idx*4 + 3, rgba[0]);
+            break;
+        default:
+            break;
+    }
+}
+
+// Worker thread procedure for the "ConvertImageBufferFormatAndDataType" function
+static void ConvertImageBufferFormatAndDataTypeWorker(
+    ImageFormat         srcFormat,
+    DataType            srcDataType,
+    VariantConstBuffer  srcBuffer,
+    ImageFormat         dstFormat,
+    DataType            dstDataType,
+    VariantBuffer       dstBuffer,
+    std::size_t         begin,
+    std::size_t         end)
+{
+    for_subrange(i, begin, end)
+    {
+        /* Read normalized RGBA color from source buffer with default color (0, 0, 0, 1) */
+        double color[4] = { 0.0, 0.0, 0.0, 1.0 };
+        TransferNormalizedRGBA(srcFormat, srcDataType, srcBuffer, i, color);
+
+        /* Write normalized RGBA color to destination buffer */
+        TransferNormalizedRGBA(dstFormat, dstDataType, dstBuffer, i, color);
+    }
+}
+
+// Converts image format and data type in a single pass, i.e. without an intermediate buffer.
+static void ConvertImageBufferFormatAndDataType(
+    const ImageView&        srcImageView,
+    const MutableImageView& dstImageView,
+    unsigned                threadCount)
+{
+    /* Validate destination buffer size */
+    const std::size_t imageSize             = srcImageView.dataSize / GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1);
+    const std::size_t requiredDstBufferSize = GetMemoryFootprint(dstImageView.format, dstImageView.dataType, imageSize);
+
+    if (dstImageView.dataSize != requiredDstBufferSize)
+        LLGL_TRAP("cannot convert image format and data type with destination buffer size mismatch");
+
+    DoConcurrentRange(
+        std::bind(
+            ConvertImageBufferFormatAndDataTypeWorker,
+            srcImageView.format,
+            srcImageView.dataType,
+            srcImageView.data,
+            dstImageView.format,
+            dstImageView.dataType,
+            dstImageView.data,
+            std::placeholders::_1,
+            std::placeholders::_2
+        ),
+        imageSize,
+        threadCount
+    );
+}
+
+// Converts a single row of texels. Source and destination must have been validated and must differ in either format or data type.
+static void ConvertImageRow(
+    ImageFormat     srcFormat,
+    DataType        srcDataType,
+    const void*     srcRow,
+    ImageFormat     dstFormat,
+    DataType        dstDataType,
+    void*           dstRow,
+    std::size_t     numTexels)
+{
+    if (IsDepthOrStencilFormat(srcFormat) || srcDataType == dstDataType)
+        ConvertImageBufferFormatWorker(srcFormat, srcDataType, srcRow, dstFormat, dstDataType, dstRow, 0, numTexels);
+    else if (srcFormat == dstFormat)
+        ConvertImageBufferDataTypeWorker(srcDataType, srcRow, dstDataType, dstRow, 0, numTexels * ImageFormatSize(srcFormat));
+    else
+        ConvertImageBufferFormatAndDataTypeWorker(srcFormat, srcDataType, srcRow, dstFormat, dstDataType, dstRow, 0, numTexels);
+}
+
 static void ValidateSourceImageView(const ImageView& imageView)
 {
     LLGL_ASSERT_PTR(imageView.data);
@@ -568,6 +703,21 @@ static void ValidateDestinationImageView(const MutableImageView& imageView)
     LLGL_ASSERT(imageView.dataSize % dataTypeSize == 0, "destination image data size is not a multiple of the source data type size");
 }
 
+// Validates the size of an image view whose rows are padded to the specified stride; Its size does not need to be a multiple of the texel size.
+static void ValidateStridedImageView(
+    std::size_t dataSize,
+    std::size_t numRows,
+    std::size_t rowStride,
+    std::size_t rowSize,
+    const char* imageName)
+{
+    LLGL_ASSERT(rowStride >= rowSize, "%s row stride must not be less than the size of a row", imageName);
+    LLGL_ASSERT(
+        dataSize >= (numRows - 1) * rowStride + rowSize,
+        "%s image data size (%zu) is too small for %zu rows with a stride of %zu bytes", imageName, dataSize, numRows, rowStride
+    );
+}
+
 static void ValidateImageConversionParams(
     const ImageView&    srcImageView,
     ImageFormat         dstFormat,
@@ -607,32 +757,8 @@ LLGL_EXPORT bool ConvertImageBuffer(
     }
     else if (srcImageView.dataType != dstImageView.dataType && srcImageView.format != dstImageView.format)
     {
-        /* Convert image data type with intermediate buffer */
-        const std::size_t   intermediateBufferSize  = srcImageView.dataSize / DataTypeSize(srcImageView.dataType) * DataTypeSize(dstImageView.dataType);
-        DynamicByteArray    intermediateBuffer      = DynamicByteArray{ intermediateBufferSize, UninitializeTag{} };
-
-        ConvertImageBufferDataType(
-            srcImageView.dataType,
-            srcImageView.data,
-            srcImageView.dataSize,
-            dstImageView.dataType,
-            intermediateBuffer.get(),
-            intermediateBufferSize,
-            threadCount
-        );
-
-        /* Set new source buffer and source data type */
-        const ImageView intermediateImageView
-        {
-            srcImageView.format,
-            dstImageView.dataType,
-            intermediateBuffer.get(),
-            intermediateBufferSize
-        };
-
-        /* Convert image format */
-        ConvertImageBufferFormat(intermediateImageView, dstImageView, threadCount);
-
+        /* Convert image format and data type */
+        ConvertImageBufferFormatAndDataType(srcImageView, dstImageView, threadCount);
         return true;
     }
     else if (srcImageView.dataType != dstImageView.dataType)
@@ -659,6 +785,76 @@ LLGL_EXPORT bool ConvertImageBuffer(
     return false;
 }
 
+// Worker thread procedure for the row-aligned "ConvertImageBuffer" function
+static void ConvertImageBufferRowsWorker(
+    const ImageView&        srcImageView,
+    std::size_t             srcRowStride,
+    const MutableImageView& dstImageView,
+    std::size_t             dstRowStride,
+    std::uint32_t           rowLength,
+    std::size_t             begin,
+    std::size_t             end)
+{
+    const bool          isConversion    = (srcImageView.format != dstImageView.format || srcImageView.dataType != dstImageView.dataType);
+    const std::size_t   rowSize         = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, rowLength);
+
+    for_subrange(row, begin, end)
+    {
+        const char* srcRow = static_cast<const char*>(srcImageView.data) + row * srcRowStride;
+        char*       dstRow = static_cast<char*>(dstImageView.data) + row * dstRowStride;
+
+        if (isConversion)
+            ConvertImageRow(srcImageView.format, srcImageView.dataType, srcRow, dstImageView.format, dstImageView.dataType, dstRow, rowLength);
+        else
+            ::memcpy(dstRow, srcRow, rowSize);
+    }
+}
+
+LLGL_EXPORT bool ConvertImageBuffer(
+    const ImageView&        srcImageView,
+    std::uint32_t           srcRowStride,
+    const MutableImageView& dstImageView,
+    std::uint32_t           dstRowStride,
+    std::uint32_t           rowLength,
+    unsigned                threadCount)
+{
+    /* Validate input parameters; Padded rows are validated by their stride instead of the texel size */
+    LLGL_ASSERT_PTR(srcImageView.data);
+    LLGL_ASSERT_PTR(dstImageView.data);
+    ValidateImageConversionParams(srcImageView, dstImageView.format, dstImageView.dataType);
+
+    const std::size_t srcRowSize = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, rowLength);
+    const std::size_t dstRowSize = GetMemoryFootprint(dstImageView.format, dstImageView.dataType, rowLength);
+
+    const std::size_t srcStride = (srcRowStride != 0 ? srcRowStride : srcRowSize);
+    const std::size_t dstStride = (dstRowStride != 0 ? dstRowStride : dstRowSize);
+
+    /* Determine number of rows; the last row of the source image does not need to be padded */
+    if (srcRowSize == 0 || srcImageView.dataSize < srcRowSize)
+        return false;
+
+    const std::size_t numRows = (srcImageView.dataSize - srcRowSize) / srcStride + 1;
+
+    ValidateStridedImageView(srcImageView.dataSize, numRows, srcStride, srcRowSize, "source");
+    ValidateStridedImageView(dstImageView.dataSize, numRows, dstStride, dstRowSize, "destination");
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Convert or copy each row straight into the destination buffer */
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            ConvertImageBufferRowsWorker(srcImageView, srcStride, dstImageView, dstStride, rowLength, begin, end);
+        },
+        numRows,
+        threadCount,
+        std::max(1u, 4096u / std::max(1u, rowLength))
+    );
+
+    return (srcImageView.format != dstImageView.format || srcImageView.dataType != dstImageView.dataType);
+}
+
 LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
     const ImageView&    srcImageView,
     ImageFormat         dstFormat,
@@ -690,25 +886,8 @@ LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
     }
     else if (srcImageView.dataType != dstDataType && srcImageView.format != dstFormat)
     {
-        /* Convert image data type with intermediate buffer */
-        const std::size_t   intermediateBufferSize  = srcImageView.dataSize / DataTypeSize(srcImageView.dataType) * DataTypeSize(dstDataType);
-        DynamicByteArray    intermediateBuffer      = DynamicByteArray{ intermediateBufferSize, UninitializeTag{} };
-
-        ConvertImageBufferDataType(
-            srcImageView.dataType,
-            srcImageView.data,
-            srcImageView.dataSize,
-            dstDataType,
-            intermediateBuffer.get(),
-            intermediateBufferSize,
-            threadCount
-        );
-
-        /* Set new source buffer and source data type */
-        const ImageView intermediateImageView{ srcImageView.format, dstDataType, intermediateBuffer.get(), intermediateBufferSize };
-
-        /* Convert image format */
-        ConvertImageBufferFormat(intermediateImageView, dstImageView, threadCount);
+        /* Convert image format and data type */
+        ConvertImageBufferFormatAndDataType(srcImageView, dstImageView, threadCount);
     }
     else if (srcImageView.dataType != dstDataType)
     {
@@ -747,6 +926,41 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     return nullptr;
 }
 
+LLGL_EXPORT DynamicByteArray CompressImageBuffer(
+    const ImageView&    srcImageView,
+    const Extent2D&     extent,
+    ImageFormat         dstFormat,
+    CompressionQuality  quality,
+    unsigned            threadCount)
+{
+    if (!IsCompressedFormat(dstFormat))
+        return nullptr;
+
+    /* Validate input parameters */
+    ValidateSourceImageView(srcImageView);
+
+    if (IsCompressedFormat(srcImageView.format))
+        LLGL_TRAP("cannot compress image that is already compressed");
+    if (IsDepthOrStencilFormat(srcImageView.format))
+        LLGL_TRAP("cannot compress depth-stencil image formats");
+
+    const std::size_t numTexels     = static_cast<std::size_t>(extent.width) * extent.height;
+    const std::size_t srcImageSize  = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, numTexels);
+
+    if (srcImageView.dataSize < srcImageSize)
+        LLGL_TRAP("cannot compress image with source buffer size mismatch");
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Convert source image to RGBA8UNorm if necessary */
+    const ImageView srcView{ srcImageView.format, srcImageView.dataType, srcImageView.data, srcImageSize };
+    if (DynamicByteArray rgba8Image = ConvertImageBuffer(srcView, ImageFormat::RGBA, DataType::UInt8, threadCount))
+        return CompressRGBA8UNormToBC(dstFormat, extent, reinterpret_cast<const std::uint8_t*>(rgba8Image.get()), quality, threadCount);
+
+    return CompressRGBA8UNormToBC(dstFormat, extent, static_cast<const std::uint8_t*>(srcImageView.data), quality, threadCount);
+}
+
 // Returns the 1D flattened buffer position for a 3D image coordinate ('bpp' denotes the bytes per pixel)
 static std::size_t GetFlattenedImageBufferPos(
     std::uint32_t x,
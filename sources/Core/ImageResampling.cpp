@@ -0,0 +1,464 @@
+/*
+ * ImageResampling.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include "../Core/Assertion.h"
+#include "../Core/Threading.h"
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <cmath>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Range of source elements that contribute to a single destination element.
+struct ResampleContribution
+{
+    std::uint32_t first;        // Index of the first source element.
+    std::uint32_t count;        // Number of source elements.
+    std::uint32_t weightOffset; // Offset into the weight table.
+};
+
+// Precomputed filter weights to resample a single dimension.
+struct ResampleWeightTable
+{
+    std::vector<ResampleContribution>   contributions;  // One entry for each destination element.
+    std::vector<float>                  weights;
+};
+
+
+/* ----- Internal functions ----- */
+
+static constexpr double g_pi = 3.14159265358979323846;
+
+static double GetResampleFilterRadius(const ResampleFilter filter)
+{
+    switch (filter)
+    {
+        case ResampleFilter::Box:       return 0.5;
+        case ResampleFilter::Bilinear:  return 1.0;
+        case ResampleFilter::Bicubic:   return 2.0;
+        case ResampleFilter::Lanczos3:  return 3.0;
+    }
+    return 0.0;
+}
+
+static double Sinc(double x)
+{
+    if (std::abs(x) < 1.0e-8)
+        return 1.0;
+    x *= g_pi;
+    return std::sin(x) / x;
+}
+
+// Evaluates the filter kernel at the specified distance (in source pixels) from the sample center.
+static double EvalResampleFilter(const ResampleFilter filter, double x)
+{
+    x = std::abs(x);
+    switch (filter)
+    {
+        case ResampleFilter::Box:
+            return (x < 0.5 ? 1.0 : 0.0);
+
+        case ResampleFilter::Bilinear:
+            return (x < 1.0 ? 1.0 - x : 0.0);
+
+        case ResampleFilter::Bicubic:
+            /* Catmull-Rom spline, i.e. Mitchell-Netravali with B=0 and C=0.5 */
+            if (x < 1.0)
+                return (1.5*x - 2.5)*x*x + 1.0;
+            if (x < 2.0)
+                return ((-0.5*x + 2.5)*x - 4.0)*x + 2.0;
+            return 0.0;
+
+        case ResampleFilter::Lanczos3:
+            return (x < 3.0 ? Sinc(x) * Sinc(x / 3.0) : 0.0);
+    }
+    return 0.0;
+}
+
+/*
+Builds the weight table to resample a dimension of 'srcSize' elements into 'dstSize' elements.
+When downsampling, the filter is stretched to cover all source elements of a destination element.
+Source elements outside the image are clamped to the edge, so their weights are folded into the edge elements.
+*/
+static void BuildResampleWeightTable(ResampleWeightTable& table, std::uint32_t srcSize, std::uint32_t dstSize, const ResampleFilter filter)
+{
+    const double scale          = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+    const double filterScale    = std::max(1.0, scale);
+    const double support        = GetResampleFilterRadius(filter) * filterScale;
+    const int    maxIndex       = static_cast<int>(srcSize) - 1;
+
+    table.contributions.resize(dstSize);
+    table.weights.clear();
+
+    std::vector<double> weights;
+
+    for_range(i, dstSize)
+    {
+        /* Determine range of source elements for the center of this destination element */
+        const double center = (static_cast<double>(i) + 0.5) * scale;
+        const int    begin  = static_cast<int>(std::floor(center - support));
+        const int    end    = static_cast<int>(std::ceil(center + support));
+        const int    first  = std::max(0, std::min(begin, maxIndex));
+        const int    last   = std::max(0, std::min(end, maxIndex));
+
+        weights.assign(static_cast<std::size_t>(last - first + 1), 0.0);
+
+        double weightSum = 0.0;
+        for (int j = begin; j <= end; ++j)
+        {
+            const double w = EvalResampleFilter(filter, (static_cast<double>(j) + 0.5 - center) / filterScale);
+            if (w != 0.0)
+            {
+                weights[std::max(0, std::min(j, maxIndex)) - first] += w;
+                weightSum += w;
+            }
+        }
+
+        /* Normalize weights or fall back to nearest element if the filter has no coverage */
+        if (weightSum != 0.0)
+        {
+            for (double& w : weights)
+                w /= weightSum;
+        }
+        else
+        {
+            const int nearest = std::max(0, std::min(static_cast<int>(center), maxIndex));
+            table.contributions[i] = { static_cast<std::uint32_t>(nearest), 1u, static_cast<std::uint32_t>(table.weights.size()) };
+            table.weights.push_back(1.0f);
+            continue;
+        }
+
+        /* Trim zero weights at both ends, e.g. for the box filter */
+        std::size_t trimBegin = 0, trimEnd = weights.size();
+        while (trimEnd - trimBegin > 1 && weights[trimBegin] == 0.0)
+            ++trimBegin;
+        while (trimEnd - trimBegin > 1 && weights[trimEnd - 1] == 0.0)
+            --trimEnd;
+
+        ResampleContribution& contrib = table.contributions[i];
+        {
+            contrib.first           = static_cast<std::uint32_t>(first) + static_cast<std::uint32_t>(trimBegin);
+            contrib.count           = static_cast<std::uint32_t>(trimEnd - trimBegin);
+            contrib.weightOffset    = static_cast<std::uint32_t>(table.weights.size());
+        }
+        for_subrange(j, trimBegin, trimEnd)
+            table.weights.push_back(static_cast<float>(weights[j]));
+    }
+}
+
+/*
+Accumulates the weighted source rows into the destination row, i.e. dst[x] = sum_k(weights[k] * src[k*srcStride + x]).
+Each row is contiguous, so the inner loops are vectorized by the compiler.
+*/
+static void AccumulateWeightedRows(
+    float*          dst,
+    const float*    src,
+    std::size_t     rowLength,
+    std::size_t     srcStride,
+    const float*    weights,
+    std::uint32_t   numWeights)
+{
+    const float w0 = weights[0];
+    for_range(x, rowLength)
+        dst[x] = src[x] * w0;
+
+    for_subrange(k, 1u, numWeights)
+    {
+        const float*    srcRow  = src + k * srcStride;
+        const float     w       = weights[k];
+        for_range(x, rowLength)
+            dst[x] += srcRow[x] * w;
+    }
+}
+
+// Specialization of AccumulateWeightedRows for a single RGBA texel.
+static void AccumulateWeightedTexels(
+    float*          dst,
+    const float*    src,
+    const float*    weights,
+    std::uint32_t   numWeights)
+{
+    float rgba[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for_range(k, numWeights)
+    {
+        const float w = weights[k];
+        rgba[0] += src[k*4 + 0] * w;
+        rgba[1] += src[k*4 + 1] * w;
+        rgba[2] += src[k*4 + 2] * w;
+        rgba[3] += src[k*4 + 3] * w;
+    }
+    dst[0] = rgba[0];
+    dst[1] = rgba[1];
+    dst[2] = rgba[2];
+    dst[3] = rgba[3];
+}
+
+/*
+Resamples a single dimension of the RGBA image. The image is interpreted as array of 'numOuter' blocks, each with 'srcSize' elements,
+where each element has 'elementSize' floats. This covers all dimensions: the width has elements of a single texel, the height has elements of a row,
+and the depth has elements of a slice. Each destination element is computed independently, so the work is distributed over all destination elements.
+*/
+static void ResampleImageDimension(
+    std::vector<float>&         dst,
+    const std::vector<float>&   src,
+    std::size_t                 numOuter,
+    std::uint32_t               srcSize,
+    std::uint32_t               dstSize,
+    std::size_t                 elementSize,
+    const ResampleFilter        filter,
+    unsigned                    threadCount)
+{
+    ResampleWeightTable table;
+    BuildResampleWeightTable(table, srcSize, dstSize, filter);
+
+    dst.resize(numOuter * dstSize * elementSize);
+
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            for_subrange(idx, begin, end)
+            {
+                const std::size_t               outer   = idx / dstSize;
+                const ResampleContribution&     contrib = table.contributions[idx % dstSize];
+                const float*                    srcElem = &src[(outer * srcSize + contrib.first) * elementSize];
+                const float*                    weights = &table.weights[contrib.weightOffset];
+
+                if (elementSize == 4)
+                    AccumulateWeightedTexels(&dst[idx * 4], srcElem, weights, contrib.count);
+                else
+                    AccumulateWeightedRows(&dst[idx * elementSize], srcElem, elementSize, elementSize, weights, contrib.count);
+            }
+        },
+        numOuter * dstSize,
+        threadCount,
+        static_cast<unsigned>(std::max<std::size_t>(1, 4096 / elementSize))
+    );
+}
+
+static float DecodeSRGB(float c)
+{
+    return (c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f));
+}
+
+static float EncodeSRGB(float c)
+{
+    return (c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f);
+}
+
+// Converts the color components (but not alpha) of all RGBA texels between sRGB and linear space.
+static void TransformSRGB(std::vector<float>& texels, bool encode, unsigned threadCount)
+{
+    DoConcurrentRange(
+        [&texels, encode](std::size_t begin, std::size_t end)
+        {
+            for_subrange(i, begin, end)
+            {
+                float* rgb = &texels[i * 4];
+                for_range(c, 3)
+                    rgb[c] = (encode ? EncodeSRGB(std::max(0.0f, rgb[c])) : DecodeSRGB(rgb[c]));
+            }
+        },
+        texels.size() / 4,
+        threadCount
+    );
+}
+
+static bool IsNormalizedIntegerDataType(const DataType dataType)
+{
+    return (dataType >= DataType::Int8 && dataType <= DataType::UInt32);
+}
+
+// Returns true if the image can take the fast path for 8-bit images with alpha in the last component.
+static bool IsRGBA8ImageView(const ImageView& imageView)
+{
+    return
+    (
+        imageView.dataType == DataType::UInt8 &&
+        (imageView.format == ImageFormat::RGBA || imageView.format == ImageFormat::BGRA)
+    );
+}
+
+// Decodes 8-bit texels into RGBA floats with a lookup table for the color components.
+static void ReadRGBA8Texels(std::vector<float>& texels, const std::uint8_t* src, bool isSRGB, unsigned threadCount)
+{
+    float colorTable[256], alphaTable[256];
+    for_range(i, 256)
+    {
+        alphaTable[i] = static_cast<float>(i) / 255.0f;
+        colorTable[i] = (isSRGB ? DecodeSRGB(alphaTable[i]) : alphaTable[i]);
+    }
+
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            for_subrange(i, begin, end)
+            {
+                texels[i*4 + 0] = colorTable[src[i*4 + 0]];
+                texels[i*4 + 1] = colorTable[src[i*4 + 1]];
+                texels[i*4 + 2] = colorTable[src[i*4 + 2]];
+                texels[i*4 + 3] = alphaTable[src[i*4 + 3]];
+            }
+        },
+        texels.size() / 4,
+        threadCount
+    );
+}
+
+static std::uint8_t RoundUNorm8(float value)
+{
+    return static_cast<std::uint8_t>(std::max(0.0f, std::min(value, 1.0f)) * 255.0f + 0.5f);
+}
+
+// Encodes RGBA floats into 8-bit texels with rounding to the nearest value.
+static void WriteRGBA8Texels(std::uint8_t* dst, const std::vector<float>& texels, bool isSRGB, unsigned threadCount)
+{
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            for_subrange(i, begin, end)
+            {
+                for_range(c, 3)
+                {
+                    const float color = texels[i*4 + c];
+                    dst[i*4 + c] = RoundUNorm8(isSRGB ? EncodeSRGB(std::max(0.0f, color)) : color);
+                }
+                dst[i*4 + 3] = RoundUNorm8(texels[i*4 + 3]);
+            }
+        },
+        texels.size() / 4,
+        threadCount
+    );
+}
+
+// Converts the source image into RGBA floats in linear space.
+static void ReadResampleTexels(std::vector<float>& texels, const ImageView& srcImageView, bool isSRGB, unsigned threadCount)
+{
+    if (IsRGBA8ImageView(srcImageView))
+        ReadRGBA8Texels(texels, static_cast<const std::uint8_t*>(srcImageView.data), isSRGB, threadCount);
+    else
+    {
+        const MutableImageView dstImageView{ ImageFormat::RGBA, DataType::Float32, texels.data(), texels.size() * sizeof(float) };
+        if (!ConvertImageBuffer(srcImageView, dstImageView, threadCount))
+            ::memcpy(texels.data(), srcImageView.data, srcImageView.dataSize);
+        if (isSRGB)
+            TransformSRGB(texels, false, threadCount);
+    }
+}
+
+// Converts the RGBA floats in linear space back into the destination image.
+static void WriteResampleTexels(const MutableImageView& dstImageView, std::vector<float>& texels, bool isSRGB, unsigned threadCount)
+{
+    if (IsRGBA8ImageView(ImageView{ dstImageView.format, dstImageView.dataType, dstImageView.data, dstImageView.dataSize }))
+        WriteRGBA8Texels(static_cast<std::uint8_t*>(dstImageView.data), texels, isSRGB, threadCount);
+    else
+    {
+        if (isSRGB)
+            TransformSRGB(texels, true, threadCount);
+
+        /* Clamp overshooting values for normalized integer data types */
+        if (IsNormalizedIntegerDataType(dstImageView.dataType))
+        {
+            for (float& value : texels)
+                value = std::max(0.0f, std::min(value, 1.0f));
+        }
+
+        const ImageView srcImageView{ ImageFormat::RGBA, DataType::Float32, texels.data(), texels.size() * sizeof(float) };
+        if (!ConvertImageBuffer(srcImageView, dstImageView, threadCount))
+            ::memcpy(dstImageView.data, texels.data(), dstImageView.dataSize);
+    }
+}
+
+
+/* ----- Public functions ----- */
+
+LLGL_EXPORT DynamicByteArray ResampleImageBuffer(
+    const ImageView&    srcImageView,
+    const Extent3D&     srcExtent,
+    const Extent3D&     dstExtent,
+    ResampleFilter      filter,
+    bool                isSRGB,
+    unsigned            threadCount)
+{
+    if (srcExtent == dstExtent)
+        return nullptr;
+
+    /* Validate input parameters */
+    LLGL_ASSERT_PTR(srcImageView.data);
+
+    if (IsCompressedFormat(srcImageView.format))
+        LLGL_TRAP("cannot resample compressed image formats");
+    if (IsDepthOrStencilFormat(srcImageView.format))
+        LLGL_TRAP("cannot resample depth-stencil image formats");
+    if (srcExtent.width == 0 || srcExtent.height == 0 || srcExtent.depth == 0)
+        LLGL_TRAP("cannot resample image with empty source extent");
+    if (dstExtent.width == 0 || dstExtent.height == 0 || dstExtent.depth == 0)
+        LLGL_TRAP("cannot resample image with empty destination extent");
+
+    const std::size_t srcNumTexels  = static_cast<std::size_t>(srcExtent.width) * srcExtent.height * srcExtent.depth;
+    const std::size_t srcImageSize  = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, srcNumTexels);
+
+    if (srcImageView.dataSize < srcImageSize)
+        LLGL_TRAP("cannot resample image with source buffer size mismatch");
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Convert source image into RGBA floats */
+    std::vector<float> texels(srcNumTexels * 4);
+    ReadResampleTexels(texels, ImageView{ srcImageView.format, srcImageView.dataType, srcImageView.data, srcImageSize }, isSRGB, threadCount);
+
+    /* Resample each dimension that changes in a separate pass */
+    std::vector<float> texelsTemp;
+    Extent3D extent = srcExtent;
+
+    if (dstExtent.width != extent.width)
+    {
+        const std::size_t numRows = static_cast<std::size_t>(extent.height) * extent.depth;
+        ResampleImageDimension(texelsTemp, texels, numRows, extent.width, dstExtent.width, 4, filter, threadCount);
+        texels.swap(texelsTemp);
+        extent.width = dstExtent.width;
+    }
+
+    if (dstExtent.height != extent.height)
+    {
+        const std::size_t rowSize = static_cast<std::size_t>(extent.width) * 4;
+        ResampleImageDimension(texelsTemp, texels, extent.depth, extent.height, dstExtent.height, rowSize, filter, threadCount);
+        texels.swap(texelsTemp);
+        extent.height = dstExtent.height;
+    }
+
+    if (dstExtent.depth != extent.depth)
+    {
+        const std::size_t sliceSize = static_cast<std::size_t>(extent.width) * extent.height * 4;
+        ResampleImageDimension(texelsTemp, texels, 1, extent.depth, dstExtent.depth, sliceSize, filter, threadCount);
+        texels.swap(texelsTemp);
+        extent.depth = dstExtent.depth;
+    }
+
+    /* Convert RGBA floats back into the source format */
+    const std::size_t   dstImageSize    = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, texels.size() / 4);
+    DynamicByteArray    dstImage        = DynamicByteArray{ dstImageSize, UninitializeTag{} };
+    WriteResampleTexels(MutableImageView{ srcImageView.format, srcImageView.dataType, dstImage.get(), dstImageSize }, texels, isSRGB, threadCount);
+
+    return dstImage;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,522 @@
+/*
+ * IndirectDrawCuller.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/IndirectDrawCuller.h>
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Shader.h>
+#include <LLGL/Texture.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Report.h>
+#include "Assertion.h"
+#include "Exception.h"
+#include "CoreUtils.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Number of threads per work group; must match the built-in shaders.
+static constexpr std::uint32_t g_cullingWorkGroupSize = 64;
+
+// Constant buffer layout for the culling shader.
+struct CullingParams
+{
+    float           frustumPlanes[6][4];
+    float           viewProjection[4][4];
+    std::uint32_t   numObjects;
+    std::uint32_t   hiZNumMips;             // Number of Hi-Z mip levels; 0 disables occlusion culling.
+    std::uint32_t   hiZWidth;
+    std::uint32_t   hiZHeight;
+    std::uint32_t   flipY;                  // Non-zero if the Hi-Z texture rows start at the top of the screen.
+    std::uint32_t   depthMinusOneToOne;     // Non-zero if the normalized device Z coordinate is in the range [-1, 1].
+    std::uint32_t   padding[2];
+};
+
+// Storage buffer layout of a single input object for the culling shader.
+struct CullingObject
+{
+    float                           boundingSphere[4];
+    DrawIndexedIndirectArguments    drawArgs;
+    std::uint32_t                   padding[3];
+};
+
+static_assert(sizeof(CullingParams) == 192, "CullingParams must be 192 bytes");
+static_assert(sizeof(CullingObject) == 48, "CullingObject must be 48 bytes");
+static_assert(sizeof(DrawIndexedIndirectArguments) == 20, "DrawIndexedIndirectArguments must be 20 bytes");
+
+static const char* g_cullingShaderGLSL =
+    "#version 430 core\n"
+    "layout(local_size_x = 64) in;\n"
+    "layout(std140, binding = 0) uniform CullingParams {\n"
+    "    vec4 frustumPlanes[6];\n"
+    "    mat4 viewProjection;\n"
+    "    uint numObjects;\n"
+    "    uint hiZNumMips;\n"
+    "    uint hiZWidth;\n"
+    "    uint hiZHeight;\n"
+    "    uint flipY;\n"
+    "    uint depthMinusOneToOne;\n"
+    "};\n"
+    "struct CullingObject {\n"
+    "    vec4 boundingSphere;\n"
+    "    uint drawArgs[5];\n"
+    "    uint padding[3];\n"
+    "};\n"
+    "struct DrawArgs {\n"
+    "    uint value[5];\n"
+    "};\n"
+    "layout(std430, binding = 1) readonly buffer Objects { CullingObject objects[]; };\n"
+    "layout(std430, binding = 2) writeonly buffer OutDrawArgs { DrawArgs outDrawArgs[]; };\n"
+    "layout(std430, binding = 3) buffer OutDrawCount { uint outDrawCount; };\n"
+    "layout(binding = 4) uniform sampler2D hiZTexture;\n"
+    "bool IsOccluded(vec4 sphere) {\n"
+    "    if (hiZNumMips == 0u)\n"
+    "        return false;\n"
+    "    vec3 minNDC = vec3(1.0e30);\n"
+    "    vec3 maxNDC = vec3(-1.0e30);\n"
+    "    for (int i = 0; i < 8; ++i) {\n"
+    "        vec3 corner = sphere.xyz + sphere.w * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);\n"
+    "        vec4 clipPos = viewProjection * vec4(corner, 1.0);\n"
+    "        if (clipPos.w <= 0.0)\n"
+    "            return false;\n"
+    "        vec3 ndc = clipPos.xyz / clipPos.w;\n"
+    "        minNDC = min(minNDC, ndc);\n"
+    "        maxNDC = max(maxNDC, ndc);\n"
+    "    }\n"
+    "    float nearestDepth = (depthMinusOneToOne != 0u ? minNDC.z * 0.5 + 0.5 : minNDC.z);\n"
+    "    vec2 minUV = clamp(minNDC.xy * 0.5 + 0.5, 0.0, 1.0);\n"
+    "    vec2 maxUV = clamp(maxNDC.xy * 0.5 + 0.5, 0.0, 1.0);\n"
+    "    if (flipY != 0u) {\n"
+    "        float minV = 1.0 - maxUV.y;\n"
+    "        maxUV.y = 1.0 - minUV.y;\n"
+    "        minUV.y = minV;\n"
+    "    }\n"
+    "    vec2 size = (maxUV - minUV) * vec2(hiZWidth, hiZHeight);\n"
+    "    int mip = int(min(uint(ceil(log2(max(max(size.x, size.y), 1.0)))), hiZNumMips - 1u));\n"
+    "    ivec2 mipSize = max(ivec2(hiZWidth, hiZHeight) >> mip, ivec2(1));\n"
+    "    ivec2 minTexel = clamp(ivec2(minUV * vec2(mipSize)), ivec2(0), mipSize - 1);\n"
+    "    ivec2 maxTexel = clamp(ivec2(maxUV * vec2(mipSize)), ivec2(0), mipSize - 1);\n"
+    "    float farthestDepth = 0.0;\n"
+    "    for (int y = minTexel.y; y <= maxTexel.y; ++y) {\n"
+    "        for (int x = minTexel.x; x <= maxTexel.x; ++x)\n"
+    "            farthestDepth = max(farthestDepth, texelFetch(hiZTexture, ivec2(x, y), mip).r);\n"
+    "    }\n"
+    "    return (nearestDepth > farthestDepth);\n"
+    "}\n"
+    "void main() {\n"
+    "    uint id = gl_GlobalInvocationID.x;\n"
+    "    if (id >= numObjects)\n"
+    "        return;\n"
+    "    vec4 sphere = objects[id].boundingSphere;\n"
+    "    for (int i = 0; i < 6; ++i) {\n"
+    "        if (dot(frustumPlanes[i].xyz, sphere.xyz) + frustumPlanes[i].w < -sphere.w)\n"
+    "            return;\n"
+    "    }\n"
+    "    if (IsOccluded(sphere))\n"
+    "        return;\n"
+    "    uint idx = atomicAdd(outDrawCount, 1u);\n"
+    "    for (int i = 0; i < 5; ++i)\n"
+    "        outDrawArgs[idx].value[i] = objects[id].drawArgs[i];\n"
+    "}\n"
+;
+
+static const char* g_cullingShaderHLSL =
+    "cbuffer CullingParams : register(b0) {\n"
+    "    float4 frustumPlanes[6];\n"
+    "    float4x4 viewProjection;\n"
+    "    uint numObjects;\n"
+    "    uint hiZNumMips;\n"
+    "    uint hiZWidth;\n"
+    "    uint hiZHeight;\n"
+    "    uint flipY;\n"
+    "    uint depthMinusOneToOne;\n"
+    "};\n"
+    "struct CullingObject {\n"
+    "    float4 boundingSphere;\n"
+    "    uint drawArgs[5];\n"
+    "    uint padding[3];\n"
+    "};\n"
+    "struct DrawArgs {\n"
+    "    uint value[5];\n"
+    "};\n"
+    "RWStructuredBuffer<CullingObject> objects : register(u1);\n"
+    "RWStructuredBuffer<DrawArgs> outDrawArgs : register(u2);\n"
+    "RWStructuredBuffer<uint> outDrawCount : register(u3);\n"
+    "Texture2D<float> hiZTexture : register(t4);\n"
+    "bool IsOccluded(float4 sphere) {\n"
+    "    if (hiZNumMips == 0)\n"
+    "        return false;\n"
+    "    float3 minNDC = 1.0e30;\n"
+    "    float3 maxNDC = -1.0e30;\n"
+    "    [unroll] for (int i = 0; i < 8; ++i) {\n"
+    "        float3 corner = sphere.xyz + sphere.w * float3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);\n"
+    "        float4 clipPos = mul(viewProjection, float4(corner, 1.0));\n"
+    "        if (clipPos.w <= 0.0)\n"
+    "            return false;\n"
+    "        float3 ndc = clipPos.xyz / clipPos.w;\n"
+    "        minNDC = min(minNDC, ndc);\n"
+    "        maxNDC = max(maxNDC, ndc);\n"
+    "    }\n"
+    "    float nearestDepth = (depthMinusOneToOne != 0 ? minNDC.z * 0.5 + 0.5 : minNDC.z);\n"
+    "    float2 minUV = saturate(minNDC.xy * 0.5 + 0.5);\n"
+    "    float2 maxUV = saturate(maxNDC.xy * 0.5 + 0.5);\n"
+    "    if (flipY != 0) {\n"
+    "        float minV = 1.0 - maxUV.y;\n"
+    "        maxUV.y = 1.0 - minUV.y;\n"
+    "        minUV.y = minV;\n"
+    "    }\n"
+    "    float2 size = (maxUV - minUV) * float2(hiZWidth, hiZHeight);\n"
+    "    int mip = (int)min((uint)ceil(log2(max(max(size.x, size.y), 1.0))), hiZNumMips - 1);\n"
+    "    int2 mipSize = max(int2(hiZWidth, hiZHeight) >> mip, 1);\n"
+    "    int2 minTexel = clamp(int2(minUV * float2(mipSize)), 0, mipSize - 1);\n"
+    "    int2 maxTexel = clamp(int2(maxUV * float2(mipSize)), 0, mipSize - 1);\n"
+    "    float farthestDepth = 0.0;\n"
+    "    for (int y = minTexel.y; y <= maxTexel.y; ++y) {\n"
+    "        for (int x = minTexel.x; x <= maxTexel.x; ++x)\n"
+    "            farthestDepth = max(farthestDepth, hiZTexture.Load(int3(x, y, mip)));\n"
+    "    }\n"
+    "    return (nearestDepth > farthestDepth);\n"
+    "}\n"
+    "[numthreads(64, 1, 1)]\n"
+    "void CullCS(uint3 threadID : SV_DispatchThreadID) {\n"
+    "    uint id = threadID.x;\n"
+    "    if (id >= numObjects)\n"
+    "        return;\n"
+    "    float4 sphere = objects[id].boundingSphere;\n"
+    "    [unroll] for (int i = 0; i < 6; ++i) {\n"
+    "        if (dot(frustumPlanes[i].xyz, sphere.xyz) + frustumPlanes[i].w < -sphere.w)\n"
+    "            return;\n"
+    "    }\n"
+    "    if (IsOccluded(sphere))\n"
+    "        return;\n"
+    "    uint idx;\n"
+    "    InterlockedAdd(outDrawCount[0], 1u, idx);\n"
+    "    DrawArgs args;\n"
+    "    [unroll] for (int j = 0; j < 5; ++j)\n"
+    "        args.value[j] = objects[id].drawArgs[j];\n"
+    "    outDrawArgs[idx] = args;\n"
+    "}\n"
+;
+
+struct IndirectDrawCuller::Pimpl
+{
+    RenderSystem*   renderSystem        = nullptr;
+    std::uint32_t   maxNumObjects       = 0;
+    std::uint32_t   numCulledObjects    = 0;        // Number of objects of the last culling pass
+    Buffer*         paramsBuffer        = nullptr;
+    Buffer*         objectsBuffer       = nullptr;
+    Buffer*         drawArgsBuffer      = nullptr;
+    Buffer*         drawCountBuffer     = nullptr;
+    Texture*        hiZTexture          = nullptr;
+    bool            ownsHiZTexture      = false;    // Placeholder texture if no Hi-Z texture is specified
+    std::uint32_t   hiZNumMips          = 0;
+    std::uint32_t   hiZWidth            = 0;
+    std::uint32_t   hiZHeight           = 0;
+    bool            flipY               = false;
+    bool            depthMinusOneToOne  = false;
+    Shader*         computeShader       = nullptr;
+    bool            ownsComputeShader   = false;
+    PipelineLayout* pipelineLayout      = nullptr;
+    PipelineState*  pipelineState       = nullptr;
+    ResourceHeap*   resourceHeap        = nullptr;
+
+    // Encodes the culling pass with the specified parameters; Only the number of objects must be validated by the caller.
+    void EncodeCullingPass(CommandBuffer& commandBuffer, const CullingParams& params);
+};
+
+void IndirectDrawCuller::Pimpl::EncodeCullingPass(CommandBuffer& commandBuffer, const CullingParams& params)
+{
+    commandBuffer.UpdateBuffer(*paramsBuffer, 0, &params, sizeof(params));
+
+    /* Reset draw count; visible objects are appended atomically by the culling shader */
+    commandBuffer.FillBuffer(*drawCountBuffer, 0, 0, sizeof(std::uint32_t));
+
+    if (params.numObjects > 0)
+    {
+        commandBuffer.SetPipelineState(*pipelineState);
+        commandBuffer.SetResourceHeap(*resourceHeap);
+        commandBuffer.Dispatch(DivideRoundUp(params.numObjects, g_cullingWorkGroupSize), 1, 1);
+    }
+
+    numCulledObjects = params.numObjects;
+}
+
+static bool HasShadingLanguage(const RenderSystem& renderSystem, const ShadingLanguage language)
+{
+    const auto& languages = renderSystem.GetRenderingCaps().shadingLanguages;
+    return (std::find(languages.begin(), languages.end(), language) != languages.end());
+}
+
+static Shader* CreateBuiltinCullingShader(RenderSystem& renderSystem)
+{
+    ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.debugName    = "IndirectDrawCuller.Shader";
+        shaderDesc.type         = ShaderType::Compute;
+        shaderDesc.sourceType   = ShaderSourceType::CodeString;
+    }
+
+    if (HasShadingLanguage(renderSystem, ShadingLanguage::GLSL_430))
+        shaderDesc.source = g_cullingShaderGLSL;
+    else if (HasShadingLanguage(renderSystem, ShadingLanguage::HLSL_5_0))
+    {
+        shaderDesc.source       = g_cullingShaderHLSL;
+        shaderDesc.entryPoint   = "CullCS";
+        shaderDesc.profile      = "cs_5_0";
+    }
+    else
+        LLGL_TRAP("no built-in culling shader for this renderer; IndirectDrawCullerDescriptor::computeShader must be specified");
+
+    Shader* shader = renderSystem.CreateShader(shaderDesc);
+    if (const Report* report = shader->GetReport())
+    {
+        if (report->HasErrors())
+            LLGL_TRAP("failed to compile built-in culling shader:\n%s", report->GetText());
+    }
+    return shader;
+}
+
+IndirectDrawCuller::IndirectDrawCuller(RenderSystem& renderSystem, const IndirectDrawCullerDescriptor& cullerDesc) :
+    pimpl_ { new Pimpl{} }
+{
+    LLGL_ASSERT(cullerDesc.maxNumObjects > 0, "indirect draw culler requires at least one object");
+
+    pimpl_->renderSystem    = &renderSystem;
+    pimpl_->maxNumObjects   = cullerDesc.maxNumObjects;
+
+    /* Create input and output buffers */
+    BufferDescriptor paramsBufferDesc;
+    {
+        paramsBufferDesc.debugName  = "IndirectDrawCuller.Params";
+        paramsBufferDesc.size       = sizeof(CullingParams);
+        paramsBufferDesc.bindFlags  = BindFlags::ConstantBuffer | BindFlags::CopyDst;
+    }
+    pimpl_->paramsBuffer = renderSystem.CreateBuffer(paramsBufferDesc);
+
+    BufferDescriptor objectsBufferDesc;
+    {
+        objectsBufferDesc.debugName = "IndirectDrawCuller.Objects";
+        objectsBufferDesc.size      = sizeof(CullingObject) * cullerDesc.maxNumObjects;
+        objectsBufferDesc.stride    = sizeof(CullingObject);
+        objectsBufferDesc.bindFlags = BindFlags::Storage | BindFlags::CopyDst;
+    }
+    pimpl_->objectsBuffer = renderSystem.CreateBuffer(objectsBufferDesc);
+
+    BufferDescriptor drawArgsBufferDesc;
+    {
+        drawArgsBufferDesc.debugName    = "IndirectDrawCuller.DrawArgs";
+        drawArgsBufferDesc.size         = sizeof(DrawIndexedIndirectArguments) * cullerDesc.maxNumObjects;
+        drawArgsBufferDesc.stride       = sizeof(DrawIndexedIndirectArguments);
+        drawArgsBufferDesc.bindFlags    = BindFlags::Storage | BindFlags::IndirectBuffer;
+    }
+    pimpl_->drawArgsBuffer = renderSystem.CreateBuffer(drawArgsBufferDesc);
+
+    BufferDescriptor drawCountBufferDesc;
+    {
+        drawCountBufferDesc.debugName   = "IndirectDrawCuller.DrawCount";
+        drawCountBufferDesc.size        = sizeof(std::uint32_t);
+        drawCountBufferDesc.stride      = sizeof(std::uint32_t);
+        drawCountBufferDesc.bindFlags   = BindFlags::Storage | BindFlags::IndirectBuffer | BindFlags::CopyDst;
+    }
+    pimpl_->drawCountBuffer = renderSystem.CreateBuffer(drawCountBufferDesc);
+
+    /* Use Hi-Z texture for occlusion culling or create a placeholder, since the pipeline layout always includes the texture */
+    if (cullerDesc.hiZTexture != nullptr)
+    {
+        LLGL_ASSERT(cullerDesc.hiZTexture->GetFormat() == Format::R32Float, "Hi-Z texture of indirect draw culler must have format R32Float");
+        const TextureDescriptor hiZTextureDesc = cullerDesc.hiZTexture->GetDesc();
+        pimpl_->hiZTexture  = cullerDesc.hiZTexture;
+        pimpl_->hiZNumMips  = NumMipLevels(hiZTextureDesc);
+        pimpl_->hiZWidth    = hiZTextureDesc.extent.width;
+        pimpl_->hiZHeight   = hiZTextureDesc.extent.height;
+    }
+    else
+    {
+        TextureDescriptor hiZTextureDesc;
+        {
+            hiZTextureDesc.debugName    = "IndirectDrawCuller.HiZPlaceholder";
+            hiZTextureDesc.type         = TextureType::Texture2D;
+            hiZTextureDesc.bindFlags    = BindFlags::Sampled;
+            hiZTextureDesc.format       = Format::R32Float;
+            hiZTextureDesc.extent       = { 1, 1, 1 };
+            hiZTextureDesc.mipLevels    = 1;
+        }
+        pimpl_->hiZTexture      = renderSystem.CreateTexture(hiZTextureDesc);
+        pimpl_->ownsHiZTexture  = true;
+    }
+
+    /* Match screen-space conventions of the renderer to map normalized device coordinates into the Hi-Z texture */
+    const RenderingCapabilities& caps = renderSystem.GetRenderingCaps();
+    pimpl_->flipY               = (caps.screenOrigin == ScreenOrigin::UpperLeft);
+    pimpl_->depthMinusOneToOne  = (caps.clippingRange == ClippingRange::MinusOneToOne);
+
+    /* Create compute shader unless a custom shader is specified */
+    if (cullerDesc.computeShader != nullptr)
+        pimpl_->computeShader = cullerDesc.computeShader;
+    else
+    {
+        pimpl_->computeShader       = CreateBuiltinCullingShader(renderSystem);
+        pimpl_->ownsComputeShader   = true;
+    }
+
+    /* Create compute pipeline with a resource heap that synchronizes the storage buffers */
+    pimpl_->pipelineLayout = renderSystem.CreatePipelineLayout(
+        Parse(
+            "heap{"
+            "  cbuffer(CullingParams@0):comp,"
+            "  rwbuffer(Objects@1):comp,"
+            "  rwbuffer(OutDrawArgs@2):comp,"
+            "  rwbuffer(OutDrawCount@3):comp,"
+            "  texture(HiZ@4):comp,"
+            "}"
+        )
+    );
+
+    ComputePipelineDescriptor pipelineDesc;
+    {
+        pipelineDesc.debugName      = "IndirectDrawCuller.Pipeline";
+        pipelineDesc.pipelineLayout = pimpl_->pipelineLayout;
+        pipelineDesc.computeShader  = pimpl_->computeShader;
+    }
+    pimpl_->pipelineState = renderSystem.CreatePipelineState(pipelineDesc);
+
+    const ResourceViewDescriptor resourceViews[] =
+    {
+        pimpl_->paramsBuffer, pimpl_->objectsBuffer, pimpl_->drawArgsBuffer, pimpl_->drawCountBuffer, pimpl_->hiZTexture
+    };
+    ResourceHeapDescriptor resourceHeapDesc;
+    {
+        resourceHeapDesc.debugName      = "IndirectDrawCuller.ResourceHeap";
+        resourceHeapDesc.pipelineLayout = pimpl_->pipelineLayout;
+        resourceHeapDesc.barrierFlags   = BarrierFlags::Storage;
+    }
+    pimpl_->resourceHeap = renderSystem.CreateResourceHeap(resourceHeapDesc, resourceViews);
+}
+
+IndirectDrawCuller::~IndirectDrawCuller()
+{
+    RenderSystem& renderSystem = *pimpl_->renderSystem;
+    renderSystem.Release(*pimpl_->resourceHeap);
+    renderSystem.Release(*pimpl_->pipelineState);
+    renderSystem.Release(*pimpl_->pipelineLayout);
+    if (pimpl_->ownsComputeShader)
+        renderSystem.Release(*pimpl_->computeShader);
+    if (pimpl_->ownsHiZTexture)
+        renderSystem.Release(*pimpl_->hiZTexture);
+    renderSystem.Release(*pimpl_->drawCountBuffer);
+    renderSystem.Release(*pimpl_->drawArgsBuffer);
+    renderSystem.Release(*pimpl_->objectsBuffer);
+    renderSystem.Release(*pimpl_->paramsBuffer);
+    delete pimpl_;
+}
+
+void IndirectDrawCuller::WriteObjects(std::uint32_t firstObject, std::uint32_t numObjects, const IndirectDrawCullerObject* objects)
+{
+    LLGL_ASSERT_RANGE(firstObject + numObjects, pimpl_->maxNumObjects);
+    if (numObjects == 0)
+        return;
+
+    LLGL_ASSERT_PTR(objects);
+
+    /* Convert objects into the padded storage buffer layout of the culling shader */
+    std::vector<CullingObject> cullingObjects(numObjects);
+    for_range(i, numObjects)
+    {
+        CullingObject& dst = cullingObjects[i];
+        ::memcpy(dst.boundingSphere, objects[i].boundingSphere, sizeof(dst.boundingSphere));
+        dst.drawArgs = objects[i].drawArgs;
+        dst.padding[0] = 0;
+        dst.padding[1] = 0;
+        dst.padding[2] = 0;
+    }
+
+    pimpl_->renderSystem->WriteBuffer(
+        *pimpl_->objectsBuffer,
+        sizeof(CullingObject) * firstObject,
+        cullingObjects.data(),
+        sizeof(CullingObject) * numObjects
+    );
+}
+
+void IndirectDrawCuller::Cull(CommandBuffer& commandBuffer, const float frustumPlanes[6][4], std::uint32_t numObjects)
+{
+    LLGL_ASSERT_RANGE(numObjects, pimpl_->maxNumObjects);
+
+    /* Hi-Z parameters remain zero, which disables the occlusion test */
+    CullingParams params = {};
+    {
+        ::memcpy(params.frustumPlanes, frustumPlanes, sizeof(params.frustumPlanes));
+        params.numObjects = numObjects;
+    }
+    pimpl_->EncodeCullingPass(commandBuffer, params);
+}
+
+void IndirectDrawCuller::Cull(
+    CommandBuffer&  commandBuffer,
+    const float     frustumPlanes[6][4],
+    const float     viewProjection[4][4],
+    std::uint32_t   numObjects)
+{
+    LLGL_ASSERT_RANGE(numObjects, pimpl_->maxNumObjects);
+    LLGL_ASSERT(!pimpl_->ownsHiZTexture, "occlusion culling requires IndirectDrawCullerDescriptor::hiZTexture");
+
+    CullingParams params = {};
+    {
+        ::memcpy(params.frustumPlanes, frustumPlanes, sizeof(params.frustumPlanes));
+        ::memcpy(params.viewProjection, viewProjection, sizeof(params.viewProjection));
+        params.numObjects           = numObjects;
+        params.hiZNumMips           = pimpl_->hiZNumMips;
+        params.hiZWidth             = pimpl_->hiZWidth;
+        params.hiZHeight            = pimpl_->hiZHeight;
+        params.flipY                = (pimpl_->flipY ? 1u : 0u);
+        params.depthMinusOneToOne   = (pimpl_->depthMinusOneToOne ? 1u : 0u);
+    }
+    pimpl_->EncodeCullingPass(commandBuffer, params);
+}
+
+void IndirectDrawCuller::Draw(CommandBuffer& commandBuffer)
+{
+    if (pimpl_->numCulledObjects > 0)
+    {
+        commandBuffer.DrawIndexedIndirectCount(
+            *pimpl_->drawArgsBuffer,
+            0,
+            *pimpl_->drawCountBuffer,
+            0,
+            pimpl_->numCulledObjects,
+            sizeof(DrawIndexedIndirectArguments)
+        );
+    }
+}
+
+Buffer* IndirectDrawCuller::GetDrawArgsBuffer() const
+{
+    return pimpl_->drawArgsBuffer;
+}
+
+Buffer* IndirectDrawCuller::GetDrawCountBuffer() const
+{
+    return pimpl_->drawCountBuffer;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
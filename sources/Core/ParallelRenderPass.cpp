@@ -0,0 +1,107 @@
+/*
+ * ParallelRenderPass.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ParallelRenderPass.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandBufferFlags.h>
+#include "Assertion.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+struct ParallelRenderPassEncoder::Pimpl
+{
+    RenderSystem*               renderSystem        = nullptr;
+    const RenderPass*           renderPass          = nullptr;
+    std::vector<CommandBuffer*> encoders;
+    CommandBuffer*              primaryCmdBuffer    = nullptr;  // Primary command buffer between Begin and End
+};
+
+ParallelRenderPassEncoder::ParallelRenderPassEncoder(RenderSystem& renderSystem, const RenderPass& renderPass, std::uint32_t numEncoders) :
+    pimpl_ { new Pimpl{} }
+{
+    LLGL_ASSERT(numEncoders > 0, "parallel render pass requires at least one encoder");
+
+    pimpl_->renderSystem    = &renderSystem;
+    pimpl_->renderPass      = &renderPass;
+
+    /*
+    Create secondary command buffers that continue the render pass of the primary command buffer.
+    Secondary command buffers cycle through their native command buffers without waiting,
+    so allocate as many as a primary command buffer can have in flight by default.
+    */
+    CommandBufferDescriptor cmdBufferDesc;
+    {
+        cmdBufferDesc.flags             = CommandBufferFlags::Secondary;
+        cmdBufferDesc.renderPass        = &renderPass;
+        cmdBufferDesc.numNativeBuffers  = cmdBufferDesc.maxNumNativeBuffers;
+    }
+    pimpl_->encoders.reserve(numEncoders);
+    for_range(i, numEncoders)
+        pimpl_->encoders.push_back(renderSystem.CreateCommandBuffer(cmdBufferDesc));
+}
+
+ParallelRenderPassEncoder::~ParallelRenderPassEncoder()
+{
+    for (CommandBuffer* encoder : pimpl_->encoders)
+        pimpl_->renderSystem->Release(*encoder);
+    delete pimpl_;
+}
+
+void ParallelRenderPassEncoder::Begin(
+    CommandBuffer&      primaryCommandBuffer,
+    RenderTarget&       renderTarget,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    LLGL_ASSERT(pimpl_->primaryCmdBuffer == nullptr, "parallel render pass is still active; missing call to <LLGL::ParallelRenderPassEncoder::End>");
+
+    pimpl_->primaryCmdBuffer = &primaryCommandBuffer;
+    primaryCommandBuffer.BeginParallelRenderPass(renderTarget, pimpl_->renderPass, numClearValues, clearValues, swapBufferIndex);
+
+    /* Begin all encoders here, so worker threads only record draw commands */
+    for (CommandBuffer* encoder : pimpl_->encoders)
+        encoder->Begin();
+}
+
+void ParallelRenderPassEncoder::End()
+{
+    LLGL_ASSERT(pimpl_->primaryCmdBuffer != nullptr, "parallel render pass is not active; missing call to <LLGL::ParallelRenderPassEncoder::Begin>");
+
+    /* End all encoders and execute them in the order of their indices */
+    for (CommandBuffer* encoder : pimpl_->encoders)
+        encoder->End();
+    for (CommandBuffer* encoder : pimpl_->encoders)
+        pimpl_->primaryCmdBuffer->Execute(*encoder);
+
+    pimpl_->primaryCmdBuffer->EndRenderPass();
+    pimpl_->primaryCmdBuffer = nullptr;
+}
+
+CommandBuffer* ParallelRenderPassEncoder::GetEncoder(std::uint32_t index) const
+{
+    LLGL_ASSERT_UPPER_BOUND(index, static_cast<std::uint32_t>(pimpl_->encoders.size()));
+    return pimpl_->encoders[index];
+}
+
+std::uint32_t ParallelRenderPassEncoder::GetNumEncoders() const
+{
+    return static_cast<std::uint32_t>(pimpl_->encoders.size());
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
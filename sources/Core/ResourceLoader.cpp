@@ -0,0 +1,199 @@
+/*
+ * ResourceLoader.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ResourceLoader.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderSystem.h>
+#include "Assertion.h"
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+struct ResourceLoadJob
+{
+    ResourceLoadTicket              ticket;
+    ResourceLoader::LoadFunction    loadFunction;
+};
+
+// Internal state of the resource loader; separate from ResourceLoader::Pimpl so the loader threads can access it.
+struct ResourceLoaderContext
+{
+    RenderSystem*                           renderSystem        = nullptr;
+
+    // Job queue that is shared with the loader threads
+    mutable std::mutex                      jobMutex;
+    std::condition_variable                 jobSignal;
+    std::condition_variable                 completeSignal;
+    std::queue<ResourceLoadJob>             jobQueue;
+    std::unordered_set<ResourceLoadTicket>  pendingTickets;     // Tickets of all enqueued jobs that have not been completed yet
+    ResourceLoadTicket                      nextTicket          = 1;
+    bool                                    stopLoaders         = false;
+
+    // Startup handshake to determine whether the render system supports loader threads
+    std::uint32_t                           numStartedLoaders   = 0;
+    bool                                    loaderThreadsFailed = false;
+    std::condition_variable                 startSignal;
+
+    std::vector<std::thread>                loaderThreads;
+};
+
+struct ResourceLoader::Pimpl : ResourceLoaderContext
+{
+};
+
+
+/*
+ * Internal functions
+ */
+
+static void LoaderThreadMain(ResourceLoaderContext* ctx)
+{
+    /* Register this thread as loader thread and report the result to the constructor */
+    const bool isLoaderThread = ctx->renderSystem->BeginLoaderThread();
+
+    std::unique_lock<std::mutex> lock{ ctx->jobMutex };
+    ++ctx->numStartedLoaders;
+    if (!isLoaderThread)
+        ctx->loaderThreadsFailed = true;
+    ctx->startSignal.notify_all();
+
+    if (isLoaderThread)
+    {
+        for (;;)
+        {
+            ctx->jobSignal.wait(lock, [ctx]() { return (ctx->stopLoaders || !ctx->jobQueue.empty()); });
+            if (ctx->jobQueue.empty())
+                break;
+
+            ResourceLoadJob job = std::move(ctx->jobQueue.front());
+            ctx->jobQueue.pop();
+
+            /* Invoke load function without holding the lock and make its resources visible to other threads before the ticket is completed */
+            lock.unlock();
+            job.loadFunction(*(ctx->renderSystem));
+            ctx->renderSystem->FlushLoaderThread();
+            lock.lock();
+
+            ctx->pendingTickets.erase(job.ticket);
+            ctx->completeSignal.notify_all();
+        }
+
+        lock.unlock();
+        ctx->renderSystem->EndLoaderThread();
+    }
+}
+
+static void StopLoaderThreads(ResourceLoaderContext& ctx)
+{
+    {
+        std::lock_guard<std::mutex> guard{ ctx.jobMutex };
+        ctx.stopLoaders = true;
+    }
+    ctx.jobSignal.notify_all();
+    for (std::thread& loaderThread : ctx.loaderThreads)
+        loaderThread.join();
+    ctx.loaderThreads.clear();
+}
+
+
+/*
+ * ResourceLoader class
+ */
+
+ResourceLoader::ResourceLoader(RenderSystem& renderSystem, const ResourceLoaderDescriptor& loaderDesc) :
+    pimpl_ { new Pimpl{} }
+{
+    pimpl_->renderSystem = &renderSystem;
+
+    /* Start loader threads and wait until each of them has been registered with the render system */
+    for_range(i, loaderDesc.numLoaderThreads)
+        pimpl_->loaderThreads.push_back(std::thread{ LoaderThreadMain, static_cast<ResourceLoaderContext*>(pimpl_) });
+
+    bool loaderThreadsFailed = false;
+    {
+        std::unique_lock<std::mutex> lock{ pimpl_->jobMutex };
+        pimpl_->startSignal.wait(lock, [this, &loaderDesc]() { return (pimpl_->numStartedLoaders == loaderDesc.numLoaderThreads); });
+        loaderThreadsFailed = pimpl_->loaderThreadsFailed;
+    }
+
+    /* Fall back to synchronous jobs if any of the threads could not be registered as loader thread */
+    if (loaderThreadsFailed)
+        StopLoaderThreads(*pimpl_);
+}
+
+ResourceLoader::~ResourceLoader()
+{
+    /* Loader threads process all remaining jobs before they stop */
+    StopLoaderThreads(*pimpl_);
+    delete pimpl_;
+}
+
+ResourceLoadTicket ResourceLoader::Enqueue(const LoadFunction& loadFunction)
+{
+    LLGL_ASSERT(loadFunction != nullptr);
+
+    if (pimpl_->loaderThreads.empty())
+    {
+        /* Process job synchronously on the calling thread */
+        loadFunction(*(pimpl_->renderSystem));
+        std::lock_guard<std::mutex> guard{ pimpl_->jobMutex };
+        return pimpl_->nextTicket++;
+    }
+
+    ResourceLoadTicket ticket = LLGL_INVALID_RESOURCE_LOAD_TICKET;
+    {
+        std::lock_guard<std::mutex> guard{ pimpl_->jobMutex };
+        ticket = pimpl_->nextTicket++;
+        pimpl_->pendingTickets.insert(ticket);
+        pimpl_->jobQueue.push(ResourceLoadJob{ ticket, loadFunction });
+    }
+    pimpl_->jobSignal.notify_one();
+
+    return ticket;
+}
+
+bool ResourceLoader::IsComplete(ResourceLoadTicket ticket) const
+{
+    std::lock_guard<std::mutex> guard{ pimpl_->jobMutex };
+    return (ticket != LLGL_INVALID_RESOURCE_LOAD_TICKET && ticket < pimpl_->nextTicket && pimpl_->pendingTickets.count(ticket) == 0);
+}
+
+void ResourceLoader::Wait(ResourceLoadTicket ticket)
+{
+    std::unique_lock<std::mutex> lock{ pimpl_->jobMutex };
+    pimpl_->completeSignal.wait(lock, [this, ticket]() { return (pimpl_->pendingTickets.count(ticket) == 0); });
+}
+
+void ResourceLoader::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock{ pimpl_->jobMutex };
+    pimpl_->completeSignal.wait(lock, [this]() { return pimpl_->pendingTickets.empty(); });
+}
+
+bool ResourceLoader::IsAsynchronous() const
+{
+    return !pimpl_->loaderThreads.empty();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
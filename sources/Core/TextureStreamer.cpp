@@ -0,0 +1,741 @@
+/*
+ * TextureStreamer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/TextureStreamer.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Buffer.h>
+#include <LLGL/Format.h>
+#include "CoreUtils.h"
+#include "Assertion.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Alignment (in bytes) of each upload within the staging buffer.
+static constexpr std::uint64_t g_stagingAlignment = 512;
+
+#define LLGL_INVALID_MIP_LEVEL (~0u)
+
+struct StreamingTextureEntry
+{
+    bool                used            = false;
+    TextureDescriptor   desc;                                       // Descriptor of the full texture with all MIP-maps
+    Texture*            texture         = nullptr;                  // Hardware texture with the MIP-maps [residentMip, desc.mipLevels)
+    std::uint32_t       tailMip         = 0;                        // Coarsest MIP-map level that is never evicted
+    std::uint32_t       residentMip     = 0;                        // Finest resident MIP-map level
+    std::uint32_t       requestedMip    = 0;
+    std::uint32_t       minLoadableMip  = 0;                        // Finest MIP-map level that can be loaded; raised after a failed load
+    float               priority        = 1.0f;
+    std::uint64_t       residentSize    = 0;
+    std::uint32_t       generation      = 0;                        // Incremented on release to discard outdated loads
+    bool                loading         = false;                    // Load job is queued or in progress
+    std::uint32_t       loadedMip       = LLGL_INVALID_MIP_LEVEL;   // MIP-map level of the loaded data that waits for upload
+    DynamicByteArray    loadedData;
+};
+
+struct StreamingLoadJob
+{
+    StreamingTexture    texture;
+    std::uint32_t       generation;
+    std::uint32_t       mipLevel;
+    Extent3D            extent;
+    std::size_t         dataSize;
+    float               priority;
+    std::uint64_t       sequence;
+};
+
+struct StreamingLoadResult
+{
+    StreamingTexture    texture;
+    std::uint32_t       generation;
+    std::uint32_t       mipLevel;
+    bool                succeeded;
+    DynamicByteArray    data;
+};
+
+// Orders load jobs by descending priority, then from coarse to fine MIP-maps, then in order of submission.
+struct StreamingLoadJobLess
+{
+    bool operator () (const StreamingLoadJob& lhs, const StreamingLoadJob& rhs) const
+    {
+        if (lhs.priority != rhs.priority)
+            return (lhs.priority < rhs.priority);
+        if (lhs.mipLevel != rhs.mipLevel)
+            return (lhs.mipLevel < rhs.mipLevel);
+        return (lhs.sequence > rhs.sequence);
+    }
+};
+
+struct StreamingRetiredObject
+{
+    std::uint64_t   frame;
+    Texture*        texture;
+    Buffer*         buffer;
+};
+
+// Internal state of the texture streamer; separate from TextureStreamer::Pimpl so the internal functions can access it.
+struct StreamingContext
+{
+    RenderSystem*                               renderSystem        = nullptr;
+    TextureStreamer::LoadFunction               loadFunction;
+    TextureStreamerDescriptor                   desc;
+
+    std::vector<StreamingTextureEntry>          textures;
+    std::vector<StreamingTexture>               freeHandles;
+    std::vector<StreamingRetiredObject>         retiredObjects;
+    std::uint64_t                               frame               = 0;
+
+    Buffer*                                     stagingBuffer       = nullptr;
+    std::uint64_t                               stagingOffset       = 0;    // Offset within the staging segment of the current frame
+
+    TextureStreamerStatistics                   stats;
+
+    // Load queue that is shared with the loader threads
+    std::mutex                                  loadMutex;
+    std::condition_variable                     loadSignal;
+    std::condition_variable                     idleSignal;
+    std::priority_queue<StreamingLoadJob, std::vector<StreamingLoadJob>, StreamingLoadJobLess> loadQueue;
+    std::vector<StreamingLoadResult>            loadResults;
+    std::uint32_t                               numActiveLoads      = 0;
+    std::uint64_t                               loadSequence        = 0;
+    bool                                        stopLoaders         = false;
+    std::vector<std::thread>                    loaderThreads;
+};
+
+struct TextureStreamer::Pimpl : StreamingContext
+{
+};
+
+
+/*
+ * Internal functions
+ */
+
+// Returns the size (in bytes) of a tightly packed MIP-map, which also supports block compressed formats.
+static std::uint64_t GetStreamingMipSize(const TextureDescriptor& textureDesc, std::uint32_t mipLevel)
+{
+    const FormatAttributes& formatAttribs = GetFormatAttribs(textureDesc.format);
+    const Extent3D extent = GetMipExtent(textureDesc, mipLevel);
+    const std::uint64_t numBlocksX = (extent.width  + formatAttribs.blockWidth  - 1) / formatAttribs.blockWidth;
+    const std::uint64_t numBlocksY = (extent.height + formatAttribs.blockHeight - 1) / formatAttribs.blockHeight;
+    return (numBlocksX * numBlocksY * formatAttribs.bitSize / 8);
+}
+
+static std::uint64_t GetStreamingMipRangeSize(const TextureDescriptor& textureDesc, std::uint32_t firstMip)
+{
+    std::uint64_t size = 0;
+    for_subrange(mipLevel, firstMip, textureDesc.mipLevels)
+        size += GetStreamingMipSize(textureDesc, mipLevel);
+    return size;
+}
+
+static std::uint32_t GetStreamingTailMip(const TextureDescriptor& textureDesc, std::uint32_t mipTailSize)
+{
+    for_range(mipLevel, textureDesc.mipLevels)
+    {
+        const Extent3D extent = GetMipExtent(textureDesc, mipLevel);
+        if (extent.width <= mipTailSize && extent.height <= mipTailSize)
+            return mipLevel;
+    }
+    return textureDesc.mipLevels - 1;
+}
+
+// Returns the effective MIP-map level a texture is supposed to be resident at.
+static std::uint32_t GetStreamingTargetMip(const StreamingTextureEntry& entry)
+{
+    return std::max(entry.requestedMip, entry.minLoadableMip);
+}
+
+static void ProcessLoadJob(const TextureStreamer::LoadFunction& loadFunction, const StreamingLoadJob& job, StreamingLoadResult& result)
+{
+    result.texture      = job.texture;
+    result.generation   = job.generation;
+    result.mipLevel     = job.mipLevel;
+    result.succeeded    = (loadFunction(job.texture, job.mipLevel, job.extent, result.data) && result.data.size() >= job.dataSize);
+    if (!result.succeeded)
+        result.data.clear();
+}
+
+static void LoaderThreadMain(StreamingContext* ctx)
+{
+    std::unique_lock<std::mutex> lock{ ctx->loadMutex };
+    for (;;)
+    {
+        ctx->loadSignal.wait(lock, [ctx]() { return (ctx->stopLoaders || !ctx->loadQueue.empty()); });
+        if (ctx->stopLoaders)
+            break;
+
+        StreamingLoadJob job = ctx->loadQueue.top();
+        ctx->loadQueue.pop();
+        ++ctx->numActiveLoads;
+
+        /* Invoke load function without holding the lock */
+        lock.unlock();
+        StreamingLoadResult result;
+        ProcessLoadJob(ctx->loadFunction, job, result);
+        lock.lock();
+
+        ctx->loadResults.push_back(std::move(result));
+        if (--ctx->numActiveLoads == 0 && ctx->loadQueue.empty())
+            ctx->idleSignal.notify_all();
+    }
+}
+
+
+/*
+ * TextureStreamer class
+ */
+
+TextureStreamer::TextureStreamer(RenderSystem& renderSystem, const LoadFunction& loadFunction, const TextureStreamerDescriptor& streamerDesc) :
+    pimpl_ { new Pimpl{} }
+{
+    LLGL_ASSERT(loadFunction != nullptr);
+
+    pimpl_->renderSystem                = &renderSystem;
+    pimpl_->loadFunction                = loadFunction;
+    pimpl_->desc                        = streamerDesc;
+    pimpl_->desc.numFramesInFlight      = std::max(1u, streamerDesc.numFramesInFlight);
+    pimpl_->desc.maxUploadSizePerFrame  = GetAlignedSize(std::max<std::uint64_t>(1u, streamerDesc.maxUploadSizePerFrame), g_stagingAlignment);
+    pimpl_->stats.numFailedLoads        = 0;
+
+    /* Start background loader threads */
+    for_range(i, streamerDesc.numLoaderThreads)
+        pimpl_->loaderThreads.push_back(std::thread{ LoaderThreadMain, static_cast<StreamingContext*>(pimpl_) });
+}
+
+TextureStreamer::~TextureStreamer()
+{
+    /* Stop loader threads before any resources are released */
+    {
+        std::lock_guard<std::mutex> guard{ pimpl_->loadMutex };
+        pimpl_->stopLoaders = true;
+    }
+    pimpl_->loadSignal.notify_all();
+    for (std::thread& loaderThread : pimpl_->loaderThreads)
+        loaderThread.join();
+
+    for (StreamingRetiredObject& retired : pimpl_->retiredObjects)
+    {
+        if (retired.texture != nullptr)
+            pimpl_->renderSystem->Release(*retired.texture);
+        if (retired.buffer != nullptr)
+            pimpl_->renderSystem->Release(*retired.buffer);
+    }
+    for (StreamingTextureEntry& entry : pimpl_->textures)
+    {
+        if (entry.texture != nullptr)
+            pimpl_->renderSystem->Release(*entry.texture);
+    }
+    if (pimpl_->stagingBuffer != nullptr)
+        pimpl_->renderSystem->Release(*pimpl_->stagingBuffer);
+
+    delete pimpl_;
+}
+
+/* ----- Textures ----- */
+
+StreamingTexture TextureStreamer::Register(const TextureDescriptor& textureDesc)
+{
+    LLGL_ASSERT(textureDesc.type == TextureType::Texture2D, "texture streamer only supports 2D textures");
+
+    StreamingTextureEntry entry;
+    {
+        entry.used                  = true;
+        entry.desc                  = textureDesc;
+        entry.desc.bindFlags       |= (BindFlags::CopySrc | BindFlags::CopyDst);
+        entry.desc.miscFlags       &= ~MiscFlags::GenerateMips;
+        entry.desc.mipLevels        = NumMipLevels(textureDesc);
+        entry.desc.debugName        = nullptr;
+        entry.tailMip               = GetStreamingTailMip(entry.desc, pimpl_->desc.mipTailSize);
+        entry.residentMip           = entry.tailMip;
+        entry.requestedMip          = entry.tailMip;
+        entry.residentSize          = GetStreamingMipRangeSize(entry.desc, entry.tailMip);
+    }
+
+    const StreamingTexture handle = (pimpl_->freeHandles.empty() ? static_cast<StreamingTexture>(pimpl_->textures.size()) : pimpl_->freeHandles.back());
+    if (handle < pimpl_->textures.size())
+        entry.generation = pimpl_->textures[handle].generation;
+
+    /* Load MIP-map tail on the calling thread */
+    std::vector<DynamicByteArray> tailMips;
+    for_subrange(mipLevel, entry.tailMip, entry.desc.mipLevels)
+    {
+        const Extent3D extent = GetMipExtent(entry.desc, mipLevel);
+        const std::size_t mipSize = static_cast<std::size_t>(GetStreamingMipSize(entry.desc, mipLevel));
+        DynamicByteArray data;
+        if (!pimpl_->loadFunction(handle, mipLevel, extent, data) || data.size() < mipSize)
+        {
+            ++pimpl_->stats.numFailedLoads;
+            return LLGL_INVALID_STREAMING_TEXTURE;
+        }
+        tailMips.push_back(std::move(data));
+    }
+
+    /* Create hardware texture for MIP-map tail and write texels directly */
+    TextureDescriptor tailDesc = entry.desc;
+    {
+        tailDesc.extent     = GetMipExtent(entry.desc, entry.tailMip);
+        tailDesc.mipLevels  = entry.desc.mipLevels - entry.tailMip;
+        tailDesc.debugName  = textureDesc.debugName;
+    }
+    entry.texture = pimpl_->renderSystem->CreateTexture(tailDesc);
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(entry.desc.format);
+    for_range(i, tailDesc.mipLevels)
+    {
+        const TextureRegion region{ TextureSubresource{ 0, i }, Offset3D{}, GetMipExtent(tailDesc, i) };
+        const ImageView imageView{ formatAttribs.format, formatAttribs.dataType, tailMips[i].get(), tailMips[i].size() };
+        pimpl_->renderSystem->WriteTexture(*entry.texture, region, imageView);
+    }
+
+    pimpl_->stats.residentMemory += entry.residentSize;
+
+    if (handle < pimpl_->textures.size())
+    {
+        pimpl_->freeHandles.pop_back();
+        pimpl_->textures[handle] = std::move(entry);
+    }
+    else
+        pimpl_->textures.push_back(std::move(entry));
+
+    return handle;
+}
+
+static StreamingTextureEntry& GetStreamingTextureEntry(std::vector<StreamingTextureEntry>& textures, StreamingTexture texture)
+{
+    LLGL_ASSERT(texture < textures.size() && textures[texture].used, "invalid streaming texture handle: %u", texture);
+    return textures[texture];
+}
+
+static void RetireObject(StreamingContext& ctx, Texture* texture, Buffer* buffer)
+{
+    ctx.retiredObjects.push_back(StreamingRetiredObject{ ctx.frame, texture, buffer });
+}
+
+void TextureStreamer::Release(StreamingTexture texture)
+{
+    StreamingTextureEntry& entry = GetStreamingTextureEntry(pimpl_->textures, texture);
+    RetireObject(*pimpl_, entry.texture, nullptr);
+    pimpl_->stats.residentMemory -= entry.residentSize;
+
+    const std::uint32_t generation = entry.generation + 1;
+    entry = StreamingTextureEntry{};
+    entry.generation = generation;
+
+    pimpl_->freeHandles.push_back(texture);
+}
+
+void TextureStreamer::RequestMipLevel(StreamingTexture texture, std::uint32_t mipLevel, float priority)
+{
+    StreamingTextureEntry& entry = GetStreamingTextureEntry(pimpl_->textures, texture);
+    entry.requestedMip  = std::min(mipLevel, entry.tailMip);
+    entry.priority      = priority;
+}
+
+/* ----- Streaming ----- */
+
+static void ReleaseRetiredObjects(StreamingContext& ctx)
+{
+    auto IsReleasable = [&ctx](const StreamingRetiredObject& retired) -> bool
+    {
+        return (retired.frame + ctx.desc.numFramesInFlight <= ctx.frame);
+    };
+
+    for (StreamingRetiredObject& retired : ctx.retiredObjects)
+    {
+        if (IsReleasable(retired))
+        {
+            if (retired.texture != nullptr)
+                ctx.renderSystem->Release(*retired.texture);
+            if (retired.buffer != nullptr)
+                ctx.renderSystem->Release(*retired.buffer);
+        }
+    }
+    RemoveAllFromListIf(ctx.retiredObjects, IsReleasable);
+}
+
+static void CollectLoadResults(StreamingContext& ctx, std::vector<StreamingLoadResult>& results)
+{
+    for (StreamingLoadResult& result : results)
+    {
+        if (result.texture >= ctx.textures.size())
+            continue;
+
+        /* Discard results for released textures */
+        StreamingTextureEntry& entry = ctx.textures[result.texture];
+        if (!entry.used || entry.generation != result.generation)
+            continue;
+
+        entry.loading = false;
+
+        if (!result.succeeded)
+        {
+            entry.minLoadableMip = std::max(entry.minLoadableMip, result.mipLevel + 1);
+            ++ctx.stats.numFailedLoads;
+        }
+        else if (result.mipLevel + 1 == entry.residentMip)
+        {
+            /* Keep data until it is uploaded; discard it if the texture has been evicted in the meantime */
+            entry.loadedMip     = result.mipLevel;
+            entry.loadedData    = std::move(result.data);
+        }
+    }
+    results.clear();
+}
+
+static void ScheduleLoads(StreamingContext& ctx)
+{
+    std::lock_guard<std::mutex> guard{ ctx.loadMutex };
+
+    for_range(i, ctx.textures.size())
+    {
+        StreamingTextureEntry& entry = ctx.textures[i];
+        if (!entry.used || entry.loading || entry.loadedMip != LLGL_INVALID_MIP_LEVEL)
+            continue;
+        if (GetStreamingTargetMip(entry) >= entry.residentMip)
+            continue;
+
+        /* Always load the next finer MIP-map, so coarser MIP-maps are resident first */
+        StreamingLoadJob job;
+        {
+            job.texture     = static_cast<StreamingTexture>(i);
+            job.generation  = entry.generation;
+            job.mipLevel    = entry.residentMip - 1;
+            job.extent      = GetMipExtent(entry.desc, job.mipLevel);
+            job.dataSize    = static_cast<std::size_t>(GetStreamingMipSize(entry.desc, job.mipLevel));
+            job.priority    = entry.priority;
+            job.sequence    = ctx.loadSequence++;
+        }
+        ctx.loadQueue.push(job);
+        entry.loading = true;
+    }
+
+    if (!ctx.loaderThreads.empty())
+        ctx.loadSignal.notify_all();
+}
+
+// Processes queued loads on the calling thread until the upload limit of this frame would be exceeded.
+static void ProcessLoadsSynchronously(StreamingContext& ctx, std::vector<StreamingLoadResult>& results)
+{
+    std::uint64_t plannedSize = 0;
+    while (!ctx.loadQueue.empty())
+    {
+        const StreamingLoadJob& job = ctx.loadQueue.top();
+        if (plannedSize > 0 && plannedSize + job.dataSize > ctx.desc.maxUploadSizePerFrame)
+            break;
+        plannedSize += job.dataSize;
+
+        StreamingLoadResult result;
+        ProcessLoadJob(ctx.loadFunction, job, result);
+        results.push_back(std::move(result));
+        ctx.loadQueue.pop();
+    }
+}
+
+// Writes the texels into the staging buffer and returns the buffer and offset to copy from.
+static Buffer* WriteStagingData(StreamingContext& ctx, const void* data, std::uint64_t dataSize, std::uint64_t& outOffset)
+{
+    const std::uint64_t segmentSize = ctx.desc.maxUploadSizePerFrame;
+
+    if (ctx.stagingOffset + dataSize > segmentSize)
+    {
+        /* Upload exceeds the per-frame segment, so use a dedicated buffer that is released once the GPU has finished */
+        BufferDescriptor bufferDesc;
+        {
+            bufferDesc.size         = dataSize;
+            bufferDesc.bindFlags    = BindFlags::CopySrc;
+        }
+        Buffer* buffer = ctx.renderSystem->CreateBuffer(bufferDesc, data);
+        RetireObject(ctx, nullptr, buffer);
+        outOffset = 0;
+        return buffer;
+    }
+
+    if (ctx.stagingBuffer == nullptr)
+    {
+        BufferDescriptor bufferDesc;
+        {
+            bufferDesc.debugName    = "LLGL.TextureStreamer.Staging";
+            bufferDesc.size         = segmentSize * ctx.desc.numFramesInFlight;
+            bufferDesc.bindFlags    = BindFlags::CopySrc;
+        }
+        ctx.stagingBuffer = ctx.renderSystem->CreateBuffer(bufferDesc);
+    }
+
+    /* Each frame in flight uses its own segment of the staging buffer */
+    outOffset = (ctx.frame % ctx.desc.numFramesInFlight) * segmentSize + ctx.stagingOffset;
+    ctx.renderSystem->WriteBuffer(*ctx.stagingBuffer, outOffset, data, dataSize);
+    ctx.stagingOffset = GetAlignedSize(ctx.stagingOffset + dataSize, g_stagingAlignment);
+    return ctx.stagingBuffer;
+}
+
+/*
+Replaces the hardware texture of the specified entry by a new one that holds the MIP-maps [newResidentMip, desc.mipLevels).
+All MIP-maps that are resident in both textures are copied. If 'mipData' is non-null, it holds the texels for the new finest MIP-map.
+*/
+static void ReallocateStreamingTexture(
+    StreamingContext& ctx,
+    CommandBuffer&          commandBuffer,
+    StreamingTextureEntry&  entry,
+    std::uint32_t           newResidentMip,
+    const DynamicByteArray* mipData)
+{
+    TextureDescriptor newDesc = entry.desc;
+    {
+        newDesc.extent      = GetMipExtent(entry.desc, newResidentMip);
+        newDesc.mipLevels   = entry.desc.mipLevels - newResidentMip;
+    }
+    Texture* newTexture = ctx.renderSystem->CreateTexture(newDesc);
+
+    /* Copy MIP-maps that remain resident */
+    for_subrange(mipLevel, std::max(entry.residentMip, newResidentMip), entry.desc.mipLevels)
+    {
+        commandBuffer.CopyTexture(
+            *newTexture,
+            TextureLocation{ Offset3D{}, 0, mipLevel - newResidentMip },
+            *entry.texture,
+            TextureLocation{ Offset3D{}, 0, mipLevel - entry.residentMip },
+            GetMipExtent(entry.desc, mipLevel)
+        );
+    }
+
+    /* Upload new finest MIP-map from staging buffer */
+    if (mipData != nullptr)
+    {
+        const std::uint64_t mipSize = GetStreamingMipSize(entry.desc, newResidentMip);
+        std::uint64_t srcOffset = 0;
+        Buffer* srcBuffer = WriteStagingData(ctx, mipData->get(), mipSize, srcOffset);
+        commandBuffer.CopyTextureFromBuffer(
+            *newTexture,
+            TextureRegion{ TextureSubresource{ 0, 0 }, Offset3D{}, newDesc.extent },
+            *srcBuffer,
+            srcOffset
+        );
+        ctx.stats.uploadedSize += mipSize;
+    }
+
+    /* Old texture might still be in use by the GPU */
+    RetireObject(ctx, entry.texture, nullptr);
+
+    const std::uint64_t newResidentSize = GetStreamingMipRangeSize(entry.desc, newResidentMip);
+    ctx.stats.residentMemory = ctx.stats.residentMemory - entry.residentSize + newResidentSize;
+
+    entry.texture       = newTexture;
+    entry.residentMip   = newResidentMip;
+    entry.residentSize  = newResidentSize;
+}
+
+// Returns true if MIP-maps of the victim can be evicted in favor of the requester and returns the coarsest MIP-map level it may be reduced to.
+static bool CanEvictStreamingTexture(const StreamingTextureEntry& victim, const StreamingTextureEntry& requester, std::uint32_t& outMaxMip)
+{
+    if (!victim.used || &victim == &requester || victim.residentMip >= victim.tailMip)
+        return false;
+
+    const std::uint32_t targetMip = GetStreamingTargetMip(victim);
+    if (victim.residentMip < targetMip)
+    {
+        /* Victim is resident beyond its request */
+        outMaxMip = (victim.priority < requester.priority ? victim.tailMip : targetMip);
+        return true;
+    }
+    if (victim.priority < requester.priority)
+    {
+        outMaxMip = victim.tailMip;
+        return true;
+    }
+    return false;
+}
+
+// Evicts MIP-maps of other textures until the specified size is available within the memory budget. Returns false if that is not possible.
+static bool MakeStreamingMemoryAvailable(
+    StreamingContext& ctx,
+    CommandBuffer&          commandBuffer,
+    StreamingTextureEntry&  requester,
+    std::uint64_t           size)
+{
+    while (ctx.stats.residentMemory + size > ctx.desc.memoryBudget)
+    {
+        /* Find victim: textures beyond their request first, then the lowest priority, then the finest resident MIP-map */
+        StreamingTextureEntry*  victim      = nullptr;
+        std::uint32_t           victimMax   = 0;
+        bool                    victimSurplus = false;
+
+        for (StreamingTextureEntry& entry : ctx.textures)
+        {
+            std::uint32_t maxMip = 0;
+            if (!CanEvictStreamingTexture(entry, requester, maxMip))
+                continue;
+
+            const bool surplus = (entry.residentMip < GetStreamingTargetMip(entry));
+            if (victim == nullptr ||
+                (surplus && !victimSurplus) ||
+                (surplus == victimSurplus && (entry.priority < victim->priority || (entry.priority == victim->priority && entry.residentMip < victim->residentMip))))
+            {
+                victim          = &entry;
+                victimMax       = maxMip;
+                victimSurplus   = surplus;
+            }
+        }
+
+        if (victim == nullptr)
+            return false;
+
+        /* Evict as many MIP-maps of the victim as required in a single reallocation */
+        const std::uint64_t requiredSize = ctx.stats.residentMemory + size - ctx.desc.memoryBudget;
+        std::uint32_t newResidentMip = victim->residentMip;
+        std::uint64_t freedSize = 0;
+        while (newResidentMip < victimMax && freedSize < requiredSize)
+            freedSize += GetStreamingMipSize(victim->desc, newResidentMip++);
+
+        ctx.stats.numEvictedMips += (newResidentMip - victim->residentMip);
+        ReallocateStreamingTexture(ctx, commandBuffer, *victim, newResidentMip, nullptr);
+
+        /* Pending data of the victim no longer matches its resident MIP-maps */
+        victim->loadedMip = LLGL_INVALID_MIP_LEVEL;
+        victim->loadedData.clear();
+    }
+    return true;
+}
+
+static void UploadLoadedMips(StreamingContext& ctx, CommandBuffer& commandBuffer)
+{
+    /* Gather textures with loaded data in the same order as the load queue */
+    std::vector<StreamingTextureEntry*> candidates;
+    for (StreamingTextureEntry& entry : ctx.textures)
+    {
+        if (entry.used && entry.loadedMip != LLGL_INVALID_MIP_LEVEL)
+            candidates.push_back(&entry);
+    }
+
+    std::sort(
+        candidates.begin(), candidates.end(),
+        [](const StreamingTextureEntry* lhs, const StreamingTextureEntry* rhs) -> bool
+        {
+            if (lhs->priority != rhs->priority)
+                return (lhs->priority > rhs->priority);
+            return (lhs->loadedMip > rhs->loadedMip);
+        }
+    );
+
+    for (StreamingTextureEntry* entry : candidates)
+    {
+        /* Skip if the entry has been evicted for a previous candidate */
+        if (entry->loadedMip == LLGL_INVALID_MIP_LEVEL)
+            continue;
+
+        /* Drop data if the texture is no longer requested at this level */
+        if (entry->loadedMip < GetStreamingTargetMip(*entry))
+        {
+            entry->loadedMip = LLGL_INVALID_MIP_LEVEL;
+            entry->loadedData.clear();
+            continue;
+        }
+
+        const std::uint64_t mipSize = GetStreamingMipSize(entry->desc, entry->loadedMip);
+        if (ctx.stats.uploadedSize > 0 && ctx.stats.uploadedSize + mipSize > ctx.desc.maxUploadSizePerFrame)
+            break;
+
+        if (!MakeStreamingMemoryAvailable(ctx, commandBuffer, *entry, mipSize))
+            continue;
+
+        ReallocateStreamingTexture(ctx, commandBuffer, *entry, entry->loadedMip, &(entry->loadedData));
+        ++ctx.stats.numLoadedMips;
+
+        entry->loadedMip = LLGL_INVALID_MIP_LEVEL;
+        entry->loadedData.clear();
+    }
+}
+
+void TextureStreamer::Update(CommandBuffer& commandBuffer)
+{
+    ++pimpl_->frame;
+    pimpl_->stagingOffset           = 0;
+    pimpl_->stats.numLoadedMips     = 0;
+    pimpl_->stats.numEvictedMips    = 0;
+    pimpl_->stats.uploadedSize      = 0;
+
+    ReleaseRetiredObjects(*pimpl_);
+
+    /* Schedule new loads and take over the results of finished loads */
+    std::vector<StreamingLoadResult> results;
+    ScheduleLoads(*pimpl_);
+    if (pimpl_->loaderThreads.empty())
+        ProcessLoadsSynchronously(*pimpl_, results);
+    else
+    {
+        std::lock_guard<std::mutex> guard{ pimpl_->loadMutex };
+        results.swap(pimpl_->loadResults);
+    }
+    CollectLoadResults(*pimpl_, results);
+
+    UploadLoadedMips(*pimpl_, commandBuffer);
+}
+
+void TextureStreamer::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock{ pimpl_->loadMutex };
+    if (!pimpl_->loaderThreads.empty())
+        pimpl_->idleSignal.wait(lock, [this]() { return (pimpl_->loadQueue.empty() && pimpl_->numActiveLoads == 0); });
+}
+
+/* ----- Queries ----- */
+
+Texture* TextureStreamer::GetTexture(StreamingTexture texture) const
+{
+    return GetStreamingTextureEntry(pimpl_->textures, texture).texture;
+}
+
+std::uint32_t TextureStreamer::GetResidentMipLevel(StreamingTexture texture) const
+{
+    return GetStreamingTextureEntry(pimpl_->textures, texture).residentMip;
+}
+
+TextureStreamerStatistics TextureStreamer::GetStatistics() const
+{
+    TextureStreamerStatistics stats = pimpl_->stats;
+    {
+        stats.numTextures       = 0;
+        stats.requestedMemory   = 0;
+        for (const StreamingTextureEntry& entry : pimpl_->textures)
+        {
+            if (entry.used)
+            {
+                ++stats.numTextures;
+                stats.requestedMemory += GetStreamingMipRangeSize(entry.desc, GetStreamingTargetMip(entry));
+            }
+        }
+
+        std::lock_guard<std::mutex> guard{ pimpl_->loadMutex };
+        stats.numPendingLoads = static_cast<std::uint32_t>(pimpl_->loadQueue.size()) + pimpl_->numActiveLoads;
+    }
+    return stats;
+}
+
+
+#undef LLGL_INVALID_MIP_LEVEL
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -10,6 +10,7 @@
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <atomic>
 
 
 namespace LLGL
@@ -93,6 +94,13 @@ LLGL_EXPORT void DoConcurrent(
     );
 }
 
+LLGL_EXPORT std::uint32_t GetCurrentThreadID()
+{
+    static std::atomic<std::uint32_t> nextThreadID{ 1 };
+    static thread_local std::uint32_t threadID = nextThreadID++;
+    return threadID;
+}
+
 
 } // /namespace LLGL
 
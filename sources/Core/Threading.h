@@ -13,6 +13,7 @@
 #include <LLGL/Constants.h>
 #include <functional>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace LLGL
@@ -33,6 +34,9 @@ LLGL_EXPORT void DoConcurrent(
     unsigned                                        threadMinWorkSize   = 64
 );
 
+// Returns a compact process unique identifier for the calling thread. The first thread that calls this function is assigned 1.
+LLGL_EXPORT std::uint32_t GetCurrentThreadID();
+
 
 } // /namespace LLGL
 
@@ -241,6 +241,8 @@ LLGL_EXPORT const char* ToString(const Format val)
         case T::BC4SNorm:           return "BC4SNorm";
         case T::BC5UNorm:           return "BC5UNorm";
         case T::BC5SNorm:           return "BC5SNorm";
+        case T::BC7UNorm:           return "BC7UNorm";
+        case T::BC7UNorm_sRGB:      return "BC7UNorm_sRGB";
     }
 
     return nullptr;
@@ -274,6 +276,7 @@ LLGL_EXPORT const char* ToString(const ImageFormat val)
         case T::BC3:            return "BC3";
         case T::BC4:            return "BC4";
         case T::BC5:            return "BC5";
+        case T::BC7:            return "BC7";
     }
 
     return nullptr;
@@ -336,6 +339,18 @@ LLGL_EXPORT const char* ToString(const ResourceType val)
     return nullptr;
 }
 
+LLGL_EXPORT const char* ToString(const CommandQueueType val)
+{
+    using T = CommandQueueType;
+    switch (val)
+    {
+        case T::Graphics:   return "graphics";
+        case T::Compute:    return "compute";
+        case T::Transfer:   return "transfer";
+    }
+    return nullptr;
+}
+
 
 } // /namespace LLGL
 
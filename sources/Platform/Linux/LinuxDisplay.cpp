@@ -49,8 +49,15 @@ static bool UpdateDisplayList()
  * LinuxSharedX11Display class
  */
 
+// Opens the X11 display connection with Xlib's thread support, since GL loader threads use the shared display concurrently.
+static ::Display* OpenX11DisplayWithThreadSupport()
+{
+    XInitThreads();
+    return XOpenDisplay(nullptr);
+}
+
 LinuxSharedX11Display::LinuxSharedX11Display() :
-    native_ { XOpenDisplay(nullptr) }
+    native_ { OpenX11DisplayWithThreadSupport() }
 {
     if (!native_)
         throw std::runtime_error("failed to open connection to X server");
@@ -0,0 +1,68 @@
+/*
+ * CommandQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/CommandQueue.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <chrono>
+
+
+namespace LLGL
+{
+
+
+CommandQueue::CommandQueue(const CommandQueueType type) :
+    type_ { type }
+{
+}
+
+void CommandQueue::SubmitWait(Fence& fence)
+{
+    /* Emulate GPU-side wait by blocking the CPU until the fence has been signaled */
+    WaitFence(fence, ~0ull);
+}
+
+void CommandQueue::SubmitSignal(Fence& fence, std::uint64_t /*value*/)
+{
+    /* Emulate timeline fence with binary fence, i.e. any value is reached once the most recent submission has been signaled */
+    Submit(fence);
+}
+
+bool CommandQueue::WaitFenceValue(Fence& fence, std::uint64_t /*value*/, std::uint64_t timeout)
+{
+    return WaitFence(fence, timeout);
+}
+
+bool CommandQueue::WaitFenceValues(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, std::uint64_t timeout)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const bool isInfinite = (timeout >= static_cast<std::uint64_t>(std::chrono::nanoseconds::max().count()));
+    const Clock::time_point deadline = (isInfinite ? Clock::time_point{} : Clock::now() + std::chrono::nanoseconds(timeout));
+
+    /* Wait for each fence in turn and only pass the remaining time of the timeout to each wait */
+    for_range(i, numFences)
+    {
+        std::uint64_t remainingTimeout = timeout;
+        if (!isInfinite)
+        {
+            const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now()).count();
+            remainingTimeout = static_cast<std::uint64_t>(std::max<decltype(remaining)>(remaining, 0));
+        }
+        if (!WaitFenceValue(*fences[i], values[i], remainingTimeout))
+            return false;
+    }
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -14,6 +14,7 @@
 #include "CheckedCast.h"
 #include <memory>
 #include <vector>
+#include <mutex>
 #include <utility>
 #include <type_traits>
 #include <unordered_set>
@@ -306,6 +307,123 @@ class UnorderedUniquePtrVector
 
 };
 
+/*
+Thread-safe container class for an array of unordered unique pointers. Used by RenderSystem implementations for child objects that can be created on loader threads.
+Objects are constructed and destroyed outside of the lock, so only the bookkeeping of the container is serialized. Iterating is not thread-safe.
+*/
+template <typename T>
+class ConcurrentUniquePtrVector
+{
+
+    public:
+
+        using container_type    = std::vector<IndexedUniquePtr<T>>;
+        using iterator          = typename container_type::iterator;
+        using const_iterator    = typename container_type::const_iterator;
+
+    public:
+
+        // Allocates a new object for this container and returns a non-owning raw pointer to that object.
+        template <typename TSub, typename... Args>
+        TSub* emplace(Args&&... args)
+        {
+            /* Allocate object before its index in the container is known */
+            IndexedUniquePtr<TSub> object = IndexedUniquePtr<TSub>::Alloc(IndexPayload{ 0 }, std::forward<Args>(args)...);
+            TSub* ref = object.get();
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                object.payload().index = container_.size();
+                container_.push_back(std::move(object));
+            }
+            return ref;
+        }
+
+        // Releases the memory for the specified object in that list.
+        template <typename TBase>
+        void erase(TBase* object)
+        {
+            if (object != nullptr)
+            {
+                /* Take ownership of object within the lock, so it can be destroyed outside of the lock */
+                IndexedUniquePtr<T> releasedObject;
+                {
+                    std::lock_guard<std::mutex> guard{ mutex_ };
+
+                    /* Locate object in container with index from payload */
+                    T* subTypedObject = ObjectCast<T*>(object);
+                    auto* payload = reinterpret_cast<IndexPayload*>(reinterpret_cast<char*>(subTypedObject) - sizeof(IndexPayload));
+                    LLGL_ASSERT(payload->index < container_.size());
+
+                    if (payload->index + 1 < container_.size())
+                    {
+                        /* Move last element to location of the input object in order to delete it */
+                        std::swap(container_[payload->index], container_.back());
+
+                        /* Update payload for moved object */
+                        container_[payload->index].payload() = *payload;
+                    }
+
+                    /* Remove last element in container; it's the input object after the swap */
+                    releasedObject.swap(container_.back());
+                    container_.pop_back();
+                }
+            }
+        }
+
+        void clear()
+        {
+            container_type releasedObjects;
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                releasedObjects.swap(container_);
+            }
+        }
+
+        bool empty() const
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return container_.empty();
+        }
+
+    public:
+
+        const_iterator cbegin() const
+        {
+            return container_.cbegin();
+        }
+
+        const_iterator begin() const
+        {
+            return container_.begin();
+        }
+
+        iterator begin()
+        {
+            return container_.begin();
+        }
+
+        const_iterator cend() const
+        {
+            return container_.cend();
+        }
+
+        const_iterator end() const
+        {
+            return container_.end();
+        }
+
+        iterator end()
+        {
+            return container_.end();
+        }
+
+    private:
+
+        container_type      container_;
+        mutable std::mutex  mutex_;
+
+};
+
 // Container class for a set of unordered unique pointers. Used by RenderSystem implementations for all child objects.
 template <typename T>
 class UnorderedUniquePtrSet
@@ -401,6 +519,10 @@ using HWObjectContainer = UnorderedUniquePtrVector<T>;
 
 #endif
 
+// Container for child objects that can be created and released on loader threads (see RenderSystem::BeginLoaderThread).
+template <typename T>
+using ConcurrentHWObjectContainer = ConcurrentUniquePtrVector<T>;
+
 
 } // /namespace LLGL
 
@@ -44,8 +44,10 @@ class DbgBuffer final : public Buffer
         Buffer&                 instance;
         const BufferDescriptor  desc;
         std::string             label;
-        std::uint64_t           elements    = 0;
-        bool                    initialized = false;
+        std::uint64_t           elements        = 0;
+        bool                    initialized     = false;
+        std::uint64_t           lastWriteSerial = 0;    // Submission serial of the last command buffer that wrote to this buffer.
+        std::uint64_t           lastReadSerial  = 0;    // Submission serial of the last command buffer that read from this buffer.
 
     private:
 
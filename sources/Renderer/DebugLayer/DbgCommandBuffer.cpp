@@ -6,6 +6,7 @@
  */
 
 #include "DbgCommandBuffer.h"
+#include "DbgCommandQueue.h"
 #include "DbgCore.h"
 #include "DbgReportUtils.h"
 #include "../CheckedCast.h"
@@ -62,22 +63,27 @@ static const char* GetLabelOrDefault(const std::string& label, const char* defau
 }
 
 DbgCommandBuffer::DbgCommandBuffer(
-    RenderSystem&                   renderSystemInstance,
-    CommandQueue&                   commandQueueInstance,
-    CommandBuffer&                  commandBufferInstance,
-    FrameProfile&                   commonProfile,
-    RenderingDebugger*              debugger,
-    const CommandBufferDescriptor&  desc,
-    const RenderingCapabilities&    caps)
+    RenderSystem&                     renderSystemInstance,
+    DbgCommandQueue&                  commandQueue,
+    CommandBuffer&                    commandBufferInstance,
+    FrameProfile&                     commonProfile,
+    const std::atomic<std::uint64_t>& frameCounter,
+    RenderingDebugger*                debugger,
+    const CommandBufferDescriptor&    desc,
+    const RenderingCapabilities&      caps)
 :
-    instance        { commandBufferInstance                                             },
-    desc            { desc                                                              },
-    debugger_       { debugger                                                          },
-    commonProfile_  { commonProfile                                                     },
-    features_       { caps.features                                                     },
-    limits_         { caps.limits                                                       },
-    queryTimerPool_ { renderSystemInstance, commandQueueInstance, commandBufferInstance }
+    instance        { commandBufferInstance                                                            },
+    desc            { desc                                                                             },
+    commandQueue_   { commandQueue                                                                     },
+    debugger_       { debugger                                                                         },
+    commonProfile_  { commonProfile                                                                    },
+    features_       { caps.features                                                                    },
+    limits_         { caps.limits                                                                      },
+    queryTimerPool_ { renderSystemInstance, commandQueue.instance, commandBufferInstance, frameCounter }
 {
+    /* Seed random validation sampling with a non-zero value that differs between command buffers */
+    validationRandomState_  = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(this) >> 4) | 1u;
+    hazardRandomState_      = (validationRandomState_ * 0x9E3779B9u) | 1u;
 }
 
 /* ----- Encoding ----- */
@@ -95,7 +101,19 @@ void DbgCommandBuffer::Begin()
 
     /* Begin with command recording  */
     if (debugger_)
+    {
         EnableRecording(true);
+        validationSampling_ = debugger_->GetValidationSampling();
+        loadStoreAnalysis_  = debugger_->GetLoadStoreAnalysis();
+
+        /* Start every-N-th sampling at a different phase with each encoding, so the same commands are not skipped in every frame */
+        if (validationSampling_.interval > 1)
+            validationCounter_ = (numEncodings_ % validationSampling_.interval);
+        ++numEncodings_;
+
+        /* Hazard tracking is sampled for entire encodings, so all resource accesses of a sampled encoding are recorded */
+        hazardTrackingSampled_ = SampleHazardTracking();
+    }
 
     instance.Begin();
 
@@ -115,6 +133,10 @@ void DbgCommandBuffer::End()
 
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
     {
+        /* Stamp all resources this command buffer accessed with the new submission serial */
+        StampResourceAccesses(commandQueue_.AdvanceSubmissionSerial());
+        ResolveAttachmentRecords();
+
         /* Merge frame profile values into rendering profiler */
         FrameProfile profile;
         FlushProfile(profile);
@@ -141,6 +163,23 @@ void DbgCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
             CommandBufferFlags::Secondary,
             "LLGL::CommandBuffer"
         );
+
+        if (commandBufferDbg.IsInheritedCmdBuffer() && !states_.insideParallelRenderPass)
+        {
+            LLGL_DBG_WARN(
+                WarningType::VaryingBehavior,
+                "secondary command buffer that inherits a render pass is executed outside of a parallel render pass; missing call to <LLGL::CommandBuffer::BeginParallelRenderPass>"
+            );
+        }
+
+        /* Inherit resource accesses from secondary command buffer */
+        const Records& secondaryRecords = commandBufferDbg.records_;
+        records_.bufferReads.insert(records_.bufferReads.end(), secondaryRecords.bufferReads.begin(), secondaryRecords.bufferReads.end());
+        records_.bufferWrites.insert(records_.bufferWrites.end(), secondaryRecords.bufferWrites.begin(), secondaryRecords.bufferWrites.end());
+        records_.textureReads.insert(records_.textureReads.end(), secondaryRecords.textureReads.begin(), secondaryRecords.textureReads.end());
+        records_.textureWrites.insert(records_.textureWrites.end(), secondaryRecords.textureWrites.begin(), secondaryRecords.textureWrites.end());
+        records_.attachments.insert(records_.attachments.end(), secondaryRecords.attachments.begin(), secondaryRecords.attachments.end());
+        records_.renderTargetPasses.insert(records_.renderTargetPasses.end(), secondaryRecords.renderTargetPasses.begin(), secondaryRecords.renderTargetPasses.end());
     }
 
     LLGL_DBG_COMMAND( "Execute", instance.Execute(commandBufferDbg.instance) );
@@ -160,7 +199,9 @@ void DbgCommandBuffer::UpdateBuffer(
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
-        ValidateBufferRange(dstBufferDbg, dstOffset, dataSize, "destination range");
+        RecordResourceAccess(dstBufferDbg, true);
+        if (SampleValidation())
+            ValidateBufferRange(dstBufferDbg, dstOffset, dataSize, "destination range");
     }
 
     LLGL_DBG_COMMAND( "UpdateBuffer", instance.UpdateBuffer(dstBufferDbg.instance, dstOffset, data, dataSize) );
@@ -182,10 +223,15 @@ void DbgCommandBuffer::CopyBuffer(
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
-        ValidateBufferRange(dstBufferDbg, dstOffset, size, "destination range");
-        ValidateBufferRange(srcBufferDbg, srcOffset, size, "source range");
         ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
         ValidateBindBufferFlags(srcBufferDbg, BindFlags::CopySrc);
+        RecordResourceAccess(dstBufferDbg, true);
+        RecordResourceAccess(srcBufferDbg, false);
+        if (SampleValidation())
+        {
+            ValidateBufferRange(dstBufferDbg, dstOffset, size, "destination range");
+            ValidateBufferRange(srcBufferDbg, srcOffset, size, "source range");
+        }
     }
 
     LLGL_DBG_COMMAND( "CopyBuffer", instance.CopyBuffer(dstBufferDbg.instance, dstOffset, srcBufferDbg.instance, srcOffset, size) );
@@ -216,10 +262,15 @@ void DbgCommandBuffer::CopyBufferFromTexture(
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
-        ValidateBufferRange(dstBufferDbg, dstOffset, GetTextureRegionMinFootprint(srcTextureDbg, srcRegion));
         ValidateBindTextureFlags(srcTextureDbg, BindFlags::CopySrc);
-        ValidateTextureRegion(srcTextureDbg, srcRegion);
-        ValidateTextureBufferCopyStrides(srcTextureDbg, rowStride, layerStride, srcRegion.extent);
+        RecordResourceAccess(dstBufferDbg, true);
+        RecordResourceAccess(srcTextureDbg, false);
+        if (SampleValidation())
+        {
+            ValidateBufferRange(dstBufferDbg, dstOffset, GetTextureRegionMinFootprint(srcTextureDbg, srcRegion));
+            ValidateTextureRegion(srcTextureDbg, srcRegion);
+            ValidateTextureBufferCopyStrides(srcTextureDbg, rowStride, layerStride, srcRegion.extent);
+        }
     }
 
     LLGL_DBG_COMMAND( "CopyBufferFromTexture", instance.CopyBufferFromTexture(dstBufferDbg.instance, dstOffset, srcTextureDbg.instance, srcRegion, rowStride, layerStride) );
@@ -240,6 +291,7 @@ void DbgCommandBuffer::FillBuffer(
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+        RecordResourceAccess(dstBufferDbg, true);
 
         if (fillSize == LLGL_WHOLE_SIZE)
         {
@@ -250,7 +302,8 @@ void DbgCommandBuffer::FillBuffer(
         {
             if (fillSize % 4 != 0)
                 LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer fill size is not a multiple of 4");
-            ValidateBufferRange(dstBufferDbg, dstOffset, fillSize);
+            if (SampleValidation())
+                ValidateBufferRange(dstBufferDbg, dstOffset, fillSize);
         }
     }
 
@@ -275,6 +328,8 @@ void DbgCommandBuffer::CopyTexture(
         AssertRecording();
         ValidateBindTextureFlags(dstTextureDbg, BindFlags::CopyDst);
         ValidateBindTextureFlags(srcTextureDbg, BindFlags::CopySrc);
+        RecordResourceAccess(dstTextureDbg, true);
+        RecordResourceAccess(srcTextureDbg, false);
     }
 
     LLGL_DBG_COMMAND( "CopyTexture", instance.CopyTexture(dstTextureDbg.instance, dstLocation, srcTextureDbg.instance, srcLocation, extent) );
@@ -298,10 +353,15 @@ void DbgCommandBuffer::CopyTextureFromBuffer(
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateBindTextureFlags(dstTextureDbg, BindFlags::CopyDst);
-        ValidateTextureRegion(dstTextureDbg, dstRegion);
         ValidateBindBufferFlags(srcBufferDbg, BindFlags::CopySrc);
-        ValidateBufferRange(srcBufferDbg, srcOffset, GetTextureRegionMinFootprint(dstTextureDbg, dstRegion));
-        ValidateTextureBufferCopyStrides(dstTextureDbg, rowStride, layerStride, dstRegion.extent);
+        RecordResourceAccess(dstTextureDbg, true);
+        RecordResourceAccess(srcBufferDbg, false);
+        if (SampleValidation())
+        {
+            ValidateTextureRegion(dstTextureDbg, dstRegion);
+            ValidateBufferRange(srcBufferDbg, srcOffset, GetTextureRegionMinFootprint(dstTextureDbg, dstRegion));
+            ValidateTextureBufferCopyStrides(dstTextureDbg, rowStride, layerStride, dstRegion.extent);
+        }
     }
 
     LLGL_DBG_COMMAND( "CopyTextureFromBuffer", instance.CopyTextureFromBuffer(dstTextureDbg.instance, dstRegion, srcBufferDbg.instance, srcOffset, rowStride, layerStride) );
@@ -321,7 +381,9 @@ void DbgCommandBuffer::CopyTextureFromFramebuffer(
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateBindTextureFlags(dstTextureDbg, BindFlags::CopyDst);
-        ValidateTextureRegion(dstTextureDbg, dstRegion);
+        RecordResourceAccess(dstTextureDbg, true);
+        if (SampleValidation())
+            ValidateTextureRegion(dstTextureDbg, dstRegion);
         if (dstRegion.subresource.numArrayLayers > 1)
             LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot copy texture from framebuffer with number of array layers greater than 1");
         if (dstRegion.extent.depth != 1)
@@ -348,6 +410,7 @@ void DbgCommandBuffer::GenerateMips(Texture& texture)
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateGenerateMips(textureDbg);
+        RecordResourceAccess(textureDbg, true);
     }
 
     LLGL_DBG_COMMAND( "GenerateMips", instance.GenerateMips(textureDbg.instance) );
@@ -364,6 +427,7 @@ void DbgCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateGenerateMips(textureDbg, &subresource);
+        RecordResourceAccess(textureDbg, true);
     }
 
     LLGL_DBG_COMMAND( "GenerateMips", instance.GenerateMips(textureDbg.instance, subresource) );
@@ -461,6 +525,7 @@ void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateBindBufferFlags(bufferDbg, BindFlags::VertexBuffer);
+        RecordResourceAccess(bufferDbg, false);
 
         bindings_.vertexBufferStore[0]  = (&bufferDbg);
         bindings_.vertexBuffers         = bindings_.vertexBufferStore;
@@ -484,6 +549,9 @@ void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 
         bindings_.vertexBuffers     = bufferArrayDbg.buffers.data();
         bindings_.numVertexBuffers  = static_cast<std::uint32_t>(bufferArrayDbg.buffers.size());
+
+        for (DbgBuffer* bufferDbg : bufferArrayDbg.buffers)
+            RecordResourceAccess(*bufferDbg, false);
     }
 
     LLGL_DBG_COMMAND( "SetVertexBufferArray", instance.SetVertexBufferArray(bufferArrayDbg.instance) );
@@ -501,6 +569,7 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer)
         AssertRecording();
 
         ValidateBindBufferFlags(bufferDbg, BindFlags::IndexBuffer);
+        RecordResourceAccess(bufferDbg, false);
         ValidateIndexType(bufferDbg.desc.format);
 
         bindings_.indexBuffer           = (&bufferDbg);
@@ -524,6 +593,7 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::
         AssertRecording();
 
         ValidateBindBufferFlags(bufferDbg, BindFlags::IndexBuffer);
+        RecordResourceAccess(bufferDbg, false);
         ValidateIndexType(format);
 
         bindings_.indexBuffer           = (&bufferDbg);
@@ -558,6 +628,17 @@ void DbgCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
         AssertRecording();
         ValidateDescriptorSetIndex(descriptorSet, resourceHeapDbg.GetNumDescriptorSets(), resourceHeapDbg.label.c_str());
         bindings_.bindingTable.resourceHeap = &resourceHeap;
+
+        /* Record all resources of the descriptor set as read, since the heap does not distinguish between read and write access */
+        for (Resource* resource : resourceHeapDbg.GetDescriptorSetResources(descriptorSet))
+        {
+            if (resource == nullptr)
+                continue;
+            if (resource->GetResourceType() == ResourceType::Buffer)
+                RecordResourceAccess(LLGL_CAST(DbgBuffer&, *resource), false);
+            else if (resource->GetResourceType() == ResourceType::Texture)
+                RecordResourceAccess(LLGL_CAST(DbgTexture&, *resource), false);
+        }
     }
 
     LLGL_DBG_COMMAND( "SetResourceHeap", instance.SetResourceHeap(resourceHeapDbg.instance, descriptorSet) );
@@ -604,6 +685,7 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
                     (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage),
                     GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")
                 );
+                RecordResourceAccess(bufferDbg, (bindingDesc->bindFlags & BindFlags::Storage) != 0);
             }
 
             LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, bufferDbg.instance) );
@@ -634,6 +716,9 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
                     (BindFlags::Sampled | BindFlags::Storage | BindFlags::CombinedSampler),
                     GetLabelOrDefault(textureDbg.label, "LLGL::Buffer")
                 );
+                RecordResourceAccess(textureDbg, false);
+                if ((bindingDesc->bindFlags & BindFlags::Storage) != 0)
+                    RecordResourceAccess(textureDbg, true);
             }
 
             LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, textureDbg.instance) );
@@ -693,63 +778,17 @@ void DbgCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       swapBufferIndex)
 {
-    if (debugger_)
-    {
-        LLGL_DBG_SOURCE();
-        AssertRecording();
-
-        if (IsInheritedCmdBuffer())
-        {
-            LLGL_DBG_ERROR(
-                ErrorType::InvalidState,
-                "cannot begin render passes with secondary command buffer that inherits its state from a primary command buffer"
-            );
-        }
-        else
-        {
-            if (states_.insideRenderPass)
-            {
-                LLGL_DBG_ERROR(
-                    ErrorType::InvalidState,
-                    "cannot begin new render pass while previous render pass is still active"
-                );
-            }
-            states_.insideRenderPass = true;
-        }
-    }
-
-    const RenderPass* renderPassInstance = DbgGetInstance<DbgRenderPass>(renderPass);
-
-    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
-    {
-        auto& swapChainDbg = LLGL_CAST(DbgSwapChain&, renderTarget);
-
-        swapChainDbg.NotifyNextRenderPass(debugger_, renderPass);
-
-        bindings_.swapChain     = &swapChainDbg;
-        bindings_.renderTarget  = nullptr;
-
-        /* Record swap-chain frame to validate when submitting the command buffer */
-        if (debugger_)
-        {
-            const std::uint32_t actualSwapBufferIndex = (swapBufferIndex == LLGL_CURRENT_SWAP_INDEX ? swapChainDbg.GetCurrentSwapIndex() : swapBufferIndex);
-            records_.swapChainFrames.push_back({ bindings_.swapChain, actualSwapBufferIndex });
-            ValidateSwapBufferIndex(swapChainDbg, actualSwapBufferIndex);
-        }
-
-        instance.BeginRenderPass(swapChainDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
-    }
-    else
-    {
-        auto& renderTargetDbg = LLGL_CAST(DbgRenderTarget&, renderTarget);
-
-        bindings_.swapChain     = nullptr;
-        bindings_.renderTarget  = &renderTargetDbg;
-
-        instance.BeginRenderPass(renderTargetDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
-    }
+    BeginRenderPassSection(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex, false);
+}
 
-    profile_.commandBufferRecord.renderPassSections++;
+void DbgCommandBuffer::BeginParallelRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    BeginRenderPassSection(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex, true);
 }
 
 void DbgCommandBuffer::EndRenderPass()
@@ -760,7 +799,10 @@ void DbgCommandBuffer::EndRenderPass()
         AssertRecording();
         if (!states_.insideRenderPass)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot end render pass while no render pass is currently active");
-        states_.insideRenderPass = false;
+        states_.insideRenderPass            = false;
+        states_.insideParallelRenderPass    = false;
+        if (bindings_.analyzedRenderPass != nullptr)
+            AnalyzeAttachmentStores();
     }
 
     instance.EndRenderPass();
@@ -773,6 +815,8 @@ void DbgCommandBuffer::Clear(long flags, const ClearValue& clearValue)
         LLGL_DBG_SOURCE();
         AssertRecording();
         AssertInsideRenderPass();
+        if (bindings_.pendingAttachmentLoads != 0)
+            AnalyzeAttachmentClears(flags, LLGL_MAX_NUM_COLOR_ATTACHMENTS);
     }
 
     LLGL_DBG_COMMAND( "Clear", instance.Clear(flags, clearValue) );
@@ -788,7 +832,11 @@ void DbgCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Atta
         AssertRecording();
         AssertInsideRenderPass();
         for_range(i, numAttachments)
+        {
             ValidateAttachmentClear(attachments[i]);
+            if (bindings_.pendingAttachmentLoads != 0)
+                AnalyzeAttachmentClears(attachments[i].flags, attachments[i].colorAttachment);
+        }
     }
 
     LLGL_DBG_COMMAND( "ClearAttachments", instance.ClearAttachments(numAttachments, attachments) );
@@ -998,6 +1046,7 @@ void DbgCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
             if (bufferDbg != nullptr)
             {
                 ValidateBindBufferFlags(*bufferDbg, BindFlags::StreamOutputBuffer);
+                RecordResourceAccess(*bufferDbg, true);
                 bindings_.streamOutputs[i] = bufferDbg;
                 bufferInstances[i] = &(bufferDbg->instance);
             }
@@ -1059,8 +1108,12 @@ void DbgCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex
 {
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        ValidateDrawCmd(numVertices, firstVertex, 1, 0);
+        AnalyzeAttachmentDraws();
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            ValidateDrawCmd(numVertices, firstVertex, 1, 0);
+        }
     }
 
     LLGL_DBG_COMMAND( "Draw", instance.Draw(numVertices, firstVertex) );
@@ -1072,8 +1125,12 @@ void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t first
 {
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        ValidateDrawIndexedCmd(numIndices, 1, firstIndex, 0, 0);
+        AnalyzeAttachmentDraws();
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            ValidateDrawIndexedCmd(numIndices, 1, firstIndex, 0, 0);
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndexed", instance.DrawIndexed(numIndices, firstIndex) );
@@ -1085,8 +1142,12 @@ void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t first
 {
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        ValidateDrawIndexedCmd(numIndices, 1, firstIndex, vertexOffset, 0);
+        AnalyzeAttachmentDraws();
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            ValidateDrawIndexedCmd(numIndices, 1, firstIndex, vertexOffset, 0);
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndexed", instance.DrawIndexed(numIndices, firstIndex, vertexOffset) );
@@ -1098,9 +1159,13 @@ void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fi
 {
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertInstancingSupported();
-        ValidateDrawCmd(numVertices, firstVertex, numInstances, 0);
+        AnalyzeAttachmentDraws();
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertInstancingSupported();
+            ValidateDrawCmd(numVertices, firstVertex, numInstances, 0);
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawInstanced", instance.DrawInstanced(numVertices, firstVertex, numInstances) );
@@ -1112,10 +1177,14 @@ void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fi
 {
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertInstancingSupported();
-        AssertOffsetInstancingSupported();
-        ValidateDrawCmd(numVertices, firstVertex, numInstances, firstInstance);
+        AnalyzeAttachmentDraws();
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertInstancingSupported();
+            AssertOffsetInstancingSupported();
+            ValidateDrawCmd(numVertices, firstVertex, numInstances, firstInstance);
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawInstanced", instance.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance) );
@@ -1127,9 +1196,13 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
 {
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertInstancingSupported();
-        ValidateDrawIndexedCmd(numIndices, numInstances, firstIndex, 0, 0);
+        AnalyzeAttachmentDraws();
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertInstancingSupported();
+            ValidateDrawIndexedCmd(numIndices, numInstances, firstIndex, 0, 0);
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex) );
@@ -1141,9 +1214,13 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
 {
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertInstancingSupported();
-        ValidateDrawIndexedCmd(numIndices, numInstances, firstIndex, vertexOffset, 0);
+        AnalyzeAttachmentDraws();
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertInstancingSupported();
+            ValidateDrawIndexedCmd(numIndices, numInstances, firstIndex, vertexOffset, 0);
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset) );
@@ -1155,10 +1232,14 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
 {
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertInstancingSupported();
-        AssertOffsetInstancingSupported();
-        ValidateDrawIndexedCmd(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+        AnalyzeAttachmentDraws();
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertInstancingSupported();
+            AssertOffsetInstancingSupported();
+            ValidateDrawIndexedCmd(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance) );
@@ -1172,11 +1253,16 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertIndirectDrawingSupported();
-        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
-        ValidateBufferRange(bufferDbg, offset, sizeof(DrawIndirectArguments));
-        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        AnalyzeAttachmentDraws();
+        RecordResourceAccess(bufferDbg, false);
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertIndirectDrawingSupported();
+            ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+            ValidateBufferRange(bufferDbg, offset, sizeof(DrawIndirectArguments));
+            ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndirect", instance.DrawIndirect(bufferDbg.instance, offset) );
@@ -1190,12 +1276,17 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::u
 
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertIndirectDrawingSupported();
-        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
-        ValidateBufferRange(bufferDbg, offset, stride*numCommands);
-        ValidateAddressAlignment(offset, 4, "<offset> parameter");
-        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+        AnalyzeAttachmentDraws();
+        RecordResourceAccess(bufferDbg, false);
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertIndirectDrawingSupported();
+            ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+            ValidateBufferRange(bufferDbg, offset, stride*numCommands);
+            ValidateAddressAlignment(offset, 4, "<offset> parameter");
+            ValidateAddressAlignment(stride, 4, "<stride> parameter");
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndirect", instance.DrawIndirect(bufferDbg.instance, offset, numCommands, stride) );
@@ -1209,11 +1300,16 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertIndirectDrawingSupported();
-        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
-        ValidateBufferRange(bufferDbg, offset, sizeof(DrawIndexedIndirectArguments));
-        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        AnalyzeAttachmentDraws();
+        RecordResourceAccess(bufferDbg, false);
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertIndirectDrawingSupported();
+            ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+            ValidateBufferRange(bufferDbg, offset, sizeof(DrawIndexedIndirectArguments));
+            ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedIndirect", instance.DrawIndexedIndirect(bufferDbg.instance, offset) );
@@ -1227,12 +1323,17 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
 
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        AssertIndirectDrawingSupported();
-        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
-        ValidateBufferRange(bufferDbg, offset, stride*numCommands);
-        ValidateAddressAlignment(offset, 4, "<offset> parameter");
-        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+        AnalyzeAttachmentDraws();
+        RecordResourceAccess(bufferDbg, false);
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertIndirectDrawingSupported();
+            ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+            ValidateBufferRange(bufferDbg, offset, stride*numCommands);
+            ValidateAddressAlignment(offset, 4, "<offset> parameter");
+            ValidateAddressAlignment(stride, 4, "<stride> parameter");
+        }
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedIndirect", instance.DrawIndexedIndirect(bufferDbg.instance, offset, numCommands, stride) );
@@ -1240,14 +1341,104 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
     profile_.commandBufferRecord.drawCommands += numCommands;
 }
 
+void DbgCommandBuffer::DrawIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& argsBufferDbg     = LLGL_CAST(DbgBuffer&, argsBuffer);
+    auto& countBufferDbg    = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        AnalyzeAttachmentDraws();
+        RecordResourceAccess(argsBufferDbg, false);
+        RecordResourceAccess(countBufferDbg, false);
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertIndirectDrawingSupported();
+            AssertIndirectDrawCountSupported();
+            ValidateBindBufferFlags(argsBufferDbg, BindFlags::IndirectBuffer);
+            ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+            ValidateBufferRange(argsBufferDbg, argsOffset, stride*maxNumCommands, "argument range");
+            ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t), "count range");
+            ValidateAddressAlignment(argsOffset, 4, "<argsOffset> parameter");
+            ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+            ValidateAddressAlignment(stride, 4, "<stride> parameter");
+            if (stride < sizeof(DrawIndirectArguments))
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "<stride> parameter must be greater than or equal to sizeof(DrawIndirectArguments) = %u, but %u was specified",
+                    static_cast<unsigned>(sizeof(DrawIndirectArguments)), stride
+                );
+            }
+        }
+    }
+
+    LLGL_DBG_COMMAND( "DrawIndirectCount", instance.DrawIndirectCount(argsBufferDbg.instance, argsOffset, countBufferDbg.instance, countOffset, maxNumCommands, stride) );
+
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& argsBufferDbg     = LLGL_CAST(DbgBuffer&, argsBuffer);
+    auto& countBufferDbg    = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        AnalyzeAttachmentDraws();
+        RecordResourceAccess(argsBufferDbg, false);
+        RecordResourceAccess(countBufferDbg, false);
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            AssertIndirectDrawingSupported();
+            AssertIndirectDrawCountSupported();
+            ValidateBindBufferFlags(argsBufferDbg, BindFlags::IndirectBuffer);
+            ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+            ValidateBufferRange(argsBufferDbg, argsOffset, stride*maxNumCommands, "argument range");
+            ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t), "count range");
+            ValidateAddressAlignment(argsOffset, 4, "<argsOffset> parameter");
+            ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+            ValidateAddressAlignment(stride, 4, "<stride> parameter");
+            if (stride < sizeof(DrawIndexedIndirectArguments))
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "<stride> parameter must be greater than or equal to sizeof(DrawIndexedIndirectArguments) = %u, but %u was specified",
+                    static_cast<unsigned>(sizeof(DrawIndexedIndirectArguments)), stride
+                );
+            }
+        }
+    }
+
+    LLGL_DBG_COMMAND( "DrawIndexedIndirectCount", instance.DrawIndexedIndirectCount(argsBufferDbg.instance, argsOffset, countBufferDbg.instance, countOffset, maxNumCommands, stride) );
+
+    profile_.commandBufferRecord.drawCommands++;
+}
+
 /* ----- Compute ----- */
 
 void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
-    if (debugger_)
+    if (debugger_ && SampleValidation())
     {
         LLGL_DBG_SOURCE();
 
+        ValidateCommandQueueType(CommandQueueType::Compute, "compute dispatches");
+
         if (numWorkGroupsX * numWorkGroupsY * numWorkGroupsZ == 0)
             LLGL_DBG_WARN(WarningType::PointlessOperation, "thread group size has volume of 0 units");
 
@@ -1269,11 +1460,16 @@ void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 
     if (debugger_)
     {
-        LLGL_DBG_SOURCE();
-        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
-        ValidateBufferRange(bufferDbg, offset, sizeof(DispatchIndirectArguments));
-        ValidateAddressAlignment(offset, 4, "<offset> parameter");
-        ValidateBindingTable();
+        RecordResourceAccess(bufferDbg, false);
+        if (SampleValidation())
+        {
+            LLGL_DBG_SOURCE();
+            ValidateCommandQueueType(CommandQueueType::Compute, "compute dispatches");
+            ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+            ValidateAddressAlignment(offset, 4, "<offset> parameter");
+            ValidateBufferRange(bufferDbg, offset, sizeof(DispatchIndirectArguments));
+            ValidateBindingTable();
+        }
     }
 
     LLGL_DBG_COMMAND( "DispatchIndirect", instance.DispatchIndirect(bufferDbg.instance, offset) );
@@ -1297,10 +1493,16 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
 
     debugGroups_.push(name);
     instance.PushDebugGroup(name);
+
+    if (perfProfilerEnabled_)
+        queryTimerPool_.PushGroup(name);
 }
 
 void DbgCommandBuffer::PopDebugGroup()
 {
+    if (perfProfilerEnabled_)
+        queryTimerPool_.PopGroup();
+
     instance.PopDebugGroup();
     debugGroups_.pop();
 
@@ -1349,6 +1551,116 @@ void DbgCommandBuffer::ValidateSubmit()
     }
 }
 
+void DbgCommandBuffer::StampResourceAccesses(std::uint64_t serial)
+{
+    for (DbgBuffer* bufferDbg : records_.bufferReads)
+        bufferDbg->lastReadSerial = serial;
+    for (DbgBuffer* bufferDbg : records_.bufferWrites)
+        bufferDbg->lastWriteSerial = serial;
+    for (DbgTexture* textureDbg : records_.textureReads)
+        textureDbg->lastReadSerial = serial;
+    for (DbgTexture* textureDbg : records_.textureWrites)
+        textureDbg->lastWriteSerial = serial;
+}
+
+// Returns a descriptive name of the specified attachment slot for the load/store analysis, e.g. "color attachment [0] of texture 'GBuffer'".
+static std::string GetAttachmentSlotLabel(std::uint32_t slot, const DbgTexture& textureDbg)
+{
+    std::string s;
+
+    if (slot == DbgRenderTarget::depthStencilSlot)
+        s = "depth-stencil attachment";
+    else
+        s = "color attachment [" + std::to_string(slot) + "]";
+
+    if (!textureDbg.label.empty())
+        s += " of texture '" + textureDbg.label + "'";
+
+    return s;
+}
+
+void DbgCommandBuffer::ResolveAttachmentRecords()
+{
+    for (const RenderTargetPassPair& pair : records_.renderTargetPasses)
+        pair.renderTarget->NotifyAnalyzedRenderPass(*pair.renderPass);
+
+    /* Attachment records are merged in the order of submission, so previous submissions determine the state of the first access */
+    for (const AttachmentRecord& record : records_.attachments)
+    {
+        DbgTexture::AttachmentState& state = record.texture->attachmentState;
+
+        if (record.firstAccess == AttachmentAccess::Load && !state.contentDefined)
+        {
+            LLGL_DBG_WARN(
+                WarningType::PointlessOperation,
+                "render pass loads %s with undefined content; use LLGL::AttachmentLoadOp::Undefined instead",
+                GetAttachmentSlotLabel(record.firstSlot, *record.texture).c_str()
+            );
+        }
+
+        if (record.firstAccess == AttachmentAccess::Load || record.firstAccess == AttachmentAccess::Read)
+            record.texture->NotifyContentRead();
+        else if (record.firstAccess == AttachmentAccess::Overwrite && state.storePending)
+        {
+            state.storeRedundant    = true;
+            state.storePending      = false;
+            LLGL_DBG_WARN(
+                WarningType::PointlessOperation,
+                "render pass stores %s that is overwritten before it is read; use LLGL::AttachmentStoreOp::Undefined instead",
+                GetAttachmentSlotLabel(record.firstSlot, *record.texture).c_str()
+            );
+        }
+
+        /* Merge findings of this command buffer */
+        state.storeRedundant    |= record.state.storeRedundant;
+        state.storeRequired     |= record.state.storeRequired;
+        state.loadRedundant     |= record.state.loadRedundant;
+        state.loadRequired      |= record.state.loadRequired;
+
+        if (record.contentKnown)
+            state.contentDefined = record.state.contentDefined;
+        if (record.storeKnown)
+            state.storePending = record.state.storePending;
+    }
+}
+
+// Removes all entries from the specified record list for which the predicate returns true.
+template <typename T, typename TPredicate>
+static void EraseRecordsIf(std::vector<T>& records, TPredicate pred)
+{
+    records.erase(std::remove_if(records.begin(), records.end(), pred), records.end());
+}
+
+void DbgCommandBuffer::ReleaseRecords(const DbgBuffer& bufferDbg)
+{
+    auto IsBuffer = [&bufferDbg](const DbgBuffer* entry) { return (entry == &bufferDbg); };
+    EraseRecordsIf(records_.bufferReads, IsBuffer);
+    EraseRecordsIf(records_.bufferWrites, IsBuffer);
+}
+
+void DbgCommandBuffer::ReleaseRecords(const DbgTexture& textureDbg)
+{
+    auto IsTexture = [&textureDbg](const DbgTexture* entry) { return (entry == &textureDbg); };
+    EraseRecordsIf(records_.textureReads, IsTexture);
+    EraseRecordsIf(records_.textureWrites, IsTexture);
+    EraseRecordsIf(records_.attachments, [&textureDbg](const AttachmentRecord& entry) { return (entry.texture == &textureDbg); });
+}
+
+void DbgCommandBuffer::ReleaseRecords(const DbgSwapChain& swapChainDbg)
+{
+    EraseRecordsIf(records_.swapChainFrames, [&swapChainDbg](const SwapChainFramePair& entry) { return (entry.swapChain == &swapChainDbg); });
+}
+
+void DbgCommandBuffer::ReleaseRecords(const DbgRenderTarget& renderTargetDbg)
+{
+    EraseRecordsIf(records_.renderTargetPasses, [&renderTargetDbg](const RenderTargetPassPair& entry) { return (entry.renderTarget == &renderTargetDbg); });
+}
+
+void DbgCommandBuffer::ReleaseRecords(const DbgRenderPass& renderPassDbg)
+{
+    EraseRecordsIf(records_.renderTargetPasses, [&renderPassDbg](const RenderTargetPassPair& entry) { return (entry.renderPass == &renderPassDbg); });
+}
+
 #undef LLGL_DBG_COMMAND
 
 
@@ -1372,6 +1684,253 @@ void DbgCommandBuffer::EnableRecording(bool enable)
     }
 }
 
+template <typename T>
+static void RecordUniqueResource(std::vector<T*>& resources, T& resource)
+{
+    /* Skip consecutive duplicates, since the same resource is usually bound many times in a row */
+    if (resources.empty() || resources.back() != &resource)
+        resources.push_back(&resource);
+}
+
+void DbgCommandBuffer::RecordResourceAccess(DbgBuffer& bufferDbg, bool isWrite)
+{
+    if (hazardTrackingSampled_)
+        RecordUniqueResource(isWrite ? records_.bufferWrites : records_.bufferReads, bufferDbg);
+}
+
+void DbgCommandBuffer::RecordResourceAccess(DbgTexture& textureDbg, bool isWrite)
+{
+    if (hazardTrackingSampled_)
+        RecordUniqueResource(isWrite ? records_.textureWrites : records_.textureReads, textureDbg);
+
+    /* Keep track of attachment content for the load/store analysis */
+    if (loadStoreAnalysis_ != LoadStoreAnalysis::Disabled &&
+        (textureDbg.desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0)
+    {
+        AttachmentRecord& record = GetAttachmentRecord(textureDbg);
+        if (isWrite)
+        {
+            record.state.contentDefined = true;
+            record.contentKnown         = true;
+        }
+        else
+            ReadAttachmentContent(record, AttachmentAccess::Read, 0);
+    }
+}
+
+void DbgCommandBuffer::RecordRenderTargetAccess(const DbgRenderTarget& renderTargetDbg)
+{
+    /* Only record attachments for hazard tracking; their content is tracked by the load/store analysis */
+    auto RecordAttachment = [this](const AttachmentDescriptor& attachmentDesc)
+    {
+        if (attachmentDesc.texture != nullptr && hazardTrackingSampled_)
+            RecordUniqueResource(records_.textureWrites, LLGL_CAST(DbgTexture&, *attachmentDesc.texture));
+    };
+
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        RecordAttachment(renderTargetDbg.desc.colorAttachments[i]);
+        RecordAttachment(renderTargetDbg.desc.resolveAttachments[i]);
+    }
+    RecordAttachment(renderTargetDbg.desc.depthStencilAttachment);
+}
+
+void DbgCommandBuffer::AnalyzeAttachmentLoads(DbgRenderTarget& renderTargetDbg, const DbgRenderPass& renderPassDbg)
+{
+    /* Render target is only updated on submission, since it can be shared between command buffers that are encoded on different threads */
+    records_.renderTargetPasses.push_back({ &renderTargetDbg, &renderPassDbg });
+
+    bindings_.analyzedRenderPass        = &renderPassDbg;
+    bindings_.pendingAttachmentLoads    = 0;
+
+    for_range(slot, DbgRenderTarget::numAttachmentSlots)
+    {
+        DbgTexture* textureDbg = renderTargetDbg.GetAttachmentTexture(slot);
+        if (textureDbg == nullptr)
+            continue;
+
+        AttachmentRecord& record = GetAttachmentRecord(*textureDbg);
+        const AttachmentLoadOp loadOp = DbgRenderTarget::GetAttachmentLoadOp(renderPassDbg.desc, slot);
+
+        if (loadOp == AttachmentLoadOp::Load)
+        {
+            /* Loading the attachment consumes the content that was stored by a previous render pass */
+            const bool contentKnown = record.contentKnown;
+            ReadAttachmentContent(record, (contentKnown ? AttachmentAccess::Read : AttachmentAccess::Load), slot);
+
+            /* Content of previous submissions is only validated when this command buffer is submitted */
+            if (!contentKnown || record.state.contentDefined)
+                bindings_.pendingAttachmentLoads |= (1u << slot);
+            else
+            {
+                LLGL_DBG_WARN(
+                    WarningType::PointlessOperation,
+                    "render pass loads %s with undefined content; use LLGL::AttachmentLoadOp::Undefined instead",
+                    GetAttachmentSlotLabel(slot, *textureDbg).c_str()
+                );
+            }
+        }
+        else
+        {
+            OverwriteAttachmentContent(record, slot);
+
+            if (loadOp == AttachmentLoadOp::Clear)
+                bindings_.pendingAttachmentLoads |= (1u << slot);
+        }
+    }
+}
+
+void DbgCommandBuffer::AnalyzeAttachmentClears(long flags, std::uint32_t colorAttachment)
+{
+    DbgRenderTarget* renderTargetDbg = bindings_.renderTarget;
+    if (renderTargetDbg == nullptr)
+        return;
+
+    /* Determine which attachment slots are fully cleared by this command */
+    std::uint32_t clearedSlots = 0;
+
+    if ((flags & ClearFlags::Color) != 0)
+    {
+        if (colorAttachment < LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+            clearedSlots |= (1u << colorAttachment);
+        else
+            clearedSlots |= ((1u << LLGL_MAX_NUM_COLOR_ATTACHMENTS) - 1u);
+    }
+
+    if ((flags & ClearFlags::DepthStencil) != 0)
+    {
+        /* Depth-stencil attachment is only fully cleared if all of its components are cleared */
+        if (DbgTexture* textureDbg = renderTargetDbg->GetAttachmentTexture(DbgRenderTarget::depthStencilSlot))
+        {
+            const Format format = textureDbg->GetFormat();
+            const bool isDepthCleared   = ((flags & ClearFlags::Depth  ) != 0 || !IsDepthFormat(format));
+            const bool isStencilCleared = ((flags & ClearFlags::Stencil) != 0 || !IsStencilFormat(format));
+            if (isDepthCleared && isStencilCleared)
+                clearedSlots |= (1u << DbgRenderTarget::depthStencilSlot);
+        }
+    }
+
+    /* Load operations of attachments that are cleared before anything is drawn are unnecessary */
+    const std::uint32_t redundantLoads = (bindings_.pendingAttachmentLoads & clearedSlots);
+    if (redundantLoads == 0)
+        return;
+
+    for_range(slot, DbgRenderTarget::numAttachmentSlots)
+    {
+        if ((redundantLoads & (1u << slot)) != 0)
+        {
+            if (DbgTexture* textureDbg = renderTargetDbg->GetAttachmentTexture(slot))
+            {
+                GetAttachmentRecord(*textureDbg).state.loadRedundant = true;
+                const bool isLoadOp = (DbgRenderTarget::GetAttachmentLoadOp(bindings_.analyzedRenderPass->desc, slot) == AttachmentLoadOp::Load);
+                LLGL_DBG_WARN(
+                    WarningType::PointlessOperation,
+                    "render pass %s %s that is cleared again before anything is drawn; use LLGL::AttachmentLoadOp::Undefined instead",
+                    (isLoadOp ? "loads" : "clears"), GetAttachmentSlotLabel(slot, *textureDbg).c_str()
+                );
+            }
+        }
+    }
+
+    bindings_.pendingAttachmentLoads &= ~redundantLoads;
+}
+
+void DbgCommandBuffer::AnalyzeAttachmentDraws()
+{
+    if (bindings_.pendingAttachmentLoads == 0)
+        return;
+
+    /* Load operations of all attachments that have not been cleared again before the first draw command are necessary */
+    if (DbgRenderTarget* renderTargetDbg = bindings_.renderTarget)
+    {
+        for_range(slot, DbgRenderTarget::numAttachmentSlots)
+        {
+            if ((bindings_.pendingAttachmentLoads & (1u << slot)) != 0)
+            {
+                if (DbgTexture* textureDbg = renderTargetDbg->GetAttachmentTexture(slot))
+                    GetAttachmentRecord(*textureDbg).state.loadRequired = true;
+            }
+        }
+    }
+
+    bindings_.pendingAttachmentLoads = 0;
+}
+
+void DbgCommandBuffer::AnalyzeAttachmentStores()
+{
+    /* Render passes without draw commands keep their load operations */
+    AnalyzeAttachmentDraws();
+
+    if (DbgRenderTarget* renderTargetDbg = bindings_.renderTarget)
+    {
+        for_range(slot, DbgRenderTarget::numAttachmentSlots)
+        {
+            if (DbgTexture* textureDbg = renderTargetDbg->GetAttachmentTexture(slot))
+            {
+                AttachmentRecord& record = GetAttachmentRecord(*textureDbg);
+                const bool isStored = (DbgRenderTarget::GetAttachmentStoreOp(bindings_.analyzedRenderPass->desc, slot) == AttachmentStoreOp::Store);
+                record.state.contentDefined = isStored;
+                record.state.storePending   = isStored;
+                record.contentKnown         = true;
+                record.storeKnown           = true;
+            }
+        }
+    }
+
+    bindings_.analyzedRenderPass = nullptr;
+}
+
+DbgCommandBuffer::AttachmentRecord& DbgCommandBuffer::GetAttachmentRecord(DbgTexture& textureDbg)
+{
+    /* Search backwards, since the records of secondary command buffers are appended and can contain the same texture */
+    for (auto it = records_.attachments.rbegin(); it != records_.attachments.rend(); ++it)
+    {
+        if (it->texture == &textureDbg)
+            return *it;
+    }
+
+    AttachmentRecord record;
+    record.texture = &textureDbg;
+    records_.attachments.push_back(record);
+    return records_.attachments.back();
+}
+
+void DbgCommandBuffer::ReadAttachmentContent(AttachmentRecord& record, AttachmentAccess access, std::uint32_t slot)
+{
+    if (record.firstAccess == AttachmentAccess::None)
+    {
+        record.firstAccess  = access;
+        record.firstSlot    = slot;
+    }
+
+    if (record.state.storePending)
+    {
+        record.state.storeRequired  = true;
+        record.state.storePending   = false;
+    }
+}
+
+void DbgCommandBuffer::OverwriteAttachmentContent(AttachmentRecord& record, std::uint32_t slot)
+{
+    if (record.firstAccess == AttachmentAccess::None)
+    {
+        record.firstAccess  = AttachmentAccess::Overwrite;
+        record.firstSlot    = slot;
+    }
+
+    /* Overwriting the attachment makes the previous store operation unnecessary if the content has not been read since */
+    if (record.state.storePending)
+    {
+        record.state.storeRedundant = true;
+        record.state.storePending   = false;
+        LLGL_DBG_WARN(
+            WarningType::PointlessOperation,
+            "render pass stores %s that is overwritten before it is read; use LLGL::AttachmentStoreOp::Undefined instead",
+            GetAttachmentSlotLabel(slot, *record.texture).c_str()
+        );
+    }
+}
+
 void DbgCommandBuffer::ValidateGenerateMips(DbgTexture& textureDbg, const TextureSubresource* subresource)
 {
     if ((textureDbg.desc.bindFlags & BindFlags::ColorAttachment) == 0)
@@ -1640,12 +2199,12 @@ void DbgCommandBuffer::ValidateDrawCmd(
     AssertGraphicsPipelineBound();
     AssertVertexBufferBound();
     AssertViewportBound();
-    ValidateDynamicStates();
-    ValidateVertexLayout();
     ValidateNumVertices(numVertices);
     ValidateNumInstances(numInstances);
     ValidateVertexID(firstVertex);
     ValidateInstanceID(firstInstance);
+    ValidateDynamicStates();
+    ValidateVertexLayout();
     ValidateBindingTable();
 
     if (bindings_.numVertexBuffers > 0 && bindings_.anyShaderAttributes)
@@ -1661,11 +2220,11 @@ void DbgCommandBuffer::ValidateDrawIndexedCmd(
     AssertVertexBufferBound();
     AssertIndexBufferBound();
     AssertViewportBound();
-    ValidateDynamicStates();
-    ValidateVertexLayout();
     ValidateNumVertices(numVertices);
     ValidateNumInstances(numInstances);
     ValidateInstanceID(firstInstance);
+    ValidateDynamicStates();
+    ValidateVertexLayout();
     ValidateBindingTable();
 
     if (bindings_.indexBuffer)
@@ -1980,6 +2539,14 @@ void DbgCommandBuffer::ValidateTextureBufferCopyStrides(DbgTexture& textureDbg,
     }
 }
 
+void DbgCommandBuffer::ValidateCommandQueueType(const CommandQueueType requiredType, const char* commandsName)
+{
+    /* Queue types are ordered by their capabilities, i.e. graphics queues support compute commands and compute queues support copy commands */
+    const CommandQueueType queueType = commandQueue_.GetType();
+    if (static_cast<int>(queueType) > static_cast<int>(requiredType))
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "%s are not supported on %s command queue", commandsName, ToString(queueType));
+}
+
 void DbgCommandBuffer::ValidateStageFlags(long stageFlags, long validFlags)
 {
     if ((stageFlags & validFlags) == 0)
@@ -2293,6 +2860,8 @@ void DbgCommandBuffer::AssertInsideRenderPass()
 {
     if (!states_.insideRenderPass && !IsInheritedCmdBuffer())
         LLGL_DBG_ERROR(ErrorType::InvalidState, "operation is only allowed inside a render pass; missing call to <LLGL::CommandBuffer::BeginRenderPass>");
+    else if (states_.insideParallelRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "operation is not allowed inside a parallel render pass; commands must be encoded by secondary command buffers");
 }
 
 void DbgCommandBuffer::AssertGraphicsPipelineBound()
@@ -2360,6 +2929,12 @@ void DbgCommandBuffer::AssertIndirectDrawingSupported()
         LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
 }
 
+void DbgCommandBuffer::AssertIndirectDrawCountSupported()
+{
+    if (!features_.hasIndirectDrawCount)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect draw count");
+}
+
 void DbgCommandBuffer::AssertNullPointer(const void* ptr, const char* name)
 {
     if (ptr == nullptr)
@@ -2381,6 +2956,115 @@ void DbgCommandBuffer::WarnImproperVertices(const char* topologyName, std::uint3
     );
 }
 
+void DbgCommandBuffer::BeginRenderPassSection(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex,
+    bool                parallel)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        ValidateCommandQueueType(CommandQueueType::Graphics, "render passes");
+
+        if (IsInheritedCmdBuffer())
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot begin render passes with secondary command buffer that inherits its state from a primary command buffer"
+            );
+        }
+        else
+        {
+            if (states_.insideRenderPass)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidState,
+                    "cannot begin new render pass while previous render pass is still active"
+                );
+            }
+            states_.insideRenderPass            = true;
+            states_.insideParallelRenderPass    = parallel;
+        }
+    }
+
+    const RenderPass* renderPassInstance = DbgGetInstance<DbgRenderPass>(renderPass);
+
+    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
+    {
+        auto& swapChainDbg = LLGL_CAST(DbgSwapChain&, renderTarget);
+
+        swapChainDbg.NotifyNextRenderPass(debugger_, renderPass);
+
+        bindings_.swapChain     = &swapChainDbg;
+        bindings_.renderTarget  = nullptr;
+
+        /* Record swap-chain frame to validate when submitting the command buffer */
+        if (debugger_)
+        {
+            const std::uint32_t actualSwapBufferIndex = (swapBufferIndex == LLGL_CURRENT_SWAP_INDEX ? swapChainDbg.GetCurrentSwapIndex() : swapBufferIndex);
+            records_.swapChainFrames.push_back({ bindings_.swapChain, actualSwapBufferIndex });
+            ValidateSwapBufferIndex(swapChainDbg, actualSwapBufferIndex);
+        }
+
+        if (parallel)
+            instance.BeginParallelRenderPass(swapChainDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
+        else
+            instance.BeginRenderPass(swapChainDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
+    }
+    else
+    {
+        auto& renderTargetDbg = LLGL_CAST(DbgRenderTarget&, renderTarget);
+
+        bindings_.swapChain     = nullptr;
+        bindings_.renderTarget  = &renderTargetDbg;
+
+        ClearValue optimizedClearValues[DbgRenderTarget::numAttachmentSlots];
+
+        if (debugger_)
+        {
+            if (loadStoreAnalysis_ != LoadStoreAnalysis::Disabled)
+            {
+                if (const DbgRenderPass* effectiveRenderPassDbg = renderTargetDbg.GetEffectiveRenderPass(renderPass))
+                {
+                    AnalyzeAttachmentLoads(renderTargetDbg, *effectiveRenderPassDbg);
+
+                    /*
+                    Substitute render pass with downgraded load operations that were learned from previous frames.
+                    Multi-submit command buffers keep the original render pass, since they can outlive any optimized render pass.
+                    */
+                    DbgRenderTarget::OptimizedRenderPass optimizedRenderPass;
+                    if (loadStoreAnalysis_ == LoadStoreAnalysis::Downgrade &&
+                        (desc.flags & CommandBufferFlags::MultiSubmit) == 0 &&
+                        renderTargetDbg.GetOptimizedRenderPass(effectiveRenderPassDbg, optimizedRenderPass))
+                    {
+                        for_range(i, optimizedRenderPass.numClearValues)
+                        {
+                            const std::uint32_t clearValueIndex = optimizedRenderPass.clearValueMap[i];
+                            if (clearValueIndex < numClearValues)
+                                optimizedClearValues[i] = clearValues[clearValueIndex];
+                        }
+                        renderPassInstance  = optimizedRenderPass.instance;
+                        numClearValues      = optimizedRenderPass.numClearValues;
+                        clearValues         = optimizedClearValues;
+                    }
+                }
+            }
+            RecordRenderTargetAccess(renderTargetDbg);
+        }
+
+        if (parallel)
+            instance.BeginParallelRenderPass(renderTargetDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
+        else
+            instance.BeginRenderPass(renderTargetDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
+    }
+
+    profile_.commandBufferRecord.renderPassSections++;
+}
+
 void DbgCommandBuffer::ResetStates()
 {
     /* Reset all counters of frame profile, bindings, and other command buffer states */
@@ -2392,6 +3076,12 @@ void DbgCommandBuffer::ResetStates()
 void DbgCommandBuffer::ResetRecords()
 {
     records_.swapChainFrames.clear();
+    records_.bufferReads.clear();
+    records_.bufferWrites.clear();
+    records_.textureReads.clear();
+    records_.textureWrites.clear();
+    records_.attachments.clear();
+    records_.renderTargetPasses.clear();
 }
 
 void DbgCommandBuffer::ResetBindingTable(const DbgPipelineLayout* pipelineLayoutDbg)
@@ -2428,6 +3118,39 @@ void DbgCommandBuffer::EndTimer()
     queryTimerPool_.Stop();
 }
 
+// Returns true if the next event is sampled with the specified sampling configuration and advances the sampling state.
+static bool SampleNextEvent(const ValidationSampling& sampling, std::uint32_t& counter, std::uint32_t& randomState)
+{
+    const std::uint32_t interval = sampling.interval;
+    if (interval <= 1)
+        return true;
+
+    if (sampling.randomized)
+    {
+        /* Advance xorshift32 state and sample with a probability of 1/interval */
+        std::uint32_t& x = randomState;
+        x ^= (x << 13);
+        x ^= (x >> 17);
+        x ^= (x << 5);
+        return (x % interval == 0);
+    }
+
+    /* Sample every N-th event, starting with the first one */
+    const bool sampled = (counter == 0);
+    counter = (counter + 1) % interval;
+    return sampled;
+}
+
+bool DbgCommandBuffer::SampleValidation()
+{
+    return SampleNextEvent(validationSampling_, validationCounter_, validationRandomState_);
+}
+
+bool DbgCommandBuffer::SampleHazardTracking()
+{
+    return SampleNextEvent(validationSampling_, hazardCounter_, hazardRandomState_);
+}
+
 bool DbgCommandBuffer::IsInheritedCmdBuffer() const
 {
     return ((desc.flags & CommandBufferFlags::Secondary) != 0 && desc.renderPass != nullptr);
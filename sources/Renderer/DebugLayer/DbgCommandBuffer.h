@@ -14,6 +14,7 @@
 #include <LLGL/Constants.h>
 #include <LLGL/Container/ArrayView.h>
 #include "RenderState/DbgQueryHeap.h"
+#include "Texture/DbgTexture.h"
 #include "DbgQueryTimerPool.h"
 #include <cstdint>
 #include <string>
@@ -28,9 +29,11 @@ class DbgBuffer;
 class DbgTexture;
 class DbgSwapChain;
 class DbgRenderTarget;
+class DbgRenderPass;
 class DbgPipelineState;
 class DbgPipelineLayout;
 class DbgShader;
+class DbgCommandQueue;
 
 class DbgCommandBuffer final : public CommandBuffer
 {
@@ -42,13 +45,14 @@ class DbgCommandBuffer final : public CommandBuffer
     public:
 
         DbgCommandBuffer(
-            RenderSystem&                   renderSystemInstance,
-            CommandQueue&                   commandQueueInstance,
-            CommandBuffer&                  commandBufferInstance,
-            FrameProfile&                   commonProfile,
-            RenderingDebugger*              debugger,
-            const CommandBufferDescriptor&  desc,
-            const RenderingCapabilities&    caps
+            RenderSystem&                     renderSystemInstance,
+            DbgCommandQueue&                  commandQueue,
+            CommandBuffer&                    commandBufferInstance,
+            FrameProfile&                     commonProfile,
+            const std::atomic<std::uint64_t>& frameCounter,
+            RenderingDebugger*                debugger,
+            const CommandBufferDescriptor&    desc,
+            const RenderingCapabilities&      caps
         );
 
     public:
@@ -57,15 +61,71 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void ValidateSubmit();
 
+        // Stamps all buffers and textures this command buffer accessed with the specified submission serial.
+        void StampResourceAccesses(std::uint64_t serial);
+
+        // Merges the load/store analysis of this command buffer into its attachment textures and render targets. Must be called on submission.
+        void ResolveAttachmentRecords();
+
+        // Removes all records of the specified object. Must be called when the object is released, so no dangling pointers remain for later submissions.
+        void ReleaseRecords(const DbgBuffer& bufferDbg);
+        void ReleaseRecords(const DbgTexture& textureDbg);
+        void ReleaseRecords(const DbgSwapChain& swapChainDbg);
+        void ReleaseRecords(const DbgRenderTarget& renderTargetDbg);
+        void ReleaseRecords(const DbgRenderPass& renderPassDbg);
+
+        // Returns the command queue this command buffer was created for.
+        inline DbgCommandQueue& GetCommandQueue() const
+        {
+            return commandQueue_;
+        }
+
     public:
 
         CommandBuffer&                  instance;
         const CommandBufferDescriptor   desc;
 
+    private:
+
+        // First access of an attachment within a command buffer that depends on the content of previous submissions.
+        enum class AttachmentAccess
+        {
+            None,       // Content of previous submissions has not been accessed.
+            Load,       // Loaded by a render pass before its content was determined within this command buffer.
+            Read,       // Read by a copy command or loaded by a render pass.
+            Overwrite,  // Cleared or discarded by a render pass.
+        };
+
+        // Load/store analysis state of an attachment texture within a single command buffer.
+        struct AttachmentRecord
+        {
+            DbgTexture*                 texture         = nullptr;
+            DbgTexture::AttachmentState state;
+            AttachmentAccess            firstAccess     = AttachmentAccess::None;
+            std::uint32_t               firstSlot       = 0;        // Attachment slot of the first access; Only used for diagnostics.
+            bool                        contentKnown    = false;    // Content has been defined or invalidated within this command buffer.
+            bool                        storeKnown      = false;    // Content has been stored or discarded by a render pass within this command buffer.
+        };
+
     private:
 
         void EnableRecording(bool enable);
 
+        // Records the specified resource as being read or written by this command buffer for hazard tracking.
+        void RecordResourceAccess(DbgBuffer& bufferDbg, bool isWrite);
+        void RecordResourceAccess(DbgTexture& textureDbg, bool isWrite);
+        void RecordRenderTargetAccess(const DbgRenderTarget& renderTargetDbg);
+
+        // Load/store analysis of render pass attachments.
+        void AnalyzeAttachmentLoads(DbgRenderTarget& renderTargetDbg, const DbgRenderPass& renderPassDbg);
+        void AnalyzeAttachmentClears(long flags, std::uint32_t colorAttachment);
+        void AnalyzeAttachmentDraws();
+        void AnalyzeAttachmentStores();
+
+        AttachmentRecord& GetAttachmentRecord(DbgTexture& textureDbg);
+        void ReadAttachmentContent(AttachmentRecord& record, AttachmentAccess access, std::uint32_t slot);
+        void OverwriteAttachmentContent(AttachmentRecord& record, std::uint32_t slot);
+
         void ValidateGenerateMips(DbgTexture& textureDbg, const TextureSubresource* subresource = nullptr);
         void ValidateViewport(const Viewport& viewport);
         void ValidateAttachmentClear(const AttachmentClear& attachment);
@@ -93,6 +153,9 @@ class DbgCommandBuffer final : public CommandBuffer
         void ValidateIndexType(const Format format);
         void ValidateTextureBufferCopyStrides(DbgTexture& textureDbg, std::uint32_t rowStride, std::uint32_t layerStride, const Extent3D& extent);
 
+        // Validates that the command queue this command buffer was created for supports commands of the specified queue type.
+        void ValidateCommandQueueType(const CommandQueueType requiredType, const char* commandsName);
+
         void ValidateStageFlags(long stageFlags, long validFlags);
         void ValidateBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size, const char* rangeName = nullptr);
         void ValidateAddressAlignment(std::uint64_t address, std::uint64_t alignment, const char* addressName);
@@ -128,11 +191,22 @@ class DbgCommandBuffer final : public CommandBuffer
         void AssertInstancingSupported();
         void AssertOffsetInstancingSupported();
         void AssertIndirectDrawingSupported();
+        void AssertIndirectDrawCountSupported();
 
         void AssertNullPointer(const void* ptr, const char* name);
 
         void WarnImproperVertices(const char* topologyName, std::uint32_t unusedVertices);
 
+        // Shared implementation of BeginRenderPass and BeginParallelRenderPass.
+        void BeginRenderPassSection(
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass,
+            std::uint32_t       numClearValues,
+            const ClearValue*   clearValues,
+            std::uint32_t       swapBufferIndex,
+            bool                parallel
+        );
+
         void ResetStates();
         void ResetRecords();
         void ResetBindingTable(const DbgPipelineLayout* pipelineLayoutDbg);
@@ -140,6 +214,12 @@ class DbgCommandBuffer final : public CommandBuffer
         void StartTimer(const char* annotation);
         void EndTimer();
 
+        // Returns true if the current command is sampled for validation. Must be called at most once per command.
+        bool SampleValidation();
+
+        // Returns true if the current encoding is sampled for hazard tracking. Uses a separate sampling state, so it does not affect SampleValidation.
+        bool SampleHazardTracking();
+
         // Returns true if this command buffer inherits its state from a primary command buffer.
         bool IsInheritedCmdBuffer() const;
 
@@ -153,10 +233,17 @@ class DbgCommandBuffer final : public CommandBuffer
             std::uint64_t   frame;      // Frame index when the swap-chain render-pass was encoded
         };
 
+        struct RenderTargetPassPair
+        {
+            DbgRenderTarget*        renderTarget;
+            const DbgRenderPass*    renderPass;     // Render pass the load/store analysis was recorded with
+        };
+
     private:
 
         /* ----- Common objects ----- */
 
+        DbgCommandQueue&            commandQueue_;
         RenderingDebugger*          debugger_                               = nullptr;
         FrameProfile&               commonProfile_;
 
@@ -168,6 +255,15 @@ class DbgCommandBuffer final : public CommandBuffer
         DbgQueryTimerPool           queryTimerPool_;
         bool                        perfProfilerEnabled_                    = false;
 
+        ValidationSampling          validationSampling_;
+        LoadStoreAnalysis           loadStoreAnalysis_                      = LoadStoreAnalysis::Disabled;
+        std::uint32_t               validationCounter_                      = 0;
+        std::uint32_t               validationRandomState_                  = 0;
+        std::uint32_t               hazardCounter_                          = 0;
+        std::uint32_t               hazardRandomState_                      = 0;
+        std::uint32_t               numEncodings_                           = 0;
+        bool                        hazardTrackingSampled_                  = true;
+
         /* ----- Render states ----- */
 
         FrameProfile                profile_;
@@ -179,6 +275,8 @@ class DbgCommandBuffer final : public CommandBuffer
             // Framebuffers
             DbgSwapChain*           swapChain                               = nullptr;
             DbgRenderTarget*        renderTarget                            = nullptr;
+            const DbgRenderPass*    analyzedRenderPass                      = nullptr;
+            std::uint32_t           pendingAttachmentLoads                  = 0;
             std::uint32_t           numViewports                            = 0;
 
             // Stream inputs/outputs
@@ -214,13 +312,20 @@ class DbgCommandBuffer final : public CommandBuffer
         {
             bool                    recording                               = false;
             bool                    insideRenderPass                        = false;
+            bool                    insideParallelRenderPass                = false;
             bool                    streamOutputBusy                        = false;
         }
         states_;
 
         struct Records
         {
-            std::vector<SwapChainFramePair> swapChainFrames;
+            std::vector<SwapChainFramePair>     swapChainFrames;
+            std::vector<DbgBuffer*>             bufferReads;
+            std::vector<DbgBuffer*>             bufferWrites;
+            std::vector<DbgTexture*>            textureReads;
+            std::vector<DbgTexture*>            textureWrites;
+            std::vector<AttachmentRecord>       attachments;
+            std::vector<RenderTargetPassPair>   renderTargetPasses;
         }
         records_;
 
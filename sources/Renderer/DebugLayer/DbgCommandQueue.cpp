@@ -9,18 +9,24 @@
 #include "DbgCommandBuffer.h"
 #include "DbgCore.h"
 #include "../CheckedCast.h"
+#include "../../Core/Threading.h"
 #include <LLGL/RenderingDebugger.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-DbgCommandQueue::DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger) :
-    instance  { instance },
-    profile_  { profile  },
-    debugger_ { debugger }
+DbgCommandQueue::DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger, DbgCommandQueue* timeline) :
+    CommandQueue { instance.GetType() },
+    instance     { instance           },
+    debugger_    { debugger           },
+    profile_     { profile            },
+    timeline_    { timeline           }
 {
 }
 
@@ -34,16 +40,34 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
     {
         LLGL_DBG_SOURCE();
         commandBufferDbg.ValidateSubmit();
+        if (&(commandBufferDbg.GetCommandQueue()) != this)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot submit command buffer to %s command queue: command buffer was created for %s command queue",
+                ToString(GetType()), ToString(commandBufferDbg.GetCommandQueue().GetType())
+            );
+        }
     }
 
+    const bool timeRecording = IsTimeRecording();
+    const std::uint64_t cpuTicksStart = (timeRecording ? Timer::Tick() : 0);
+
     instance.Submit(commandBufferDbg.instance);
 
+    /* Stamp all resources this command buffer accessed with the new submission serial */
+    commandBufferDbg.StampResourceAccesses(AdvanceSubmissionSerial());
+    commandBufferDbg.ResolveAttachmentRecords();
+
     /* Merge frame profile values into rendering profiler */
     FrameProfile profile;
     commandBufferDbg.FlushProfile(profile);
 
     RenderingDebugger::MergeProfiles(profile_, profile);
     profile_.commandQueueRecord.commandBufferSubmittions++;
+
+    if (timeRecording)
+        RecordTime("Submit", cpuTicksStart);
 }
 
 /* ----- Queries ----- */
@@ -65,18 +89,236 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
 
 void DbgCommandQueue::Submit(Fence& fence)
 {
+    std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        const auto& fenceTimelines = GetTimeline().fenceTimelines_;
+        if (fenceTimelines.find(&fence) != fenceTimelines.end())
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot submit fence that has already been signaled with a value via SubmitSignal()");
+    }
+
     instance.Submit(fence);
+    GetTimeline().fenceSerials_[&fence] = lastQueueSerial_;
     profile_.commandQueueRecord.fenceSubmissions++;
 }
 
 bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
-    return instance.WaitFence(fence, timeout);
+    /* Don't hold the timeline lock while waiting, since other queues must be able to submit in the meantime */
+    bool            hasFenceSerial  = false;
+    std::uint64_t   fenceSerial     = 0;
+    {
+        std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+
+        const auto& fenceSerials = GetTimeline().fenceSerials_;
+        auto fenceSerialIt = fenceSerials.find(&fence);
+        if (fenceSerialIt != fenceSerials.end())
+        {
+            hasFenceSerial  = true;
+            fenceSerial     = fenceSerialIt->second;
+        }
+
+        if (debugger_)
+        {
+            LLGL_DBG_SOURCE();
+            if (!hasFenceSerial)
+                LLGL_DBG_WARN(WarningType::ImproperState, "waiting for fence that has not been submitted to the command queue");
+            else if (fenceSerial <= GetTimeline().completedSerial_)
+                LLGL_DBG_WARN(WarningType::PointlessOperation, "avoidable fence wait: all command buffers submitted before this fence are already synchronized");
+        }
+    }
+
+    const bool timeRecording = IsTimeRecording();
+    const std::uint64_t cpuTicksStart = (timeRecording ? Timer::Tick() : 0);
+
+    const bool result = instance.WaitFence(fence, timeout);
+
+    if (timeRecording)
+        RecordTime("WaitFence", cpuTicksStart);
+
+    /* Everything that was submitted before the fence is complete once the fence has been signaled */
+    if (result && hasFenceSerial)
+    {
+        std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+        CompleteSubmissions(fenceSerial);
+    }
+
+    return result;
 }
 
 void DbgCommandQueue::WaitIdle()
 {
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+        if (GetTimeline().completedSerial_ >= lastQueueSerial_)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "avoidable WaitIdle: no command buffers have been submitted since the last synchronization");
+    }
+
+    const bool timeRecording = IsTimeRecording();
+    const std::uint64_t cpuTicksStart = (timeRecording ? Timer::Tick() : 0);
+
     instance.WaitIdle();
+
+    if (timeRecording)
+        RecordTime("WaitIdle", cpuTicksStart);
+
+    std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+    CompleteSubmissions(lastQueueSerial_);
+}
+
+void DbgCommandQueue::SubmitWait(Fence& fence)
+{
+    {
+        std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+
+        const auto& fenceSerials = GetTimeline().fenceSerials_;
+        auto fenceSerialIt = fenceSerials.find(&fence);
+
+        if (fenceSerialIt != fenceSerials.end())
+        {
+            /* Work submitted to this queue from now on completes after everything that was submitted before the fence */
+            lastQueueSerial_ = std::max(lastQueueSerial_, fenceSerialIt->second);
+        }
+        else if (debugger_)
+        {
+            LLGL_DBG_SOURCE();
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot wait for fence on command queue: fence has not been submitted to any command queue");
+        }
+    }
+
+    instance.SubmitWait(fence);
+    profile_.commandQueueRecord.fenceSubmissions++;
+}
+
+void DbgCommandQueue::SubmitSignal(Fence& fence, std::uint64_t value)
+{
+    std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+
+    auto& fenceTimeline = GetTimeline().fenceTimelines_[&fence];
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        const auto& fenceSerials = GetTimeline().fenceSerials_;
+        if (fenceSerials.find(&fence) != fenceSerials.end())
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot signal fence with a value that has already been submitted via Submit(Fence&)");
+        if (value <= fenceTimeline.lastValue)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "fence values must increase monotonically: signaling value %" PRIu64 " but fence has already been signaled with value %" PRIu64,
+                value, fenceTimeline.lastValue
+            );
+        }
+    }
+
+    instance.SubmitSignal(fence, value);
+
+    if (value > fenceTimeline.lastValue)
+    {
+        fenceTimeline.lastValue = value;
+        fenceTimeline.signals.push_back(FenceSignal{ value, lastQueueSerial_ });
+    }
+
+    profile_.commandQueueRecord.fenceSubmissions++;
+}
+
+bool DbgCommandQueue::WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+        ValidateFenceValue(fence, value);
+    }
+
+    const bool timeRecording = IsTimeRecording();
+    const std::uint64_t cpuTicksStart = (timeRecording ? Timer::Tick() : 0);
+
+    const bool result = instance.WaitFenceValue(fence, value, timeout);
+
+    if (timeRecording)
+        RecordTime("WaitFenceValue", cpuTicksStart);
+
+    if (result)
+    {
+        std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+        CompleteFenceValue(fence, value);
+    }
+
+    return result;
+}
+
+bool DbgCommandQueue::WaitFenceValues(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, std::uint64_t timeout)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        if (numFences == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "waiting for fence values has no effect: <numFences> is zero");
+        else if (fences == nullptr || values == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot wait for fence values with <fences> or <values> parameter being a null pointer");
+        else
+        {
+            std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+            for_range(i, numFences)
+            {
+                if (fences[i] == nullptr)
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot wait for fence value: fences[%u] is a null pointer", i);
+                else
+                    ValidateFenceValue(*fences[i], values[i]);
+            }
+        }
+    }
+
+    const bool timeRecording = IsTimeRecording();
+    const std::uint64_t cpuTicksStart = (timeRecording ? Timer::Tick() : 0);
+
+    const bool result = instance.WaitFenceValues(numFences, fences, values, timeout);
+
+    if (timeRecording)
+        RecordTime("WaitFenceValues", cpuTicksStart);
+
+    if (result)
+    {
+        std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+        for_range(i, numFences)
+            CompleteFenceValue(*fences[i], values[i]);
+    }
+
+    return result;
+}
+
+/* ----- Internal ----- */
+
+std::uint64_t DbgCommandQueue::AdvanceSubmissionSerial()
+{
+    std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+    lastQueueSerial_ = ++GetTimeline().submissionSerial_;
+    return lastQueueSerial_;
+}
+
+bool DbgCommandQueue::IsSubmissionPending(std::uint64_t serial) const
+{
+    std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+    return (serial > GetTimeline().completedSerial_);
+}
+
+std::uint64_t DbgCommandQueue::GetSubmissionSerial() const
+{
+    std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+    return GetTimeline().submissionSerial_;
+}
+
+void DbgCommandQueue::ReleaseFence(Fence& fence)
+{
+    std::lock_guard<std::mutex> guard{ GetTimelineMutex() };
+    GetTimeline().fenceSerials_.erase(&fence);
+    GetTimeline().fenceTimelines_.erase(&fence);
 }
 
 
@@ -125,6 +367,82 @@ void DbgCommandQueue::ValidateQueryResult(
     }
 }
 
+bool DbgCommandQueue::IsTimeRecording() const
+{
+    return (debugger_ != nullptr && debugger_->GetTimeRecording());
+}
+
+DbgCommandQueue& DbgCommandQueue::GetTimeline()
+{
+    return (timeline_ != nullptr ? *timeline_ : *this);
+}
+
+const DbgCommandQueue& DbgCommandQueue::GetTimeline() const
+{
+    return (timeline_ != nullptr ? *timeline_ : *this);
+}
+
+std::mutex& DbgCommandQueue::GetTimelineMutex() const
+{
+    return GetTimeline().timelineMutex_;
+}
+
+void DbgCommandQueue::CompleteSubmissions(std::uint64_t serial)
+{
+    /*
+    The timeline only tracks the most recent complete serial, so synchronizing with one queue
+    also considers earlier submissions to other queues as complete. This can only hide hazards, never report false ones.
+    */
+    DbgCommandQueue& timeline = GetTimeline();
+    timeline.completedSerial_ = std::max(timeline.completedSerial_, serial);
+}
+
+void DbgCommandQueue::ValidateFenceValue(Fence& fence, std::uint64_t value)
+{
+    const auto& fenceTimelines = GetTimeline().fenceTimelines_;
+    auto fenceTimelineIt = fenceTimelines.find(&fence);
+    if (fenceTimelineIt == fenceTimelines.end())
+        LLGL_DBG_WARN(WarningType::ImproperState, "waiting for fence value %" PRIu64 " but fence has not been signaled via SubmitSignal()", value);
+    else if (value > fenceTimelineIt->second.lastValue)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperState,
+            "waiting for fence value %" PRIu64 " that has not been signaled yet (last signaled value is %" PRIu64 ")",
+            value, fenceTimelineIt->second.lastValue
+        );
+    }
+}
+
+void DbgCommandQueue::CompleteFenceValue(Fence& fence, std::uint64_t value)
+{
+    auto& fenceTimelines = GetTimeline().fenceTimelines_;
+    auto fenceTimelineIt = fenceTimelines.find(&fence);
+    if (fenceTimelineIt == fenceTimelines.end())
+        return;
+
+    /* Values are monotonic, so all signals up to the first one that reaches the value are complete */
+    FenceTimeline& fenceTimeline = fenceTimelineIt->second;
+    while (fenceTimeline.completedValue < value && !fenceTimeline.signals.empty())
+    {
+        const FenceSignal signal = fenceTimeline.signals.front();
+        fenceTimeline.signals.pop_front();
+        fenceTimeline.completedValue = signal.value;
+        CompleteSubmissions(signal.serial);
+    }
+}
+
+void DbgCommandQueue::RecordTime(const char* annotation, std::uint64_t cpuTicksStart)
+{
+    ProfileTimeRecord record;
+    {
+        record.annotation       = annotation;
+        record.cpuTicksStart    = cpuTicksStart;
+        record.cpuTicksEnd      = Timer::Tick();
+        record.threadID         = GetCurrentThreadID();
+    }
+    profile_.timeRecords.push_back(record);
+}
+
 
 } // /namespace LLGL
 
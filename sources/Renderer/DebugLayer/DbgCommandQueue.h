@@ -11,6 +11,10 @@
 
 #include <LLGL/CommandQueue.h>
 #include <LLGL/RenderingDebugger.h>
+#include <cstdint>
+#include <unordered_map>
+#include <deque>
+#include <mutex>
 
 
 namespace LLGL
@@ -28,7 +32,30 @@ class DbgCommandQueue final : public CommandQueue
 
     public:
 
-        DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger);
+        /*
+        Initializes the debug command queue. Dedicated queues specify the primary (graphics) queue as 'timeline',
+        so the submission serials of all queues share a single timeline for the CPU access hazard tracking.
+        */
+        DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger, DbgCommandQueue* timeline = nullptr);
+
+        void SubmitWait(Fence& fence) override;
+        void SubmitSignal(Fence& fence, std::uint64_t value) override;
+        bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout) override;
+        bool WaitFenceValues(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, std::uint64_t timeout) override;
+
+    public:
+
+        // Advances the submission timeline and returns the serial for the next command buffer submission.
+        std::uint64_t AdvanceSubmissionSerial();
+
+        // Returns true if the specified submission serial has not yet been synchronized with the CPU via a fence or WaitIdle.
+        bool IsSubmissionPending(std::uint64_t serial) const;
+
+        // Returns the serial of the most recent command buffer submission on the timeline.
+        std::uint64_t GetSubmissionSerial() const;
+
+        // Removes the specified fence from the submission timeline. Must be called when the fence is released.
+        void ReleaseFence(Fence& fence);
 
     public:
 
@@ -44,10 +71,55 @@ class DbgCommandQueue final : public CommandQueue
             std::size_t     dataSize
         );
 
+        // Returns true if the debugger has time recording enabled.
+        bool IsTimeRecording() const;
+
+        // Appends a CPU-only time record to the frame profile that started at the specified CPU time stamp.
+        void RecordTime(const char* annotation, std::uint64_t cpuTicksStart);
+
+        // Returns the queue that owns the submission timeline, i.e. the primary queue.
+        DbgCommandQueue& GetTimeline();
+        const DbgCommandQueue& GetTimeline() const;
+
+        // Returns the mutex that guards the shared timeline. Dedicated queues can be used on other threads than the primary queue.
+        std::mutex& GetTimelineMutex() const;
+
+        // Marks all submissions up to the specified serial as complete on the shared timeline. Requires the timeline mutex to be locked.
+        void CompleteSubmissions(std::uint64_t serial);
+
+        // Requires the timeline mutex to be locked.
+        void ValidateFenceValue(Fence& fence, std::uint64_t value);
+
+        // Marks all submissions before the first signal of the specified fence that reaches the specified value as complete. Requires the timeline mutex to be locked.
+        void CompleteFenceValue(Fence& fence, std::uint64_t value);
+
     private:
 
-        RenderingDebugger*  debugger_ = nullptr;
-        FrameProfile&       profile_;
+        struct FenceSignal
+        {
+            std::uint64_t value;    // Value the fence was signaled with.
+            std::uint64_t serial;   // Submission serial the signal was submitted after.
+        };
+
+        struct FenceTimeline
+        {
+            std::uint64_t           lastValue       = 0;    // Most recent value the fence was signaled with.
+            std::uint64_t           completedValue  = 0;    // Most recent value the CPU has successfully waited for.
+            std::deque<FenceSignal> signals;            // Signals that have not been waited on yet.
+        };
+
+    private:
+
+        RenderingDebugger*                          debugger_           = nullptr;
+        FrameProfile&                               profile_;
+
+        DbgCommandQueue*                            timeline_           = nullptr;
+        std::uint64_t                               submissionSerial_   = 0; // Serial of the most recent command buffer submission on the timeline.
+        std::uint64_t                               completedSerial_    = 0; // Serial of the most recent submission known to be complete on the CPU side.
+        std::uint64_t                               lastQueueSerial_    = 0; // Serial of the most recent submission to this queue.
+        std::unordered_map<Fence*, std::uint64_t>   fenceSerials_;           // Submission serial each fence was last submitted after.
+        std::unordered_map<Fence*, FenceTimeline>   fenceTimelines_;         // Value-based signals of each fence (see SubmitSignal).
+        mutable std::mutex                          timelineMutex_;          // Guards the timeline members above; Only used by the queue that owns the timeline.
 
 };
 
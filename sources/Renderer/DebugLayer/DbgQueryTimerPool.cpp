@@ -10,7 +10,9 @@
 #include <LLGL/RenderSystem.h>
 #include <LLGL/CommandQueue.h>
 #include <LLGL/QueryHeap.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/ForRange.h>
+#include "../../Core/Threading.h"
 #include <thread>
 
 
@@ -21,32 +23,48 @@ namespace LLGL
 static constexpr std::uint32_t g_queryTimerHeapSize = 64;
 
 DbgQueryTimerPool::DbgQueryTimerPool(
-    RenderSystem&   renderSystemInstance,
-    CommandQueue&   commandQueueInstance,
-    CommandBuffer&  commandBufferInstance)
+    RenderSystem&                       renderSystemInstance,
+    CommandQueue&                       commandQueueInstance,
+    CommandBuffer&                      commandBufferInstance,
+    const std::atomic<std::uint64_t>&   frameCounter)
 :
     renderSystem_  { renderSystemInstance  },
     commandQueue_  { commandQueueInstance  },
-    commandBuffer_ { commandBufferInstance }
+    commandBuffer_ { commandBufferInstance },
+    frameCounter_  { frameCounter          }
 {
 }
 
 void DbgQueryTimerPool::Reset()
 {
     records_.clear();
+    queryRecords_.clear();
+    groupRecords_.clear();
+    groupStack_.clear();
     currentQuery_       = 0;
     currentQueryHeap_   = 0;
+
+    /*
+    Release debug group names frame by frame instead of with every recording, because the records of previous recordings
+    are only flushed on the next SwapChain::Present(). Names of the previous frame are kept until the end of the current frame,
+    so the flushed profile remains valid for one frame. Otherwise, unique names such as frame numbers would grow the storage indefinitely.
+    */
+    const std::uint64_t currentFrame = frameCounter_.load();
+    if (currentFrame != groupNamesFrame_)
+    {
+        if (currentFrame == groupNamesFrame_ + 1)
+            prevGroupNames_.swap(groupNames_);
+        else
+            prevGroupNames_.clear();
+        groupNames_.clear();
+        groupNamesFrame_ = currentFrame;
+    }
 }
 
 void DbgQueryTimerPool::Start(const char* annotation)
 {
-    /* Store annotation only first */
-    ProfileTimeRecord record;
-    {
-        record.annotation   = annotation;
-        record.elapsedTime  = 0;
-    }
-    records_.push_back(record);
+    /* Store annotation and CPU time stamp only first */
+    queryRecords_.push_back(AppendRecord(annotation));
 
     /* Check if end of query heap has been reached */
     if (currentQuery_ == g_queryTimerHeapSize)
@@ -77,11 +95,36 @@ void DbgQueryTimerPool::Stop()
 
     /* Increase query index */
     ++currentQuery_;
+
+    /* Store CPU time stamp when command encoding has finished */
+    records_[queryRecords_.back()].cpuTicksEnd = Timer::Tick();
+}
+
+void DbgQueryTimerPool::PushGroup(const char* annotation)
+{
+    const std::string& groupName = *(groupNames_.insert(annotation).first);
+    const std::size_t recordIndex = AppendRecord(groupName.c_str());
+    groupRecords_.push_back(recordIndex);
+    groupStack_.push_back(recordIndex);
+}
+
+void DbgQueryTimerPool::PopGroup()
+{
+    if (!groupStack_.empty())
+    {
+        records_[groupStack_.back()].cpuTicksEnd = Timer::Tick();
+        groupStack_.pop_back();
+    }
 }
 
 void DbgQueryTimerPool::TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords)
 {
+    /* Close debug groups that are still open */
+    while (!groupStack_.empty())
+        PopGroup();
+
     ResolveQueryResults();
+    ResolveGroupTimes();
     outRecords = std::move(records_);
 }
 
@@ -94,9 +137,9 @@ void DbgQueryTimerPool::ResolveQueryResults()
 {
     constexpr int maxAttempts = 100;
 
-    for_range(i, records_.size())
+    for_range(i, queryRecords_.size())
     {
-        ProfileTimeRecord&  rec         = records_[i];
+        ProfileTimeRecord&  rec         = records_[queryRecords_[i]];
         const std::uint32_t query       = static_cast<std::uint32_t>(i % g_queryTimerHeapSize);
         const std::uint32_t heapIndex   = static_cast<std::uint32_t>(i / g_queryTimerHeapSize);
 
@@ -110,6 +153,37 @@ void DbgQueryTimerPool::ResolveQueryResults()
     }
 }
 
+void DbgQueryTimerPool::ResolveGroupTimes()
+{
+    /* Resolve inner groups first, so their accumulated times are available for the outer groups */
+    for (auto it = groupRecords_.rbegin(); it != groupRecords_.rend(); ++it)
+    {
+        ProfileTimeRecord&  group       = records_[*it];
+        const std::uint32_t childLevel  = group.nestingLevel + 1;
+
+        for (std::size_t i = *it + 1; i < records_.size() && records_[i].nestingLevel >= childLevel; ++i)
+        {
+            if (records_[i].nestingLevel == childLevel)
+                group.elapsedTime += records_[i].elapsedTime;
+        }
+    }
+}
+
+std::size_t DbgQueryTimerPool::AppendRecord(const char* annotation)
+{
+    ProfileTimeRecord record;
+    {
+        record.annotation       = annotation;
+        record.elapsedTime      = 0;
+        record.cpuTicksStart    = Timer::Tick();
+        record.cpuTicksEnd      = record.cpuTicksStart;
+        record.threadID         = GetCurrentThreadID();
+        record.nestingLevel     = static_cast<std::uint32_t>(groupStack_.size());
+    }
+    records_.push_back(record);
+    return records_.size() - 1;
+}
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,10 @@
 #include <LLGL/ForwardDecls.h>
 #include <LLGL/RenderingDebugger.h>
 #include <vector>
+#include <set>
+#include <string>
+#include <atomic>
+#include <cstdint>
 
 
 namespace LLGL
@@ -24,12 +28,13 @@ class DbgQueryTimerPool
     public:
 
         DbgQueryTimerPool(
-            RenderSystem&   renderSystemInstance,
-            CommandQueue&   commandQueueInstance,
-            CommandBuffer&  commandBufferInstance
+            RenderSystem&                       renderSystemInstance,
+            CommandQueue&                       commandQueueInstance,
+            CommandBuffer&                      commandBufferInstance,
+            const std::atomic<std::uint64_t>&   frameCounter
         );
 
-        // Resets all records in this timer manager.
+        // Resets all records in this timer manager and releases the debug group names of frames whose profiles have already been consumed.
         void Reset();
 
         // Starts measuring the time with the specified annotation.
@@ -38,6 +43,13 @@ class DbgQueryTimerPool
         // Stops measing the time and stores the current record.
         void Stop();
 
+        // Opens a new debug group record. All subsequent records will be nested inside this group until PopGroup() is called.
+        // The annotation is copied into internal storage as debug group names are usually not static strings.
+        void PushGroup(const char* annotation);
+
+        // Closes the current debug group record.
+        void PopGroup();
+
         // Moves the internal records to the specified output container.
         void TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords);
 
@@ -46,17 +58,30 @@ class DbgQueryTimerPool
         // Resolves all timer values into the output records.
         void ResolveQueryResults();
 
+        // Accumulates the elapsed times of all debug group records from their immediate children.
+        void ResolveGroupTimes();
+
+        // Appends a new record with the current CPU time stamp and returns its index.
+        std::size_t AppendRecord(const char* annotation);
+
     private:
 
         RenderSystem&                       renderSystem_;
         CommandQueue&                       commandQueue_;
         CommandBuffer&                      commandBuffer_;
+        const std::atomic<std::uint64_t>&   frameCounter_;
 
         std::vector<QueryHeap*>             queryHeaps_;
         std::uint32_t                       currentQuery_       = 0;
         std::uint32_t                       currentQueryHeap_   = 0;
 
         DynamicVector<ProfileTimeRecord>    records_;
+        std::vector<std::size_t>            queryRecords_;      // Record index for each issued query
+        std::vector<std::size_t>            groupRecords_;      // Record index for each debug group
+        std::vector<std::size_t>            groupStack_;        // Record indices of currently open debug groups
+        std::set<std::string>               groupNames_;        // Storage for debug group annotations of the current frame
+        std::set<std::string>               prevGroupNames_;    // Storage for debug group annotations of the previous frame, whose profile might not have been consumed yet
+        std::uint64_t                       groupNamesFrame_    = 0;
 
 };
 
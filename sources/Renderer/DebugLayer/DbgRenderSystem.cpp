@@ -18,6 +18,7 @@
 #include <LLGL/Constants.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -47,8 +48,25 @@ DbgRenderSystem::DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger*
 void DbgRenderSystem::FlushProfile()
 {
     if (debugger_ != nullptr)
+    {
         debugger_->RecordProfile(profile_);
+
+        /* Apply the load/store analysis of this frame to the render passes of the next frame */
+        if (debugger_->GetLoadStoreAnalysis() == LoadStoreAnalysis::Downgrade)
+        {
+            std::vector<RenderPass*> retiredRenderPasses;
+            for (auto& renderTarget : renderTargets_)
+                renderTarget->UpdateOptimizedRenderPass(*instance_, retiredRenderPasses);
+
+            for (RenderPass* renderPass : retiredRenderPasses)
+                retiredRenderPasses_.push_back(RetiredRenderPass{ renderPass, frameCounter_.load() });
+        }
+    }
     profile_ = {};
+    ++frameCounter_;
+
+    if (!retiredRenderPasses_.empty())
+        ReleaseRetiredRenderPasses();
 }
 
 /* ----- Swap-chain ----- */
@@ -62,7 +80,7 @@ SwapChain* DbgRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChain
     if (!commandQueue_)
     {
         UpdateRenderingCaps();
-        commandQueue_ = MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profile_, debugger_);
+        GetOrCreateCommandQueue();
     }
 
     /* Flush frame profile on SwapChain::Present() calls */
@@ -71,6 +89,7 @@ SwapChain* DbgRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChain
 
 void DbgRenderSystem::Release(SwapChain& swapChain)
 {
+    ReleaseCommandBufferRecords(LLGL_CAST(const DbgSwapChain&, swapChain));
     ReleaseDbg(swapChains_, swapChain);
 }
 
@@ -78,7 +97,15 @@ void DbgRenderSystem::Release(SwapChain& swapChain)
 
 CommandQueue* DbgRenderSystem::GetCommandQueue()
 {
-    return commandQueue_.get();
+    return GetOrCreateCommandQueue();
+}
+
+CommandQueue* DbgRenderSystem::GetDedicatedCommandQueue(const CommandQueueType type)
+{
+    DbgCommandQueue* commandQueueDbg = GetOrCreateDedicatedCommandQueue(type);
+    if (commandQueueDbg != nullptr && commandQueueDbg->GetType() == type)
+        return commandQueueDbg;
+    return nullptr;
 }
 
 /* ----- Command buffers ----- */
@@ -90,16 +117,21 @@ CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescripto
     {
         instanceCommandBufferDesc.flags                 = commandBufferDesc.flags;
         instanceCommandBufferDesc.numNativeBuffers      = commandBufferDesc.numNativeBuffers;
+        instanceCommandBufferDesc.maxNumNativeBuffers   = commandBufferDesc.maxNumNativeBuffers;
         instanceCommandBufferDesc.minStagingPoolSize    = commandBufferDesc.minStagingPoolSize;
+        instanceCommandBufferDesc.queueType             = commandBufferDesc.queueType;
         instanceCommandBufferDesc.renderPass            = (commandBufferDesc.renderPass != nullptr
                                                         ? &(LLGL_CAST(const DbgRenderPass*, commandBufferDesc.renderPass)->instance)
                                                         : nullptr);
     }
+    DbgCommandQueue* commandQueueDbg = GetOrCreateDedicatedCommandQueue(commandBufferDesc.queueType);
+    LLGL_ASSERT_PTR(commandQueueDbg);
     return commandBuffers_.emplace<DbgCommandBuffer>(
         *instance_,
-        commandQueue_->instance,
+        *commandQueueDbg,
         *instance_->CreateCommandBuffer(instanceCommandBufferDesc),
         profile_,
+        frameCounter_,
         debugger_,
         commandBufferDesc,
         GetRenderingCaps()
@@ -155,6 +187,7 @@ BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer
 
 void DbgRenderSystem::Release(Buffer& buffer)
 {
+    ReleaseCommandBufferRecords(LLGL_CAST(const DbgBuffer&, buffer));
     ReleaseDbg(buffers_, buffer);
 }
 
@@ -204,6 +237,7 @@ void DbgRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* dat
         ValidateBufferBoundary(bufferDbg.desc.size, offset, dataSize);
     }
 
+    /* ReadBuffer() synchronizes with pending GPU work on its own, so no CPU access hazard is validated here */
     instance_->ReadBuffer(bufferDbg.instance, offset, data, dataSize);
 
     profile_.commandQueueRecord.bufferReads++;
@@ -218,6 +252,7 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
         LLGL_DBG_SOURCE();
         ValidateResourceCPUAccess(bufferDbg.desc.cpuAccessFlags, access, "buffer");
         ValidateBufferMapping(bufferDbg, true);
+        ValidateCPUAccessHazard(bufferDbg.lastWriteSerial, bufferDbg.lastReadSerial, access, "buffer", bufferDbg.label);
     }
 
     auto result = instance_->MapBuffer(bufferDbg.instance, access);
@@ -239,6 +274,7 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::ui
         LLGL_DBG_SOURCE();
         ValidateResourceCPUAccess(bufferDbg.desc.cpuAccessFlags, access, "buffer");
         ValidateBufferMapping(bufferDbg, true);
+        ValidateCPUAccessHazard(bufferDbg.lastWriteSerial, bufferDbg.lastReadSerial, access, "buffer", bufferDbg.label);
         ValidateBufferBoundary(bufferDbg.desc.size, offset, length);
     }
 
@@ -281,6 +317,7 @@ Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, co
 
 void DbgRenderSystem::Release(Texture& texture)
 {
+    ReleaseCommandBufferRecords(LLGL_CAST(const DbgTexture&, texture));
     ReleaseDbg(textures_, texture);
 }
 
@@ -297,6 +334,8 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
 
     instance_->WriteTexture(textureDbg.instance, textureRegion, srcImageView);
 
+    textureDbg.NotifyContentWritten();
+
     profile_.commandQueueRecord.textureWrites++;
 }
 
@@ -311,11 +350,63 @@ void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& texture
         ValidateImageDataSize(textureDbg, textureRegion, dstImageView.format, dstImageView.dataType, dstImageView.dataSize);
     }
 
+    /* ReadTexture() synchronizes with pending GPU work on its own, so no CPU access hazard is validated here */
     instance_->ReadTexture(textureDbg.instance, textureRegion, dstImageView);
 
+    textureDbg.NotifyContentRead();
+
     profile_.commandQueueRecord.textureReads++;
 }
 
+std::uint64_t DbgRenderSystem::RequestTextureRead(Texture& texture, const TextureRegion& textureRegion)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateTextureRegion(textureDbg, textureRegion);
+    }
+
+    const std::uint64_t requestID = instance_->RequestTextureRead(textureDbg.instance, textureRegion);
+    pendingTextureReads_[requestID] = &textureDbg;
+
+    /* The texture content is captured at the time of the request, not when the request is resolved */
+    textureDbg.NotifyContentRead();
+
+    return requestID;
+}
+
+bool DbgRenderSystem::ResolveTextureRead(std::uint64_t requestID, const MutableImageView& dstImageView, bool wait)
+{
+    auto it = pendingTextureReads_.find(requestID);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        if (it == pendingTextureReads_.end())
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "unknown texture readback request ID: %" PRIu64, requestID);
+            return false;
+        }
+        if (dstImageView.data == nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot resolve texture readback request into null pointer");
+            return false;
+        }
+    }
+
+    if (!instance_->ResolveTextureRead(requestID, dstImageView, wait))
+        return false;
+
+    if (it != pendingTextureReads_.end())
+        pendingTextureReads_.erase(it);
+
+    profile_.commandQueueRecord.textureReads++;
+
+    return true;
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
@@ -401,10 +492,12 @@ ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
         auto pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout*, resourceHeapDesc.pipelineLayout);
         instanceDesc.pipelineLayout = &(pipelineLayoutDbg->instance);
     }
-    return resourceHeaps_.emplace<DbgResourceHeap>(
+    auto* resourceHeapDbg = resourceHeaps_.emplace<DbgResourceHeap>(
         *instance_->CreateResourceHeap(instanceDesc, instanceResourceViews),
         resourceHeapDesc
     );
+    resourceHeapDbg->WriteResourceViews(0, initialResourceViews);
+    return resourceHeapDbg;
 }
 
 void DbgRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -423,6 +516,7 @@ std::uint32_t DbgRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std
     }
 
     auto instanceResourceViews = GetResourceViewInstanceCopy(resourceViews);
+    resourceHeapDbg.WriteResourceViews(firstDescriptor, resourceViews);
     return instance_->WriteResourceHeap(resourceHeapDbg.instance, firstDescriptor, instanceResourceViews);
 }
 
@@ -439,6 +533,7 @@ void DbgRenderSystem::Release(RenderPass& renderPass)
     auto& renderPassDbg = LLGL_CAST(DbgRenderPass&, renderPass);
     if (RenderPass* instance = renderPassDbg.mutableInstance)
     {
+        ReleaseCommandBufferRecords(renderPassDbg);
         instance_->Release(*instance);
         renderPasses_.erase(&renderPass);
     }
@@ -476,6 +571,8 @@ RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor&
 
 void DbgRenderSystem::Release(RenderTarget& renderTarget)
 {
+    ReleaseCommandBufferRecords(LLGL_CAST(const DbgRenderTarget&, renderTarget));
+    LLGL_CAST(DbgRenderTarget&, renderTarget).ReleaseOptimizedRenderPass(*instance_);
     ReleaseDbg(renderTargets_, renderTarget);
 }
 
@@ -582,9 +679,70 @@ Fence* DbgRenderSystem::CreateFence()
 
 void DbgRenderSystem::Release(Fence& fence)
 {
+    if (commandQueue_)
+        commandQueue_->ReleaseFence(fence);
     instance_->Release(fence);
 }
 
+/* ----- Loader threads ----- */
+
+// Loader threads are tracked per thread, so the debug layer can validate the pairing of Begin/EndLoaderThread.
+static thread_local bool g_isLoaderThread = false;
+
+bool DbgRenderSystem::BeginLoaderThread()
+{
+    if (g_isLoaderThread)
+    {
+        LLGL_DBG_SOURCE();
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot begin loader thread on a thread that already is a loader thread");
+        return true;
+    }
+    g_isLoaderThread = instance_->BeginLoaderThread();
+    return g_isLoaderThread;
+}
+
+void DbgRenderSystem::EndLoaderThread()
+{
+    if (!g_isLoaderThread)
+    {
+        LLGL_DBG_SOURCE();
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot end loader thread on a thread that is not a loader thread");
+        return;
+    }
+    instance_->EndLoaderThread();
+    g_isLoaderThread = false;
+}
+
+void DbgRenderSystem::FlushLoaderThread()
+{
+    if (!g_isLoaderThread)
+    {
+        LLGL_DBG_SOURCE();
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot flush loader thread on a thread that is not a loader thread");
+        return;
+    }
+    instance_->FlushLoaderThread();
+}
+
+/* ----- Bindless resources ----- */
+
+std::uint32_t DbgRenderSystem::GetBindlessIndex(Resource& resource)
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+            return instance_->GetBindlessIndex(LLGL_CAST(DbgBuffer&, resource).instance);
+        case ResourceType::Texture:
+            return instance_->GetBindlessIndex(LLGL_CAST(DbgTexture&, resource).instance);
+        case ResourceType::Sampler:
+            return instance_->GetBindlessIndex(resource);
+        default:
+            LLGL_DBG_SOURCE();
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid resource type passed to GetBindlessIndex; must be Buffer, Texture, or Sampler");
+            return LLGL_INVALID_BINDLESS_INDEX;
+    }
+}
+
 /* ----- Extensions ----- */
 
 bool DbgRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -850,6 +1008,79 @@ void DbgRenderSystem::ValidateBufferBoundary(std::uint64_t bufferSize, std::uint
     }
 }
 
+std::uint64_t DbgRenderSystem::GetMaxFramesInFlight() const
+{
+    std::uint64_t maxFramesInFlight = 1;
+    for (const auto& swapChain : swapChains_)
+        maxFramesInFlight = std::max<std::uint64_t>(maxFramesInFlight, swapChain->desc.swapBuffers);
+    return maxFramesInFlight;
+}
+
+/*
+Retired render passes are released once all submitted command buffers are known to be complete, i.e. synchronized via a fence or WaitIdle,
+or once the swap-chains have presented enough frames that the GPU cannot lag behind any longer.
+Command buffers recorded in the frame of retirement are submitted before the next frame boundary, so the render pass is kept for at least one more frame.
+*/
+void DbgRenderSystem::ReleaseRetiredRenderPasses()
+{
+    const std::uint64_t currentFrame        = frameCounter_.load();
+    const std::uint64_t maxFramesInFlight   = GetMaxFramesInFlight();
+    const std::uint64_t queueSerial         = (commandQueue_ ? commandQueue_->GetSubmissionSerial() : 0);
+    const bool          isQueueIdle         = (!commandQueue_ || !commandQueue_->IsSubmissionPending(queueSerial));
+
+    auto IsRetiredRenderPassUnused = [&](const RetiredRenderPass& entry) -> bool
+    {
+        if (currentFrame < entry.frame + 2)
+            return false;
+        return (isQueueIdle || currentFrame > entry.frame + maxFramesInFlight);
+    };
+
+    for (const RetiredRenderPass& entry : retiredRenderPasses_)
+    {
+        if (IsRetiredRenderPassUnused(entry))
+            instance_->Release(*entry.instance);
+    }
+
+    retiredRenderPasses_.erase(
+        std::remove_if(retiredRenderPasses_.begin(), retiredRenderPasses_.end(), IsRetiredRenderPassUnused),
+        retiredRenderPasses_.end()
+    );
+}
+
+void DbgRenderSystem::ValidateCPUAccessHazard(
+    std::uint64_t       lastWriteSerial,
+    std::uint64_t       lastReadSerial,
+    const CPUAccess     access,
+    const char*         resourceTypeName,
+    const std::string&  label)
+{
+    if (!commandQueue_)
+        return;
+
+    /* Discarded resources are renamed by the backend, so any pending GPU access does not conflict with the CPU */
+    if (access == CPUAccess::WriteDiscard)
+        return;
+
+    const std::string labelStr = (label.empty() ? "" : " '" + label + "'");
+
+    if (commandQueue_->IsSubmissionPending(lastWriteSerial))
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperState,
+            "CPU access to %s%s that is written by a submitted command buffer without fence synchronization",
+            resourceTypeName, labelStr.c_str()
+        );
+    }
+    else if (access != CPUAccess::ReadOnly && commandQueue_->IsSubmissionPending(lastReadSerial))
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperState,
+            "CPU write access to %s%s that is read by a submitted command buffer without fence synchronization",
+            resourceTypeName, labelStr.c_str()
+        );
+    }
+}
+
 void DbgRenderSystem::ValidateBufferMapping(DbgBuffer& bufferDbg, bool mapMemory)
 {
     if (mapMemory)
@@ -2014,14 +2245,50 @@ void DbgRenderSystem::AssertMultiSampleTextures()
         LLGL_DBG_ERROR_NOT_SUPPORTED("multi-sample textures");
 }
 
-template <typename T, typename TBase>
-void DbgRenderSystem::ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry)
+template <template <typename> class TContainer, typename T, typename TBase>
+void DbgRenderSystem::ReleaseDbg(TContainer<T>& cont, TBase& entry)
 {
     auto& entryDbg = LLGL_CAST(T&, entry);
     instance_->Release(entryDbg.instance);
     cont.erase(&entry);
 }
 
+template <typename T>
+void DbgRenderSystem::ReleaseCommandBufferRecords(const T& entryDbg)
+{
+    for (auto& commandBuffer : commandBuffers_)
+        commandBuffer->ReleaseRecords(entryDbg);
+}
+
+DbgCommandQueue* DbgRenderSystem::GetOrCreateCommandQueue()
+{
+    if (!commandQueue_)
+    {
+        if (CommandQueue* commandQueueInstance = instance_->GetCommandQueue())
+            commandQueue_ = MakeUnique<DbgCommandQueue>(*commandQueueInstance, profile_, debugger_);
+    }
+    return commandQueue_.get();
+}
+
+DbgCommandQueue* DbgRenderSystem::GetOrCreateDedicatedCommandQueue(const CommandQueueType type)
+{
+    DbgCommandQueue* primaryQueue = GetOrCreateCommandQueue();
+    if (primaryQueue == nullptr || type == CommandQueueType::Graphics)
+        return primaryQueue;
+
+    HWObjectInstance<DbgCommandQueue>& dedicatedQueue = (type == CommandQueueType::Compute ? computeQueue_ : transferQueue_);
+    if (!dedicatedQueue)
+    {
+        /* Fall back to the primary queue if the instance has no dedicated queue of this type */
+        CommandQueue* commandQueueInstance = instance_->GetDedicatedCommandQueue(type);
+        if (commandQueueInstance == nullptr)
+            return primaryQueue;
+        dedicatedQueue = MakeUnique<DbgCommandQueue>(*commandQueueInstance, profile_, debugger_, primaryQueue);
+    }
+
+    return dedicatedQueue.get();
+}
+
 void DbgRenderSystem::UpdateRenderingCaps()
 {
     /* Store meta data about render system */
@@ -28,6 +28,8 @@
 #include "Texture/DbgRenderTarget.h"
 
 #include "../ContainerTypes.h"
+#include <unordered_map>
+#include <atomic>
 
 
 namespace LLGL
@@ -46,6 +48,17 @@ class DbgRenderSystem final : public RenderSystem
 
         DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger);
 
+        CommandQueue* GetDedicatedCommandQueue(const CommandQueueType type) override;
+
+        std::uint64_t RequestTextureRead(Texture& texture, const TextureRegion& textureRegion) override;
+        bool ResolveTextureRead(std::uint64_t requestID, const MutableImageView& dstImageView, bool wait = false) override;
+
+        bool BeginLoaderThread() override;
+        void EndLoaderThread() override;
+        void FlushLoaderThread() override;
+
+        std::uint32_t GetBindlessIndex(Resource& resource) override;
+
         void FlushProfile();
 
     private:
@@ -57,11 +70,18 @@ class DbgRenderSystem final : public RenderSystem
 
         void ValidateCommandBufferDesc(const CommandBufferDescriptor& commandBufferDesc);
 
+        // Returns the primary command queue and wraps the instance's queue on demand, since some backends only create it with the first swap-chain.
+        DbgCommandQueue* GetOrCreateCommandQueue();
+
+        // Returns the debug wrapper of the dedicated command queue the specified queue type resolves to, i.e. the primary queue if the instance has no such queue.
+        DbgCommandQueue* GetOrCreateDedicatedCommandQueue(const CommandQueueType type);
+
         void ValidateBufferDesc(const BufferDescriptor& bufferDesc, std::uint32_t* formatSizeOut = nullptr);
         void ValidateVertexAttributesForBuffer(const VertexAttribute& lhs, const VertexAttribute& rhs);
         void ValidateBufferSize(std::uint64_t size);
         void ValidateConstantBufferSize(std::uint64_t size);
         void ValidateBufferBoundary(std::uint64_t bufferSize, std::uint64_t dstOffset, std::uint64_t dataSize);
+        void ValidateCPUAccessHazard(std::uint64_t lastWriteSerial, std::uint64_t lastReadSerial, const CPUAccess access, const char* resourceTypeName, const std::string& label);
         void ValidateBufferMapping(DbgBuffer& bufferDbg, bool mapMemory);
         void ValidateBufferView(DbgBuffer& bufferDbg, const BufferViewDescriptor& viewDesc, const BindingDescriptor& bindingDesc);
 
@@ -106,13 +126,32 @@ class DbgRenderSystem final : public RenderSystem
         void AssertCubeArrayTextures();
         void AssertMultiSampleTextures();
 
-        template <typename T, typename TBase>
-        void ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry);
+        template <template <typename> class TContainer, typename T, typename TBase>
+        void ReleaseDbg(TContainer<T>& cont, TBase& entry);
+
+        // Removes the records of the specified object from all command buffers before the object is released.
+        template <typename T>
+        void ReleaseCommandBufferRecords(const T& entryDbg);
 
         std::vector<ResourceViewDescriptor> GetResourceViewInstanceCopy(const ArrayView<ResourceViewDescriptor>& resourceViews);
 
         void UpdateRenderingCaps();
 
+        // Returns the maximum number of frames the GPU can lag behind the CPU, derived from the swap-chains.
+        std::uint64_t GetMaxFramesInFlight() const;
+
+        // Releases all retired optimized render passes that can no longer be used by command buffers in flight.
+        void ReleaseRetiredRenderPasses();
+
+    private:
+
+        // Optimized render pass of the load/store analysis that has been replaced, but may still be used by command buffers in flight.
+        struct RetiredRenderPass
+        {
+            RenderPass*     instance;
+            std::uint64_t   frame;      // Frame counter when the render pass was retired.
+        };
+
     private:
 
         /* ----- Common objects ----- */
@@ -121,6 +160,8 @@ class DbgRenderSystem final : public RenderSystem
 
         RenderingDebugger*                      debugger_   = nullptr;
         FrameProfile                            profile_;
+        std::atomic<std::uint64_t>              frameCounter_{ 0 };  // Number of flushed frame profiles, i.e. presented frames
+        std::vector<RetiredRenderPass>          retiredRenderPasses_;
 
         const RenderingCapabilities&            caps_;
         const RenderingFeatures&                features_;
@@ -130,19 +171,25 @@ class DbgRenderSystem final : public RenderSystem
 
         HWObjectContainer<DbgSwapChain>         swapChains_;
         HWObjectInstance<DbgCommandQueue>       commandQueue_;
+        HWObjectInstance<DbgCommandQueue>       computeQueue_;
+        HWObjectInstance<DbgCommandQueue>       transferQueue_;
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
-        HWObjectContainer<DbgBuffer>            buffers_;
+        ConcurrentHWObjectContainer<DbgBuffer>  buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
-        HWObjectContainer<DbgTexture>           textures_;
+        ConcurrentHWObjectContainer<DbgTexture> textures_;
         HWObjectContainer<DbgRenderPass>        renderPasses_;
         HWObjectContainer<DbgRenderTarget>      renderTargets_;
-        HWObjectContainer<DbgShader>            shaders_;
+        ConcurrentHWObjectContainer<DbgShader>  shaders_;
         HWObjectContainer<DbgPipelineLayout>    pipelineLayouts_;
         HWObjectContainer<DbgPipelineState>     pipelineStates_;
         HWObjectContainer<DbgResourceHeap>      resourceHeaps_;
         //HWObjectContainer<DbgSampler>           samplers_;
         HWObjectContainer<DbgQueryHeap>         queryHeaps_;
 
+        /* ----- Asynchronous readback ----- */
+
+        std::unordered_map<std::uint64_t, DbgTexture*>  pendingTextureReads_;
+
 };
 
 
@@ -59,6 +59,11 @@ const Report* DbgPipelineState::GetReport() const
     return instance.GetReport();
 }
 
+bool DbgPipelineState::IsReady() const
+{
+    return instance.IsReady();
+}
+
 
 } // /namespace LLGL
 
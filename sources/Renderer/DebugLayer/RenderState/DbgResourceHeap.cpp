@@ -9,6 +9,7 @@
 #include "DbgPipelineLayout.h"
 #include "../DbgCore.h"
 #include "../../CheckedCast.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -44,6 +45,28 @@ std::uint32_t DbgResourceHeap::GetNumDescriptorSetsSafe() const
     return static_cast<std::uint32_t>(desc.numResourceViews / numBindings);
 }
 
+void DbgResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    const std::size_t endDescriptor = firstDescriptor + resourceViews.size();
+    if (resources_.size() < endDescriptor)
+        resources_.resize(endDescriptor, nullptr);
+
+    for (std::size_t i = 0; i < resourceViews.size(); ++i)
+    {
+        /* Ignore empty descriptors, since they don't modify the heap */
+        if (Resource* resource = resourceViews[i].resource)
+            resources_[firstDescriptor + i] = resource;
+    }
+}
+
+ArrayView<Resource*> DbgResourceHeap::GetDescriptorSetResources(std::uint32_t descriptorSet) const
+{
+    const std::size_t first = static_cast<std::size_t>(descriptorSet) * numBindings;
+    if (first >= resources_.size())
+        return {};
+    return ArrayView<Resource*>{ resources_.data() + first, std::min<std::size_t>(numBindings, resources_.size() - first) };
+}
+
 
 } // /namespace LLGL
 
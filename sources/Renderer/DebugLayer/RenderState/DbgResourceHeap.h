@@ -11,7 +11,9 @@
 
 #include <LLGL/ResourceHeap.h>
 #include <LLGL/ResourceHeapFlags.h>
+#include <LLGL/Container/ArrayView.h>
 #include <string>
+#include <vector>
 
 
 namespace LLGL
@@ -34,6 +36,12 @@ class DbgResourceHeap final : public ResourceHeap
         // Returns the number of descriptor sets by using the debug information only, i.e. 'desc.numResourceViews' and 'numBindings'.
         std::uint32_t GetNumDescriptorSetsSafe() const;
 
+        // Stores the debug resources of the specified resource views to track which resources are accessed when this heap is bound.
+        void WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
+
+        // Returns the debug resources of the specified descriptor set. Unused descriptors are null.
+        ArrayView<Resource*> GetDescriptorSetResources(std::uint32_t descriptorSet) const;
+
     public:
 
         ResourceHeap&                   instance;
@@ -41,6 +49,11 @@ class DbgResourceHeap final : public ResourceHeap
         std::string                     label;
         const std::uint32_t             numBindings = 1;
 
+    private:
+
+        std::vector<Resource*>          resources_;
+
+
 };
 
 
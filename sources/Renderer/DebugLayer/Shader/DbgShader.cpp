@@ -38,6 +38,11 @@ bool DbgShader::Reflect(ShaderReflection& reflection) const
     return instance.Reflect(reflection);
 }
 
+bool DbgShader::IsReady() const
+{
+    return instance.IsReady();
+}
+
 const char* DbgShader::GetVertexID() const
 {
     return (vertexID_.empty() ? nullptr : vertexID_.c_str());
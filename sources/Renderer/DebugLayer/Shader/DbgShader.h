@@ -28,6 +28,7 @@ class DbgShader final : public Shader
     public:
 
         void SetDebugName(const char* name) override;
+        bool IsReady() const override;
 
     public:
 
@@ -12,6 +12,7 @@
 #include "../../RenderTargetUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
+#include <LLGL/RenderSystem.h>
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -104,6 +105,162 @@ const RenderPass* DbgRenderTarget::GetRenderPass() const
     return renderPass_.get();
 }
 
+AttachmentLoadOp DbgRenderTarget::GetAttachmentLoadOp(const RenderPassDescriptor& renderPassDesc, std::uint32_t slot)
+{
+    if (slot < LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        return renderPassDesc.colorAttachments[slot].loadOp;
+
+    const AttachmentLoadOp depthLoadOp      = renderPassDesc.depthAttachment.loadOp;
+    const AttachmentLoadOp stencilLoadOp    = renderPassDesc.stencilAttachment.loadOp;
+
+    if (depthLoadOp == AttachmentLoadOp::Load || stencilLoadOp == AttachmentLoadOp::Load)
+        return AttachmentLoadOp::Load;
+    if (depthLoadOp == AttachmentLoadOp::Clear || stencilLoadOp == AttachmentLoadOp::Clear)
+        return AttachmentLoadOp::Clear;
+    return AttachmentLoadOp::Undefined;
+}
+
+AttachmentStoreOp DbgRenderTarget::GetAttachmentStoreOp(const RenderPassDescriptor& renderPassDesc, std::uint32_t slot)
+{
+    if (slot < LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        return renderPassDesc.colorAttachments[slot].storeOp;
+
+    if (renderPassDesc.depthAttachment.storeOp   == AttachmentStoreOp::Store ||
+        renderPassDesc.stencilAttachment.storeOp == AttachmentStoreOp::Store)
+    {
+        return AttachmentStoreOp::Store;
+    }
+    return AttachmentStoreOp::Undefined;
+}
+
+DbgTexture* DbgRenderTarget::GetAttachmentTexture(std::uint32_t slot) const
+{
+    const AttachmentDescriptor& attachmentDesc = (slot < LLGL_MAX_NUM_COLOR_ATTACHMENTS ? desc.colorAttachments[slot] : desc.depthStencilAttachment);
+    return (attachmentDesc.texture != nullptr ? LLGL_CAST(DbgTexture*, attachmentDesc.texture) : nullptr);
+}
+
+const DbgRenderPass* DbgRenderTarget::GetEffectiveRenderPass(const RenderPass* renderPass) const
+{
+    if (renderPass != nullptr)
+        return LLGL_CAST(const DbgRenderPass*, renderPass);
+    else
+        return renderPass_.get();
+}
+
+void DbgRenderTarget::NotifyAnalyzedRenderPass(const DbgRenderPass& renderPass)
+{
+    std::lock_guard<std::mutex> guard{ optimizedRenderPassMutex_ };
+    if (analyzedRenderPass_ != &renderPass)
+    {
+        analyzedRenderPass_     = &renderPass;
+        analyzedRenderPassDesc_ = renderPass.desc;
+    }
+}
+
+bool DbgRenderTarget::GetOptimizedRenderPass(const DbgRenderPass* source, OptimizedRenderPass& outOptimizedRenderPass) const
+{
+    std::lock_guard<std::mutex> guard{ optimizedRenderPassMutex_ };
+    if (optimizedRenderPass_.instance != nullptr && optimizedRenderPass_.source == source)
+    {
+        outOptimizedRenderPass = optimizedRenderPass_;
+        return true;
+    }
+    return false;
+}
+
+// Returns true if the specified attachment slot consumes a clear value in CommandBuffer::BeginRenderPass.
+static bool IsAttachmentSlotCleared(const RenderPassDescriptor& renderPassDesc, std::uint32_t slot)
+{
+    if (slot < LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        return (renderPassDesc.colorAttachments[slot].loadOp == AttachmentLoadOp::Clear);
+    else
+        return (renderPassDesc.depthAttachment.loadOp == AttachmentLoadOp::Clear || renderPassDesc.stencilAttachment.loadOp == AttachmentLoadOp::Clear);
+}
+
+void DbgRenderTarget::UpdateOptimizedRenderPass(RenderSystem& renderSystemInstance, std::vector<RenderPass*>& retiredRenderPasses)
+{
+    const DbgRenderPass*    analyzedRenderPass  = nullptr;
+    RenderPassDescriptor    analyzedRenderPassDesc;
+    OptimizedRenderPass     prevOptimizedRenderPass;
+    {
+        std::lock_guard<std::mutex> guard{ optimizedRenderPassMutex_ };
+        analyzedRenderPass      = analyzedRenderPass_;
+        analyzedRenderPassDesc  = analyzedRenderPassDesc_;
+        prevOptimizedRenderPass = optimizedRenderPass_;
+    }
+
+    if (analyzedRenderPass == nullptr)
+        return;
+
+    /* Gather attachment slots whose load operations have been found to be unnecessary */
+    std::uint32_t loadMask = 0;
+
+    for_range(slot, numAttachmentSlots)
+    {
+        if (DbgTexture* textureDbg = GetAttachmentTexture(slot))
+        {
+            if (GetAttachmentLoadOp(analyzedRenderPassDesc, slot) != AttachmentLoadOp::Undefined && textureDbg->IsAttachmentLoadRedundant())
+                loadMask |= (1u << slot);
+        }
+    }
+
+    if (prevOptimizedRenderPass.source == analyzedRenderPass && prevOptimizedRenderPass.loadMask == loadMask)
+        return;
+
+    OptimizedRenderPass nextOptimizedRenderPass;
+
+    if (loadMask != 0)
+    {
+        /* Downgrade load operations */
+        RenderPassDescriptor optimizedDesc = analyzedRenderPassDesc;
+
+        for_range(slot, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        {
+            if ((loadMask & (1u << slot)) != 0)
+                optimizedDesc.colorAttachments[slot].loadOp = AttachmentLoadOp::Undefined;
+        }
+
+        if ((loadMask & (1u << depthStencilSlot)) != 0)
+        {
+            optimizedDesc.depthAttachment.loadOp    = AttachmentLoadOp::Undefined;
+            optimizedDesc.stencilAttachment.loadOp  = AttachmentLoadOp::Undefined;
+        }
+
+        /* Map clear values of the optimized render pass to the clear values of the original render pass */
+        std::uint32_t clearValueIndex = 0;
+        for_range(slot, numAttachmentSlots)
+        {
+            if (IsAttachmentSlotCleared(analyzedRenderPassDesc, slot))
+            {
+                if ((loadMask & (1u << slot)) == 0)
+                    nextOptimizedRenderPass.clearValueMap[nextOptimizedRenderPass.numClearValues++] = clearValueIndex;
+                ++clearValueIndex;
+            }
+        }
+
+        nextOptimizedRenderPass.source      = analyzedRenderPass;
+        nextOptimizedRenderPass.instance    = renderSystemInstance.CreateRenderPass(optimizedDesc);
+        nextOptimizedRenderPass.loadMask    = loadMask;
+    }
+
+    /* Replace optimized render pass; Command buffers that already use the previous one keep it until it is released as retired render pass */
+    {
+        std::lock_guard<std::mutex> guard{ optimizedRenderPassMutex_ };
+        optimizedRenderPass_ = nextOptimizedRenderPass;
+    }
+
+    if (prevOptimizedRenderPass.instance != nullptr)
+        retiredRenderPasses.push_back(prevOptimizedRenderPass.instance);
+}
+
+void DbgRenderTarget::ReleaseOptimizedRenderPass(RenderSystem& renderSystemInstance)
+{
+    std::lock_guard<std::mutex> guard{ optimizedRenderPassMutex_ };
+    if (optimizedRenderPass_.instance != nullptr)
+        renderSystemInstance.Release(*optimizedRenderPass_.instance);
+    optimizedRenderPass_ = {};
+}
+
 
 } // /namespace LLGL
 
@@ -10,9 +10,13 @@
 
 
 #include <LLGL/RenderTarget.h>
+#include <LLGL/Constants.h>
 #include "../RenderState/DbgRenderPass.h"
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -20,6 +24,8 @@ namespace LLGL
 
 
 class RenderingDebugger;
+class RenderSystem;
+class DbgTexture;
 
 class DbgRenderTarget final : public RenderTarget
 {
@@ -36,6 +42,52 @@ class DbgRenderTarget final : public RenderTarget
 
         DbgRenderTarget(RenderTarget& instance, const RenderTargetDescriptor& desc);
 
+    public:
+
+        // Attachment slot of the depth-stencil attachment for the load/store analysis. Color attachments use their index as slot.
+        static constexpr std::uint32_t depthStencilSlot = LLGL_MAX_NUM_COLOR_ATTACHMENTS;
+        static constexpr std::uint32_t numAttachmentSlots = LLGL_MAX_NUM_COLOR_ATTACHMENTS + 1;
+
+        // Render pass instance with downgraded load operations.
+        struct OptimizedRenderPass
+        {
+            const DbgRenderPass*    source                          = nullptr;  // Render pass this optimization was derived from. Only used for identification.
+            RenderPass*             instance                        = nullptr;
+            std::uint32_t           loadMask                        = 0;        // Bitmask of attachment slots whose load operation has been downgraded.
+            std::uint32_t           clearValueMap[numAttachmentSlots];          // Index into the original clear values for each clear value of the optimized render pass.
+            std::uint32_t           numClearValues                  = 0;
+        };
+
+    public:
+
+        // Returns the combined load operation of the specified attachment slot. Depth and stencil operations are combined into one slot.
+        static AttachmentLoadOp GetAttachmentLoadOp(const RenderPassDescriptor& renderPassDesc, std::uint32_t slot);
+
+        // Returns the combined store operation of the specified attachment slot. Depth and stencil operations are combined into one slot.
+        static AttachmentStoreOp GetAttachmentStoreOp(const RenderPassDescriptor& renderPassDesc, std::uint32_t slot);
+
+        // Returns the debug texture of the specified attachment slot or null if the attachment has no texture.
+        DbgTexture* GetAttachmentTexture(std::uint32_t slot) const;
+
+        // Returns the render pass that determines the load and store operations when this render target is used with the specified render pass.
+        const DbgRenderPass* GetEffectiveRenderPass(const RenderPass* renderPass) const;
+
+        // Stores the render pass the load/store analysis is recorded with.
+        void NotifyAnalyzedRenderPass(const DbgRenderPass& renderPass);
+
+        // Copies the optimized render pass into 'outOptimizedRenderPass' if there is one for the specified source render pass. Can be called from any recording thread.
+        bool GetOptimizedRenderPass(const DbgRenderPass* source, OptimizedRenderPass& outOptimizedRenderPass) const;
+
+        /*
+        Re-creates the optimized render pass with downgraded load operations from the load/store analysis of the attachment textures.
+        Store operations are only reported, since a single frame cannot prove that stored content is never read later.
+        The previous optimized render pass is appended to 'retiredRenderPasses' instead of being released, since command buffers in flight may still use it.
+        */
+        void UpdateOptimizedRenderPass(RenderSystem& renderSystemInstance, std::vector<RenderPass*>& retiredRenderPasses);
+
+        // Releases the optimized render pass (if any).
+        void ReleaseOptimizedRenderPass(RenderSystem& renderSystemInstance);
+
     public:
 
         RenderTarget&                   instance;
@@ -46,6 +98,11 @@ class DbgRenderTarget final : public RenderTarget
 
         std::unique_ptr<DbgRenderPass>  renderPass_;
 
+        const DbgRenderPass*            analyzedRenderPass_     = nullptr; // Render pass the load/store analysis was last recorded with. Only used for identification.
+        RenderPassDescriptor            analyzedRenderPassDesc_;
+        OptimizedRenderPass             optimizedRenderPass_;
+        mutable std::mutex              optimizedRenderPassMutex_;          // Guards the members above; Command buffers read the optimized render pass on their recording threads.
+
 };
 
 
@@ -20,6 +20,7 @@ DbgTexture::DbgTexture(Texture& instance, const TextureDescriptor& desc) :
     mipLevels { NumMipLevels(desc)        },
     label     { LLGL_DBG_LABEL(desc)      }
 {
+    attachmentState.contentDefined = ((desc.miscFlags & MiscFlags::NoInitialData) == 0);
 }
 
 #if 0
@@ -51,6 +52,25 @@ void DbgTexture::SetDebugName(const char* name)
     DbgSetObjectName(*this, name);
 }
 
+void DbgTexture::NotifyContentRead()
+{
+    if (attachmentState.storePending)
+    {
+        attachmentState.storeRequired   = true;
+        attachmentState.storePending    = false;
+    }
+}
+
+void DbgTexture::NotifyContentWritten()
+{
+    attachmentState.contentDefined = true;
+}
+
+bool DbgTexture::IsAttachmentLoadRedundant() const
+{
+    return (attachmentState.loadRedundant && !attachmentState.loadRequired);
+}
+
 TextureDescriptor DbgTexture::GetDesc() const
 {
     return instance.GetDesc();
@@ -35,6 +35,28 @@ class DbgTexture final : public Texture
         //DbgTexture(Texture& instance, DbgTexture* sharedTexture, const TextureViewDescriptor& desc);
         ~DbgTexture();
 
+        // Marks the content of this texture as read, which consumes a pending store operation of a render pass.
+        void NotifyContentRead();
+
+        // Marks the content of this texture as defined, e.g. after a copy command wrote into it.
+        void NotifyContentWritten();
+
+        // Returns true if the load operation of render passes for this attachment has been found to be unnecessary.
+        bool IsAttachmentLoadRedundant() const;
+
+    public:
+
+        // Load/store analysis state of this texture when it is used as render target attachment.
+        struct AttachmentState
+        {
+            bool contentDefined = false;    // Content has been initialized, stored by a render pass, or written by a copy command.
+            bool storePending   = false;    // Content has been stored by a render pass and not been read since.
+            bool storeRedundant = false;    // Stored content has been overwritten before it was read at least once.
+            bool storeRequired  = false;    // Stored content has been read at least once.
+            bool loadRedundant  = false;    // Loaded or cleared content has been cleared again before anything was drawn at least once.
+            bool loadRequired   = false;    // Loaded or cleared content has been drawn into at least once.
+        };
+
     public:
 
         Texture&                instance;
@@ -43,6 +65,9 @@ class DbgTexture final : public Texture
         std::uint32_t           mipLevels           = 1;        // Actual number of MIP-map levels.
         std::string             label;
         const bool              isTextureView       = false;
+        std::uint64_t           lastWriteSerial     = 0;        // Submission serial of the last command buffer that wrote to this texture.
+        std::uint64_t           lastReadSerial      = 0;        // Submission serial of the last command buffer that read from this texture.
+        AttachmentState         attachmentState;
 
     private:
 
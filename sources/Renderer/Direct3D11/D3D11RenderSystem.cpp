@@ -797,6 +797,14 @@ static std::vector<Format> GetDefaultSupportedDXTextureFormats(D3D_FEATURE_LEVEL
         );
     }
 
+    if (featureLevel >= D3D_FEATURE_LEVEL_11_0)
+    {
+        formats.insert(
+            formats.end(),
+            { Format::BC7UNorm, Format::BC7UNorm_sRGB }
+        );
+    }
+
     return formats;
 }
 
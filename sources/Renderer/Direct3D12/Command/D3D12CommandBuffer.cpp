@@ -680,6 +680,17 @@ void D3D12CommandBuffer::BeginRenderPass(
     }
 }
 
+void D3D12CommandBuffer::BeginParallelRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    /* Bundles are executed in order with Execute, so this is equivalent to a regular render pass */
+    BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex);
+}
+
 void D3D12CommandBuffer::EndRenderPass()
 {
     /* Resolve multi-sampled subresources of previously bound render target */
@@ -970,6 +981,54 @@ void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offse
     }
 }
 
+void D3D12CommandBuffer::DrawIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    /* Default command signature has a fixed stride, so custom strides cannot be encoded with a GPU driven draw count */
+    if likely(stride == sizeof(D3D12_DRAW_ARGUMENTS))
+    {
+        auto& argsBufferD3D     = LLGL_CAST(D3D12Buffer&, argsBuffer);
+        auto& countBufferD3D    = LLGL_CAST(D3D12Buffer&, countBuffer);
+        commandContext_.DrawIndirect(
+            cmdSignatureFactory_->GetSignatureDrawIndirect(),
+            maxNumCommands,
+            argsBufferD3D.GetNative(),
+            argsOffset,
+            countBufferD3D.GetNative(),
+            countOffset
+        );
+    }
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    /* Default command signature has a fixed stride, so custom strides cannot be encoded with a GPU driven draw count */
+    if likely(stride == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS))
+    {
+        auto& argsBufferD3D     = LLGL_CAST(D3D12Buffer&, argsBuffer);
+        auto& countBufferD3D    = LLGL_CAST(D3D12Buffer&, countBuffer);
+        commandContext_.DrawIndirect(
+            cmdSignatureFactory_->GetSignatureDrawIndexedIndirect(),
+            maxNumCommands,
+            argsBufferD3D.GetNative(),
+            argsOffset,
+            countBufferD3D.GetNative(),
+            countOffset
+        );
+    }
+}
+
 /* ----- Compute ----- */
 
 void D3D12CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -693,7 +693,7 @@ static std::vector<Format> GetDefaultSupportedDXTextureFormats()
 
     formats.insert(
         formats.end(),
-        { Format::BC4UNorm, Format::BC4SNorm, Format::BC5UNorm, Format::BC5SNorm }
+        { Format::BC4UNorm, Format::BC4SNorm, Format::BC5UNorm, Format::BC5SNorm, Format::BC7UNorm, Format::BC7UNorm_sRGB }
     );
 
     return formats;
@@ -763,6 +763,7 @@ void D3D12RenderSystem::QueryRenderingCaps()
         caps.features.hasPipelineCaching                = true;
         caps.features.hasPipelineStatistics             = true;
         caps.features.hasRenderCondition                = true;
+        caps.features.hasIndirectDrawCount              = true;
 
         /* Query limits */
         caps.limits.lineWidthRange[0]                   = 1.0f;
@@ -539,6 +539,17 @@ void MTDirectCommandBuffer::BeginRenderPass(
     }
 }
 
+void MTDirectCommandBuffer::BeginParallelRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    /* Secondary command buffers are executed in order with Execute, so this is equivalent to a regular render pass */
+    BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex);
+}
+
 void MTDirectCommandBuffer::EndRenderPass()
 {
     context_.Flush();
@@ -994,6 +1005,28 @@ void MTDirectCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t of
     }
 }
 
+void MTDirectCommandBuffer::DrawIndirectCount(
+    Buffer&         /*argsBuffer*/,
+    std::uint64_t   /*argsOffset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy
+}
+
+void MTDirectCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         /*argsBuffer*/,
+    std::uint64_t   /*argsOffset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy
+}
+
 /* ----- Compute ----- */
 
 void MTDirectCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
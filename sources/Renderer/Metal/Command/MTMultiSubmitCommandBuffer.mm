@@ -513,6 +513,17 @@ void MTMultiSubmitCommandBuffer::BeginRenderPass(
     }
 }
 
+void MTMultiSubmitCommandBuffer::BeginParallelRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    /* Secondary command buffers are executed in order with Execute, so this is equivalent to a regular render pass */
+    BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex);
+}
+
 void MTMultiSubmitCommandBuffer::EndRenderPass()
 {
     FlushContext();
@@ -985,6 +996,28 @@ void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64
 #endif
 }
 
+void MTMultiSubmitCommandBuffer::DrawIndirectCount(
+    Buffer&         /*argsBuffer*/,
+    std::uint64_t   /*argsOffset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy
+}
+
+void MTMultiSubmitCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         /*argsBuffer*/,
+    std::uint64_t   /*argsOffset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy
+}
+
 /* ----- Compute ----- */
 
 void MTMultiSubmitCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -30,6 +30,14 @@ struct NullCmdBufferWrite
 //  std::int8_t data[dataSize];
 };
 
+struct NullCmdBufferFill
+{
+    NullBuffer*     buffer;
+    std::uint64_t   offset;
+    std::uint64_t   size;
+    std::uint32_t   value;
+};
+
 struct NullCmdCopySubresource
 {
     Resource*       srcResource;
@@ -77,6 +85,33 @@ struct NullCmdDrawIndexed
 //  const NullBuffer*               vertexBuffers[numVertexBuffers];
 };
 
+struct NullCmdDrawIndirectCount
+{
+    NullBuffer*     argsBuffer;
+    std::uint64_t   argsOffset;
+    NullBuffer*     countBuffer;
+    std::uint64_t   countOffset;
+    std::uint32_t   maxNumCommands;
+    std::uint32_t   stride;
+    std::size_t     numVertexBuffers;
+//  const NullBuffer*   vertexBuffers[numVertexBuffers];
+};
+
+struct NullCmdDrawIndexedIndirectCount
+{
+    NullBuffer*         argsBuffer;
+    std::uint64_t       argsOffset;
+    NullBuffer*         countBuffer;
+    std::uint64_t       countOffset;
+    std::uint32_t       maxNumCommands;
+    std::uint32_t       stride;
+    const NullBuffer*   indexBuffer;
+    Format              indexBufferFormat;
+    std::uint64_t       indexBufferOffset;
+    std::size_t         numVertexBuffers;
+//  const NullBuffer*   vertexBuffers[numVertexBuffers];
+};
+
 struct NullCmdPushDebugGroup
 {
     std::size_t length;
@@ -23,6 +23,7 @@
 
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/IndirectArguments.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -150,8 +151,22 @@ void NullCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
-    //auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
-    //todo
+    auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
+    auto cmd = AllocCommand<NullCmdBufferFill>(NullOpcodeBufferFill);
+    {
+        cmd->buffer = &dstBufferNull;
+        if (fillSize == LLGL_WHOLE_SIZE)
+        {
+            cmd->offset = 0;
+            cmd->size   = dstBufferNull.desc.size;
+        }
+        else
+        {
+            cmd->offset = dstOffset;
+            cmd->size   = fillSize;
+        }
+        cmd->value = value;
+    }
 }
 
 void NullCommandBuffer::CopyTexture(
@@ -171,7 +186,7 @@ void NullCommandBuffer::CopyTexture(
         cmd->srcY           = srcLocation.offset.y;
         cmd->srcZ           = srcLocation.offset.z;
         cmd->dstResource    = &dstTextureNull;
-        cmd->dstSubresource = dstTextureNull.PackSubresourceIndex(srcLocation.mipLevel, srcLocation.arrayLayer);
+        cmd->dstSubresource = dstTextureNull.PackSubresourceIndex(dstLocation.mipLevel, dstLocation.arrayLayer);
         cmd->dstX           = dstLocation.offset.x;
         cmd->dstY           = dstLocation.offset.y;
         cmd->dstZ           = dstLocation.offset.z;
@@ -343,6 +358,17 @@ void NullCommandBuffer::BeginRenderPass(
     }
 }
 
+void NullCommandBuffer::BeginParallelRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    /* Secondary command buffers are replayed in order with Execute, so this is equivalent to a regular render pass */
+    BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex);
+}
+
 void NullCommandBuffer::EndRenderPass()
 {
     //todo
@@ -561,6 +587,53 @@ void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset
     }
 }
 
+void NullCommandBuffer::DrawIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    /* Count buffer is read at execution time, since it is typically written by a compute shader before this command is executed */
+    auto cmd = AllocCommand<NullCmdDrawIndirectCount>(NullOpcodeDrawIndirectCount, sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
+    {
+        cmd->argsBuffer         = LLGL_CAST(NullBuffer*, &argsBuffer);
+        cmd->argsOffset         = argsOffset;
+        cmd->countBuffer        = LLGL_CAST(NullBuffer*, &countBuffer);
+        cmd->countOffset        = countOffset;
+        cmd->maxNumCommands     = maxNumCommands;
+        cmd->stride             = stride;
+        cmd->numVertexBuffers   = renderState_.vertexBuffers.size();
+        ::memcpy(cmd + 1, renderState_.vertexBuffers.data(), sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
+    }
+}
+
+void NullCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    /* Count buffer is read at execution time, since it is typically written by a compute shader before this command is executed */
+    auto cmd = AllocCommand<NullCmdDrawIndexedIndirectCount>(NullOpcodeDrawIndexedIndirectCount, sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
+    {
+        cmd->argsBuffer         = LLGL_CAST(NullBuffer*, &argsBuffer);
+        cmd->argsOffset         = argsOffset;
+        cmd->countBuffer        = LLGL_CAST(NullBuffer*, &countBuffer);
+        cmd->countOffset        = countOffset;
+        cmd->maxNumCommands     = maxNumCommands;
+        cmd->stride             = stride;
+        cmd->indexBuffer        = renderState_.indexBuffer;
+        cmd->indexBufferFormat  = renderState_.indexBufferFormat;
+        cmd->indexBufferOffset  = renderState_.indexBufferOffset;
+        cmd->numVertexBuffers   = renderState_.vertexBuffers.size();
+        ::memcpy(cmd + 1, renderState_.vertexBuffers.data(), sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
+    }
+}
+
 /* ----- Compute ----- */
 
 void NullCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
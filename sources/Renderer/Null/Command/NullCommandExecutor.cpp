@@ -20,12 +20,83 @@
 #include "../RenderState/NullQueryHeap.h"
 
 #include "../../CheckedCast.h"
+#include "../../TextureUtils.h"
+#include <LLGL/Format.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+// Returns the size (in bytes) of the tightly packed region of a copy command. Row and layer strides are not supported by the Null backend.
+static std::size_t GetNullCopyRegionSize(const NullTexture& texture, const NullCmdCopySubresource& cmd)
+{
+    const std::size_t numTexels = static_cast<std::size_t>(cmd.width) * cmd.height * cmd.depth;
+    return GetMemoryFootprint(texture.GetFormat(), numTexels);
+}
+
+static DynamicByteArray ReadNullTextureRegion(NullTexture& srcTexture, const NullCmdCopySubresource& cmd)
+{
+    std::uint32_t mipLevel = 0, arrayLayer = 0;
+    srcTexture.UnpackSubresourceIndex(cmd.srcSubresource, mipLevel, arrayLayer);
+
+    const Offset3D  srcOffset   = CalcTextureOffset(srcTexture.GetType(), Offset3D{ static_cast<std::int32_t>(cmd.srcX), static_cast<std::int32_t>(cmd.srcY), static_cast<std::int32_t>(cmd.srcZ) }, arrayLayer);
+    const Extent3D  extent      = { static_cast<std::uint32_t>(cmd.width), cmd.height, cmd.depth };
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(srcTexture.GetFormat());
+    DynamicByteArray texels{ GetNullCopyRegionSize(srcTexture, cmd), UninitializeTag{} };
+    srcTexture.ReadMipRegion(mipLevel, srcOffset, extent, MutableImageView{ formatAttribs.format, formatAttribs.dataType, texels.get(), texels.size() });
+    return texels;
+}
+
+static void WriteNullTextureRegion(NullTexture& dstTexture, const NullCmdCopySubresource& cmd, const DynamicByteArray& texels)
+{
+    std::uint32_t mipLevel = 0, arrayLayer = 0;
+    dstTexture.UnpackSubresourceIndex(cmd.dstSubresource, mipLevel, arrayLayer);
+
+    const Offset3D  dstOffset   = CalcTextureOffset(dstTexture.GetType(), Offset3D{ static_cast<std::int32_t>(cmd.dstX), static_cast<std::int32_t>(cmd.dstY), static_cast<std::int32_t>(cmd.dstZ) }, arrayLayer);
+    const Extent3D  extent      = { static_cast<std::uint32_t>(cmd.width), cmd.height, cmd.depth };
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(dstTexture.GetFormat());
+    dstTexture.WriteMipRegion(mipLevel, dstOffset, extent, ImageView{ formatAttribs.format, formatAttribs.dataType, texels.get(), texels.size() });
+}
+
+// Reads the number of draw commands from the count buffer at execution time, clamped to the maximum number of commands.
+static std::uint32_t ReadNullDrawCount(NullBuffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands)
+{
+    std::uint32_t numCommands = 0;
+    if (!countBuffer.Read(countOffset, &numCommands, sizeof(numCommands)))
+        return 0;
+    return std::min(numCommands, maxNumCommands);
+}
+
+/*
+Executes a single non-indexed draw command. Direct, indirect, and indirect-count draws all end up here.
+The Null backend does not rasterize, so draw commands have no observable effect besides the buffers they read.
+*/
+static void ExecuteNullDraw(
+    const DrawIndirectArguments&    /*args*/,
+    std::size_t                     /*numVertexBuffers*/,
+    const NullBuffer* const*        /*vertexBuffers*/)
+{
+    //TODO: vertex processing
+}
+
+// Executes a single indexed draw command; See ExecuteNullDraw().
+static void ExecuteNullDrawIndexed(
+    const DrawIndexedIndirectArguments& /*args*/,
+    const NullBuffer*                   /*indexBuffer*/,
+    Format                              /*indexBufferFormat*/,
+    std::uint64_t                       /*indexBufferOffset*/,
+    std::size_t                         /*numVertexBuffers*/,
+    const NullBuffer* const*            /*vertexBuffers*/)
+{
+    //TODO: vertex processing
+}
+
 static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
 {
     switch (opcode)
@@ -36,6 +107,13 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
             cmd->buffer->Write(cmd->offset, cmd + 1, cmd->size);
             return (sizeof(*cmd) + cmd->size);
         }
+        case NullOpcodeBufferFill:
+        {
+            auto cmd = reinterpret_cast<const NullCmdBufferFill*>(pc);
+            std::vector<std::uint32_t> values(static_cast<std::size_t>(cmd->size / sizeof(std::uint32_t)), cmd->value);
+            cmd->buffer->Write(cmd->offset, values.data(), values.size() * sizeof(std::uint32_t));
+            return sizeof(*cmd);
+        }
         case NullOpcodeCopySubresource:
         {
             auto cmd = reinterpret_cast<const NullCmdCopySubresource*>(pc);
@@ -51,12 +129,27 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
                 }
                 else if (src->GetResourceType() == ResourceType::Texture)
                 {
-                    //TODO
+                    auto* srcTexture = LLGL_CAST(NullTexture*, src);
+                    DynamicByteArray texels = ReadNullTextureRegion(*srcTexture, *cmd);
+                    dstBuffer->Write(cmd->dstX, texels.get(), texels.size());
                 }
             }
             else if (dst->GetResourceType() == ResourceType::Texture)
             {
-                //TODO
+                auto* dstTexture = LLGL_CAST(NullTexture*, dst);
+                if (src->GetResourceType() == ResourceType::Buffer)
+                {
+                    auto* srcBuffer = LLGL_CAST(NullBuffer*, src);
+                    DynamicByteArray texels{ GetNullCopyRegionSize(*dstTexture, *cmd), UninitializeTag{} };
+                    if (srcBuffer->Read(cmd->srcX, texels.get(), texels.size()))
+                        WriteNullTextureRegion(*dstTexture, *cmd, texels);
+                }
+                else if (src->GetResourceType() == ResourceType::Texture)
+                {
+                    auto* srcTexture = LLGL_CAST(NullTexture*, src);
+                    DynamicByteArray texels = ReadNullTextureRegion(*srcTexture, *cmd);
+                    WriteNullTextureRegion(*dstTexture, *cmd, texels);
+                }
             }
             return sizeof(*cmd);
         }
@@ -71,13 +164,57 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
         case NullOpcodeDraw:
         {
             auto cmd = reinterpret_cast<const NullCmdDraw*>(pc);
-            //TODO
+            ExecuteNullDraw(cmd->args, cmd->numVertexBuffers, reinterpret_cast<const NullBuffer* const*>(cmd + 1));
             return (sizeof(*cmd) + cmd->numVertexBuffers * sizeof(const NullBuffer*));
         }
         case NullOpcodeDrawIndexed:
         {
             auto cmd = reinterpret_cast<const NullCmdDrawIndexed*>(pc);
-            //TODO
+            ExecuteNullDrawIndexed(
+                cmd->args,
+                cmd->indexBuffer,
+                cmd->indexBufferFormat,
+                cmd->indexBufferOffset,
+                cmd->numVertexBuffers,
+                reinterpret_cast<const NullBuffer* const*>(cmd + 1)
+            );
+            return (sizeof(*cmd) + cmd->numVertexBuffers * sizeof(const NullBuffer*));
+        }
+        case NullOpcodeDrawIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const NullCmdDrawIndirectCount*>(pc);
+            const std::uint32_t numCommands = ReadNullDrawCount(*cmd->countBuffer, cmd->countOffset, cmd->maxNumCommands);
+            std::uint64_t argsOffset = cmd->argsOffset;
+            for_range(i, numCommands)
+            {
+                DrawIndirectArguments drawArgs;
+                if (!cmd->argsBuffer->Read(argsOffset, &drawArgs, sizeof(drawArgs)))
+                    break;
+                ExecuteNullDraw(drawArgs, cmd->numVertexBuffers, reinterpret_cast<const NullBuffer* const*>(cmd + 1));
+                argsOffset += cmd->stride;
+            }
+            return (sizeof(*cmd) + cmd->numVertexBuffers * sizeof(const NullBuffer*));
+        }
+        case NullOpcodeDrawIndexedIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const NullCmdDrawIndexedIndirectCount*>(pc);
+            const std::uint32_t numCommands = ReadNullDrawCount(*cmd->countBuffer, cmd->countOffset, cmd->maxNumCommands);
+            std::uint64_t argsOffset = cmd->argsOffset;
+            for_range(i, numCommands)
+            {
+                DrawIndexedIndirectArguments drawArgs;
+                if (!cmd->argsBuffer->Read(argsOffset, &drawArgs, sizeof(drawArgs)))
+                    break;
+                ExecuteNullDrawIndexed(
+                    drawArgs,
+                    cmd->indexBuffer,
+                    cmd->indexBufferFormat,
+                    cmd->indexBufferOffset,
+                    cmd->numVertexBuffers,
+                    reinterpret_cast<const NullBuffer* const*>(cmd + 1)
+                );
+                argsOffset += cmd->stride;
+            }
             return (sizeof(*cmd) + cmd->numVertexBuffers * sizeof(const NullBuffer*));
         }
         case NullOpcodePushDebugGroup:
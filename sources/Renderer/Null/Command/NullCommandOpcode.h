@@ -19,11 +19,14 @@ namespace LLGL
 enum NullOpcode : std::uint8_t
 {
     NullOpcodeBufferWrite = 1,
+    NullOpcodeBufferFill,
     NullOpcodeCopySubresource,
     NullOpcodeGenerateMips,
     //TODO
     NullOpcodeDraw,
     NullOpcodeDrawIndexed,
+    NullOpcodeDrawIndirectCount,
+    NullOpcodeDrawIndexedIndirectCount,
     NullOpcodePushDebugGroup,
     NullOpcodePopDebugGroup,
 };
@@ -9,6 +9,7 @@
 #include "NullCommandBuffer.h"
 #include "NullCommandExecutor.h"
 #include "../RenderState/NullQueryHeap.h"
+#include "../RenderState/NullFence.h"
 #include "../../CheckedCast.h"
 
 
@@ -16,13 +17,34 @@ namespace LLGL
 {
 
 
+NullCommandQueue::NullCommandQueue(const CommandQueueType type) :
+    CommandQueue { type }
+{
+    if (type != CommandQueueType::Graphics)
+        worker_ = std::thread{ &NullCommandQueue::RunWorkerThread, this };
+}
+
+NullCommandQueue::~NullCommandQueue()
+{
+    if (worker_.joinable())
+    {
+        /* Let worker thread finish all pending tasks before it quits */
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            quit_ = true;
+        }
+        taskCond_.notify_one();
+        worker_.join();
+    }
+}
+
 /* ----- Command Buffers ----- */
 
 void NullCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferNull = LLGL_CAST(NullCommandBuffer&, commandBuffer);
     if ((commandBufferNull.desc.flags & (CommandBufferFlags::ImmediateSubmit | CommandBufferFlags::Secondary)) == 0)
-        commandBufferNull.ExecuteVirtualCommands();
+        Schedule([&commandBufferNull]() { commandBufferNull.ExecuteVirtualCommands(); });
 }
 
 /* ----- Queries ----- */
@@ -38,17 +60,93 @@ bool NullCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuer
 
 void NullCommandQueue::Submit(Fence& fence)
 {
-    //todo
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    const std::uint64_t signal = fenceNull.NextSignal();
+    Schedule([&fenceNull, signal]() { fenceNull.Signal(signal); });
 }
 
 bool NullCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
-    return false; //todo
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    return fenceNull.WaitForSignal(fenceNull.GetSubmittedSignal(), timeout);
 }
 
 void NullCommandQueue::WaitIdle()
 {
-    //todo
+    if (worker_.joinable())
+    {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        idleCond_.wait(lock, [this]() { return (tasks_.empty() && !busy_); });
+    }
+}
+
+void NullCommandQueue::SubmitWait(Fence& fence)
+{
+    /* Capture the signal value at submission time, so later submissions of the same fence are not waited on */
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    const std::uint64_t signal = fenceNull.GetSubmittedSignal();
+    Schedule([&fenceNull, signal]() { fenceNull.WaitForSignal(signal); });
+}
+
+void NullCommandQueue::SubmitSignal(Fence& fence, std::uint64_t value)
+{
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    fenceNull.SubmitSignal(value);
+    Schedule([&fenceNull, value]() { fenceNull.Signal(value); });
+}
+
+bool NullCommandQueue::WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    return fenceNull.WaitForSignal(value, timeout);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullCommandQueue::Schedule(Task&& task)
+{
+    if (worker_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            tasks_.push_back(std::move(task));
+        }
+        taskCond_.notify_one();
+    }
+    else
+        task();
+}
+
+void NullCommandQueue::RunWorkerThread()
+{
+    std::unique_lock<std::mutex> lock{ mutex_ };
+    for (;;)
+    {
+        taskCond_.wait(lock, [this]() { return (quit_ || !tasks_.empty()); });
+
+        if (tasks_.empty())
+        {
+            /* Quit only after all pending tasks have been executed */
+            break;
+        }
+
+        Task task = std::move(tasks_.front());
+        tasks_.pop_front();
+        busy_ = true;
+
+        lock.unlock();
+        {
+            task();
+        }
+        lock.lock();
+
+        busy_ = false;
+        if (tasks_.empty())
+            idleCond_.notify_all();
+    }
 }
 
 
@@ -10,12 +10,21 @@
 
 
 #include <LLGL/CommandQueue.h>
+#include <functional>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 
 namespace LLGL
 {
 
 
+/*
+The graphics command queue executes all work immediately on the calling thread.
+Dedicated compute and transfer queues emulate asynchronous GPU queues with a worker thread each.
+*/
 class NullCommandQueue final : public CommandQueue
 {
 
@@ -23,6 +32,36 @@ class NullCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+    public:
+
+        void SubmitWait(Fence& fence) override;
+        void SubmitSignal(Fence& fence, std::uint64_t value) override;
+        bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout) override;
+
+    public:
+
+        NullCommandQueue(const CommandQueueType type = CommandQueueType::Graphics);
+        ~NullCommandQueue();
+
+    private:
+
+        using Task = std::function<void()>;
+
+        // Executes the task immediately or enqueues it to the worker thread if this is a dedicated queue.
+        void Schedule(Task&& task);
+
+        void RunWorkerThread();
+
+    private:
+
+        std::thread             worker_;
+        std::mutex              mutex_;
+        std::condition_variable taskCond_;
+        std::condition_variable idleCond_;
+        std::deque<Task>        tasks_;
+        bool                    busy_       = false;
+        bool                    quit_       = false;
+
 };
 
 
@@ -30,7 +30,7 @@ static void InitNullRendererShadingLanguages(std::vector<ShadingLanguage>& shadi
 static void InitNullRendererTextureFormats(std::vector<Format>& textureFormats)
 {
     constexpr int firstFormatIndex  = static_cast<int>(Format::A8UNorm);
-    constexpr int lastFormatIndex   = static_cast<int>(Format::BC5SNorm);
+    constexpr int lastFormatIndex   = static_cast<int>(Format::BC7UNorm_sRGB);
     constexpr int numFormats        = lastFormatIndex - firstFormatIndex + 1;
     textureFormats.reserve(static_cast<std::size_t>(numFormats));
     for_range(i, numFormats)
@@ -64,6 +64,7 @@ static void InitNullRendererFeatures(RenderingFeatures& features)
     features.hasLogicOp                     = true;
     features.hasPipelineStatistics          = true;
     features.hasRenderCondition             = true;
+    features.hasIndirectDrawCount           = true;
 }
 
 static void InitNullRendererLimits(RenderingLimits& limits)
@@ -119,8 +120,10 @@ static RendererInfo GetNullRenderInfo()
 }
 
 NullRenderSystem::NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
-    desc_         { renderSystemDesc               },
-    commandQueue_ { MakeUnique<NullCommandQueue>() }
+    desc_          { renderSystemDesc                                            },
+    commandQueue_  { MakeUnique<NullCommandQueue>()                              },
+    computeQueue_  { MakeUnique<NullCommandQueue>(CommandQueueType::Compute)     },
+    transferQueue_ { MakeUnique<NullCommandQueue>(CommandQueueType::Transfer)    }
 {
     SetRendererInfo(GetNullRenderInfo());
     SetRenderingCaps(GetNullRenderingCaps());
@@ -145,6 +148,17 @@ CommandQueue* NullRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* NullRenderSystem::GetDedicatedCommandQueue(const CommandQueueType type)
+{
+    switch (type)
+    {
+        case CommandQueueType::Graphics:    return commandQueue_.get();
+        case CommandQueueType::Compute:     return computeQueue_.get();
+        case CommandQueueType::Transfer:    return transferQueue_.get();
+    }
+    return nullptr;
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* NullRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -366,6 +380,14 @@ void NullRenderSystem::Release(Fence& fence)
     fences_.erase(&fence);
 }
 
+/* ----- Loader threads ----- */
+
+bool NullRenderSystem::BeginLoaderThread()
+{
+    /* Null resources are complete when they are created, so loader threads only need thread-safe object containers */
+    return true;
+}
+
 /* ----- Extensions ----- */
 
 bool NullRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -45,30 +45,38 @@ class NullRenderSystem final : public RenderSystem
 
         NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
 
+        CommandQueue* GetDedicatedCommandQueue(const CommandQueueType type) override;
+
+        bool BeginLoaderThread() override;
+
     private:
 
         /* ----- Common objects ----- */
 
-        const RenderSystemDescriptor            desc_;
+        const RenderSystemDescriptor             desc_;
 
         /* ----- Hardware object containers ----- */
 
-        HWObjectContainer<NullSwapChain>        swapChains_;
-        HWObjectInstance<NullCommandQueue>      commandQueue_;
-        HWObjectContainer<NullCommandBuffer>    commandBuffers_;
-        HWObjectContainer<NullBuffer>           buffers_;
-        HWObjectContainer<NullBufferArray>      bufferArrays_;
-        HWObjectContainer<NullTexture>          textures_;
-        HWObjectContainer<NullRenderPass>       renderPasses_;
-        HWObjectContainer<NullRenderTarget>     renderTargets_;
-        HWObjectContainer<NullShader>           shaders_;
-        HWObjectContainer<NullPipelineLayout>   pipelineLayouts_;
-        HWObjectInstance<ProxyPipelineCache>    pipelineCacheProxy_;
-        HWObjectContainer<NullPipelineState>    pipelineStates_;
-        HWObjectContainer<NullResourceHeap>     resourceHeaps_;
-        HWObjectContainer<NullSampler>          samplers_;
-        HWObjectContainer<NullQueryHeap>        queryHeaps_;
-        HWObjectContainer<NullFence>            fences_;
+        HWObjectContainer<NullSwapChain>         swapChains_;
+        HWObjectInstance<NullCommandQueue>       commandQueue_;
+        HWObjectContainer<NullCommandBuffer>     commandBuffers_;
+        ConcurrentHWObjectContainer<NullBuffer>  buffers_;
+        HWObjectContainer<NullBufferArray>       bufferArrays_;
+        ConcurrentHWObjectContainer<NullTexture> textures_;
+        HWObjectContainer<NullRenderPass>        renderPasses_;
+        HWObjectContainer<NullRenderTarget>      renderTargets_;
+        ConcurrentHWObjectContainer<NullShader>  shaders_;
+        HWObjectContainer<NullPipelineLayout>    pipelineLayouts_;
+        HWObjectInstance<ProxyPipelineCache>     pipelineCacheProxy_;
+        HWObjectContainer<NullPipelineState>     pipelineStates_;
+        HWObjectContainer<NullResourceHeap>      resourceHeaps_;
+        ConcurrentHWObjectContainer<NullSampler> samplers_;
+        HWObjectContainer<NullQueryHeap>         queryHeaps_;
+        HWObjectContainer<NullFence>             fences_;
+
+        /* Dedicated queues are declared last, so their worker threads finish before any resource is released */
+        HWObjectInstance<NullCommandQueue>       computeQueue_;
+        HWObjectInstance<NullCommandQueue>       transferQueue_;
 
 };
 
@@ -6,7 +6,7 @@
  */
 
 #include "NullFence.h"
-#include <thread>
+#include <algorithm>
 #include <chrono>
 
 
@@ -22,20 +22,49 @@ void NullFence::SetDebugName(const char* name)
         label_.clear();
 }
 
-void NullFence::Signal(std::uint64_t signal)
+NullFence::NullFence(std::uint64_t initialSignal) :
+    signal_    { initialSignal },
+    submitted_ { initialSignal }
 {
-    signal_ = signal;
 }
 
-void NullFence::WaitForSignal(std::uint64_t signal)
+std::uint64_t NullFence::NextSignal()
 {
-    while (signal_ != signal)
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return ++submitted_;
 }
 
-NullFence::NullFence(std::uint64_t initialSignal) :
-    signal_ { initialSignal }
+void NullFence::SubmitSignal(std::uint64_t signal)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    submitted_ = std::max(submitted_, signal);
+}
+
+std::uint64_t NullFence::GetSubmittedSignal()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return submitted_;
+}
+
+void NullFence::Signal(std::uint64_t signal)
+{
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        signal_ = std::max(signal_, signal);
+    }
+    signalCond_.notify_all();
+}
+
+bool NullFence::WaitForSignal(std::uint64_t signal, std::uint64_t timeout)
 {
+    std::unique_lock<std::mutex> lock{ mutex_ };
+    auto isSignaled = [this, signal]() { return (signal_ >= signal); };
+    if (timeout >= static_cast<std::uint64_t>(std::chrono::nanoseconds::max().count()))
+    {
+        signalCond_.wait(lock, isSignaled);
+        return true;
+    }
+    return signalCond_.wait_for(lock, std::chrono::nanoseconds(timeout), isSignaled);
 }
 
 
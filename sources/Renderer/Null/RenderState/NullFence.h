@@ -11,7 +11,8 @@
 
 #include <LLGL/Fence.h>
 #include <string>
-#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <cstdint>
 
 
@@ -30,14 +31,27 @@ class NullFence final : public Fence
 
         NullFence(std::uint64_t initialSignal = 0);
 
+        // Returns the next signal value for a new submission of this fence.
+        std::uint64_t NextSignal();
+
+        // Records the specified signal value as submitted. Values that are less than the current submitted value are ignored.
+        void SubmitSignal(std::uint64_t signal);
+
+        // Returns the signal value of the most recent submission of this fence.
+        std::uint64_t GetSubmittedSignal();
+
         void Signal(std::uint64_t signal);
 
-        void WaitForSignal(std::uint64_t signal);
+        // Blocks until the fence has reached the specified signal value or the timeout (in nanoseconds) has expired.
+        bool WaitForSignal(std::uint64_t signal, std::uint64_t timeout = ~0ull);
 
     private:
 
         std::string             label_;
-        std::atomic_uint64_t    signal_;
+        std::mutex              mutex_;
+        std::condition_variable signalCond_;
+        std::uint64_t           signal_     = 0;
+        std::uint64_t           submitted_  = 0;
 
 };
 
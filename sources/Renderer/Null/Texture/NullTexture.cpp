@@ -98,6 +98,18 @@ void NullTexture::Read(const TextureRegion& textureRegion, const MutableImageVie
     }
 }
 
+void NullTexture::WriteMipRegion(std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent, const ImageView& srcImageView)
+{
+    if (mipLevel < images_.size())
+        images_[mipLevel].WritePixels(offset, extent, srcImageView);
+}
+
+void NullTexture::ReadMipRegion(std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent, const MutableImageView& dstImageView)
+{
+    if (mipLevel < images_.size())
+        images_[mipLevel].ReadPixels(offset, extent, dstImageView);
+}
+
 void NullTexture::GenerateMips(const TextureSubresource* subresource)
 {
     //todo
@@ -105,13 +117,13 @@ void NullTexture::GenerateMips(const TextureSubresource* subresource)
 
 std::uint32_t NullTexture::PackSubresourceIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
 {
-    return (mipLevel * desc.mipLevels + arrayLayer);
+    return (mipLevel * desc.arrayLayers + arrayLayer);
 }
 
 void NullTexture::UnpackSubresourceIndex(std::uint32_t subresource, std::uint32_t& outMipLevel, std::uint32_t& outArrayLayer) const
 {
-    outMipLevel     = subresource / desc.mipLevels;
-    outArrayLayer   = subresource % desc.mipLevels;
+    outMipLevel     = subresource / desc.arrayLayers;
+    outArrayLayer   = subresource % desc.arrayLayers;
 }
 
 
@@ -40,6 +40,10 @@ class NullTexture final : public Texture
         void Write(const TextureRegion& textureRegion, const ImageView& srcImageView);
         void Read(const TextureRegion& textureRegion, const MutableImageView& dstImageView);
 
+        // Writes/reads a region of the specified MIP-map image. Offset and extent include the array layers (see CalcTextureOffset and CalcTextureExtent).
+        void WriteMipRegion(std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent, const ImageView& srcImageView);
+        void ReadMipRegion(std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent, const MutableImageView& dstImageView);
+
         // Generates the MIP-map images for either the entire resource or a rubresource.
         void GenerateMips(const TextureSubresource* subresource = nullptr);
 
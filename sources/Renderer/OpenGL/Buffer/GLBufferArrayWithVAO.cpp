@@ -61,6 +61,8 @@ static void ThrowNoVertexBufferErr()
 
 void GLBufferArrayWithVAO::BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
+    vao_.Create();
+
     /* Bind VAO */
     GLStateManager::Get().BindVertexArray(GetVaoID());
     {
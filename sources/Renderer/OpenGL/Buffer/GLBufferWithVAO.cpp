@@ -19,7 +19,7 @@ GLBufferWithVAO::GLBufferWithVAO(long bindFlags, const char* debugName) :
 {
 }
 
-void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs)
+void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs, bool deferred)
 {
     /* Store vertex format (required if this buffer is used in a buffer array) */
     if (numVertexAttribs > 0)
@@ -35,12 +35,33 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
     }
     else
     #endif // /LLGL_GL_ENABLE_OPENGL2X
+    if (deferred)
+    {
+        /* Build native VAO on first use in the rendering context */
+        isVAOPending_ = true;
+    }
+    else
     {
         /* Build vertex array with native VAO */
         BuildVertexArrayWithVAO();
     }
 }
 
+GLuint GLBufferWithVAO::GetVaoID()
+{
+    if (isVAOPending_)
+    {
+        BuildVertexArrayWithVAO();
+        isVAOPending_ = false;
+    }
+    return vao_.GetID();
+}
+
+void GLBufferWithVAO::BindVertexArray(GLStateManager& stateMngr)
+{
+    stateMngr.BindVertexArray(GetVaoID());
+}
+
 
 /*
  * ======= Private: =======
@@ -48,8 +69,10 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
 
 void GLBufferWithVAO::BuildVertexArrayWithVAO()
 {
+    vao_.Create();
+
     /* Bind VAO */
-    GLStateManager::Get().BindVertexArray(GetVaoID());
+    GLStateManager::Get().BindVertexArray(vao_.GetID());
     {
         /* Bind VBO */
         GLStateManager::Get().BindBuffer(GLBufferTarget::ArrayBuffer, GetID());
@@ -20,6 +20,8 @@ namespace LLGL
 {
 
 
+class GLStateManager;
+
 class GLBufferWithVAO final : public GLBuffer
 {
 
@@ -27,13 +29,17 @@ class GLBufferWithVAO final : public GLBuffer
 
         GLBufferWithVAO(long bindFlags, const char* debugName = nullptr);
 
-        void BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
+        /*
+        Builds the vertex array for the specified vertex attributes.
+        If 'deferred' is true, the native VAO is built on first use (see GetVaoID), since VAOs cannot be shared with loader contexts.
+        */
+        void BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs, bool deferred = false);
 
-        // Returns the ID of the vertex-array-object (VAO)
-        inline GLuint GetVaoID() const
-        {
-            return vao_.GetID();
-        }
+        // Returns the ID of the vertex-array-object (VAO) and builds it if it was deferred.
+        GLuint GetVaoID();
+
+        // Binds the vertex-array-object (VAO) with the specified state manager and builds it if it was deferred. Must only be called on the rendering thread.
+        void BindVertexArray(GLStateManager& stateMngr);
 
         // Returns the list of vertex attributes.
         inline const std::vector<VertexAttribute>& GetVertexAttribs() const
@@ -60,6 +66,7 @@ class GLBufferWithVAO final : public GLBuffer
 
         GLVertexArrayObject             vao_;
         std::vector<VertexAttribute>    vertexAttribs_;
+        bool                            isVAOPending_   = false;
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         GL2XVertexArray                 vertexArrayGL2X_;
@@ -0,0 +1,216 @@
+/*
+ * GLPixelBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLPixelBufferPool.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Alignment (in bytes) of each region within a chunk; this satisfies the alignment requirements of all pixel data types.
+static constexpr GLsizeiptr g_pixelBufferRegionAlignment = 16;
+
+GLPixelBufferPool::GLPixelBufferPool(GLBufferTarget target, GLsizeiptr chunkSize) :
+    target_    { target    },
+    chunkSize_ { chunkSize }
+{
+}
+
+GLPixelBufferPool::~GLPixelBufferPool()
+{
+    for (Chunk& chunk : chunks_)
+        DeleteChunk(chunk);
+}
+
+bool GLPixelBufferPool::Allocate(GLsizeiptr size, GLPixelBufferRegion& outRegion)
+{
+    /* Try to allocate region from current chunk first */
+    if (currentChunk_ < chunks_.size() && AllocFromChunk(currentChunk_, size, outRegion))
+        return true;
+
+    /*
+    Recycle the first chunk that is no longer in use and large enough.
+    Oversized chunks that are no longer in use but don't fit are deleted, so a single large transfer does not keep its memory mapped forever.
+    */
+    std::size_t freeSlot = chunks_.size();
+
+    for_range(i, chunks_.size())
+    {
+        Chunk& chunk = chunks_[i];
+        if (chunk.id == 0)
+        {
+            freeSlot = std::min(freeSlot, i);
+            continue;
+        }
+
+        if (!IsChunkAvailable(chunk))
+            continue;
+
+        if (chunk.size >= size)
+        {
+            chunk.offset    = 0;
+            currentChunk_   = i;
+            return AllocFromChunk(i, size, outRegion);
+        }
+
+        if (chunk.size > chunkSize_)
+        {
+            DeleteChunk(chunk);
+            freeSlot = std::min(freeSlot, i);
+        }
+    }
+
+    /* Create new chunk that fits at least the requested size; Chunk indices must remain stable since regions refer to them */
+    Chunk chunk;
+    if (!CreateChunk(std::max(chunkSize_, size), chunk))
+        return false;
+
+    if (freeSlot < chunks_.size())
+        chunks_[freeSlot] = chunk;
+    else
+        chunks_.push_back(chunk);
+
+    currentChunk_ = freeSlot;
+
+    return AllocFromChunk(currentChunk_, size, outRegion);
+}
+
+void GLPixelBufferPool::Fence(const GLPixelBufferRegion& region)
+{
+    LLGL_ASSERT(region.chunkIndex < chunks_.size());
+    Chunk& chunk = chunks_[region.chunkIndex];
+
+    /* Replace previous fence since GL signals sync objects in submission order */
+    glDeleteSync(chunk.sync);
+    chunk.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void GLPixelBufferPool::Release(const GLPixelBufferRegion& region)
+{
+    LLGL_ASSERT(region.chunkIndex < chunks_.size());
+    Chunk& chunk = chunks_[region.chunkIndex];
+    LLGL_ASSERT(chunk.numActiveRegions > 0);
+    --chunk.numActiveRegions;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLPixelBufferPool::CreateChunk(GLsizeiptr size, Chunk& outChunk)
+{
+    #ifdef GL_ARB_buffer_storage
+
+    if (!HasExtension(GLExt::ARB_buffer_storage))
+        return false;
+
+    /* Pack buffers are read by the CPU, unpack buffers are written by the CPU */
+    const GLbitfield accessFlags = (target_ == GLBufferTarget::PixelPackBuffer ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);
+    const GLbitfield mapFlags    = (accessFlags | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+    /* Allocate immutable buffer storage and map it persistently */
+    const GLenum targetGL = GLStateManager::ToGLBufferTarget(target_);
+
+    glGenBuffers(1, &outChunk.id);
+    GLStateManager::Get().BindBuffer(target_, outChunk.id);
+    glBufferStorage(targetGL, size, nullptr, mapFlags);
+    outChunk.mappedData = static_cast<char*>(glMapBufferRange(targetGL, 0, size, mapFlags));
+    GLStateManager::Get().BindBuffer(target_, 0);
+
+    if (outChunk.mappedData == nullptr)
+    {
+        DeleteChunk(outChunk);
+        return false;
+    }
+
+    outChunk.size = size;
+    return true;
+
+    #else // GL_ARB_buffer_storage
+
+    return false;
+
+    #endif // /GL_ARB_buffer_storage
+}
+
+void GLPixelBufferPool::DeleteChunk(Chunk& chunk)
+{
+    if (chunk.mappedData != nullptr)
+    {
+        GLStateManager::Get().BindBuffer(target_, chunk.id);
+        glUnmapBuffer(GLStateManager::ToGLBufferTarget(target_));
+        chunk.mappedData = nullptr;
+    }
+    if (chunk.id != 0)
+    {
+        GLStateManager::Get().NotifyBufferRelease(chunk.id, target_);
+        glDeleteBuffers(1, &chunk.id);
+        chunk.id = 0;
+    }
+
+    /* Always call glDeleteSync, it will silently ignore a <sync> value of zero */
+    glDeleteSync(chunk.sync);
+    chunk.sync = nullptr;
+
+    /* Leave an empty slot that can be filled with a new chunk */
+    chunk.size      = 0;
+    chunk.offset    = 0;
+}
+
+bool GLPixelBufferPool::IsChunkAvailable(Chunk& chunk)
+{
+    if (chunk.numActiveRegions > 0)
+        return false;
+
+    if (chunk.sync != nullptr)
+    {
+        /* Poll fence without waiting and drop it once it has been signaled; A failed wait can never succeed, so the fence is dropped as well */
+        const GLenum result = glClientWaitSync(chunk.sync, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+            return false;
+
+        glDeleteSync(chunk.sync);
+        chunk.sync = nullptr;
+    }
+
+    return true;
+}
+
+bool GLPixelBufferPool::AllocFromChunk(std::size_t chunkIndex, GLsizeiptr size, GLPixelBufferRegion& outRegion)
+{
+    Chunk& chunk = chunks_[chunkIndex];
+
+    const GLsizeiptr offset = GetAlignedSize(chunk.offset, g_pixelBufferRegionAlignment);
+    if (offset + size > chunk.size)
+        return false;
+
+    outRegion.bufferID      = chunk.id;
+    outRegion.offset        = static_cast<GLintptr>(offset);
+    outRegion.data          = chunk.mappedData + offset;
+    outRegion.chunkIndex    = chunkIndex;
+
+    chunk.offset = offset + size;
+    ++chunk.numActiveRegions;
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
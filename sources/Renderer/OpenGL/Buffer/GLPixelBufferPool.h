@@ -0,0 +1,94 @@
+/*
+ * GLPixelBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_PIXEL_BUFFER_POOL_H
+#define LLGL_GL_PIXEL_BUFFER_POOL_H
+
+
+#include <LLGL/NonCopyable.h>
+#include "../OpenGL.h"
+#include "../RenderState/GLState.h"
+#include <vector>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Sub-allocated region of a persistently mapped pixel buffer.
+struct GLPixelBufferRegion
+{
+    GLuint      bufferID    = 0;
+    GLintptr    offset      = 0;
+    char*       data        = nullptr;
+    std::size_t chunkIndex  = 0;
+};
+
+/*
+Pool of persistently mapped pixel buffers (GL_PIXEL_PACK_BUFFER or GL_PIXEL_UNPACK_BUFFER) for asynchronous texture transfers.
+Regions are sub-allocated linearly from a chunk and a chunk is only recycled once all of its regions have been released
+and the last fence inserted for that chunk has been signaled. Chunks that are larger than the default chunk size are deleted
+once they are no longer in use and too small for a new allocation. Requires GL_ARB_buffer_storage and GL_ARB_sync.
+*/
+class GLPixelBufferPool final : public NonCopyable
+{
+
+    public:
+
+        GLPixelBufferPool(GLBufferTarget target, GLsizeiptr chunkSize);
+        ~GLPixelBufferPool();
+
+        // Allocates a new region of the specified size. Returns false if the pixel buffer could not be mapped.
+        bool Allocate(GLsizeiptr size, GLPixelBufferRegion& outRegion);
+
+        // Inserts a fence for the chunk of the specified region after the GL commands that access this region.
+        void Fence(const GLPixelBufferRegion& region);
+
+        // Releases the specified region. Its chunk can be recycled once all its regions have been released.
+        void Release(const GLPixelBufferRegion& region);
+
+    private:
+
+        struct Chunk
+        {
+            GLuint      id                  = 0;
+            char*       mappedData          = nullptr;
+            GLsizeiptr  size                = 0;
+            GLsizeiptr  offset              = 0;
+            std::size_t numActiveRegions    = 0;
+            GLsync      sync                = nullptr;
+        };
+
+    private:
+
+        bool CreateChunk(GLsizeiptr size, Chunk& outChunk);
+        void DeleteChunk(Chunk& chunk);
+
+        // Returns true if the specified chunk is no longer in use by the CPU and GPU.
+        bool IsChunkAvailable(Chunk& chunk);
+
+        bool AllocFromChunk(std::size_t chunkIndex, GLsizeiptr size, GLPixelBufferRegion& outRegion);
+
+    private:
+
+        GLBufferTarget      target_         = GLBufferTarget::PixelUnpackBuffer;
+        GLsizeiptr          chunkSize_      = 0;
+        std::vector<Chunk>  chunks_;
+        std::size_t         currentChunk_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -19,21 +19,21 @@ namespace LLGL
 {
 
 
-GLVertexArrayObject::GLVertexArrayObject()
-{
-    if (HasNativeVAO())
-        glGenVertexArrays(1, &id_);
-}
-
 GLVertexArrayObject::~GLVertexArrayObject()
 {
-    if (HasNativeVAO())
+    if (id_ != 0)
     {
         glDeleteVertexArrays(1, &id_);
         GLStateManager::Get().NotifyVertexArrayRelease(id_);
     }
 }
 
+void GLVertexArrayObject::Create()
+{
+    if (id_ == 0 && HasNativeVAO())
+        glGenVertexArrays(1, &id_);
+}
+
 void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute)
 {
     LLGL_ASSERT_GL_EXT(ARB_vertex_array_object);
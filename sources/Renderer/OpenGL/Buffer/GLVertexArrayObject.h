@@ -24,9 +24,11 @@ class GLVertexArrayObject
 
     public:
 
-        GLVertexArrayObject();
         ~GLVertexArrayObject();
 
+        // Generates the hardware VAO. VAOs are not shared between GL contexts, so this must be called on the rendering thread.
+        void Create();
+
         // Builds the specified attribute using a 'glVertexAttrib*Pointer' function.
         void BuildVertexAttribute(const VertexAttribute& attribute);
 
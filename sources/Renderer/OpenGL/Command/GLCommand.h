@@ -24,10 +24,12 @@ namespace LLGL
 
 class RenderTarget;
 class GLBuffer;
+class GLBufferWithVAO;
 class GLTexture;
 class GLResourceHeap;
 class GLPipelineState;
 class GLQueryHeap;
+struct GLUniformCounters;
 class GLSwapChain;
 class GLRenderTarget;
 class GLRenderPass;
@@ -184,6 +186,11 @@ struct GLCmdBindVertexArray
     GLuint vao;
 };
 
+struct GLCmdBindVertexBuffer
+{
+    GLBufferWithVAO* vertexBuffer;
+};
+
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 struct GLCmdBindGL2XVertexArray
 {
@@ -255,12 +262,11 @@ struct GLCmdSetStencilRef
 
 struct GLCmdSetUniforms
 {
-    GLuint      program;
-    UniformType type;
-    GLint       location;
-    GLsizei     count;
-    GLsizeiptr  size;
-//  GLuint      buffer[size];
+    const GLPipelineState*  pipelineState;
+    GLUniformCounters*      counters;
+    std::uint32_t           first;
+    GLsizeiptr              size;
+//  std::uint32_t           buffer[size/4];
 };
 
 struct GLCmdBeginQuery
@@ -391,6 +397,29 @@ struct GLCmdMultiDrawElementsIndirect
     GLsizei         stride;
 };
 
+struct GLCmdMultiDrawArraysIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
+struct GLCmdMultiDrawElementsIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    GLenum          type;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
 struct GLCmdDispatchCompute
 {
     GLuint numgroups[3];
@@ -402,6 +431,11 @@ struct GLCmdDispatchComputeIndirect
     GLintptr    indirect;
 };
 
+struct GLCmdMemoryBarrier
+{
+    GLbitfield barriers;
+};
+
 struct GLCmdBindTexture
 {
     GLuint      slot;
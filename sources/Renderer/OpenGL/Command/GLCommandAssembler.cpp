@@ -22,7 +22,6 @@
 #include "../../../Core/Assertion.h"
 
 #include "../Shader/GLShaderProgram.h"
-#include "../Shader/GLShaderUniform.h"
 
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLMipGenerator.h"
@@ -39,6 +38,7 @@
 #include "../RenderState/GLResourceHeap.h"
 #include "../RenderState/GLRenderPass.h"
 #include "../RenderState/GLQueryHeap.h"
+#include "../RenderState/GLUniformCache.h"
 
 #include <algorithm>
 
@@ -199,6 +199,12 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.CallMember(&GLStateManager::BindVertexArray, g_stateMngrArg, cmd->vao);
             return sizeof(*cmd);
         }
+        case GLOpcodeBindVertexBuffer:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindVertexBuffer*>(pc);
+            compiler.CallMember(&GLBufferWithVAO::BindVertexArray, cmd->vertexBuffer, g_stateMngrArg);
+            return sizeof(*cmd);
+        }
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         case GLOpcodeBindGL2XVertexArray:
         {
@@ -288,7 +294,7 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
-            compiler.Call(GLSetUniformsByType, cmd->type, cmd->location, cmd->count, (cmd + 1));
+            compiler.CallMember(&GLPipelineState::SetUniforms, cmd->pipelineState, g_stateMngrArg, cmd->counters, cmd->first, (cmd + 1), cmd->size);
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeBeginQuery:
@@ -410,6 +416,24 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             return sizeof(*cmd);
         }
         #endif // /GL_ARB_multi_draw_indirect
+        #ifdef GL_ARB_indirect_parameters
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::ParameterBuffer, cmd->countId);
+            compiler.Call(glMultiDrawArraysIndirectCountARB, cmd->mode, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::ParameterBuffer, cmd->countId);
+            compiler.Call(glMultiDrawElementsIndirectCountARB, cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            return sizeof(*cmd);
+        }
+        #endif // /GL_ARB_indirect_parameters
         #ifdef GL_ARB_compute_shader
         case GLOpcodeDispatchCompute:
         {
@@ -425,6 +449,14 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             return sizeof(*cmd);
         }
         #endif // /GL_ARB_compute_shader
+        #ifdef GL_ARB_shader_image_load_store
+        case GLOpcodeMemoryBarrier:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMemoryBarrier*>(pc);
+            compiler.Call(glMemoryBarrier, cmd->barriers);
+            return sizeof(*cmd);
+        }
+        #endif // /GL_ARB_shader_image_load_store
         case GLOpcodeBindTexture:
         {
             auto cmd = reinterpret_cast<const GLCmdBindTexture*>(pc);
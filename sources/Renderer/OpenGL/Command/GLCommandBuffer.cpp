@@ -11,6 +11,8 @@
 #include "../RenderState/GLPipelineState.h"
 #include "../RenderState/GLGraphicsPSO.h"
 #include "../../CheckedCast.h"
+#include <LLGL/Buffer.h>
+#include <LLGL/Backend/OpenGL/NativeHandle.h>
 
 
 namespace LLGL
@@ -54,10 +56,29 @@ void GLCommandBuffer::SetPipelineRenderState(const GLPipelineState& pipelineStat
     }
 }
 
+GLbitfield GLCommandBuffer::GetIndirectArgumentsBarrier(const Buffer& argsBuffer, const Buffer* countBuffer)
+{
+    #ifdef GL_ARB_shader_image_load_store
+    const long bindFlags = argsBuffer.GetBindFlags() | (countBuffer != nullptr ? countBuffer->GetBindFlags() : 0);
+    if ((bindFlags & BindFlags::Storage) != 0)
+        return GL_COMMAND_BARRIER_BIT;
+    #endif // /GL_ARB_shader_image_load_store
+    return 0;
+}
+
 /* ----- Extensions ----- */
 
 bool GLCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(OpenGL::CommandBufferStatistics))
+    {
+        auto* statisticsGL = reinterpret_cast<OpenGL::CommandBufferStatistics*>(nativeHandle);
+        statisticsGL->numUniformUploads               = uniformCounters_.numUniformUploads;
+        statisticsGL->numUniformUploadsSkipped        = uniformCounters_.numUniformUploadsSkipped;
+        statisticsGL->numUniformBufferUpdates         = uniformCounters_.numUniformBufferUpdates;
+        statisticsGL->numUniformBufferUpdatesSkipped  = uniformCounters_.numUniformBufferUpdatesSkipped;
+        return true;
+    }
     return (nativeHandle == nullptr || nativeHandleSize == 0); // dummy
 }
 
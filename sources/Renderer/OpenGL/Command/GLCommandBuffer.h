@@ -44,6 +44,12 @@ class GLCommandBuffer : public CommandBuffer
         // Stores the render states for the specified PSO: Draw mode, primitive mode, binding layout.
         void SetPipelineRenderState(const GLPipelineState& pipelineStateGL);
 
+        /*
+        Returns the memory barrier bitfield that is required before the specified buffers can be consumed as indirect arguments.
+        This is GL_COMMAND_BARRIER_BIT for storage buffers, since they might have been written by a shader (e.g. a compute dispatch), otherwise 0.
+        */
+        static GLbitfield GetIndirectArgumentsBarrier(const Buffer& argsBuffer, const Buffer* countBuffer = nullptr);
+
     protected:
 
         // Returns the current render state.
@@ -89,6 +95,12 @@ class GLCommandBuffer : public CommandBuffer
             return renderState_.boundPipelineState;
         }
 
+        // Returns the counters of submitted and skipped uniform updates.
+        inline GLUniformCounters& GetUniformCounters()
+        {
+            return uniformCounters_;
+        }
+
         // Returns the currently bound shader pipeline.
         inline const GLShaderPipeline* GetBoundShaderPipeline() const
         {
@@ -98,7 +110,8 @@ class GLCommandBuffer : public CommandBuffer
 
     private:
 
-        GLRenderState renderState_;
+        GLRenderState       renderState_;
+        GLUniformCounters   uniformCounters_;
 
 };
 
@@ -18,7 +18,6 @@
 #include "../../../Core/Assertion.h"
 
 #include "../Shader/GLShaderProgram.h"
-#include "../Shader/GLShaderUniform.h"
 
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLSampler.h"
@@ -34,6 +33,7 @@
 #include "../RenderState/GLResourceHeap.h"
 #include "../RenderState/GLRenderPass.h"
 #include "../RenderState/GLQueryHeap.h"
+#include "../RenderState/GLUniformCache.h"
 
 #include <algorithm>
 #include <string.h>
@@ -198,6 +198,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr->BindVertexArray(cmd->vao);
             return sizeof(*cmd);
         }
+        case GLOpcodeBindVertexBuffer:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindVertexBuffer*>(pc);
+            cmd->vertexBuffer->BindVertexArray(*stateMngr);
+            return sizeof(*cmd);
+        }
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         case GLOpcodeBindGL2XVertexArray:
         {
@@ -285,7 +291,7 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         case GLOpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
-            GLSetUniformsByType(cmd->type, cmd->location, cmd->count, (cmd + 1));
+            cmd->pipelineState->SetUniforms(*stateMngr, *(cmd->counters), cmd->first, (cmd + 1), cmd->size);
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeBeginQuery:
@@ -417,6 +423,26 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::ParameterBuffer, cmd->countId);
+            glMultiDrawArraysIndirectCountARB(cmd->mode, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::ParameterBuffer, cmd->countId);
+            glMultiDrawElementsIndirectCountARB(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
         case GLOpcodeDispatchCompute:
         {
             auto cmd = reinterpret_cast<const GLCmdDispatchCompute*>(pc);
@@ -434,6 +460,14 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMemoryBarrier:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMemoryBarrier*>(pc);
+            #ifdef GL_ARB_shader_image_load_store
+            glMemoryBarrier(cmd->barriers);
+            #endif
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindTexture:
         {
             auto cmd = reinterpret_cast<const GLCmdBindTexture*>(pc);
@@ -40,6 +40,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeClearAttachmentsWithRenderPass,
     GLOpcodeClearBuffers,
     GLOpcodeBindVertexArray,
+    GLOpcodeBindVertexBuffer,
     GLOpcodeBindGL2XVertexArray,
     GLOpcodeBindElementArrayBufferToVAO,
     GLOpcodeBindBufferBase,
@@ -70,8 +71,11 @@ enum GLOpcode : std::uint8_t
     GLOpcodeDrawElementsIndirect,
     GLOpcodeMultiDrawArraysIndirect,
     GLOpcodeMultiDrawElementsIndirect,
+    GLOpcodeMultiDrawArraysIndirectCount,
+    GLOpcodeMultiDrawElementsIndirectCount,
     GLOpcodeDispatchCompute,
     GLOpcodeDispatchComputeIndirect,
+    GLOpcodeMemoryBarrier,
     GLOpcodeBindTexture,
     GLOpcodeBindImageTexture,
     GLOpcodeBindSampler,
@@ -192,6 +192,59 @@ void GLCommandQueue::WaitIdle()
     glFinish();
 }
 
+void GLCommandQueue::SubmitSignal(Fence& fence, std::uint64_t value)
+{
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    fenceGL.Signal(value, ++signalIssueCounter_);
+}
+
+bool GLCommandQueue::WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    Fence* fences[] = { &fence };
+    return WaitFenceValues(1, fences, &value, timeout);
+}
+
+bool GLCommandQueue::WaitFenceValues(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, std::uint64_t timeout)
+{
+    /*
+    All sync objects of a GL context complete in the order they were inserted into the command stream,
+    so waiting for all fences only requires to wait for the most recently issued signal among them.
+    */
+    GLFence*        latestFence = nullptr;
+    std::uint64_t   latestIssue = 0;
+
+    for_range(i, numFences)
+    {
+        auto* fenceGL = LLGL_CAST(GLFence*, fences[i]);
+        const std::uint64_t issue = fenceGL->FindSignalIssue(values[i]);
+        if (issue == ~0ull)
+        {
+            /* Value has never been signaled; it cannot be reached since GL commands are only submitted on this thread */
+            return false;
+        }
+        if (issue > latestIssue)
+        {
+            latestFence = fenceGL;
+            latestIssue = issue;
+        }
+    }
+
+    if (latestFence == nullptr)
+        return true;
+
+    if (!latestFence->WaitForSignalIssue(latestIssue, timeout))
+        return false;
+
+    /* Mark all earlier signals of the other fences as complete as well */
+    for_range(i, numFences)
+    {
+        auto* fenceGL = LLGL_CAST(GLFence*, fences[i]);
+        fenceGL->CompleteSignals(latestIssue);
+    }
+
+    return true;
+}
+
 
 } // /namespace LLGL
 
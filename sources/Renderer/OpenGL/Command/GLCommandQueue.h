@@ -30,9 +30,16 @@ class GLCommandQueue final : public CommandQueue
 
         GLCommandQueue(GLStateManager& stateManager);
 
+    public:
+
+        void SubmitSignal(Fence& fence, std::uint64_t value) override;
+        bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout) override;
+        bool WaitFenceValues(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, std::uint64_t timeout) override;
+
     private:
 
         GLStateManager& stateMngr_;
+        std::uint64_t   signalIssueCounter_ = 0;    // Counter of all fence signals submitted to this queue; sync objects complete in this order.
 
 };
 
@@ -359,7 +359,7 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        auto& bufferWithVAO = LLGL_CAST(const GLBufferWithVAO&, buffer);
+        auto& bufferWithVAO = LLGL_CAST(GLBufferWithVAO&, buffer);
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         if (!HasNativeVAO())
         {
@@ -369,8 +369,9 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
         {
-            auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
-            cmd->vao = bufferWithVAO.GetVaoID();
+            /* Resolve VAO when the command is executed, since it might be built on first use and VAOs are not shared between GL contexts */
+            auto cmd = AllocCommand<GLCmdBindVertexBuffer>(GLOpcodeBindVertexBuffer);
+            cmd->vertexBuffer = &bufferWithVAO;
         }
     }
 }
@@ -561,6 +562,17 @@ void GLDeferredCommandBuffer::BeginRenderPass(
     }
 }
 
+void GLDeferredCommandBuffer::BeginParallelRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    /* Secondary command buffers are recorded on the CPU and replayed in order with Execute, so this is equivalent to a regular render pass */
+    BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex);
+}
+
 void GLDeferredCommandBuffer::EndRenderPass()
 {
     // dummy
@@ -644,31 +656,17 @@ void GLDeferredCommandBuffer::SetUniforms(std::uint32_t first, const void* data,
     if (boundPipelineState == nullptr)
         return /*GL_INVALID_VALUE*/;
 
-    auto* boundShaderPipeline = boundPipelineState->GetShaderPipeline();
-    if (boundPipelineState == nullptr)
-        return /*GL_INVALID_VALUE*/;
-
-    const std::uint32_t dataSizeInWords = dataSize / 4;
-    const auto& uniformMap = boundPipelineState->GetUniformMap();
-
-    for (auto words = reinterpret_cast<const std::uint32_t*>(data), wordsEnd = words + dataSizeInWords; words != wordsEnd; ++first)
+    /*
+    Allocate GL command and copy data buffer; uniforms are compared with their shadow copy when the command is executed.
+    The uniform cache is resolved at execution time as well, since the PSO might not be finalized while commands are recorded on another thread.
+    */
+    auto cmd = AllocCommand<GLCmdSetUniforms>(GLOpcodeSetUniforms, dataSize);
     {
-        if (first >= uniformMap.size())
-            return /*GL_INVALID_INDEX*/;
-
-        /* Allocate GL command and copy data buffer */
-        const auto& uniform = uniformMap[first];
-        const std::uint32_t uniformSize = uniform.wordSize * 4;
-        auto cmd = AllocCommand<GLCmdSetUniforms>(GLOpcodeSetUniforms, dataSize);
-        {
-            cmd->program    = boundShaderPipeline->GetID(); //TODO: must distinguish between GLShaderProgram and GLProgramPipeline
-            cmd->type       = uniform.type;
-            cmd->location   = uniform.location;
-            cmd->count      = uniform.count;
-            cmd->size       = static_cast<GLsizeiptr>(uniformSize);
-            ::memcpy(cmd + 1, words, uniformSize);
-        }
-        words += uniform.wordSize;
+        cmd->pipelineState  = boundPipelineState;
+        cmd->counters       = &(GetUniformCounters());
+        cmd->first          = first;
+        cmd->size           = static_cast<GLsizeiptr>(dataSize);
+        ::memcpy(cmd + 1, data, dataSize);
     }
 }
 
@@ -867,6 +865,7 @@ void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std
 
 void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    IndirectArgumentsBarrier(buffer);
     auto cmd = AllocCommand<GLCmdDrawArraysIndirect>(GLOpcodeDrawArraysIndirect);
     {
         cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
@@ -879,6 +878,7 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 
 void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    IndirectArgumentsBarrier(buffer);
     #ifndef __APPLE__
     if (HasExtension(GLExt::ARB_multi_draw_indirect))
     {
@@ -908,6 +908,7 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset,
 
 void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    IndirectArgumentsBarrier(buffer);
     auto cmd = AllocCommand<GLCmdDrawElementsIndirect>(GLOpcodeDrawElementsIndirect);
     {
         cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
@@ -921,6 +922,7 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 
 void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    IndirectArgumentsBarrier(buffer);
     #ifndef __APPLE__
     if (HasExtension(GLExt::ARB_multi_draw_indirect))
     {
@@ -950,6 +952,57 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+void GLDeferredCommandBuffer::DrawIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    IndirectArgumentsBarrier(argsBuffer, &countBuffer);
+    if (HasExtension(GLExt::ARB_indirect_parameters))
+    {
+        const GLintptr indirect = static_cast<GLintptr>(argsOffset);
+        auto cmd = AllocCommand<GLCmdMultiDrawArraysIndirectCount>(GLOpcodeMultiDrawArraysIndirectCount);
+        {
+            cmd->id             = LLGL_CAST(GLBuffer&, argsBuffer).GetID();
+            cmd->countId        = LLGL_CAST(GLBuffer&, countBuffer).GetID();
+            cmd->mode           = GetDrawMode();
+            cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+            cmd->drawcount      = static_cast<GLintptr>(countOffset);
+            cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+            cmd->stride         = static_cast<GLsizei>(stride);
+        }
+    }
+}
+
+void GLDeferredCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    IndirectArgumentsBarrier(argsBuffer, &countBuffer);
+    if (HasExtension(GLExt::ARB_indirect_parameters))
+    {
+        const GLintptr indirect = static_cast<GLintptr>(argsOffset);
+        auto cmd = AllocCommand<GLCmdMultiDrawElementsIndirectCount>(GLOpcodeMultiDrawElementsIndirectCount);
+        {
+            cmd->id             = LLGL_CAST(GLBuffer&, argsBuffer).GetID();
+            cmd->countId        = LLGL_CAST(GLBuffer&, countBuffer).GetID();
+            cmd->mode           = GetDrawMode();
+            cmd->type           = GetIndexType();
+            cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+            cmd->drawcount      = static_cast<GLintptr>(countOffset);
+            cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+            cmd->stride         = static_cast<GLsizei>(stride);
+        }
+    }
+}
+
 /* ----- Compute ----- */
 
 void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -968,6 +1021,7 @@ void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32
 
 void GLDeferredCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    IndirectArgumentsBarrier(buffer);
     #ifndef __APPLE__
     auto cmd = AllocCommand<GLCmdDispatchComputeIndirect>(GLOpcodeDispatchComputeIndirect);
     {
@@ -1038,6 +1092,15 @@ bool GLDeferredCommandBuffer::IsPrimary() const
  * ======= Private: =======
  */
 
+void GLDeferredCommandBuffer::IndirectArgumentsBarrier(const Buffer& argsBuffer, const Buffer* countBuffer)
+{
+    if (GLbitfield barriers = GetIndirectArgumentsBarrier(argsBuffer, countBuffer))
+    {
+        auto cmd = AllocCommand<GLCmdMemoryBarrier>(GLOpcodeMemoryBarrier);
+        cmd->barriers = barriers;
+    }
+}
+
 void GLDeferredCommandBuffer::BindBufferBase(const GLBufferTarget bufferTarget, const GLBuffer& bufferGL, std::uint32_t slot)
 {
     auto cmd = AllocCommand<GLCmdBindBufferBase>(GLOpcodeBindBufferBase);
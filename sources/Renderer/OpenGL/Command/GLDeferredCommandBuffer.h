@@ -103,6 +103,9 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         void BindGL2XSampler(const GL2XSampler& samplerGL2X, std::uint32_t slot);
         #endif
 
+        // Records a command barrier if the indirect arguments might have been written by a shader.
+        void IndirectArgumentsBarrier(const Buffer& argsBuffer, const Buffer* countBuffer = nullptr);
+
         /* Allocates only an opcode for empty commands */
         void AllocOpcode(const GLOpcode opcode);
 
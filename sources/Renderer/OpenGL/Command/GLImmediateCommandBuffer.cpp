@@ -483,6 +483,17 @@ void GLImmediateCommandBuffer::BeginRenderPass(
     }
 }
 
+void GLImmediateCommandBuffer::BeginParallelRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    /* Secondary command buffers are recorded on the CPU and replayed in order with Execute, so this is equivalent to a regular render pass */
+    BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex);
+}
+
 void GLImmediateCommandBuffer::EndRenderPass()
 {
     // dummy
@@ -544,19 +555,8 @@ void GLImmediateCommandBuffer::SetUniforms(std::uint32_t first, const void* data
     if (boundPipelineState == nullptr)
         return /*GL_INVALID_VALUE*/;
 
-    const std::uint32_t dataSizeInWords = dataSize / 4;
-    const auto& uniformMap = boundPipelineState->GetUniformMap();
-
-    for (auto words = reinterpret_cast<const std::uint32_t*>(data), wordsEnd = words + dataSizeInWords; words != wordsEnd; ++first)
-    {
-        if (first >= uniformMap.size())
-            return /*GL_INVALID_INDEX*/;
-
-        const auto& uniform = uniformMap[first];
-        GLSetUniformsByType(uniform.type, uniform.location, uniform.count, words);
-
-        words += uniform.wordSize;
-    }
+    /* Submit only the uniforms that have changed */
+    boundPipelineState->SetUniforms(*stateMngr_, GetUniformCounters(), first, data, static_cast<GLsizeiptr>(dataSize));
 }
 
 /* ----- Queries ----- */
@@ -735,6 +735,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    IndirectArgumentsBarrier(buffer);
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
@@ -749,6 +750,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    IndirectArgumentsBarrier(buffer);
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -784,6 +786,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    IndirectArgumentsBarrier(buffer);
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
@@ -799,6 +802,7 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    IndirectArgumentsBarrier(buffer);
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -834,6 +838,67 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     #endif
 }
 
+void GLImmediateCommandBuffer::DrawIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    IndirectArgumentsBarrier(argsBuffer, &countBuffer);
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    if (HasExtension(GLExt::ARB_indirect_parameters))
+    {
+        /* Bind indirect argument buffer and parameter buffer for the draw count */
+        auto& argsBufferGL  = LLGL_CAST(GLBuffer&, argsBuffer);
+        auto& countBufferGL = LLGL_CAST(GLBuffer&, countBuffer);
+        stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, argsBufferGL.GetID());
+        stateMngr_->BindBuffer(GLBufferTarget::ParameterBuffer, countBufferGL.GetID());
+
+        const GLintptr indirect = static_cast<GLintptr>(argsOffset);
+        glMultiDrawArraysIndirectCountARB(
+            GetDrawMode(),
+            reinterpret_cast<const GLvoid*>(indirect),
+            static_cast<GLintptr>(countOffset),
+            static_cast<GLsizei>(maxNumCommands),
+            static_cast<GLsizei>(stride)
+        );
+    }
+    #endif
+}
+
+void GLImmediateCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    IndirectArgumentsBarrier(argsBuffer, &countBuffer);
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    if (HasExtension(GLExt::ARB_indirect_parameters))
+    {
+        /* Bind indirect argument buffer and parameter buffer for the draw count */
+        auto& argsBufferGL  = LLGL_CAST(GLBuffer&, argsBuffer);
+        auto& countBufferGL = LLGL_CAST(GLBuffer&, countBuffer);
+        stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, argsBufferGL.GetID());
+        stateMngr_->BindBuffer(GLBufferTarget::ParameterBuffer, countBufferGL.GetID());
+
+        const GLintptr indirect = static_cast<GLintptr>(argsOffset);
+        glMultiDrawElementsIndirectCountARB(
+            GetDrawMode(),
+            GetIndexType(),
+            reinterpret_cast<const GLvoid*>(indirect),
+            static_cast<GLintptr>(countOffset),
+            static_cast<GLsizei>(maxNumCommands),
+            static_cast<GLsizei>(stride)
+        );
+    }
+    #endif
+}
+
 /* ----- Compute ----- */
 
 void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -845,6 +910,7 @@ void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint3
 
 void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    IndirectArgumentsBarrier(buffer);
     #ifdef LLGL_GLEXT_COMPUTE_SHADER
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DispatchIndirectBuffer, bufferGL.GetID());
@@ -900,6 +966,19 @@ bool GLImmediateCommandBuffer::IsImmediateCmdBuffer() const
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void GLImmediateCommandBuffer::IndirectArgumentsBarrier(const Buffer& argsBuffer, const Buffer* countBuffer)
+{
+    #ifdef GL_ARB_shader_image_load_store
+    if (GLbitfield barriers = GetIndirectArgumentsBarrier(argsBuffer, countBuffer))
+        glMemoryBarrier(barriers);
+    #endif // /GL_ARB_shader_image_load_store
+}
+
+
 } // /namespace LLGL
 
 
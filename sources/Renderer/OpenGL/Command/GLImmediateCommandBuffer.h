@@ -38,6 +38,11 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
         // Returns true.
         bool IsImmediateCmdBuffer() const override;
 
+    private:
+
+        // Submits a command barrier if the indirect arguments might have been written by a shader.
+        void IndirectArgumentsBarrier(const Buffer& argsBuffer, const Buffer* countBuffer = nullptr);
+
     private:
 
         GLStateManager* stateMngr_ = nullptr;
@@ -49,6 +49,7 @@ enum class GLExt
     ARB_get_texture_sub_image,          // GL 4.5
     ARB_geometry_shader4,               // no procedures
     ARB_gl_spirv,                       // GL 4.6
+    ARB_indirect_parameters,            // GL 4.6
     ARB_instanced_arrays,               // GL 2.1
     ARB_internalformat_query,
     ARB_internalformat_query2,
@@ -91,6 +92,7 @@ enum class GLExt
 
     /* Khronos group extensions (KHR) */
     KHR_debug,
+    KHR_parallel_shader_compile,
 
     /* Multi-vendor extensions (EXT) */
     EXT_blend_color,
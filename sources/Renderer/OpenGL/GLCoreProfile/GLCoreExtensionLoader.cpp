@@ -199,6 +199,8 @@ static bool DECL_LOADGLEXT_PROC(ARB_framebuffer_object)
 static bool DECL_LOADGLEXT_PROC(ARB_uniform_buffer_object)
 {
     LOAD_GLPROC( glGetUniformBlockIndex      );
+    LOAD_GLPROC( glGetUniformIndices         );
+    LOAD_GLPROC( glGetActiveUniformsiv       );
     LOAD_GLPROC( glGetActiveUniformBlockiv   );
     LOAD_GLPROC( glGetActiveUniformBlockName );
     LOAD_GLPROC( glUniformBlockBinding       );
@@ -767,6 +769,19 @@ static bool DECL_LOADGLEXT_PROC(ARB_multi_draw_indirect)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_indirect_parameters)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirectCountARB   );
+    LOAD_GLPROC( glMultiDrawElementsIndirectCountARB );
+    return true;
+}
+
+static bool DECL_LOADGLEXT_PROC(KHR_parallel_shader_compile)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_get_texture_sub_image)
 {
     LOAD_GLPROC( glGetTextureSubImage           );
@@ -1177,6 +1192,8 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_draw_indirect                );
     LOAD_GLEXT( ARB_multi_draw_indirect          );
+    LOAD_GLEXT( ARB_indirect_parameters          );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
     LOAD_GLEXT( ARB_get_texture_sub_image        );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
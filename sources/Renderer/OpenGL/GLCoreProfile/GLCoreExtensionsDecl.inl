@@ -398,6 +398,8 @@ DECL_GLPROC(PFNGLGETPROGRAMPIPELINEINFOLOGPROC,                     glGetProgram
 /* GL_ARB_uniform_buffer_object */
 
 DECL_GLPROC(PFNGLGETUNIFORMBLOCKINDEXPROC,                          glGetUniformBlockIndex,                         GLuint,         (GLuint, const GLchar*));
+DECL_GLPROC(PFNGLGETUNIFORMINDICESPROC,                             glGetUniformIndices,                            void,           (GLuint, GLsizei, const GLchar* const*, GLuint*));
+DECL_GLPROC(PFNGLGETACTIVEUNIFORMSIVPROC,                           glGetActiveUniformsiv,                          void,           (GLuint, GLsizei, const GLuint*, GLenum, GLint*));
 DECL_GLPROC(PFNGLGETACTIVEUNIFORMBLOCKIVPROC,                       glGetActiveUniformBlockiv,                      void,           (GLuint, GLuint, GLenum, GLint*));
 DECL_GLPROC(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC,                     glGetActiveUniformBlockName,                    void,           (GLuint, GLuint, GLsizei, GLsizei*, GLchar*));
 DECL_GLPROC(PFNGLUNIFORMBLOCKBINDINGPROC,                           glUniformBlockBinding,                          void,           (GLuint, GLuint, GLuint));
@@ -557,6 +559,15 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINDIRECTPROC,                          glDrawElemen
 DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTPROC,                       glMultiDrawArraysIndirect,                      void,           (GLenum, const void*, GLsizei, GLsizei));
 DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTPROC,                     glMultiDrawElementsIndirect,                    void,           (GLenum, GLenum, const void*, GLsizei, GLsizei));
 
+/* GL_ARB_indirect_parameters */
+
+DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC,               glMultiDrawArraysIndirectCountARB,              void,           (GLenum, const void*, GLintptr, GLsizei, GLsizei));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC,             glMultiDrawElementsIndirectCountARB,            void,           (GLenum, GLenum, const void*, GLintptr, GLsizei, GLsizei));
+
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC,                   glMaxShaderCompilerThreadsKHR,                  void,           (GLuint));
+
 /* GL_ARB_get_texture_sub_image */
 
 DECL_GLPROC(PFNGLGETTEXTURESUBIMAGEPROC,                            glGetTextureSubImage,                           void,           (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, GLsizei, void*));
@@ -207,6 +207,7 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasPipelineCaching             = (HasExtension(GLExt::ARB_get_program_binary) && GLGetInt(GL_NUM_PROGRAM_BINARY_FORMATS) > 0);
     features.hasPipelineStatistics          = HasExtension(GLExt::ARB_pipeline_statistics_query);
     features.hasRenderCondition             = true;
+    features.hasIndirectDrawCount           = HasExtension(GLExt::ARB_indirect_parameters);
 }
 
 static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimits& limits)
@@ -160,6 +160,7 @@ static void GLGetSupportedFeatures(RenderingFeatures& features, GLint version)
     features.hasPipelineCaching             = (version >= 300); // GLES 3.0
     features.hasPipelineStatistics          = false;
     features.hasRenderCondition             = false;
+    features.hasIndirectDrawCount           = false;
 }
 
 static void GLGetFeatureLimits(RenderingLimits& limits, GLint version)
@@ -84,6 +84,10 @@ namespace LLGL
 #define GL_QUERY_BUFFER 0x9192 // for wrappers only
 #endif
 
+#ifndef GL_PARAMETER_BUFFER
+#define GL_PARAMETER_BUFFER 0x80EE // for wrappers only
+#endif
+
 #ifndef GL_SHADER_STORAGE_BUFFER
 #define GL_SHADER_STORAGE_BUFFER 0x90D2 // GLES 3.2
 #endif
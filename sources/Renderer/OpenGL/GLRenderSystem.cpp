@@ -17,6 +17,7 @@
 #include "GLTypes.h"
 #include "GLCore.h"
 #include "Shader/GLLegacyShader.h"
+#include "Shader/GLProgramBinaryCache.h"
 #include "Buffer/GLBufferWithVAO.h"
 #include "Buffer/GLBufferArrayWithVAO.h"
 #include "../CheckedCast.h"
@@ -31,6 +32,7 @@
 #include "RenderState/GLGraphicsPSO.h"
 #include "RenderState/GLComputePSO.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Log.h>
 
 #ifdef LLGL_OPENGL
 #   include "Shader/GLSeparableShader.h"
@@ -41,6 +43,12 @@ namespace LLGL
 {
 
 
+// Size (in bytes) of each persistently mapped pixel buffer chunk for asynchronous texture transfers.
+static constexpr GLsizeiptr     g_pixelBufferChunkSize  = 4 * 1024 * 1024;
+
+// Bit that tags texture read requests that are served by a pixel pack buffer.
+static constexpr std::uint64_t  g_nativeTextureReadBit  = (1ull << 63);
+
 /* ----- Common ----- */
 
 static RendererConfigurationOpenGL GetGLProfileFromDesc(const RenderSystemDescriptor& renderSystemDesc)
@@ -51,19 +59,45 @@ static RendererConfigurationOpenGL GetGLProfileFromDesc(const RenderSystemDescri
         return RendererConfigurationOpenGL{};
 }
 
+static std::string GetGLProgramBinaryCacheDirFromDesc(const RenderSystemDescriptor& renderSystemDesc)
+{
+    if (auto rendererConfigGL = GetRendererConfiguration<RendererConfigurationOpenGL>(renderSystemDesc))
+    {
+        if (rendererConfigGL->programBinaryCacheDir != nullptr)
+            return rendererConfigGL->programBinaryCacheDir;
+    }
+    return "";
+}
+
+static bool GetGLPackBlockUniformsFromDesc(const RenderSystemDescriptor& renderSystemDesc)
+{
+    if (auto rendererConfigGL = GetRendererConfiguration<RendererConfigurationOpenGL>(renderSystemDesc))
+        return rendererConfigGL->packBlockUniforms;
+    return false;
+}
+
 GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
-    contextMngr_  { GetGLProfileFromDesc(renderSystemDesc), renderSystemDesc.nativeHandle, renderSystemDesc.nativeHandleSize },
-    debugContext_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0)                                         }
+    contextMngr_            { GetGLProfileFromDesc(renderSystemDesc), renderSystemDesc.nativeHandle, renderSystemDesc.nativeHandleSize },
+    debugContext_           { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0)                                         },
+    programBinaryCacheDir_  { GetGLProgramBinaryCacheDirFromDesc(renderSystemDesc)                                                     },
+    packBlockUniforms_      { GetGLPackBlockUniformsFromDesc(renderSystemDesc)                                                         },
+    unpackBufferPool_       { GLBufferTarget::PixelUnpackBuffer, g_pixelBufferChunkSize                                                },
+    packBufferPool_         { GLBufferTarget::PixelPackBuffer,   g_pixelBufferChunkSize                                                }
 {
 }
 
 GLRenderSystem::~GLRenderSystem()
 {
+    /* Delete sync objects of pending texture reads; their pixel buffers are deleted by the pools */
+    for (auto& request : textureReads_)
+        glDeleteSync(request.second.sync);
+
     /* Clear all render state containers first, the rest will be deleted automatically */
     GLFramebufferCapture::Get().Clear();
     GLTextureViewPool::Get().Clear();
     GLMipGenerator::Get().Clear();
     GLStatePool::Get().Clear();
+    GLProgramBinaryCache::Get().Clear();
 }
 
 /* ----- Swap-chain ----- */
@@ -177,7 +211,7 @@ GLBuffer* GLRenderSystem::CreateGLBuffer(const BufferDescriptor& bufferDesc, con
         auto* bufferGL = buffers_.emplace<GLBufferWithVAO>(bufferDesc.bindFlags, bufferDesc.debugName);
         {
             GLBufferStorage(*bufferGL, bufferDesc, initialData);
-            bufferGL->BuildVertexArray(bufferDesc.vertexAttribs.size(), bufferDesc.vertexAttribs.data());
+            bufferGL->BuildVertexArray(bufferDesc.vertexAttribs.size(), bufferDesc.vertexAttribs.data(), IsLoaderThread());
         }
         return bufferGL;
     }
@@ -269,6 +303,61 @@ void GLRenderSystem::UnmapBuffer(Buffer& buffer)
 /* ----- Textures ----- */
 
 //private
+bool GLRenderSystem::IsPixelBufferTransferSupported(const GLTexture& textureGL) const
+{
+    /*
+    Persistently mapped pixel buffers require GL 4.4+ buffer storage and sub-image readback must not fall back to an intermediate whole-image copy.
+    Depth-stencil and compressed formats as well as emulated swizzle formats are transferred with the synchronous path.
+    */
+    return
+    (
+        HasExtension(GLExt::ARB_buffer_storage)                 &&
+        HasExtension(GLExt::ARB_get_texture_sub_image)         &&
+        HasExtension(GLExt::ARB_sync)                           &&
+        !textureGL.IsRenderbuffer()                             &&
+        textureGL.GetSwizzleFormat() == GLSwizzleFormat::RGBA   &&
+        IsColorFormat(textureGL.GetFormat())                    &&
+        !IsCompressedFormat(textureGL.GetFormat())
+    );
+}
+
+bool GLRenderSystem::WriteTextureWithPixelBuffer(GLTexture& textureGL, const TextureRegion& textureRegion, const ImageView& srcImageView)
+{
+    if (!IsPixelBufferTransferSupported(textureGL) || srcImageView.data == nullptr)
+        return false;
+
+    /* Source images with compressed or depth-stencil formats cannot be converted on the CPU */
+    if (IsCompressedFormat(srcImageView.format) || IsDepthOrStencilFormat(srcImageView.format))
+        return false;
+
+    /* Determine size of texture region in the native texture format */
+    const Extent3D      extent      = CalcTextureExtent(textureGL.GetType(), textureRegion.extent, textureRegion.subresource.numArrayLayers);
+    const std::uint32_t numTexels   = extent.width * extent.height * extent.depth;
+    const std::size_t   dataSize    = GetMemoryFootprint(textureGL.GetFormat(), numTexels);
+
+    GLPixelBufferRegion region;
+    if (dataSize == 0 || !unpackBufferPool_.Allocate(static_cast<GLsizeiptr>(dataSize), region))
+        return false;
+
+    /* Convert source image straight into the persistently mapped pixel unpack buffer */
+    const auto& formatAttribs = GetFormatAttribs(textureGL.GetFormat());
+    const MutableImageView dstImageView
+    {
+        formatAttribs.format,
+        formatAttribs.dataType,
+        region.data,
+        dataSize
+    };
+    RenderSystem::CopyTextureImageData(dstImageView, srcImageView, numTexels, extent.width);
+
+    /* Copy pixel unpack buffer into texture and fence the buffer chunk until the GPU has consumed it */
+    textureGL.CopyImageFromBuffer(textureRegion, region.bufferID, region.offset, static_cast<GLsizei>(dataSize));
+    unpackBufferPool_.Fence(region);
+    unpackBufferPool_.Release(region);
+
+    return true;
+}
+
 void GLRenderSystem::ValidateGLTextureType(const TextureType type)
 {
     /* Validate texture type for this GL device */
@@ -326,9 +415,10 @@ void GLRenderSystem::Release(Texture& texture)
 
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
-    /* Bind texture and write texture sub data */
+    /* Write texture sub data through pixel unpack buffer if supported, otherwise bind texture and write texture sub data directly */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
-    textureGL.TextureSubImage(textureRegion, srcImageView, false);
+    if (!WriteTextureWithPixelBuffer(textureGL, textureRegion, srcImageView))
+        textureGL.TextureSubImage(textureRegion, srcImageView, false);
 }
 
 void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
@@ -339,6 +429,76 @@ void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     textureGL.GetTextureSubImage(textureRegion, dstImageView, false);
 }
 
+std::uint64_t GLRenderSystem::RequestTextureRead(Texture& texture, const TextureRegion& textureRegion)
+{
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    if (IsPixelBufferTransferSupported(textureGL))
+    {
+        /* Determine size of texture region in the native texture format */
+        const Extent3D      extent      = CalcTextureExtent(textureGL.GetType(), textureRegion.extent, textureRegion.subresource.numArrayLayers);
+        const std::uint32_t numTexels   = extent.width * extent.height * extent.depth;
+        const std::size_t   dataSize    = GetMemoryFootprint(textureGL.GetFormat(), numTexels);
+
+        GLTextureReadRequest request;
+        if (dataSize > 0 && packBufferPool_.Allocate(static_cast<GLsizeiptr>(dataSize), request.region))
+        {
+            /* Copy texture region into pixel pack buffer and insert fence after the copy command */
+            textureGL.CopyImageToBuffer(textureRegion, request.region.bufferID, request.region.offset, static_cast<GLsizei>(dataSize));
+
+            request.sync        = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            request.format      = textureGL.GetFormat();
+            request.numTexels   = numTexels;
+            request.rowLength   = extent.width;
+
+            /* Tag native requests with the upper bit to distinguish them from the synchronous fallback of the base class */
+            const std::uint64_t requestID = (g_nativeTextureReadBit | nextTextureReadID_++);
+            textureReads_[requestID] = request;
+            return requestID;
+        }
+    }
+    return RenderSystem::RequestTextureRead(texture, textureRegion);
+}
+
+bool GLRenderSystem::ResolveTextureRead(std::uint64_t requestID, const MutableImageView& dstImageView, bool wait)
+{
+    auto it = textureReads_.find(requestID);
+    if (it == textureReads_.end())
+        return RenderSystem::ResolveTextureRead(requestID, dstImageView, wait);
+
+    LLGL_ASSERT_PTR(dstImageView.data);
+    GLTextureReadRequest& request = it->second;
+
+    /* Poll fence without blocking unless the caller requested to wait */
+    const GLuint64  timeout = (wait ? ~0ull : 0ull);
+    const GLenum    result  = glClientWaitSync(request.sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    if (result == GL_TIMEOUT_EXPIRED)
+        return false;
+
+    /* Copy (and convert) data from the persistently mapped pixel pack buffer into the output image unless the wait failed */
+    const bool succeeded = (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED);
+    if (succeeded)
+    {
+        const auto& formatAttribs = GetFormatAttribs(request.format);
+        const ImageView srcImageView
+        {
+            formatAttribs.format,
+            formatAttribs.dataType,
+            request.region.data,
+            GetMemoryFootprint(request.format, request.numTexels)
+        };
+        RenderSystem::CopyTextureImageData(dstImageView, srcImageView, request.numTexels, request.rowLength);
+    }
+    else
+        Log::Errorf("failed to wait for texture readback request [0x%016llX]\n", static_cast<unsigned long long>(requestID));
+
+    /* Release request; A failed wait can never succeed, so the request is released in either case */
+    glDeleteSync(request.sync);
+    packBufferPool_.Release(request.region);
+    textureReads_.erase(it);
+
+    return succeeded;
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
@@ -498,7 +658,8 @@ PipelineState* GLRenderSystem::CreatePipelineState(const GraphicsPipelineDescrip
     return pipelineStates_.emplace<GLGraphicsPSO>(
         pipelineStateDesc,
         GetRenderingCaps().limits,
-        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
+        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr),
+        packBlockUniforms_
     );
 }
 
@@ -506,7 +667,8 @@ PipelineState* GLRenderSystem::CreatePipelineState(const ComputePipelineDescript
 {
     return pipelineStates_.emplace<GLComputePSO>(
         pipelineStateDesc,
-        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
+        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr),
+        packBlockUniforms_
     );
 }
 
@@ -539,6 +701,46 @@ void GLRenderSystem::Release(Fence& fence)
     fences_.erase(&fence);
 }
 
+/* ----- Loader threads ----- */
+
+// Shared GL context of the calling loader thread. Only one render system can be active at a time, so this is not associated with a GLRenderSystem instance.
+static thread_local std::unique_ptr<GLLoaderContext> g_loaderContext;
+
+bool GLRenderSystem::BeginLoaderThread()
+{
+    #if defined LLGL_OS_WIN32 || defined LLGL_OS_LINUX
+    /* Create shared GL context for calling thread; this requires the primary GL context, i.e. the first swap-chain */
+    if (!g_loaderContext)
+        g_loaderContext = contextMngr_.MakeLoaderContext();
+    return (g_loaderContext != nullptr);
+    #else
+    /* Shared GL contexts on other platforms cannot be created without a surface owned by the client */
+    return false;
+    #endif
+}
+
+void GLRenderSystem::EndLoaderThread()
+{
+    if (g_loaderContext)
+    {
+        /* Wait for all GL commands of this loader context before the shared objects are used by other threads */
+        glFinish();
+        GLSwapChainContext::MakeCurrent(nullptr);
+        g_loaderContext.reset();
+    }
+}
+
+void GLRenderSystem::FlushLoaderThread()
+{
+    if (g_loaderContext)
+        glFinish();
+}
+
+bool GLRenderSystem::IsLoaderThread()
+{
+    return (g_loaderContext != nullptr);
+}
+
 /* ----- Extensions ----- */
 
 bool GLRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -566,6 +768,16 @@ void GLRenderSystem::CreateGLContextDependentDevices(GLStateManager& stateManage
     /* Query renderer information and limits */
     QueryRendererInfo();
     QueryRenderingCaps();
+
+    #ifdef LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    /* Let the driver choose the number of threads for asynchronous shader compilation; Queries are deferred until shaders and PSOs are used */
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+    #endif
+
+    /* Enable global program binary cache if a directory was specified */
+    if (!programBinaryCacheDir_.empty())
+        GLProgramBinaryCache::Get().Open(programBinaryCacheDir_);
 }
 
 #ifdef GL_KHR_debug
@@ -20,6 +20,7 @@
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
+#include "Buffer/GLPixelBufferPool.h"
 
 #include "Shader/GLShader.h"
 #include "Shader/GLShaderProgram.h"
@@ -45,6 +46,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <unordered_map>
 
 
 namespace LLGL
@@ -63,6 +65,13 @@ class GLRenderSystem final : public RenderSystem
         GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~GLRenderSystem();
 
+        std::uint64_t RequestTextureRead(Texture& texture, const TextureRegion& textureRegion) override;
+        bool ResolveTextureRead(std::uint64_t requestID, const MutableImageView& dstImageView, bool wait = false) override;
+
+        bool BeginLoaderThread() override;
+        void EndLoaderThread() override;
+        void FlushLoaderThread() override;
+
     private:
 
         void CreateGLContextDependentDevices(GLStateManager& stateManager);
@@ -74,28 +83,51 @@ class GLRenderSystem final : public RenderSystem
 
         GLBuffer* CreateGLBuffer(const BufferDescriptor& desc, const void* initialData);
 
+        // Returns true if the calling thread has a shared GL context from BeginLoaderThread.
+        static bool IsLoaderThread();
+
         void ValidateGLTextureType(const TextureType type);
 
+        // Returns true if texture transfers through persistently mapped pixel buffers are supported for the specified texture.
+        bool IsPixelBufferTransferSupported(const GLTexture& textureGL) const;
+
+        // Writes the specified image through a pixel unpack buffer. Returns false if the pixel buffer path cannot be used.
+        bool WriteTextureWithPixelBuffer(GLTexture& textureGL, const TextureRegion& textureRegion, const ImageView& srcImageView);
+
+    private:
+
+        // Pending texture readback into a pixel pack buffer.
+        struct GLTextureReadRequest
+        {
+            GLPixelBufferRegion region;
+            GLsync              sync        = nullptr;
+            Format              format      = Format::Undefined;
+            std::uint32_t       numTexels   = 0;
+            std::uint32_t       rowLength   = 0;
+        };
+
     private:
 
         /* ----- Hardware object containers ----- */
 
         GLContextManager                        contextMngr_;
-        bool                                    debugContext_   = false;
+        bool                                    debugContext_       = false;
+        std::string                             programBinaryCacheDir_;
+        bool                                    packBlockUniforms_  = false;
 
         HWObjectContainer<GLSwapChain>          swapChains_;
         HWObjectInstance<GLCommandQueue>        commandQueue_;
         HWObjectContainer<GLCommandBuffer>      commandBuffers_;
-        HWObjectContainer<GLBuffer>             buffers_;
+        ConcurrentHWObjectContainer<GLBuffer>   buffers_;
         HWObjectContainer<GLBufferArray>        bufferArrays_;
-        HWObjectContainer<GLTexture>            textures_;
-        HWObjectContainer<GLSampler>            samplers_;
+        ConcurrentHWObjectContainer<GLTexture>  textures_;
+        ConcurrentHWObjectContainer<GLSampler>  samplers_;
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         HWObjectContainer<GL2XSampler>          samplersGL2X_;
         #endif
         HWObjectContainer<GLRenderPass>         renderPasses_;
         HWObjectContainer<GLRenderTarget>       renderTargets_;
-        HWObjectContainer<GLShader>             shaders_;
+        ConcurrentHWObjectContainer<GLShader>   shaders_;
         HWObjectContainer<GLPipelineLayout>     pipelineLayouts_;
         HWObjectInstance<ProxyPipelineCache>    pipelineCacheProxy_;
         HWObjectContainer<GLPipelineCache>      pipelineCaches_;
@@ -104,6 +136,13 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLQueryHeap>          queryHeaps_;
         HWObjectContainer<GLFence>              fences_;
 
+        /* ----- Asynchronous texture transfers ----- */
+
+        GLPixelBufferPool                                           unpackBufferPool_;
+        GLPixelBufferPool                                           packBufferPool_;
+        std::unordered_map<std::uint64_t, GLTextureReadRequest>     textureReads_;
+        std::uint64_t                                               nextTextureReadID_  = 1;
+
 };
 
 
@@ -80,6 +80,8 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawElementsInstancedBaseVertexBaseInstance )
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawElementsIndirect );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawArraysIndirect );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawElementsIndirect );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawArraysIndirectCount );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawElementsIndirectCount );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDispatchCompute );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDispatchComputeIndirect );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindTexture );
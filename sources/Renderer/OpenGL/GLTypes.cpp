@@ -169,6 +169,11 @@ GLenum MapOrZero(const Format format)
         case Format::BC5SNorm:          return GL_COMPRESSED_SIGNED_RED_GREEN_RGTC2_EXT;
         #endif // /GL_EXT_texture_compression_rgtc
 
+        #ifdef GL_ARB_texture_compression_bptc
+        case Format::BC7UNorm:          return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case Format::BC7UNorm_sRGB:     return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+        #endif // /GL_ARB_texture_compression_bptc
+
         default:                        return 0;
     }
 }
@@ -284,6 +289,7 @@ static GLenum MapImageFormat(const ImageFormat imageFormat)
         case ImageFormat::BC3:              return GL_COMPRESSED_RGBA;
         case ImageFormat::BC4:              return GL_COMPRESSED_RED;
         case ImageFormat::BC5:              return GL_COMPRESSED_RG;
+        case ImageFormat::BC7:              return GL_COMPRESSED_RGBA;
         #endif
         default:                            break;
     }
@@ -314,6 +320,7 @@ static GLenum MapIntegerImageFormat(const ImageFormat imageFormat)
         case ImageFormat::BC3:              return GL_COMPRESSED_RGBA;
         case ImageFormat::BC4:              return GL_COMPRESSED_RED;
         case ImageFormat::BC5:              return GL_COMPRESSED_RG;
+        case ImageFormat::BC7:              return GL_COMPRESSED_RGBA;
         #endif
         default:                            break;
     }
@@ -956,6 +963,11 @@ Format UnmapFormat(const GLenum internalFormat)
         case GL_COMPRESSED_SIGNED_RED_GREEN_RGTC2_EXT:  return Format::BC5SNorm;
         #endif // /GL_EXT_texture_compression_rgtc
 
+        #ifdef GL_ARB_texture_compression_bptc
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:             return Format::BC7UNorm;
+        case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:       return Format::BC7UNorm_sRGB;
+        #endif // /GL_ARB_texture_compression_bptc
+
         default:                                        break;
     }
     return Format::Undefined;
@@ -32,6 +32,14 @@
 #   define LLGL_GLEXT_MULTI_DRAW_INDIRECT
 #endif
 
+#if defined GL_ARB_indirect_parameters
+#   define LLGL_GLEXT_INDIRECT_PARAMETERS
+#endif
+
+#if defined GL_KHR_parallel_shader_compile && defined LLGL_OPENGL
+#   define LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+#endif
+
 #if defined GL_ARB_compute_shader || defined GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_COMPUTE_SHADER
 #endif
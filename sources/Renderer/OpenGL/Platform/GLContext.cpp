@@ -6,6 +6,7 @@
  */
 
 #include "GLContext.h"
+#include <atomic>
 
 
 namespace LLGL
@@ -33,9 +34,10 @@ bool operator != (const GLPixelFormat& lhs, const GLPixelFormat& rhs)
  * GLContext class
  */
 
-static GLContext*   g_currentContext;
-static unsigned     g_currentGlobalIndex;
-static unsigned     g_globalIndexCounter;
+// Current GL context is tracked per thread, since loader threads have their own shared GL context
+static thread_local GLContext*  g_currentContext;
+static thread_local unsigned    g_currentGlobalIndex;
+static std::atomic<unsigned>    g_globalIndexCounter;
 
 bool GLContext::SetCurrentSwapInterval(int interval)
 {
@@ -36,12 +36,45 @@ GLContextManager::GLContextManager(
 
 std::shared_ptr<GLContext> GLContextManager::AllocContext(const GLPixelFormat* pixelFormat, Surface* surface)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     if (pixelFormat != nullptr)
         return FindOrMakeContextWithPixelFormat(*pixelFormat, surface);
     else
         return FindOrMakeAnyContext();
 }
 
+std::unique_ptr<GLLoaderContext> GLContextManager::MakeLoaderContext()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Loader contexts can only share objects with a context that was created by this manager */
+    if (pixelFormats_.empty() || !customNativeHandle_.empty())
+        return nullptr;
+
+    const GLPixelFormatWithContext& primaryFormat = pixelFormats_.front();
+
+    /* Create shared GL context on a new placeholder surface */
+    std::unique_ptr<GLLoaderContext> loaderContext = MakeUnique<GLLoaderContext>();
+    {
+        loaderContext->surface          = CreatePlaceholderSurface();
+        loaderContext->context          = GLContext::Create(primaryFormat.pixelFormat, profile_, *(loaderContext->surface), primaryFormat.context.get());
+        loaderContext->swapChainContext = GLSwapChainContext::Create(*(loaderContext->context), *(loaderContext->surface));
+    }
+
+    if (!GLSwapChainContext::MakeCurrent(loaderContext->swapChainContext.get()))
+        return nullptr;
+
+    /*
+    Initialize state manager for the loader context; extensions have already been loaded with the primary context.
+    Limits are inherited from the primary context, since querying them would also write the common limits from the loader thread.
+    */
+    GLStateManager& stateMngr = loaderContext->context->GetStateManager();
+    stateMngr.InheritExtensionsAndLimits(primaryFormat.context->GetStateManager());
+    InitRenderStates(stateMngr);
+
+    return loaderContext;
+}
+
 
 /*
  * ======= Private: =======
@@ -10,10 +10,12 @@
 
 
 #include "GLContext.h"
+#include "GLSwapChainContext.h"
 #include <LLGL/RendererConfiguration.h>
 #include <LLGL/Container/DynamicArray.h>
 #include <vector>
 #include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -29,6 +31,14 @@ struct RenderSystemNativeHandle;
 
 class GLStateManager;
 
+// Shared GL context with its own placeholder surface for a loader thread. See GLRenderSystem::BeginLoaderThread.
+struct GLLoaderContext
+{
+    std::unique_ptr<Surface>            surface;
+    std::unique_ptr<GLContext>          context;
+    std::unique_ptr<GLSwapChainContext> swapChainContext;
+};
+
 // Helper class to reuse GL contexts for suitable pixel formats.
 class GLContextManager
 {
@@ -50,6 +60,12 @@ class GLContextManager
         // Returns a GL context with the specified pixel format or any context if 'pixelFormat' is null.
         std::shared_ptr<GLContext> AllocContext(const GLPixelFormat* pixelFormat = nullptr, Surface* surface = nullptr);
 
+        /*
+        Creates a new GL context that shares its objects with the primary GL context and makes it current on the calling thread.
+        Returns null if there is no primary GL context yet or the primary GL context was provided by the client.
+        */
+        std::unique_ptr<GLLoaderContext> MakeLoaderContext();
+
     public:
 
         // Returns the OpenGL profile configuration.
@@ -89,6 +105,7 @@ class GLContextManager
         RendererConfigurationOpenGL             profile_;
         std::vector<GLPixelFormatWithContext>   pixelFormats_;
         DynamicByteArray                        customNativeHandle_;
+        std::mutex                              mutex_;
 
 };
 
@@ -230,7 +230,7 @@ GLXContext LinuxGLContext::CreateGLXContextCoreProfile(GLXContext glcShared, int
                 None
             };
 
-            GLXContext glc = glXCreateContextAttribsARB(display_, fbcList[0], nullptr, True, contextAttribs);
+            GLXContext glc = glXCreateContextAttribsARB(display_, fbcList[0], glcShared, True, contextAttribs);
 
             XFree(fbcList);
 
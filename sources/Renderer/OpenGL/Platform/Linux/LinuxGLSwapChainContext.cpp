@@ -64,8 +64,10 @@ bool LinuxGLSwapChainContext::MakeCurrentGLXContext(LinuxGLSwapChainContext* con
 {
     if (context)
         return glXMakeCurrent(context->dpy_, context->wnd_, context->glc_);
+    else if (::Display* dpy = glXGetCurrentDisplay())
+        return glXMakeCurrent(dpy, None, nullptr);
     else
-        return glXMakeCurrent(nullptr, 0, 0);
+        return true;
 }
 
 
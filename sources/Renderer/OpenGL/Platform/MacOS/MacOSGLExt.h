@@ -37,6 +37,10 @@
 #define GL_QUERY_BUFFER                     ( 0x9192 )
 #endif
 
+#ifndef GL_PARAMETER_BUFFER
+#define GL_PARAMETER_BUFFER                 ( 0x80EE )
+#endif
+
 #ifndef GL_SHADER_STORAGE_BUFFER
 #define GL_SHADER_STORAGE_BUFFER            ( 0x90D2 )
 #endif
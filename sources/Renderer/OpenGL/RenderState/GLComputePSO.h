@@ -26,7 +26,7 @@ class GLComputePSO final : public GLPipelineState
 
     public:
 
-        GLComputePSO(const ComputePipelineDescriptor& desc, PipelineCache* pipelineCache = nullptr);
+        GLComputePSO(const ComputePipelineDescriptor& desc, PipelineCache* pipelineCache = nullptr, bool packBlockUniforms = false);
 
 };
 
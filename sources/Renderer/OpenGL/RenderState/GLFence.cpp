@@ -9,6 +9,7 @@
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -19,6 +20,8 @@ GLFence::~GLFence()
 {
     /* Always call glDeleteSync, it will silently ignore a <sync> value of zero */
     glDeleteSync(sync_);
+    for (const TimelineSignal& signal : signals_)
+        glDeleteSync(signal.sync);
 }
 
 void GLFence::SetDebugName(const char* name)
@@ -65,6 +68,99 @@ bool GLFence::Wait(GLuint64 timeout)
     }
 }
 
+// Maximum number of pending signals per fence before Signal() blocks on the oldest one.
+static constexpr std::size_t g_maxPendingSignals = 16;
+
+void GLFence::Signal(std::uint64_t value, std::uint64_t issue)
+{
+    if (HasExtension(GLExt::ARB_sync))
+    {
+        /* Release completed signals and keep the ring of sync objects bounded */
+        PollSignals();
+        if (signals_.size() >= g_maxPendingSignals)
+        {
+            const TimelineSignal& oldest = signals_.front();
+            glClientWaitSync(oldest.sync, GL_SYNC_FLUSH_COMMANDS_BIT, ~GLuint64(0));
+            CompleteSignals(oldest.issue);
+        }
+
+        TimelineSignal signal;
+        {
+            signal.value    = value;
+            signal.issue    = issue;
+            signal.sync     = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+        signals_.push_back(signal);
+    }
+    else
+    {
+        /* Without sync objects, the only way to reach the signal is to finish all commands */
+        glFinish();
+        completedValue_ = std::max(completedValue_, value);
+    }
+}
+
+std::uint64_t GLFence::FindSignalIssue(std::uint64_t value) const
+{
+    if (value <= completedValue_)
+        return 0;
+
+    /* Values are monotonic, so the first signal that reaches the value is the earliest point to wait for */
+    for (const TimelineSignal& signal : signals_)
+    {
+        if (signal.value >= value)
+            return signal.issue;
+    }
+
+    return ~0ull;
+}
+
+bool GLFence::WaitForSignalIssue(std::uint64_t issue, GLuint64 timeout)
+{
+    for (const TimelineSignal& signal : signals_)
+    {
+        if (signal.issue == issue)
+        {
+            GLenum result = glClientWaitSync(signal.sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+            {
+                CompleteSignals(issue);
+                return true;
+            }
+            return false;
+        }
+    }
+    return false;
+}
+
+void GLFence::CompleteSignals(std::uint64_t issue)
+{
+    while (!signals_.empty() && signals_.front().issue <= issue)
+    {
+        const TimelineSignal& signal = signals_.front();
+        completedValue_ = std::max(completedValue_, signal.value);
+        glDeleteSync(signal.sync);
+        signals_.pop_front();
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLFence::PollSignals()
+{
+    while (!signals_.empty())
+    {
+        const TimelineSignal& signal = signals_.front();
+        GLenum result = glClientWaitSync(signal.sync, 0, 0);
+        if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+            break;
+        CompleteSignals(signal.issue);
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,8 @@
 #include <LLGL/Fence.h>
 #include "../OpenGL.h"
 #include <string>
+#include <deque>
+#include <cstdint>
 
 
 namespace LLGL
@@ -32,9 +34,35 @@ class GLFence final : public Fence
         void Submit();
         bool Wait(GLuint64 timeout);
 
+        // Inserts a new sync object into the command stream that sets this fence to the specified value once it has been reached.
+        void Signal(std::uint64_t value, std::uint64_t issue);
+
+        // Returns the issue number of the first pending signal that reaches the specified value, 0 if the value has already been reached, or ~0ull if it has never been signaled.
+        std::uint64_t FindSignalIssue(std::uint64_t value) const;
+
+        // Blocks until the sync object of the specified signal issue number has been completed.
+        bool WaitForSignalIssue(std::uint64_t issue, GLuint64 timeout);
+
+        // Marks all pending signals up to and including the specified issue number as completed, since sync objects complete in submission order.
+        void CompleteSignals(std::uint64_t issue);
+
+    private:
+
+        struct TimelineSignal
+        {
+            std::uint64_t   value;
+            std::uint64_t   issue;  // Issue number of this signal across all fences of the command queue
+            GLsync          sync;
+        };
+
+        // Releases all pending signals that have already been completed without blocking.
+        void PollSignals();
+
     private:
 
-        GLsync      sync_ = 0;
+        GLsync                      sync_           = 0;
+        std::deque<TimelineSignal>  signals_;
+        std::uint64_t               completedValue_ = 0;
 
         #ifdef LLGL_DEBUG
         // Only provide name in debug mode, to keep fence objects as lightweight as possible
@@ -31,7 +31,12 @@ class GLGraphicsPSO final : public GLPipelineState
 
     public:
 
-        GLGraphicsPSO(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits, PipelineCache* pipelineCache = nullptr);
+        GLGraphicsPSO(
+            const GraphicsPipelineDescriptor&   desc,
+            const RenderingLimits&              limits,
+            PipelineCache*                      pipelineCache       = nullptr,
+            bool                                packBlockUniforms   = false
+        );
         ~GLGraphicsPSO();
 
         // Binds this graphics pipeline state with the specified GL state manager.
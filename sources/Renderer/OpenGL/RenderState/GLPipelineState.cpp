@@ -13,6 +13,7 @@
 #include "../Shader/GLShaderProgram.h"
 #include "../Ext/GLExtensions.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
 
@@ -25,9 +26,11 @@ GLPipelineState::GLPipelineState(
     bool                        isGraphicsPSO,
     const PipelineLayout*       pipelineLayout,
     PipelineCache*              pipelineCache,
-    const ArrayView<Shader*>&   shaders)
+    const ArrayView<Shader*>&   shaders,
+    bool                        packBlockUniforms)
 :
-    isGraphicsPSO_ { isGraphicsPSO }
+    isGraphicsPSO_      { isGraphicsPSO     },
+    packBlockUniforms_  { packBlockUniforms }
 {
     /* Get GL pipeline cache if specified */
     GLPipelineCache* pipelineCacheGL = (pipelineCache != nullptr ? LLGL_CAST(GLPipelineCache*, pipelineCache) : nullptr);
@@ -37,16 +40,11 @@ GLPipelineState::GLPipelineState(
         const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
         if (GLShader::HasAnyShaderPermutation(permutation, shaders))
         {
-            /* Create shader pipeline for current permutation */
+            /*
+            Create shader pipeline for current permutation.
+            The link status is not queried here, so the driver can link multiple pipelines concurrently; See FinalizeShaderPipelines().
+            */
             shaderPipelines_[permutation] = GLStatePool::Get().CreateShaderPipeline(shaders.size(), shaders.data(), permutation, pipelineCacheGL);
-
-            /* Query information log and stop linking shader pipelines if the default permutation has errors */
-            if (permutation == GLShader::PermutationDefault)
-            {
-                shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(report_);
-                if (report_.HasErrors())
-                    break;
-            }
         }
     }
 
@@ -61,13 +59,6 @@ GLPipelineState::GLPipelineState(
             if (!shaderBindingLayout_->HasBindings())
                 GLStatePool::Get().ReleaseShaderBindingLayout(std::move(shaderBindingLayout_));
         }
-
-        /* Build uniform table */
-        for_range(permutationIndex, GLShader::PermutationCount)
-        {
-            const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
-            BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
-        }
     }
 }
 
@@ -80,11 +71,39 @@ GLPipelineState::~GLPipelineState()
 
 const Report* GLPipelineState::GetReport() const
 {
+    FinalizeShaderPipelines();
     return (report_ ? &report_ : nullptr);
 }
 
+bool GLPipelineState::IsReady() const
+{
+    if (isLinkPending_)
+    {
+        for (const GLShaderPipelineSPtr& shaderPipeline : shaderPipelines_)
+        {
+            if (shaderPipeline && !shaderPipeline->QueryCompletionStatus())
+                return false;
+        }
+    }
+    return true;
+}
+
+void GLPipelineState::SetUniforms(
+    GLStateManager&     stateMngr,
+    GLUniformCounters&  counters,
+    std::uint32_t       first,
+    const void*         data,
+    GLsizeiptr          dataSize) const
+{
+    if (GLUniformCache* uniformCache = GetUniformCache())
+        uniformCache->SetUniforms(stateMngr, counters, first, data, dataSize);
+}
+
 void GLPipelineState::Bind(GLStateManager& stateMngr)
 {
+    /* Wait for shader pipelines to be linked on first use */
+    FinalizeShaderPipelines();
+
     /* Select shader pipeline permutation depending on what is needed for the current framebuffer */
     const GLShader::Permutation shaderPipelinePermutation =
     (
@@ -98,6 +117,10 @@ void GLPipelineState::Bind(GLStateManager& stateMngr)
     LLGL_ASSERT(shaderPipeline != nullptr, "GL shader permutation [%d] not compiled", static_cast<int>(shaderPipelinePermutation));
     shaderPipeline->Bind(stateMngr);
 
+    /* Bind uniform buffer and select shader pipeline for dynamic uniforms */
+    if (uniformCache_)
+        uniformCache_->Bind(stateMngr, *shaderPipeline);
+
     /* Update resource slots in shader program (if necessary) */
     if (shaderBindingLayout_)
         shaderPipeline->BindResourceSlots(*shaderBindingLayout_);
@@ -112,99 +135,50 @@ void GLPipelineState::Bind(GLStateManager& stateMngr)
  * ======= Private: =======
  */
 
-//TODO: support separate shaders; each separable shader needs its own set of uniform locations
-void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms)
+void GLPipelineState::FinalizeShaderPipelines() const
 {
-    if (shaderPipelines_[permutation].get() != nullptr && !uniforms.empty())
-    {
-        const GLuint program = shaderPipelines_[permutation]->GetID();
+    if (!isLinkPending_)
+        return;
+
+    isLinkPending_ = false;
 
-        /* Build uniform locations from input descriptors */
-        uniformMap_.resize(uniforms.size());
-        for_range(i, uniforms.size())
-            BuildUniformLocation(program, uniformMap_[i], uniforms[i]);
+    /* Finish deferred work of all shader pipelines; This blocks until the driver has linked them */
+    for (const GLShaderPipelineSPtr& shaderPipeline : shaderPipelines_)
+    {
+        if (shaderPipeline)
+            shaderPipeline->FinalizeLink();
     }
-}
 
-// Returns the size (in 32-bit words) for the specified GL uniform type
-static GLuint GetUniformWordSize(GLenum type)
-{
-    switch (type)
+    /* Query information log of default permutation and keep the messages that have been reported while creating this PSO */
+    if (GLShaderPipeline* shaderPipeline = shaderPipelines_[GLShader::PermutationDefault].get())
     {
-        /* ----- Scalars/Vectors ----- */
-        case GL_FLOAT:              return 1;
-        case GL_FLOAT_VEC2:         return 2;
-        case GL_FLOAT_VEC3:         return 3;
-        case GL_FLOAT_VEC4:         return 4;
-        #ifdef LLGL_OPENGL
-        case GL_DOUBLE:             return 1*2;
-        case GL_DOUBLE_VEC2:        return 2*2;
-        case GL_DOUBLE_VEC3:        return 3*2;
-        case GL_DOUBLE_VEC4:        return 4*2;
-        #endif // /LLGL_OPENGL
-        case GL_INT:                return 1;
-        case GL_INT_VEC2:           return 2;
-        case GL_INT_VEC3:           return 3;
-        case GL_INT_VEC4:           return 4;
-        case GL_UNSIGNED_INT:       return 1;
-        case GL_UNSIGNED_INT_VEC2:  return 2;
-        case GL_UNSIGNED_INT_VEC3:  return 3;
-        case GL_UNSIGNED_INT_VEC4:  return 4;
-        case GL_BOOL:               return 1;
-        case GL_BOOL_VEC2:          return 2;
-        case GL_BOOL_VEC3:          return 3;
-        case GL_BOOL_VEC4:          return 4;
-
-        /* ----- Matrices ----- */
-        case GL_FLOAT_MAT2:         return 2*2;
-        case GL_FLOAT_MAT2x3:       return 2*3;
-        case GL_FLOAT_MAT2x4:       return 2*4;
-        case GL_FLOAT_MAT3x2:       return 3*2;
-        case GL_FLOAT_MAT3:         return 3*3;
-        case GL_FLOAT_MAT3x4:       return 3*4;
-        case GL_FLOAT_MAT4x2:       return 4*2;
-        case GL_FLOAT_MAT4x3:       return 4*3;
-        case GL_FLOAT_MAT4:         return 4*4;
-        #ifdef LLGL_OPENGL
-        case GL_DOUBLE_MAT2:        return 2*2*2;
-        case GL_DOUBLE_MAT2x3:      return 2*3*2;
-        case GL_DOUBLE_MAT2x4:      return 2*4*2;
-        case GL_DOUBLE_MAT3x2:      return 3*2*2;
-        case GL_DOUBLE_MAT3:        return 3*3*2;
-        case GL_DOUBLE_MAT3x4:      return 3*4*2;
-        case GL_DOUBLE_MAT4x2:      return 4*2*2;
-        case GL_DOUBLE_MAT4x3:      return 4*3*2;
-        case GL_DOUBLE_MAT4:        return 4*4*2;
-        #endif // /LLGL_OPENGL
-
-        default:                    return 0;
+        Report linkReport;
+        shaderPipeline->QueryInfoLogs(linkReport);
+        if (report_)
+        {
+            std::string text = linkReport.GetText();
+            text += report_.GetText();
+            report_.Reset(std::move(text), linkReport.HasErrors() || report_.HasErrors());
+        }
+        else
+            report_ = std::move(linkReport);
     }
+
+    /* Build uniform table */
+    if (pipelineLayout_ != nullptr)
+        BuildUniformCache(*pipelineLayout_);
 }
 
-void GLPipelineState::BuildUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform)
+//TODO: support separate shaders; each separable shader needs its own set of uniform locations
+void GLPipelineState::BuildUniformCache(const GLPipelineLayout& pipelineLayout) const
 {
-    /* Find uniform location by name in shader pipeline */
-    GLint location = glGetUniformLocation(program, inUniform.name.c_str());
-    if (location == -1)
-    {
-        /* Write invalid uniform location */
-        outUniform.type     = UniformType::Undefined;
-        outUniform.location = -1;
-        outUniform.count    = 0;
-        outUniform.wordSize = 0;
-    }
-    else
+    if (shaderPipelines_[GLShader::PermutationDefault].get() != nullptr && !pipelineLayout.GetUniforms().empty())
     {
-        /* Determine type of uniform */
-        GLenum type = 0;
-        GLint size = 0;
-        glGetActiveUniform(program, static_cast<GLuint>(location), 0, nullptr, &size, &type, nullptr);
-
-        /* Write output uniform */
-        outUniform.type     = GLTypes::UnmapUniformType(type);
-        outUniform.location = location;
-        outUniform.count    = size;
-        outUniform.wordSize = GetUniformWordSize(type);
+        /*
+        Build uniform locations from the default permutation; all permutations share the same uniform declarations.
+        The uniform block of packed uniforms is bound to each program when the PSO is bound; See GLUniformCache::Bind().
+        */
+        uniformCache_ = MakeUnique<GLUniformCache>(shaderPipelines_[GLShader::PermutationDefault]->GetID(), pipelineLayout, packBlockUniforms_);
     }
 }
 
@@ -13,6 +13,7 @@
 #include "../Shader/GLShaderBindingLayout.h"
 #include "../Shader/GLShaderPipeline.h"
 #include "../Shader/GLShader.h"
+#include "GLUniformCache.h"
 #include <LLGL/Report.h>
 #include <LLGL/PipelineState.h>
 #include <LLGL/RenderSystemFlags.h>
@@ -29,15 +30,6 @@ class PipelineCache;
 class GLStateManager;
 class GLShaderProgram;
 
-// GL uniform location with size and type information.
-struct GLUniformLocation
-{
-    UniformType type;
-    GLint       location;
-    GLsizei     count;
-    GLuint      wordSize; // Size in words (32-bit values)
-};
-
 // Base class for OpenGL PSOs.
 class GLPipelineState : public PipelineState
 {
@@ -48,11 +40,13 @@ class GLPipelineState : public PipelineState
             bool                        isGraphicsPSO,
             const PipelineLayout*       pipelineLayout,
             PipelineCache*              pipelineCache,
-            const ArrayView<Shader*>&   shaders
+            const ArrayView<Shader*>&   shaders,
+            bool                        packBlockUniforms
         );
         ~GLPipelineState();
 
         const Report* GetReport() const override;
+        bool IsReady() const override;
 
         // Binds this pipeline state with the specified GL state manager.
         virtual void Bind(GLStateManager& stateMngr);
@@ -75,12 +69,24 @@ class GLPipelineState : public PipelineState
             return shaderPipelines_[GLShader::PermutationDefault].get();
         }
 
-        // Returns the list of uniforms that maps from index of 'PipelineLayoutDescriptor::uniforms[]' to GL uniform location.
-        inline const std::vector<GLUniformLocation>& GetUniformMap() const
+        /*
+        Returns the cache for dynamic uniforms of this PSO or null if there are no uniforms; See 'PipelineLayoutDescriptor::uniforms'.
+        This is only valid after the PSO has been bound, since the uniform cache is built when the PSO is finalized.
+        */
+        inline GLUniformCache* GetUniformCache() const
         {
-            return uniformMap_;
+            return uniformCache_.get();
         }
 
+        // Submits the dynamic uniforms to the uniform cache of this PSO. Does nothing if there are no uniforms or if the PSO has not been bound yet.
+        void SetUniforms(
+            GLStateManager&     stateMngr,
+            GLUniformCounters&  counters,
+            std::uint32_t       first,
+            const void*         data,
+            GLsizeiptr          dataSize
+        ) const;
+
     protected:
 
         // Returns a mutable reference to the PSO report.
@@ -91,20 +97,27 @@ class GLPipelineState : public PipelineState
 
     private:
 
-        // Builds the index-to-uniform map.
-        void BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms);
+        /*
+        Queries the link status of all shader pipelines and builds the uniform cache. This is deferred until first use; See GL_KHR_parallel_shader_compile.
+        Must only be called on the rendering thread, i.e. when the PSO is bound or its report is queried, but never while commands are recorded.
+        */
+        void FinalizeShaderPipelines() const;
 
-        // Builds the specified uniform location.
-        void BuildUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform);
+        // Builds the index-to-uniform map and the shadow copy of uniform values.
+        void BuildUniformCache(const GLPipelineLayout& pipelineLayout) const;
 
     private:
 
-        const bool                      isGraphicsPSO_                                  = false;
-        const GLPipelineLayout*         pipelineLayout_                                 = nullptr;
-        GLShaderPipelineSPtr            shaderPipelines_[GLShader::PermutationCount];
-        GLShaderBindingLayoutSPtr       shaderBindingLayout_;
-        std::vector<GLUniformLocation>  uniformMap_;
-        Report                          report_;
+        const bool                              isGraphicsPSO_                                  = false;
+        const bool                              packBlockUniforms_                              = false;
+        const GLPipelineLayout*                 pipelineLayout_                                 = nullptr;
+        GLShaderPipelineSPtr                    shaderPipelines_[GLShader::PermutationCount];
+        GLShaderBindingLayoutSPtr               shaderBindingLayout_;
+
+        /* Lazily finalized when the PSO is used the first time, since querying the link status blocks */
+        mutable std::unique_ptr<GLUniformCache> uniformCache_;
+        mutable Report                          report_;
+        mutable bool                            isLinkPending_                                  = true;
 
 };
 
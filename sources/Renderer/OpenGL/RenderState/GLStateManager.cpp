@@ -84,6 +84,7 @@ static const GLenum g_bufferTargetsEnum[] =
     GL_DISPATCH_INDIRECT_BUFFER,
     GL_DRAW_INDIRECT_BUFFER,
     GL_ELEMENT_ARRAY_BUFFER,
+    GL_PARAMETER_BUFFER,
     GL_PIXEL_PACK_BUFFER,
     GL_PIXEL_UNPACK_BUFFER,
     GL_QUERY_BUFFER,
@@ -152,8 +153,8 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
  * GLStateManager static members
  */
 
-GLStateManager*             GLStateManager::current_;
-GLStateManager::GLLimits    GLStateManager::commonLimits_;
+thread_local GLStateManager*    GLStateManager::current_;
+GLStateManager::GLLimits        GLStateManager::commonLimits_;
 
 struct GLStateManager::GLIntermediateBufferWriteMasks
 {
@@ -188,6 +189,15 @@ void GLStateManager::DetermineExtensionsAndLimits()
     #endif
 }
 
+void GLStateManager::InheritExtensionsAndLimits(const GLStateManager& primaryStateMngr)
+{
+    /* Loader contexts are created with the same pixel format and profile as the primary context, so they share its limitations */
+    limits_ = primaryStateMngr.limits_;
+    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
+    DetermineVendorSpecificExtensions();
+    #endif
+}
+
 void GLStateManager::ResetFramebufferHeight(GLint height)
 {
     /* Store new render-target height */
@@ -1036,6 +1046,7 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
     {
         NotifyBufferRelease(id, GLBufferTarget::DrawIndirectBuffer);
         NotifyBufferRelease(id, GLBufferTarget::DispatchIndirectBuffer);
+        NotifyBufferRelease(id, GLBufferTarget::ParameterBuffer);
     }
 
     NotifyBufferRelease(id, GLBufferTarget::CopyReadBuffer);
@@ -1708,6 +1719,7 @@ static void AccumCommonGLLimits(GLStateManager::GLLimits& dst, const GLStateMana
         dst.maxLabelLength      = std::min(dst.maxLabelLength, src.maxLabelLength);
         dst.maxTextureLayers    = std::min(dst.maxTextureLayers, src.maxTextureLayers);
         dst.maxImageUnits       = std::min(dst.maxImageUnits, src.maxImageUnits);
+        dst.maxUniformBuffers   = std::min(dst.maxUniformBuffers, src.maxUniformBuffers);
     }
 }
 
@@ -1753,6 +1765,14 @@ void GLStateManager::DetermineLimits()
     }
     #endif // /GL_ARB_shader_image_load_store
 
+    /* Get maximum number of uniform buffer binding points */
+    if (HasExtension(GLExt::ARB_uniform_buffer_object))
+    {
+        GLint maxUniformBuffers = 0;
+        glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &maxUniformBuffers);
+        limits_.maxUniformBuffers = static_cast<GLuint>(maxUniformBuffers);
+    }
+
     /* Accumulate common limitations */
     AccumCommonGLLimits(GLStateManager::commonLimits_, limits_);
 }
@@ -61,6 +61,7 @@ class GLStateManager
             GLint       maxLabelLength      = 0;                // Maximal length of debug labels (minimum value is 256).
             GLuint      maxTextureLayers    = 0;                // Maximal number of texture layers (minimum value is 16).
             GLuint      maxImageUnits       = 0;                // Maximal number of image units.
+            GLuint      maxUniformBuffers   = 0;                // Maximal number of uniform buffer binding points (minimum value is 24).
         };
 
     public:
@@ -81,6 +82,10 @@ class GLStateManager
         // Queries all supported and available GL extensions and limitations, then stores it internally (must be called once a GL context has been created).
         void DetermineExtensionsAndLimits();
 
+        // Copies the limitations of the specified primary state manager and queries the vendor specific extensions of this GL context.
+        // This does not modify the common limitations and can therefore be called on a loader thread.
+        void InheritExtensionsAndLimits(const GLStateManager& primaryStateMngr);
+
         //TODO: viewports and scissors must be updated!
         // Notifies the state manager about a new render-target height.
         void ResetFramebufferHeight(GLint height);
@@ -396,8 +401,8 @@ class GLStateManager
 
     private:
 
-        static GLStateManager*  current_;
-        static GLLimits         commonLimits_;          // Common denominator of limitations for all GL contexts
+        static thread_local GLStateManager* current_;       // Current state manager per thread, since loader threads have their own GL context
+        static GLLimits                     commonLimits_;  // Common denominator of limitations for all GL contexts
 
     private:
 
@@ -0,0 +1,496 @@
+/*
+ * GLUniformCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLUniformCache.h"
+#include "GLStateManager.h"
+#include "GLPipelineLayout.h"
+#include "GLResourceType.h"
+#include "../GLTypes.h"
+#include "../Shader/GLShaderPipeline.h"
+#include "../Shader/GLShaderUniform.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Returns the size (in 32-bit words) for the specified GL uniform type
+static GLuint GetUniformWordSize(GLenum type)
+{
+    switch (type)
+    {
+        /* ----- Scalars/Vectors ----- */
+        case GL_FLOAT:              return 1;
+        case GL_FLOAT_VEC2:         return 2;
+        case GL_FLOAT_VEC3:         return 3;
+        case GL_FLOAT_VEC4:         return 4;
+        #ifdef LLGL_OPENGL
+        case GL_DOUBLE:             return 1*2;
+        case GL_DOUBLE_VEC2:        return 2*2;
+        case GL_DOUBLE_VEC3:        return 3*2;
+        case GL_DOUBLE_VEC4:        return 4*2;
+        #endif // /LLGL_OPENGL
+        case GL_INT:                return 1;
+        case GL_INT_VEC2:           return 2;
+        case GL_INT_VEC3:           return 3;
+        case GL_INT_VEC4:           return 4;
+        case GL_UNSIGNED_INT:       return 1;
+        case GL_UNSIGNED_INT_VEC2:  return 2;
+        case GL_UNSIGNED_INT_VEC3:  return 3;
+        case GL_UNSIGNED_INT_VEC4:  return 4;
+        case GL_BOOL:               return 1;
+        case GL_BOOL_VEC2:          return 2;
+        case GL_BOOL_VEC3:          return 3;
+        case GL_BOOL_VEC4:          return 4;
+
+        /* ----- Matrices ----- */
+        case GL_FLOAT_MAT2:         return 2*2;
+        case GL_FLOAT_MAT2x3:       return 2*3;
+        case GL_FLOAT_MAT2x4:       return 2*4;
+        case GL_FLOAT_MAT3x2:       return 3*2;
+        case GL_FLOAT_MAT3:         return 3*3;
+        case GL_FLOAT_MAT3x4:       return 3*4;
+        case GL_FLOAT_MAT4x2:       return 4*2;
+        case GL_FLOAT_MAT4x3:       return 4*3;
+        case GL_FLOAT_MAT4:         return 4*4;
+        #ifdef LLGL_OPENGL
+        case GL_DOUBLE_MAT2:        return 2*2*2;
+        case GL_DOUBLE_MAT2x3:      return 2*3*2;
+        case GL_DOUBLE_MAT2x4:      return 2*4*2;
+        case GL_DOUBLE_MAT3x2:      return 3*2*2;
+        case GL_DOUBLE_MAT3:        return 3*3*2;
+        case GL_DOUBLE_MAT3x4:      return 3*4*2;
+        case GL_DOUBLE_MAT4x2:      return 4*2*2;
+        case GL_DOUBLE_MAT4x3:      return 4*3*2;
+        case GL_DOUBLE_MAT4:        return 4*4*2;
+        #endif // /LLGL_OPENGL
+
+        default:                    return 0;
+    }
+}
+
+// Returns the number of matrix columns for the specified GL uniform type, or 1 for scalars and vectors.
+static GLuint GetUniformNumColumns(GLenum type)
+{
+    switch (type)
+    {
+        case GL_FLOAT_MAT2:
+        case GL_FLOAT_MAT2x3:
+        case GL_FLOAT_MAT2x4:
+        #ifdef LLGL_OPENGL
+        case GL_DOUBLE_MAT2:
+        case GL_DOUBLE_MAT2x3:
+        case GL_DOUBLE_MAT2x4:
+        #endif // /LLGL_OPENGL
+            return 2;
+
+        case GL_FLOAT_MAT3x2:
+        case GL_FLOAT_MAT3:
+        case GL_FLOAT_MAT3x4:
+        #ifdef LLGL_OPENGL
+        case GL_DOUBLE_MAT3x2:
+        case GL_DOUBLE_MAT3:
+        case GL_DOUBLE_MAT3x4:
+        #endif // /LLGL_OPENGL
+            return 3;
+
+        case GL_FLOAT_MAT4x2:
+        case GL_FLOAT_MAT4x3:
+        case GL_FLOAT_MAT4:
+        #ifdef LLGL_OPENGL
+        case GL_DOUBLE_MAT4x2:
+        case GL_DOUBLE_MAT4x3:
+        case GL_DOUBLE_MAT4:
+        #endif // /LLGL_OPENGL
+            return 4;
+
+        default:
+            return 1;
+    }
+}
+
+// Returns the size (in bytes) of a single component for the specified GL uniform type.
+static GLuint GetUniformComponentSize(GLenum type)
+{
+    switch (type)
+    {
+        #ifdef LLGL_OPENGL
+        case GL_DOUBLE:
+        case GL_DOUBLE_VEC2:
+        case GL_DOUBLE_VEC3:
+        case GL_DOUBLE_VEC4:
+        case GL_DOUBLE_MAT2:
+        case GL_DOUBLE_MAT2x3:
+        case GL_DOUBLE_MAT2x4:
+        case GL_DOUBLE_MAT3x2:
+        case GL_DOUBLE_MAT3:
+        case GL_DOUBLE_MAT3x4:
+        case GL_DOUBLE_MAT4x2:
+        case GL_DOUBLE_MAT4x3:
+        case GL_DOUBLE_MAT4:
+            return 8;
+        #endif // /LLGL_OPENGL
+
+        default:
+            return 4;
+    }
+}
+
+GLUniformCache::GLUniformCache(GLuint program, const GLPipelineLayout& pipelineLayout, bool packBlockUniforms)
+{
+    /* Uniforms inside a uniform block can only be packed if a binding point can be reserved for the uniform buffer */
+    const bool canPackBlockUniforms = (packBlockUniforms && ReserveBlockBinding(pipelineLayout));
+
+    /* Build uniform locations from input descriptors and allocate their ranges within the shadow copy */
+    const std::vector<UniformDescriptor>& uniforms = pipelineLayout.GetUniforms();
+
+    uniformMap_.resize(uniforms.size());
+    shadowValid_.resize(uniforms.size(), false);
+
+    std::uint32_t numShadowWords = 0;
+
+    for_range(i, uniforms.size())
+    {
+        GLUniformLocation& uniform = uniformMap_[i];
+
+        if (!BuildUniformLocation(program, uniform, uniforms[i]) &&
+            !(canPackBlockUniforms && BuildBlockUniformLocation(program, uniform, uniforms[i])))
+        {
+            /* Write invalid uniform location */
+            uniform.type            = UniformType::Undefined;
+            uniform.location        = -1;
+            uniform.count           = 0;
+            uniform.wordSize        = 0;
+            uniform.blockOffset     = -1;
+            uniform.arrayStride     = 0;
+            uniform.matrixStride    = 0;
+            uniform.numColumns      = 1;
+            uniform.componentSize   = 4;
+            uniform.isRowMajor      = false;
+        }
+
+        uniform.shadowOffset = numShadowWords;
+        numShadowWords += uniform.wordSize * static_cast<std::uint32_t>(uniform.count);
+
+        /* Packed uniforms start with a valid shadow copy, since the uniform buffer is zero initialized */
+        if (uniform.blockOffset != -1)
+            shadowValid_[i] = true;
+    }
+
+    shadowWords_.resize(numShadowWords, 0u);
+
+    if (blockIndex_ != -1)
+        CreateUniformBuffer(program);
+}
+
+GLUniformCache::~GLUniformCache()
+{
+    if (uniformBuffer_ != 0)
+    {
+        GLStateManager::Get().NotifyBufferRelease(uniformBuffer_, GLBufferTarget::UniformBuffer);
+        glDeleteBuffers(1, &uniformBuffer_);
+    }
+}
+
+void GLUniformCache::Bind(GLStateManager& stateMngr, GLShaderPipeline& shaderPipeline)
+{
+    boundShaderPipeline_ = &shaderPipeline;
+    if (uniformBuffer_ != 0)
+    {
+        /* Programs are shared between PSOs, so only rebind the uniform block if another PSO has bound it to a different binding point */
+        if (shaderPipeline.ExchangePackedUniformBlockBinding(blockIndex_, blockBinding_))
+            BindUniformBlock(shaderPipeline.GetID());
+        stateMngr.BindBufferBase(GLBufferTarget::UniformBuffer, blockBinding_, uniformBuffer_);
+    }
+}
+
+void GLUniformCache::SetUniforms(
+    GLStateManager&     stateMngr,
+    GLUniformCounters&  counters,
+    std::uint32_t       first,
+    const void*         data,
+    GLsizeiptr          dataSize)
+{
+    if (boundShaderPipeline_ == nullptr)
+        return;
+
+    /*
+    Uniform values are stored per GL program, which can be shared between multiple PSOs.
+    Invalidate the shadow copy if another cache has written to the uniforms of the bound shader pipeline in the meantime.
+    */
+    if (boundShaderPipeline_->ExchangeUniformCacheOwner(this) != this || shadowShaderPipeline_ != boundShaderPipeline_)
+    {
+        InvalidateShadow();
+        shadowShaderPipeline_ = boundShaderPipeline_;
+    }
+
+    const std::uint32_t* words      = reinterpret_cast<const std::uint32_t*>(data);
+    const std::uint32_t* wordsEnd   = words + dataSize / 4;
+
+    std::size_t dirtyBegin      = blockData_.size();
+    std::size_t dirtyEnd        = 0;
+    bool        hasBlockData    = false;
+
+    for (; words != wordsEnd && first < uniformMap_.size(); ++first)
+    {
+        const GLUniformLocation& uniform = uniformMap_[first];
+
+        /* Uniforms that were not found in the shader program don't consume any data */
+        const std::uint32_t numWords = uniform.wordSize * static_cast<std::uint32_t>(uniform.count);
+        if (numWords == 0)
+            continue;
+
+        if (numWords > static_cast<std::uint32_t>(wordsEnd - words))
+            break /*GL_INVALID_VALUE*/;
+
+        /* Only submit uniform if it differs from the shadow copy */
+        std::uint32_t* shadow = &(shadowWords_[uniform.shadowOffset]);
+        const std::size_t numBytes = numWords * sizeof(std::uint32_t);
+        const bool isChanged = (!shadowValid_[first] || ::memcmp(shadow, words, numBytes) != 0);
+
+        if (uniform.blockOffset == -1)
+        {
+            if (isChanged)
+            {
+                GLSetUniformsByType(uniform.type, uniform.location, uniform.count, words);
+                ::memcpy(shadow, words, numBytes);
+                shadowValid_[first] = true;
+                ++counters.numUniformUploads;
+            }
+            else
+                ++counters.numUniformUploadsSkipped;
+        }
+        else
+        {
+            if (isChanged)
+            {
+                ::memcpy(shadow, words, numBytes);
+                dirtyBegin  = std::min(dirtyBegin, static_cast<std::size_t>(uniform.blockOffset));
+                dirtyEnd    = std::max(dirtyEnd, CopyToBlockData(uniform, words));
+            }
+            hasBlockData = true;
+        }
+
+        words += numWords;
+    }
+
+    /* Update modified range of uniform buffer at once */
+    if (dirtyBegin < dirtyEnd)
+    {
+        stateMngr.BindBuffer(GLBufferTarget::UniformBuffer, uniformBuffer_);
+        glBufferSubData(
+            GL_UNIFORM_BUFFER,
+            static_cast<GLintptr>(dirtyBegin),
+            static_cast<GLsizeiptr>(dirtyEnd - dirtyBegin),
+            &(blockData_[dirtyBegin])
+        );
+        ++counters.numUniformBufferUpdates;
+    }
+    else if (hasBlockData)
+        ++counters.numUniformBufferUpdatesSkipped;
+}
+
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLUniformCache::ReserveBlockBinding(const GLPipelineLayout& pipelineLayout)
+{
+    if (!HasExtension(GLExt::ARB_uniform_buffer_object))
+        return false;
+
+    /* Gather all uniform buffer binding points of the pipeline layout */
+    const GLuint maxUniformBuffers = GLStateManager::GetCommonLimits().maxUniformBuffers;
+    std::vector<bool> usedBindings(maxUniformBuffers, false);
+
+    auto MarkBindingsUsed = [&usedBindings, maxUniformBuffers](std::uint32_t first, std::uint32_t count)
+    {
+        for (std::uint32_t slot = first; slot < maxUniformBuffers && slot - first < count; ++slot)
+            usedBindings[slot] = true;
+    };
+
+    for (const BindingDescriptor& binding : pipelineLayout.GetHeapBindings())
+    {
+        if (binding.type == ResourceType::Buffer && (binding.bindFlags & BindFlags::ConstantBuffer) != 0)
+            MarkBindingsUsed(binding.slot.index, std::max(1u, binding.arraySize));
+    }
+
+    for (const GLPipelineResourceBinding& binding : pipelineLayout.GetBindings())
+    {
+        if (binding.type == GLResourceType_UBO)
+            MarkBindingsUsed(binding.slot, 1);
+    }
+
+    /* Reserve the highest free binding point, since it's the least likely to collide with bindings that are not declared in the pipeline layout */
+    for (GLuint binding = maxUniformBuffers; binding > 0; --binding)
+    {
+        if (!usedBindings[binding - 1])
+        {
+            blockBinding_ = binding - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool GLUniformCache::BuildUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform)
+{
+    /* Find uniform location by name in shader pipeline */
+    GLint location = glGetUniformLocation(program, inUniform.name.c_str());
+    if (location == -1)
+        return false;
+
+    /* Determine type of uniform */
+    GLenum type = 0;
+    GLint size = 0;
+    glGetActiveUniform(program, static_cast<GLuint>(location), 0, nullptr, &size, &type, nullptr);
+
+    /* Write output uniform */
+    outUniform.type             = GLTypes::UnmapUniformType(type);
+    outUniform.location         = location;
+    outUniform.count            = size;
+    outUniform.wordSize         = GetUniformWordSize(type);
+    outUniform.blockOffset      = -1;
+    outUniform.arrayStride      = 0;
+    outUniform.matrixStride     = 0;
+    outUniform.numColumns       = GetUniformNumColumns(type);
+    outUniform.componentSize    = GetUniformComponentSize(type);
+    outUniform.isRowMajor       = false;
+
+    return true;
+}
+
+bool GLUniformCache::BuildBlockUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform)
+{
+    /* Find uniform index by name in shader pipeline */
+    const GLchar* name = inUniform.name.c_str();
+    GLuint index = GL_INVALID_INDEX;
+    glGetUniformIndices(program, 1, &name, &index);
+    if (index == GL_INVALID_INDEX)
+        return false;
+
+    /* Only uniforms of a single uniform block can be packed into the uniform buffer */
+    GLint blockIndex = -1;
+    glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+    if (blockIndex == -1 || (blockIndex_ != -1 && blockIndex_ != blockIndex))
+        return false;
+
+    blockIndex_ = blockIndex;
+
+    /* Determine type and layout of uniform within its block */
+    GLint type = 0, size = 0, offset = 0, arrayStride = 0, matrixStride = 0, isRowMajor = 0;
+    glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_TYPE, &type);
+    glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_SIZE, &size);
+    glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &offset);
+    glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_ARRAY_STRIDE, &arrayStride);
+    glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_MATRIX_STRIDE, &matrixStride);
+    glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_IS_ROW_MAJOR, &isRowMajor);
+
+    /* Write output uniform */
+    outUniform.type             = GLTypes::UnmapUniformType(static_cast<GLenum>(type));
+    outUniform.location         = -1;
+    outUniform.count            = size;
+    outUniform.wordSize         = GetUniformWordSize(static_cast<GLenum>(type));
+    outUniform.blockOffset      = offset;
+    outUniform.arrayStride      = arrayStride;
+    outUniform.matrixStride     = matrixStride;
+    outUniform.numColumns       = GetUniformNumColumns(static_cast<GLenum>(type));
+    outUniform.componentSize    = GetUniformComponentSize(static_cast<GLenum>(type));
+    outUniform.isRowMajor       = (isRowMajor != 0);
+
+    return true;
+}
+
+void GLUniformCache::CreateUniformBuffer(GLuint program)
+{
+    /* Query size and name of uniform block */
+    const GLuint blockIndex = static_cast<GLuint>(blockIndex_);
+
+    GLint blockSize = 0, blockNameLength = 0;
+    glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize);
+    glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_NAME_LENGTH, &blockNameLength);
+
+    if (blockNameLength > 0)
+    {
+        blockName_.resize(static_cast<std::size_t>(blockNameLength));
+        glGetActiveUniformBlockName(program, blockIndex, blockNameLength, nullptr, &blockName_[0]);
+        blockName_.resize(static_cast<std::size_t>(blockNameLength - 1));
+    }
+
+    /* Create zero initialized uniform buffer */
+    blockData_.resize(static_cast<std::size_t>(blockSize), 0);
+
+    glGenBuffers(1, &uniformBuffer_);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::UniformBuffer, uniformBuffer_);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(blockSize), blockData_.data(), GL_DYNAMIC_DRAW);
+}
+
+void GLUniformCache::BindUniformBlock(GLuint program)
+{
+    GLuint blockIndex = glGetUniformBlockIndex(program, blockName_.c_str());
+    if (blockIndex != GL_INVALID_INDEX)
+        glUniformBlockBinding(program, blockIndex, blockBinding_);
+}
+
+std::size_t GLUniformCache::CopyToBlockData(const GLUniformLocation& uniform, const std::uint32_t* words)
+{
+    /* Copy each component individually, since the uniform block layout has its own strides for array elements and matrix columns */
+    const char*     src             = reinterpret_cast<const char*>(words);
+    const GLuint    componentSize   = uniform.componentSize;
+    const GLuint    numColumns      = uniform.numColumns;
+    const GLuint    numRows         = uniform.wordSize * 4 / (numColumns * componentSize);
+    std::size_t     blockEnd        = static_cast<std::size_t>(uniform.blockOffset);
+
+    for_range(element, static_cast<GLuint>(uniform.count))
+    {
+        const std::size_t elementOffset = static_cast<std::size_t>(uniform.blockOffset + element * uniform.arrayStride);
+
+        for_range(column, numColumns)
+        {
+            for_range(row, numRows)
+            {
+                const std::size_t dstOffset =
+                (
+                    elementOffset +
+                    (uniform.isRowMajor ? row * uniform.matrixStride + column * componentSize : column * uniform.matrixStride + row * componentSize)
+                );
+                if (dstOffset + componentSize <= blockData_.size())
+                {
+                    ::memcpy(&(blockData_[dstOffset]), src, componentSize);
+                    blockEnd = std::max(blockEnd, dstOffset + componentSize);
+                }
+                src += componentSize;
+            }
+        }
+    }
+
+    return blockEnd;
+}
+
+void GLUniformCache::InvalidateShadow()
+{
+    for_range(i, uniformMap_.size())
+    {
+        if (uniformMap_[i].blockOffset == -1)
+            shadowValid_[i] = false;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
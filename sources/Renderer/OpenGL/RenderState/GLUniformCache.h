@@ -0,0 +1,136 @@
+/*
+ * GLUniformCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_UNIFORM_CACHE_H
+#define LLGL_GL_UNIFORM_CACHE_H
+
+
+#include "../OpenGL.h"
+#include <LLGL/PipelineLayoutFlags.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLStateManager;
+class GLShaderPipeline;
+class GLPipelineLayout;
+
+// GL uniform location with size and type information.
+struct GLUniformLocation
+{
+    UniformType     type;
+    GLint           location;       // Uniform location for glUniform*, or -1 if the uniform is packed into the uniform buffer.
+    GLsizei         count;
+    GLuint          wordSize;       // Size in words (32-bit values)
+    std::uint32_t   shadowOffset;   // Offset (in words) into the shadow copy of uniform values.
+    GLint           blockOffset;    // Byte offset within the uniform block, or -1 if the uniform is not packed into the uniform buffer.
+    GLint           arrayStride;    // Byte stride between array elements within the uniform block.
+    GLint           matrixStride;   // Byte stride between matrix columns (or rows if 'isRowMajor' is true) within the uniform block.
+    GLuint          numColumns;     // Number of matrix columns, or 1 for scalars and vectors.
+    GLuint          componentSize;  // Size (in bytes) of a single uniform component: 4 or 8.
+    bool            isRowMajor;
+};
+
+// Counters of the uniform updates that have been submitted and skipped by GLUniformCache.
+struct GLUniformCounters
+{
+    std::uint64_t numUniformUploads                 = 0; // Number of glUniform* calls.
+    std::uint64_t numUniformUploadsSkipped          = 0; // Number of glUniform* calls that were skipped, because their values did not change.
+    std::uint64_t numUniformBufferUpdates           = 0; // Number of glBufferSubData calls for packed uniforms.
+    std::uint64_t numUniformBufferUpdatesSkipped    = 0; // Number of glBufferSubData calls that were skipped, because none of the packed uniforms changed.
+};
+
+/*
+Manages a shadow copy of the dynamic uniform values for a PSO; See 'PipelineLayoutDescriptor::uniforms'.
+Uniforms in the default uniform block are only submitted with glUniform* if their values changed.
+If enabled, uniforms that are declared inside a uniform block are packed into a uniform buffer that is owned by this cache
+and updated with a single glBufferSubData per call to SetUniforms(); See 'RendererConfigurationOpenGL::packBlockUniforms'.
+*/
+class GLUniformCache
+{
+
+    public:
+
+        GLUniformCache(const GLUniformCache&) = delete;
+        GLUniformCache& operator = (const GLUniformCache&) = delete;
+
+        GLUniformCache(GLuint program, const GLPipelineLayout& pipelineLayout, bool packBlockUniforms);
+        ~GLUniformCache();
+
+        // Binds the uniform buffer of this cache (if any) and stores the shader pipeline the uniforms will be submitted to.
+        // The uniform block of the packed uniforms is only bound to the reserved binding point if the shader pipeline was last bound with a different one.
+        void Bind(GLStateManager& stateMngr, GLShaderPipeline& shaderPipeline);
+
+        // Submits the uniforms that have changed since the last call. The data size must be a multiple of 4.
+        void SetUniforms(
+            GLStateManager&     stateMngr,
+            GLUniformCounters&  counters,
+            std::uint32_t       first,
+            const void*         data,
+            GLsizeiptr          dataSize
+        );
+
+        // Returns the list of uniforms that maps from index of 'PipelineLayoutDescriptor::uniforms[]' to GL uniform location.
+        inline const std::vector<GLUniformLocation>& GetUniformMap() const
+        {
+            return uniformMap_;
+        }
+
+    private:
+
+        // Reserves the highest uniform buffer binding point that is not used by the pipeline layout and returns false if there is none.
+        bool ReserveBlockBinding(const GLPipelineLayout& pipelineLayout);
+
+        // Builds the specified uniform location and returns true if the uniform was found in the program.
+        bool BuildUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform);
+
+        // Builds the specified uniform location for a uniform inside a uniform block.
+        bool BuildBlockUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform);
+
+        // Creates the uniform buffer for the packed uniforms.
+        void CreateUniformBuffer(GLuint program);
+
+        // Binds the uniform block of the packed uniforms to the reserved binding point for the specified program.
+        void BindUniformBlock(GLuint program);
+
+        // Copies the tightly packed uniform data into the uniform block data with its respective strides and returns the end of the written range (in bytes).
+        std::size_t CopyToBlockData(const GLUniformLocation& uniform, const std::uint32_t* words);
+
+        // Invalidates the shadow copy of all uniforms that are submitted with glUniform*.
+        void InvalidateShadow();
+
+    private:
+
+        std::vector<GLUniformLocation>  uniformMap_;
+        std::vector<std::uint32_t>      shadowWords_;                       // Shadow copy of the tightly packed uniform values.
+        std::vector<bool>               shadowValid_;                       // Specifies whether the shadow copy of each uniform in 'uniformMap_' is valid.
+
+        GLShaderPipeline*               boundShaderPipeline_    = nullptr;
+        const GLShaderPipeline*         shadowShaderPipeline_   = nullptr;  // Shader pipeline the shadow copy was written to.
+
+        GLint                           blockIndex_             = -1;       // Index of the uniform block that holds the packed uniforms.
+        std::string                     blockName_;
+        GLuint                          blockBinding_           = 0;        // Reserved binding point for the uniform buffer; See ReserveBlockBinding().
+        GLuint                          uniformBuffer_          = 0;
+        std::vector<char>               blockData_;                         // CPU copy of the uniform buffer contents.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,11 +7,13 @@
 
 #include "GLLegacyShader.h"
 #include "GLShaderProgram.h"
+#include "GLProgramBinaryCache.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../../../Core/Exception.h"
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -44,6 +46,27 @@ bool GLLegacyShader::Reflect(ShaderReflection& reflection) const
     return true;
 }
 
+const Report* GLLegacyShader::GetReport() const
+{
+    /* Query compile status on first request, since this blocks until the driver has finished compiling the shader */
+    if (isStatusPending_)
+        QueryStatusAndLog();
+    return GLShader::GetReport();
+}
+
+bool GLLegacyShader::IsReady() const
+{
+    if (isStatusPending_)
+    {
+        for_range(permutation, PermutationCount)
+        {
+            if (!GLLegacyShader::GetCompletionStatus(GetID(static_cast<Permutation>(permutation))))
+                return false;
+        }
+    }
+    return true;
+}
+
 void GLLegacyShader::CompileShaderSource(GLuint shader, const char* source)
 {
     const GLchar* strings[1] = { source };
@@ -58,6 +81,19 @@ bool GLLegacyShader::GetCompileStatus(GLuint shader)
     return (status != GL_FALSE);
 }
 
+bool GLLegacyShader::GetCompletionStatus(GLuint shader)
+{
+    #ifdef LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+    {
+        GLint status = 0;
+        glGetShaderiv(shader, GL_COMPLETION_STATUS_KHR, &status);
+        return (status != GL_FALSE);
+    }
+    #endif // /LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    return true;
+}
+
 std::string GLLegacyShader::GetGLShaderLog(GLuint shader)
 {
     /* Query info log length */
@@ -93,12 +129,12 @@ GLuint GLLegacyShader::CreateShaderPermutation(Permutation permutation)
     return id;
 }
 
-bool GLLegacyShader::FinalizeShaderPermutation(Permutation permutation)
+void GLLegacyShader::QueryStatusAndLog() const
 {
     /* Query compile status and log */
     const bool status = GLLegacyShader::GetCompileStatus(GetID());
     ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(GetID()));
-    return status;
+    isStatusPending_ = false;
 }
 
 void GLLegacyShader::BuildShader(const ShaderDescriptor& shaderDesc)
@@ -111,10 +147,15 @@ void GLLegacyShader::BuildShader(const ShaderDescriptor& shaderDesc)
 
 void GLLegacyShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
-    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation, long enabledFlags) -> bool
+    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation, long enabledFlags)
     {
         const GLuint shader = CreateShaderPermutation(permutation);
-        auto sourceCallback = std::bind(GLLegacyShader::CompileShaderSource, shader, std::placeholders::_1);
+        auto sourceCallback = [this, shader, permutation](const char* source)
+        {
+            /* Store hash of final source for the program binary cache */
+            SetSourceHash(GLHashString(source), permutation);
+            GLLegacyShader::CompileShaderSource(shader, source);
+        };
 
         if (shaderDesc.sourceType == ShaderSourceType::CodeFile)
         {
@@ -123,17 +164,18 @@ void GLLegacyShader::CompileSource(const ShaderDescriptor& shaderDesc)
         }
         else
             GLShader::PatchShaderSource(sourceCallback, shaderDesc.source, shaderDesc, enabledFlags);
-
-        return FinalizeShaderPermutation(permutation);
     };
 
-    /* Compile and patch default shader permutation */
-    if (CompileShaderPermutation(PermutationDefault, ShaderCompileFlags::NoOptimization))
-    {
-        /* Compile and patch shader permutation for flipped Y-position */
-        if (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags))
-            CompileShaderPermutation(PermutationFlippedYPosition, ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
-    }
+    /*
+    Compile and patch default shader permutation and the permutation for flipped Y-position.
+    The compile status is not queried here, so the driver can compile multiple shaders concurrently; See QueryStatusAndLog().
+    */
+    CompileShaderPermutation(PermutationDefault, ShaderCompileFlags::NoOptimization);
+
+    if (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags))
+        CompileShaderPermutation(PermutationFlippedYPosition, ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
+
+    isStatusPending_ = true;
 }
 
 void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
@@ -168,6 +210,9 @@ void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         /* Specialize for the default "main" function in a SPIR-V module  */
         const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
         glSpecializeShader(shader, entryPoint, 0, nullptr, nullptr);
+
+        /* Store hash of binary and entry point for the program binary cache */
+        SetSourceHash(GLHashString(entryPoint, GLHashBytes(binaryBuffer, static_cast<std::size_t>(binaryLength))));
     }
     else
     #endif
@@ -175,7 +220,7 @@ void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         LLGL_TRAP_FEATURE_NOT_SUPPORTED("loading binary shader");
     }
 
-    FinalizeShaderPermutation(PermutationDefault);
+    isStatusPending_ = true;
 }
 
 
@@ -24,6 +24,8 @@ class GLLegacyShader final : public GLShader
 
         void SetDebugName(const char* name) override;
         bool Reflect(ShaderReflection& reflection) const override;
+        const Report* GetReport() const override;
+        bool IsReady() const override;
 
     public:
 
@@ -38,18 +40,27 @@ class GLLegacyShader final : public GLShader
         // Returns true if the native GL shader was compiled successfully.
         static bool GetCompileStatus(GLuint shader);
 
+        // Returns true if the driver has finished compiling the native GL shader. Always true if GL_KHR_parallel_shader_compile is not supported.
+        static bool GetCompletionStatus(GLuint shader);
+
         // Returns the native GL shader log.
         static std::string GetGLShaderLog(GLuint shader);
 
     private:
 
         GLuint CreateShaderPermutation(Permutation permutation);
-        bool FinalizeShaderPermutation(Permutation permutation);
+
+        // Queries the compile status and log of the default permutation. This is deferred until first use; See GL_KHR_parallel_shader_compile.
+        void QueryStatusAndLog() const;
 
         void BuildShader(const ShaderDescriptor& shaderDesc);
         void CompileSource(const ShaderDescriptor& shaderDesc);
         void LoadBinary(const ShaderDescriptor& shaderDesc);
 
+    private:
+
+        mutable bool isStatusPending_ = false; // Compile status has not been queried yet.
+
 };
 
 
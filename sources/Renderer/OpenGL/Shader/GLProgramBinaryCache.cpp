@@ -0,0 +1,244 @@
+/*
+ * GLProgramBinaryCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLProgramBinaryCache.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include <LLGL/Container/DynamicArray.h>
+#include <fstream>
+#include <atomic>
+#include <random>
+#include <string.h>
+#include <stdio.h>
+
+
+namespace LLGL
+{
+
+
+std::uint64_t GLHashBytes(const void* data, std::size_t size, std::uint64_t hash)
+{
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+std::uint64_t GLHashString(const char* str, std::uint64_t hash)
+{
+    return (str != nullptr ? GLHashBytes(str, ::strlen(str) + 1, hash) : GLHashBytes("", 1, hash));
+}
+
+#include "../../../Core/PackStructPush.inl"
+
+struct GLProgramBinaryFileHeader
+{
+    char            magic[4];       // "LGPB"
+    std::uint32_t   version;        // Version of this file format
+    std::uint64_t   key;            // Program key; Must match the filename
+    std::uint32_t   binaryFormat;   // GLenum of program binary format
+    std::uint32_t   binaryLength;   // Length (in bytes) of program binary that follows this header
+}
+LLGL_PACK_STRUCT;
+
+#include "../../../Core/PackStructPop.inl"
+
+static constexpr std::uint32_t g_programBinaryFileVersion = 1;
+
+static bool IsProgramBinaryFileHeaderValid(const GLProgramBinaryFileHeader& header, std::uint64_t key)
+{
+    return
+    (
+        ::memcmp(header.magic, "LGPB", 4) == 0  &&
+        header.version      == g_programBinaryFileVersion &&
+        header.key          == key &&
+        header.binaryLength >  0
+    );
+}
+
+GLProgramBinaryCache& GLProgramBinaryCache::Get()
+{
+    static GLProgramBinaryCache instance;
+    return instance;
+}
+
+void GLProgramBinaryCache::Open(const std::string& directory)
+{
+    Clear();
+
+    #ifdef GL_ARB_get_program_binary
+    /* Program binaries are only supported if there is at least one binary format */
+    if (directory.empty() || !HasExtension(GLExt::ARB_get_program_binary))
+        return;
+
+    GLint numBinaryFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numBinaryFormats);
+    if (numBinaryFormats <= 0)
+        return;
+
+    /* Store directory with trailing path separator */
+    directory_ = directory;
+    if (directory_.back() != '/' && directory_.back() != '\\')
+        directory_ += '/';
+
+    /* Binaries are only compatible with the same driver, so the renderer and version strings are part of every key */
+    driverHash_ = GLHashString(reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    driverHash_ = GLHashString(reinterpret_cast<const char*>(glGetString(GL_VERSION)), driverHash_);
+    #endif // /GL_ARB_get_program_binary
+}
+
+void GLProgramBinaryCache::Clear()
+{
+    directory_.clear();
+    driverHash_ = 0;
+}
+
+std::uint64_t GLProgramBinaryCache::GetProgramKey(std::uint64_t programHash) const
+{
+    return GLHashBytes(&programHash, sizeof(programHash), driverHash_);
+}
+
+bool GLProgramBinaryCache::LoadProgram(std::uint64_t key, GLuint program)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    if (!IsEnabled())
+        return false;
+
+    std::ifstream file{ GetFilename(key), std::ios::in | std::ios::binary };
+    if (!file.good())
+        return false;
+
+    /* Read and validate header */
+    GLProgramBinaryFileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || !IsProgramBinaryFileHeaderValid(header, key))
+        return false;
+
+    /* Read program binary */
+    DynamicByteArray binary{ header.binaryLength, UninitializeTag{} };
+    if (!file.read(binary.get(), static_cast<std::streamsize>(header.binaryLength)))
+        return false;
+
+    /* Load program binary into GL object; This fails if the driver rejects the binary format */
+    glProgramBinary(program, static_cast<GLenum>(header.binaryFormat), binary.get(), static_cast<GLsizei>(header.binaryLength));
+
+    GLint status = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+
+    return (status != GL_FALSE);
+
+    #else // GL_ARB_get_program_binary
+
+    return false;
+
+    #endif // /GL_ARB_get_program_binary
+}
+
+bool GLProgramBinaryCache::StoreProgram(std::uint64_t key, GLuint program)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    if (!IsEnabled())
+        return false;
+
+    /* Only store successfully linked programs */
+    GLint status = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+        return false;
+
+    /* Retrieve program binary */
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0)
+        return false;
+
+    DynamicByteArray binary{ static_cast<std::size_t>(binaryLength), UninitializeTag{} };
+
+    GLsizei writtenLength = 0;
+    GLenum binaryFormat = 0;
+    glGetProgramBinary(program, binaryLength, &writtenLength, &binaryFormat, binary.get());
+    if (writtenLength != binaryLength)
+        return false;
+
+    /* Write header and binary into a temporary file first, so concurrent processes never read partially written entries */
+    GLProgramBinaryFileHeader header;
+    {
+        ::memcpy(header.magic, "LGPB", 4);
+        header.version      = g_programBinaryFileVersion;
+        header.key          = key;
+        header.binaryFormat = static_cast<std::uint32_t>(binaryFormat);
+        header.binaryLength = static_cast<std::uint32_t>(binaryLength);
+    }
+
+    const std::string filename      = GetFilename(key);
+    const std::string tempFilename  = GetTempFilename(filename);
+    {
+        std::ofstream file{ tempFilename, std::ios::out | std::ios::binary | std::ios::trunc };
+        if (!file.good())
+            return false;
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.get(), static_cast<std::streamsize>(binaryLength));
+
+        if (!file.good())
+        {
+            file.close();
+            ::remove(tempFilename.c_str());
+            return false;
+        }
+    }
+
+    /* Replace previous entry, e.g. if it was rejected by the driver */
+    ::remove(filename.c_str());
+    if (::rename(tempFilename.c_str(), filename.c_str()) != 0)
+    {
+        ::remove(tempFilename.c_str());
+        return false;
+    }
+
+    return true;
+
+    #else // GL_ARB_get_program_binary
+
+    return false;
+
+    #endif // /GL_ARB_get_program_binary
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::string GLProgramBinaryCache::GetFilename(std::uint64_t key) const
+{
+    char keyStr[17];
+    ::snprintf(keyStr, sizeof(keyStr), "%016llx", static_cast<unsigned long long>(key));
+    return directory_ + keyStr + ".glbin";
+}
+
+std::string GLProgramBinaryCache::GetTempFilename(const std::string& filename)
+{
+    /* Make temporary filename unique across threads with a counter and across processes with a random tag, so concurrent writers never share a file */
+    static const std::uint32_t          processTag = static_cast<std::uint32_t>(std::random_device{}());
+    static std::atomic<std::uint32_t>   counter{ 0 };
+
+    char suffixStr[32];
+    ::snprintf(suffixStr, sizeof(suffixStr), ".%08x-%u.tmp", processTag, counter.fetch_add(1));
+    return filename + suffixStr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
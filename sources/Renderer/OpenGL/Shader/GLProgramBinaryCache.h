@@ -0,0 +1,91 @@
+/*
+ * GLProgramBinaryCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_PROGRAM_BINARY_CACHE_H
+#define LLGL_GL_PROGRAM_BINARY_CACHE_H
+
+
+#include "../OpenGL.h"
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Returns the 64-bit FNV-1a hash of the specified bytes, continuing from the specified hash value.
+std::uint64_t GLHashBytes(const void* data, std::size_t size, std::uint64_t hash = 0xCBF29CE484222325ull);
+
+// Returns the 64-bit FNV-1a hash of the specified null-terminated string, continuing from the specified hash value.
+std::uint64_t GLHashString(const char* str, std::uint64_t hash = 0xCBF29CE484222325ull);
+
+/*
+Singleton for the global GL program binary cache (see RendererConfigurationOpenGL::programBinaryCacheDir).
+Each program binary is stored in a separate file whose name is derived from the program key.
+The key is computed by the caller from all shader sources and combined with the GL renderer and version strings of this cache,
+so a driver update invalidates all previous entries.
+*/
+class GLProgramBinaryCache
+{
+
+    public:
+
+        GLProgramBinaryCache(const GLProgramBinaryCache&) = delete;
+        GLProgramBinaryCache& operator = (const GLProgramBinaryCache&) = delete;
+
+        // Returns the instance of this cache.
+        static GLProgramBinaryCache& Get();
+
+        // Enables this cache with the specified directory. Must be called with an active GL context.
+        void Open(const std::string& directory);
+
+        // Disables this cache (used by GLRenderSystem).
+        void Clear();
+
+        // Returns the final key for the specified program key by combining it with the GL renderer and version.
+        std::uint64_t GetProgramKey(std::uint64_t programHash) const;
+
+        // Loads the program binary with the specified key into the GL program. Returns false if there is no valid entry for the key.
+        bool LoadProgram(std::uint64_t key, GLuint program);
+
+        // Stores the binary of the specified linked GL program with the specified key. Returns false if the binary could not be retrieved or written.
+        bool StoreProgram(std::uint64_t key, GLuint program);
+
+        // Returns true if this cache is enabled.
+        inline bool IsEnabled() const
+        {
+            return !directory_.empty();
+        }
+
+    private:
+
+        GLProgramBinaryCache() = default;
+
+        // Returns the filename for the specified key.
+        std::string GetFilename(std::uint64_t key) const;
+
+        // Returns a unique temporary filename for the specified cache entry filename.
+        static std::string GetTempFilename(const std::string& filename);
+
+    private:
+
+        std::string     directory_;             // Cache directory including trailing path separator; Empty if this cache is disabled.
+        std::uint64_t   driverHash_     = 0;    // Hash of GL_RENDERER and GL_VERSION strings.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
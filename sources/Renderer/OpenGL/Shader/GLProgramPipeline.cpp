@@ -97,6 +97,17 @@ void GLProgramPipeline::QueryInfoLogs(Report& report)
     report.Reset(std::move(log), hasErrors);
 }
 
+bool GLProgramPipeline::QueryCompletionStatus() const
+{
+    /* Separable shaders are linked when they are created, so there is nothing to wait for */
+    return true;
+}
+
+void GLProgramPipeline::FinalizeLink()
+{
+    // dummy
+}
+
 
 /*
  * ======= Private: =======
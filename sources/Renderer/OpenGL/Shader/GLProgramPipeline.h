@@ -33,6 +33,8 @@ class GLProgramPipeline final : public GLShaderPipeline
         void Bind(GLStateManager& stateMngr) override;
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout) override;
         void QueryInfoLogs(Report& report) override;
+        bool QueryCompletionStatus() const override;
+        void FinalizeLink() override;
 
     private:
 
@@ -168,7 +168,7 @@ void GLShader::PatchShaderSourceWithOptions(
     }
 }
 
-void GLShader::ReportStatusAndLog(bool status, const std::string& log)
+void GLShader::ReportStatusAndLog(bool status, const std::string& log) const
 {
     ResetReportWithNewline(report_, log.c_str(), !status);
 }
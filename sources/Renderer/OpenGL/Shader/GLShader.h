@@ -14,6 +14,7 @@
 #include "../OpenGL.h"
 #include "../../../Core/LinearStringContainer.h"
 #include <functional>
+#include <cstdint>
 
 
 namespace LLGL
@@ -77,6 +78,12 @@ class GLShader : public Shader
             return (id_[permutation] != 0 ? id_[permutation] : id_[PermutationDefault]);
         }
 
+        // Returns the hash of the shader source for the specified permutation or the default permutation if the specified one is not available.
+        inline std::uint64_t GetSourceHash(Permutation permutation) const
+        {
+            return (id_[permutation] != 0 ? sourceHash_[permutation] : sourceHash_[PermutationDefault]);
+        }
+
         // Returns true if this is a separable shader, i.e. of type <GLSeparableShader>. Otherwise, it's of type <GLLegacyShader>.
         inline bool IsSeparable() const
         {
@@ -113,8 +120,8 @@ class GLShader : public Shader
 
         GLShader(const bool isSeparable, const ShaderDescriptor& desc);
 
-        // Resets the report with the specified compile/link status and log.
-        void ReportStatusAndLog(bool status, const std::string& log);
+        // Resets the report with the specified compile/link status and log. This is const, since the status might be queried lazily; See GLLegacyShader::GetReport().
+        void ReportStatusAndLog(bool status, const std::string& log) const;
 
         // Stores the native shader ID.
         inline void SetID(GLuint id, Permutation permutation = PermutationDefault)
@@ -122,6 +129,12 @@ class GLShader : public Shader
             id_[permutation] = id;
         }
 
+        // Stores the hash of the shader source that was passed to the GL for the specified permutation. Used for the program binary cache.
+        inline void SetSourceHash(std::uint64_t hash, Permutation permutation = PermutationDefault)
+        {
+            sourceHash_[permutation] = hash;
+        }
+
     private:
 
         void ReserveAttribs(const ShaderDescriptor& desc);
@@ -133,11 +146,12 @@ class GLShader : public Shader
 
         const bool                      isSeparable_;
         GLuint                          id_[PermutationCount]       = {}; // ID from either glCreateShader or glCreateShaderProgramv
+        std::uint64_t                   sourceHash_[PermutationCount] = {}; // Hash of the final source or binary that was passed to the GL
         LinearStringContainer           shaderAttribNames_;
         std::vector<GLShaderAttribute>  shaderAttribs_;
         std::size_t                     numVertexAttribs_           = 0;
         std::vector<const char*>        transformFeedbackVaryings_;
-        Report                          report_;
+        mutable Report                  report_;
 
 };
 
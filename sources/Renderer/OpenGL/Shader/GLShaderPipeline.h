@@ -21,6 +21,7 @@ namespace LLGL
 class GLShaderPipeline;
 class GLShaderBindingLayout;
 class GLStateManager;
+class GLUniformCache;
 class Report;
 
 using GLShaderPipelineSPtr = std::shared_ptr<GLShaderPipeline>;
@@ -42,12 +43,39 @@ class GLShaderPipeline
         // Resets the output report with the shader info logs.
         virtual void QueryInfoLogs(Report& report) = 0;
 
+        // Returns true if the driver has finished linking this pipeline, i.e. querying its status will not block; See GL_KHR_parallel_shader_compile.
+        virtual bool QueryCompletionStatus() const = 0;
+
+        // Performs the work that was deferred until this pipeline has been linked, e.g. storing the program binary in the global cache.
+        virtual void FinalizeLink() = 0;
+
         // Returns the native pipeline ID. Can be either from glCreateProgramPipelines or glCreateProgram.
         inline GLuint GetID() const
         {
             return id_;
         }
 
+        // Stores the uniform cache that has last written the uniform values of this pipeline and returns the previous one.
+        inline const GLUniformCache* ExchangeUniformCacheOwner(const GLUniformCache* owner)
+        {
+            const GLUniformCache* prevOwner = uniformCacheOwner_;
+            uniformCacheOwner_ = owner;
+            return prevOwner;
+        }
+
+        /*
+        Stores the binding point that is assigned to the uniform block of packed uniforms and returns true if it has changed.
+        The block is identified by its index in the default shader permutation, since it's shared between all permutations of the same PSO.
+        */
+        inline bool ExchangePackedUniformBlockBinding(GLint blockIndex, GLuint blockBinding)
+        {
+            if (packedBlockIndex_ == blockIndex && packedBlockBinding_ == blockBinding)
+                return false;
+            packedBlockIndex_   = blockIndex;
+            packedBlockBinding_ = blockBinding;
+            return true;
+        }
+
     public:
 
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
@@ -78,8 +106,11 @@ class GLShaderPipeline
 
     private:
 
-        GLuint              id_         = 0; // ID from either glCreateProgramPipelines or glCreateProgram.
-        GLPipelineSignature signature_;
+        GLuint                  id_                 = 0;        // ID from either glCreateProgramPipelines or glCreateProgram.
+        GLPipelineSignature     signature_;
+        const GLUniformCache*   uniformCacheOwner_  = nullptr;  // Uniform cache whose shadow copy matches the uniform values of this pipeline.
+        GLint                   packedBlockIndex_   = -1;       // Uniform block of packed uniforms that has been bound with glUniformBlockBinding.
+        GLuint                  packedBlockBinding_ = 0;
 
 };
 
@@ -8,6 +8,7 @@
 #include "GLShaderProgram.h"
 #include "GLLegacyShader.h"
 #include "GLShaderBindingLayout.h"
+#include "GLProgramBinaryCache.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../RenderState/GLStateManager.h"
@@ -99,6 +100,19 @@ GLShaderProgram::GLShaderProgram(
             pipelineCache->GetProgramBinary(permutation, GetID());
         }
     }
+    else if (GLProgramBinaryCache::Get().IsEnabled())
+    {
+        /* Try to load program binary from global cache directory */
+        GLProgramBinaryCache& binaryCache = GLProgramBinaryCache::Get();
+        const std::uint64_t key = binaryCache.GetProgramKey(GLShaderProgram::HashProgramSources(numShaders, shaders, permutation));
+        if (!binaryCache.LoadProgram(key, GetID()))
+        {
+            /* Store program binary when the program is used the first time, so the link can complete asynchronously; See FinalizeLink() */
+            BuildProgramBinary(numShaders, shaders, permutation, /*retrievableBinary:*/ true);
+            binaryCacheKey_         = key;
+            isBinaryCachePending_   = true;
+        }
+    }
     else
         BuildProgramBinary(numShaders, shaders, permutation);
 
@@ -137,6 +151,20 @@ void GLShaderProgram::QueryInfoLogs(Report& report)
     report.Reset(std::move(log), hasErrors);
 }
 
+bool GLShaderProgram::QueryCompletionStatus() const
+{
+    return GLShaderProgram::GetCompletionStatus(GetID());
+}
+
+void GLShaderProgram::FinalizeLink()
+{
+    if (isBinaryCachePending_)
+    {
+        GLProgramBinaryCache::Get().StoreProgram(binaryCacheKey_, GetID());
+        isBinaryCachePending_ = false;
+    }
+}
+
 bool GLShaderProgram::GetLinkStatus(GLuint program)
 {
     GLint status = 0;
@@ -144,6 +172,19 @@ bool GLShaderProgram::GetLinkStatus(GLuint program)
     return (status != GL_FALSE);
 }
 
+bool GLShaderProgram::GetCompletionStatus(GLuint program)
+{
+    #ifdef LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+    {
+        GLint status = 0;
+        glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &status);
+        return (status != GL_FALSE);
+    }
+    #endif // /LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    return true;
+}
+
 std::string GLShaderProgram::GetGLProgramLog(GLuint program)
 {
     /* Query info log length */
@@ -888,10 +929,54 @@ static void AttachGLLegacyShaders(
     }
 }
 
-void GLShaderProgram::BuildProgramBinary(
+static std::uint64_t HashShaderAttribs(std::size_t numAttribs, const GLShaderAttribute* attribs, std::uint64_t hash)
+{
+    for_range(i, numAttribs)
+    {
+        hash = GLHashBytes(&(attribs[i].index), sizeof(attribs[i].index), hash);
+        hash = GLHashString(attribs[i].name, hash);
+    }
+    return hash;
+}
+
+std::uint64_t GLShaderProgram::HashProgramSources(
     std::size_t             numShaders,
     const Shader* const*    shaders,
     GLShader::Permutation   permutation)
+{
+    std::uint64_t hash = GLHashBytes(&permutation, sizeof(permutation));
+
+    for_range(i, numShaders)
+    {
+        if (const Shader* shader = shaders[i])
+        {
+            /* Hash shader type and both permutations, since the permutation of each shader depends on the entire pipeline */
+            auto shaderGL = LLGL_CAST(const GLShader*, shader);
+            const GLenum        type            = shaderGL->GetGLType();
+            const std::uint64_t sourceHashes[2] =
+            {
+                shaderGL->GetSourceHash(GLShader::PermutationDefault),
+                shaderGL->GetSourceHash(GLShader::PermutationFlippedYPosition),
+            };
+            hash = GLHashBytes(&type, sizeof(type), hash);
+            hash = GLHashBytes(sourceHashes, sizeof(sourceHashes), hash);
+
+            /* Hash attribute and varying names, since they are bound before the program is linked */
+            hash = HashShaderAttribs(shaderGL->GetNumVertexAttribs(), shaderGL->GetVertexAttribs(), hash);
+            hash = HashShaderAttribs(shaderGL->GetNumFragmentAttribs(), shaderGL->GetFragmentAttribs(), hash);
+            for (const char* varying : shaderGL->GetTransformFeedbackVaryings())
+                hash = GLHashString(varying, hash);
+        }
+    }
+
+    return hash;
+}
+
+void GLShaderProgram::BuildProgramBinary(
+    std::size_t             numShaders,
+    const Shader* const*    shaders,
+    GLShader::Permutation   permutation,
+    bool                    retrievableBinary)
 {
     GLOrderedShaders orderedShaders;
 
@@ -931,6 +1016,12 @@ void GLShaderProgram::BuildProgramBinary(
     if (const GLShader* fs = orderedShaders.fragmentShader)
         GLShaderProgram::BindFragDataLocations(GetID(), fs->GetNumFragmentAttribs(), fs->GetFragmentAttribs());
 
+    #ifdef GL_ARB_get_program_binary
+    /* Hint the driver that the program binary will be retrieved after linking */
+    if (retrievableBinary)
+        glProgramParameteri(GetID(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    #endif
+
     /* Build transform feedback varyings for vertex or geometry shader and link program */
     const GLShader* shaderWithVaryings = nullptr;
 
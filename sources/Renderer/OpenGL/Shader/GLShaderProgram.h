@@ -30,6 +30,8 @@ class GLShaderProgram final : public GLShaderPipeline
         void Bind(GLStateManager& stateMngr) override;
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout) override;
         void QueryInfoLogs(Report& report) override;
+        bool QueryCompletionStatus() const override;
+        void FinalizeLink() override;
 
     public:
 
@@ -46,6 +48,9 @@ class GLShaderProgram final : public GLShaderPipeline
         // Returns true if the native GL shader program was linked successfully.
         static bool GetLinkStatus(GLuint program);
 
+        // Returns true if the driver has finished linking the native GL shader program. Always true if GL_KHR_parallel_shader_compile is not supported.
+        static bool GetCompletionStatus(GLuint program);
+
         // Returns the native GL shader program log.
         static std::string GetGLProgramLog(GLuint program);
 
@@ -64,18 +69,28 @@ class GLShaderProgram final : public GLShaderPipeline
         // Queries the shader reflection for the specified program.
         static void QueryReflection(GLuint program, GLenum shaderStage, ShaderReflection& reflection);
 
+        // Returns a hash of all inputs that determine the program binary of the specified shaders. Used for the program binary cache.
+        static std::uint64_t HashProgramSources(
+            std::size_t             numShaders,
+            const Shader* const*    shaders,
+            GLShader::Permutation   permutation
+        );
+
     private:
 
         // Main function for constructor to attach shaders, build attributes, and link program.
         void BuildProgramBinary(
             std::size_t             numShaders,
             const Shader* const*    shaders,
-            GLShader::Permutation   permutation
+            GLShader::Permutation   permutation,
+            bool                    retrievableBinary   = false
         );
 
     private:
 
         const GLShaderBindingLayout*    bindingLayout_          = nullptr;
+        std::uint64_t                   binaryCacheKey_         = 0;        // Key for the global program binary cache; Only valid if 'isBinaryCachePending_' is true.
+        bool                            isBinaryCachePending_   = false;    // Program binary must be stored in the global cache once the program has been linked.
 
         #ifdef __APPLE__
         bool                            hasNullFragmentShader_  = false;
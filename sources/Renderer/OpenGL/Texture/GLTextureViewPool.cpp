@@ -37,6 +37,8 @@ GLTextureViewPool& GLTextureViewPool::Get()
 
 void GLTextureViewPool::Clear()
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Delete all texture view GL objects and clear container */
     for (const auto& texView : textureViews_)
     {
@@ -54,6 +56,8 @@ GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureVie
     if (!HasExtension(GLExt::ARB_texture_view))
         return 0;
 
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Compress texture view descriptor for faster comparison and sorting */
     GLTextureView texView;
     {
@@ -95,6 +99,8 @@ GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureVie
 
 void GLTextureViewPool::ReleaseTextureView(GLuint texID)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Try to find texture by GL texture ID only */
     std::size_t insertionIndex = 0;
     GLTextureView* sharedTexView = FindInSortedArray<GLTextureView>(
@@ -121,6 +127,9 @@ void GLTextureViewPool::ReleaseTextureView(GLuint texID)
 
 void GLTextureViewPool::NotifyTextureRelease(GLuint sourceTexID)
 {
+    /* Textures can be released on loader threads, see GLRenderSystem::BeginLoaderThread */
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Move all objects that are about to be removed at the end of the list using 'std::remove' */
     auto it = std::remove_if(
         textureViews_.begin(),
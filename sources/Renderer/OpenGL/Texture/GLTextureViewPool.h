@@ -12,6 +12,7 @@
 #include <LLGL/TextureFlags.h>
 #include <cstdint>
 #include <vector>
+#include <mutex>
 #include "../OpenGL.h"
 #include "../../TextureUtils.h"
 
@@ -98,6 +99,9 @@ class GLTextureViewPool
         // Number of textures that are already freed, but not removed from the texture view array yet.
         std::size_t                 numReusableEntries_ = 0;
 
+        // Guards the texture view list, since GL textures can be released on loader threads.
+        std::mutex                  mutex_;
+
 };
 
 
@@ -12,6 +12,7 @@
 #include "../Core/Exception.h"
 #include "../Core/StringUtils.h"
 #include "RenderTargetUtils.h"
+#include "TextureUtils.h"
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Format.h>
@@ -44,13 +45,25 @@ namespace LLGL
 
 /* ----- Render system ----- */
 
+// Texture readback request for backends without asynchronous readback; the texture is read when the request is created.
+struct DeferredTextureRead
+{
+    DynamicByteArray    data;
+    ImageFormat         format      = ImageFormat::RGBA;
+    DataType            dataType    = DataType::UInt8;
+    std::uint32_t       numTexels   = 0;
+    std::uint32_t       rowLength   = 0;
+};
+
 struct RenderSystem::Pimpl
 {
-    int                     rendererID = 0;
-    std::string             name;
-    RendererInfo            info;
-    RenderingCapabilities   caps;
-    Report                  report;
+    int                                                         rendererID = 0;
+    std::string                                                 name;
+    RendererInfo                                                info;
+    RenderingCapabilities                                       caps;
+    Report                                                      report;
+    std::uint64_t                                               nextTextureReadID   = 1;
+    std::unordered_map<std::uint64_t, DeferredTextureRead>      textureReads;
 };
 
 static std::unordered_map<RenderSystem*, std::unique_ptr<Module>> g_renderSystemModules;
@@ -337,6 +350,76 @@ const Report* RenderSystem::GetReport() const
     return (pimpl_->report ? &(pimpl_->report) : nullptr);
 }
 
+CommandQueue* RenderSystem::GetDedicatedCommandQueue(const CommandQueueType type)
+{
+    /* By default, only the graphics command queue is available */
+    return (type == CommandQueueType::Graphics ? GetCommandQueue() : nullptr);
+}
+
+std::uint64_t RenderSystem::RequestTextureRead(Texture& texture, const TextureRegion& textureRegion)
+{
+    /* Determine size of texture region in the native texture format */
+    const Format        format      = texture.GetFormat();
+    const Extent3D      extent      = CalcTextureExtent(texture.GetType(), textureRegion.extent, textureRegion.subresource.numArrayLayers);
+    const std::uint32_t numTexels   = extent.width * extent.height * extent.depth;
+    const std::size_t   dataSize    = GetMemoryFootprint(format, numTexels);
+
+    /* Read texture synchronously into an intermediate buffer, so the result reflects the texture content at the time of this request */
+    const auto& formatAttribs = GetFormatAttribs(format);
+
+    DeferredTextureRead request;
+    {
+        request.data        = DynamicByteArray{ dataSize, UninitializeTag{} };
+        request.format      = formatAttribs.format;
+        request.dataType    = formatAttribs.dataType;
+        request.numTexels   = numTexels;
+        request.rowLength   = extent.width;
+    }
+    ReadTexture(texture, textureRegion, MutableImageView{ request.format, request.dataType, request.data.get(), dataSize });
+
+    const std::uint64_t requestID = pimpl_->nextTextureReadID++;
+    pimpl_->textureReads[requestID] = std::move(request);
+    return requestID;
+}
+
+bool RenderSystem::ResolveTextureRead(std::uint64_t requestID, const MutableImageView& dstImageView, bool /*wait*/)
+{
+    auto it = pimpl_->textureReads.find(requestID);
+    if (it == pimpl_->textureReads.end())
+        return false;
+
+    /* Copy (and convert) intermediate data into the output image and release request */
+    LLGL_ASSERT_PTR(dstImageView.data);
+    const DeferredTextureRead& request = it->second;
+    const ImageView srcImageView{ request.format, request.dataType, request.data.get(), request.data.size() };
+    CopyTextureImageData(dstImageView, srcImageView, request.numTexels, request.rowLength);
+    pimpl_->textureReads.erase(it);
+
+    return true;
+}
+
+bool RenderSystem::BeginLoaderThread()
+{
+    /* By default, resources can only be created on the rendering thread */
+    return false;
+}
+
+void RenderSystem::EndLoaderThread()
+{
+    // dummy
+}
+
+void RenderSystem::FlushLoaderThread()
+{
+    // dummy
+}
+
+std::uint32_t RenderSystem::GetBindlessIndex(Resource& /*resource*/)
+{
+    /* By default, resources cannot be accessed as bindless resources */
+    return LLGL_INVALID_BINDLESS_INDEX;
+}
+
 
 /*
  * ======= Protected: =======
@@ -461,34 +544,26 @@ std::size_t RenderSystem::CopyTextureImageData(
 
     if (srcImageView.format != dstImageView.format || srcImageView.dataType != dstImageView.dataType)
     {
-        /* Check if padding must be removed */
-        const void* data = srcImageView.data;
-
-        DynamicByteArray unpaddedData;
-        if (rowStride != 0 && unpaddedStride != rowStride)
-        {
-            unpaddedData = DynamicByteArray{ unpaddedImageSize, UninitializeTag{} };
-            CopyRowAlignedData(unpaddedData.get(), unpaddedImageSize, unpaddedStride, data, rowStride);
-            data = unpaddedData.get();
-        }
-
         /* Determine destination image size */
         const std::size_t dstImageSize = GetMemoryFootprint(dstImageView.format, dstImageView.dataType, numTexels);
 
         /* Validate input size */
         RenderSystem::AssertImageDataSize(dstImageView.dataSize, dstImageSize);
 
-        /* Convert mapped data into requested format */
-        DynamicByteArray formattedData = ConvertImageBuffer(
-            ImageView{ srcImageView.format, srcImageView.dataType, data, unpaddedImageSize },
-            dstImageView.format,
-            dstImageView.dataType,
+        /* Convert mapped data straight into the output buffer and remove the row padding in the same pass */
+        const std::size_t numRows       = (numTexelsInRow > 0 ? numTexels / numTexelsInRow : 0);
+        const std::size_t srcStride     = (rowStride != 0 ? rowStride : unpaddedStride);
+        const std::size_t srcDataSize   = (numRows > 0 ? (numRows - 1) * srcStride + unpaddedStride : 0);
+
+        ConvertImageBuffer(
+            ImageView{ srcImageView.format, srcImageView.dataType, srcImageView.data, srcDataSize },
+            rowStride,
+            MutableImageView{ dstImageView.format, dstImageView.dataType, dstImageView.data, dstImageSize },
+            0,
+            numTexelsInRow,
             LLGL_MAX_THREAD_COUNT
         );
 
-        /* Copy temporary data into output buffer */
-        ::memcpy(dstImageView.data, formattedData.get(), dstImageSize);
-
         return dstImageSize;
     }
     else
@@ -100,6 +100,8 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"   );
     LLGL_VALIDATE_FEATURE( hasPipelineStatistics,        "query pipeline statistics"   );
     LLGL_VALIDATE_FEATURE( hasRenderCondition,           "conditional rendering"       );
+    LLGL_VALIDATE_FEATURE( hasBindlessResources,         "bindless resources"          );
+    LLGL_VALIDATE_FEATURE( hasIndirectDrawCount,         "indirect draw count"         );
 
     #undef LLGL_VALIDATE_FEATURE
 
@@ -7,10 +7,16 @@
 
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/Log.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/TypeNames.h>
+#include <LLGL/Utils/ForRange.h>
 #include <LLGL/Container/Strings.h>
 #include "../Core/StringUtils.h"
+#include <algorithm>
 #include <map>
+#include <mutex>
+#include <atomic>
+#include <stdio.h>
 
 
 namespace LLGL
@@ -36,14 +42,148 @@ struct CompareStringLess
 template <typename T>
 using UTF8StringMap = std::map<UTF8String, T, CompareStringLess>;
 
+// Reserved track ID for the GPU timeline in trace files; CPU thread IDs start at 1.
+static constexpr std::uint32_t g_traceGPUTrackID = 0;
+
+// Writes time records into a JSON file in the Chrome Trace Event Format.
+class TraceWriter
+{
+
+    public:
+
+        TraceWriter() = default;
+        TraceWriter(const TraceWriter&) = delete;
+        TraceWriter& operator = (const TraceWriter&) = delete;
+
+        ~TraceWriter()
+        {
+            Close();
+        }
+
+        bool Open(const char* filename)
+        {
+            Close();
+
+            if (filename == nullptr)
+                return false;
+
+            file_ = ::fopen(filename, "w");
+            if (file_ == nullptr)
+                return false;
+
+            startTicks_     = Timer::Tick();
+            tickFrequency_  = static_cast<double>(Timer::Frequency());
+            gpuCursor_      = 0.0;
+            numEvents_      = 0;
+
+            ::fprintf(file_, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+            WriteEventHeader("thread_name", 'M', g_traceGPUTrackID);
+            ::fprintf(file_, ",\"args\":{\"name\":\"GPU\"}}");
+
+            return true;
+        }
+
+        void Close()
+        {
+            if (file_ != nullptr)
+            {
+                ::fprintf(file_, "\n]}\n");
+                ::fclose(file_);
+                file_ = nullptr;
+            }
+        }
+
+        void WriteFrame(const DynamicVector<ProfileTimeRecord>& records)
+        {
+            if (file_ == nullptr)
+                return;
+
+            for_range(i, records.size())
+            {
+                const ProfileTimeRecord& rec = records[i];
+
+                /* Write CPU event on the track of the thread that recorded it */
+                const double cpuStart = TicksToMicroseconds(rec.cpuTicksStart);
+                const double cpuEnd = TicksToMicroseconds(rec.cpuTicksEnd);
+                WriteDurationEvent(rec.annotation, rec.threadID, cpuStart, cpuEnd - cpuStart);
+
+                /* Write GPU event; top-level records can't start on the GPU before they were encoded on the CPU */
+                if (rec.elapsedTime > 0)
+                {
+                    if (rec.nestingLevel == 0)
+                        gpuCursor_ = std::max(gpuCursor_, cpuStart);
+
+                    const double gpuDuration = static_cast<double>(rec.elapsedTime) / 1000.0;
+                    WriteDurationEvent(rec.annotation, g_traceGPUTrackID, gpuCursor_, gpuDuration);
+
+                    /* Only leaf records advance the GPU timeline; debug groups enclose their children */
+                    const bool isGroup = (i + 1 < records.size() && records[i + 1].nestingLevel > rec.nestingLevel);
+                    if (!isGroup)
+                        gpuCursor_ += gpuDuration;
+                }
+            }
+
+            /* Write frame marker */
+            WriteEventHeader("Frame", 'i', 0);
+            ::fprintf(file_, ",\"s\":\"g\",\"ts\":%.3f}", TicksToMicroseconds(Timer::Tick()));
+
+            ::fflush(file_);
+        }
+
+        bool IsOpen() const
+        {
+            return (file_ != nullptr);
+        }
+
+    private:
+
+        double TicksToMicroseconds(std::uint64_t ticks) const
+        {
+            const std::int64_t relativeTicks = static_cast<std::int64_t>(ticks - startTicks_);
+            return static_cast<double>(relativeTicks) * 1000000.0 / tickFrequency_;
+        }
+
+        void WriteEventHeader(const char* name, char phase, std::uint32_t trackID)
+        {
+            ::fprintf(file_, (numEvents_++ > 0 ? ",\n{\"name\":\"" : "{\"name\":\""));
+            for (const char* c = name; *c != '\0'; ++c)
+            {
+                if (*c == '\"' || *c == '\\')
+                    ::fputc('\\', file_);
+                if (static_cast<unsigned char>(*c) >= 0x20)
+                    ::fputc(*c, file_);
+            }
+            ::fprintf(file_, "\",\"ph\":\"%c\",\"pid\":1,\"tid\":%u", phase, trackID);
+        }
+
+        void WriteDurationEvent(const char* name, std::uint32_t trackID, double start, double duration)
+        {
+            WriteEventHeader(name, 'X', trackID);
+            ::fprintf(file_, ",\"ts\":%.3f,\"dur\":%.3f}", start, duration);
+        }
+
+    private:
+
+        FILE*           file_           = nullptr;
+        std::uint64_t   startTicks_     = 0;
+        double          tickFrequency_  = 1.0;
+        double          gpuCursor_      = 0.0;
+        std::size_t     numEvents_      = 0;
+
+};
+
 struct RenderingDebugger::Pimpl
 {
     UTF8StringMap<Message>  errors;
     UTF8StringMap<Message>  warnings;
     FrameProfile            frameProfile;
-    const char*             source          = "";
-    const char*             groupName       = "";
-    bool                    isTimeRecording = false;
+    TraceWriter             traceWriter;
+    ValidationSampling      validationSampling;
+    LoadStoreAnalysis       loadStoreAnalysis   = LoadStoreAnalysis::Disabled;
+    std::atomic<const char*> source             { "" }; // Atomic instead of guarded by the message mutex, since it is set for every recorded command
+    const char*             groupName           = "";
+    bool                    isTimeRecording     = false;
+    std::recursive_mutex    messageMutex;       // Guards messages, since loader threads can report errors concurrently
 };
 
 
@@ -59,7 +199,7 @@ RenderingDebugger::~RenderingDebugger()
 
 void RenderingDebugger::SetSource(const char* source)
 {
-    pimpl_->source = (source != nullptr ? source : "");
+    pimpl_->source.store((source != nullptr ? source : ""), std::memory_order_relaxed);
 }
 
 void RenderingDebugger::SetDebugGroup(const char* name)
@@ -77,6 +217,39 @@ bool RenderingDebugger::GetTimeRecording() const
     return pimpl_->isTimeRecording;
 }
 
+void RenderingDebugger::SetValidationSampling(const ValidationSampling& sampling)
+{
+    pimpl_->validationSampling = sampling;
+}
+
+const ValidationSampling& RenderingDebugger::GetValidationSampling() const
+{
+    return pimpl_->validationSampling;
+}
+
+void RenderingDebugger::SetLoadStoreAnalysis(const LoadStoreAnalysis mode)
+{
+    pimpl_->loadStoreAnalysis = mode;
+}
+
+LoadStoreAnalysis RenderingDebugger::GetLoadStoreAnalysis() const
+{
+    return pimpl_->loadStoreAnalysis;
+}
+
+bool RenderingDebugger::BeginTrace(const char* filename)
+{
+    if (!pimpl_->traceWriter.Open(filename))
+        return false;
+    SetTimeRecording(true);
+    return true;
+}
+
+void RenderingDebugger::EndTrace()
+{
+    pimpl_->traceWriter.Close();
+}
+
 void RenderingDebugger::Errorf(const ErrorType type, const char* format, ...)
 {
     /* Print formatted string */
@@ -84,6 +257,7 @@ void RenderingDebugger::Errorf(const ErrorType type, const char* format, ...)
     LLGL_STRING_PRINTF(message, format);
 
     /* Check if there is already an entry for the exact same message */
+    std::lock_guard<std::recursive_mutex> guard{ pimpl_->messageMutex };
     auto it = pimpl_->errors.find(message);
     if (it != pimpl_->errors.end())
     {
@@ -97,7 +271,7 @@ void RenderingDebugger::Errorf(const ErrorType type, const char* format, ...)
     {
         /* Allocate new error entry */
         Message& msg = pimpl_->errors[message];
-        msg = Message{ message, pimpl_->source, pimpl_->groupName };
+        msg = Message{ message, pimpl_->source.load(std::memory_order_relaxed), pimpl_->groupName };
         OnError(type, msg);
     }
 }
@@ -109,6 +283,7 @@ void RenderingDebugger::Warningf(const WarningType type, const char* format, ...
     LLGL_STRING_PRINTF(message, format);
 
     /* Check if there is already an entry for the exact same message */
+    std::lock_guard<std::recursive_mutex> guard{ pimpl_->messageMutex };
     auto it = pimpl_->warnings.find(message);
     if (it != pimpl_->warnings.end())
     {
@@ -122,13 +297,17 @@ void RenderingDebugger::Warningf(const WarningType type, const char* format, ...
     {
         /* Allocate new warning entry */
         Message& msg = pimpl_->warnings[message];
-        msg = Message{ message, pimpl_->source, pimpl_->groupName };
+        msg = Message{ message, pimpl_->source.load(std::memory_order_relaxed), pimpl_->groupName };
         OnWarning(type, msg);
     }
 }
 
 void RenderingDebugger::FlushProfile(FrameProfile* outputProfile)
 {
+    /* Stream time records into trace file (if active) */
+    if (pimpl_->traceWriter.IsOpen())
+        pimpl_->traceWriter.WriteFrame(pimpl_->frameProfile.timeRecords);
+
     /* Copy current counters to the output profile (if set) */
     if (outputProfile)
         *outputProfile = std::move(pimpl_->frameProfile);
@@ -17,6 +17,11 @@ Shader::Shader(const ShaderType type) :
 {
 }
 
+bool Shader::IsReady() const
+{
+    return true;
+}
+
 
 } // /namespace LLGL
 
@@ -76,7 +76,7 @@ static VkAccessFlags GetBufferVkAccessFlags(long bindFlags)
     return accessFlags;
 }
 
-VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
+VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc, const ArrayView<std::uint32_t>& queueFamilyIndices) :
     Buffer            { desc.bindFlags                         },
     bufferObj_        { device                                 },
     bufferObjStaging_ { device                                 },
@@ -86,6 +86,9 @@ VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
     if ((desc.bindFlags & BindFlags::IndexBuffer) != 0)
         indexType_ = VKTypes::ToVkIndexType(desc.format);
 
+    /* Share buffer between queue families if it can be accessed by dedicated compute or transfer queues */
+    const bool isConcurrent = (queueFamilyIndices.size() > 1);
+
     VkBufferCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -93,9 +96,9 @@ VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
         createInfo.flags                    = 0;
         createInfo.size                     = desc.size;
         createInfo.usage                    = GetVkBufferUsageFlags(desc);
-        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
-        createInfo.queueFamilyIndexCount    = 0;
-        createInfo.pQueueFamilyIndices      = nullptr;
+        createInfo.sharingMode              = (isConcurrent ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE);
+        createInfo.queueFamilyIndexCount    = (isConcurrent ? static_cast<std::uint32_t>(queueFamilyIndices.size()) : 0u);
+        createInfo.pQueueFamilyIndices      = (isConcurrent ? queueFamilyIndices.data() : nullptr);
     }
     bufferObj_.CreateVkBuffer(device, createInfo);
 }
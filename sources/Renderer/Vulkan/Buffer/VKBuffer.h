@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Buffer.h>
+#include <LLGL/Container/ArrayView.h>
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemory.h"
 
@@ -29,7 +30,7 @@ class VKBuffer : public Buffer
 
     public:
 
-        VKBuffer(VkDevice device, const BufferDescriptor& desc);
+        VKBuffer(VkDevice device, const BufferDescriptor& desc, const ArrayView<std::uint32_t>& queueFamilyIndices = {});
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
         void TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer);
@@ -0,0 +1,128 @@
+/*
+ * VKStagingBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKStagingBufferPool.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../VKInitializers.h"
+#include "../VKCore.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKStagingBufferPool::VKStagingBufferPool(VkDevice device, VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize chunkSize) :
+    device_           { device           },
+    deviceMemoryMngr_ { deviceMemoryMngr },
+    chunkSize_        { chunkSize        }
+{
+}
+
+VKStagingBufferPool::~VKStagingBufferPool()
+{
+    for (Chunk& chunk : chunks_)
+        ReleaseChunk(chunk);
+}
+
+void VKStagingBufferPool::Reset()
+{
+    /* Release chunks that have been allocated for oversized regions to not hold onto large blocks of host memory */
+    for (auto it = chunks_.begin(); it != chunks_.end();)
+    {
+        if (it->size > chunkSize_)
+        {
+            ReleaseChunk(*it);
+            it = chunks_.erase(it);
+        }
+        else
+        {
+            it->offset = 0;
+            ++it;
+        }
+    }
+    chunkIdx_ = 0;
+    usedSize_ = 0;
+}
+
+VKStagingBufferRegion VKStagingBufferPool::Allocate(VkDeviceSize size, VkDeviceSize alignment)
+{
+    LLGL_ASSERT(alignment > 0);
+
+    /* Find chunk with sufficient capacity, or allocate a new one */
+    VkDeviceSize alignedOffset = 0;
+    for (; chunkIdx_ < chunks_.size(); ++chunkIdx_)
+    {
+        const Chunk& chunk = chunks_[chunkIdx_];
+        alignedOffset = GetAlignedSize(chunk.offset, alignment);
+        if (alignedOffset + size <= chunk.size)
+            break;
+    }
+
+    if (chunkIdx_ == chunks_.size())
+    {
+        AllocChunk(size);
+        alignedOffset = 0;
+    }
+
+    /* Sub-allocate region from current chunk */
+    Chunk& chunk = chunks_[chunkIdx_];
+
+    VKStagingBufferRegion region;
+    {
+        region.buffer   = chunk.buffer.GetVkBuffer();
+        region.offset   = alignedOffset;
+        region.data     = static_cast<char*>(chunk.mappedData) + alignedOffset;
+    }
+    usedSize_       += (alignedOffset + size - chunk.offset);
+    chunk.offset    = alignedOffset + size;
+
+    return region;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKStagingBufferPool::AllocChunk(VkDeviceSize minChunkSize)
+{
+    const VkDeviceSize size = std::max(chunkSize_, minChunkSize);
+
+    VkBufferCreateInfo createInfo;
+    BuildVkBufferCreateInfo(createInfo, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    VKDeviceBuffer buffer
+    {
+        device_,
+        createInfo,
+        deviceMemoryMngr_,
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    };
+
+    /* Keep chunk mapped for its entire lifetime */
+    void* mappedData = buffer.Map(device_, 0, size);
+    LLGL_ASSERT_PTR(mappedData);
+
+    chunks_.push_back(Chunk{ std::move(buffer), mappedData, size, 0 });
+    chunkIdx_ = chunks_.size() - 1;
+}
+
+void VKStagingBufferPool::ReleaseChunk(Chunk& chunk)
+{
+    chunk.buffer.Unmap(device_);
+    chunk.buffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
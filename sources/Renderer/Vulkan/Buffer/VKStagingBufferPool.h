@@ -0,0 +1,95 @@
+/*
+ * VKStagingBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_STAGING_BUFFER_POOL_H
+#define LLGL_VK_STAGING_BUFFER_POOL_H
+
+
+#include "VKDeviceBuffer.h"
+#include "../Vulkan.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+
+// Region of a staging buffer that was allocated by VKStagingBufferPool. The memory is persistently mapped into CPU memory space.
+struct VKStagingBufferRegion
+{
+    VkBuffer        buffer  = VK_NULL_HANDLE;
+    VkDeviceSize    offset  = 0;
+    void*           data    = nullptr;
+};
+
+// Pool of persistently mapped, host-coherent staging buffers that are sub-allocated linearly.
+class VKStagingBufferPool
+{
+
+    public:
+
+        VKStagingBufferPool(VkDevice device, VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize chunkSize);
+        ~VKStagingBufferPool();
+
+        VKStagingBufferPool(const VKStagingBufferPool&) = delete;
+        VKStagingBufferPool& operator = (const VKStagingBufferPool&) = delete;
+
+        // Resets all chunks for reuse. This must only be called once the device has finished all commands that read from this pool.
+        void Reset();
+
+        // Allocates a new region of the specified size and alignment. A new chunk is allocated if the current one has insufficient capacity.
+        VKStagingBufferRegion Allocate(VkDeviceSize size, VkDeviceSize alignment);
+
+        // Returns the number of bytes that have been allocated since the last reset.
+        inline VkDeviceSize GetUsedSize() const
+        {
+            return usedSize_;
+        }
+
+        // Returns the default size of each chunk.
+        inline VkDeviceSize GetChunkSize() const
+        {
+            return chunkSize_;
+        }
+
+    private:
+
+        struct Chunk
+        {
+            VKDeviceBuffer  buffer;
+            void*           mappedData;
+            VkDeviceSize    size;
+            VkDeviceSize    offset;
+        };
+
+    private:
+
+        void AllocChunk(VkDeviceSize minChunkSize);
+        void ReleaseChunk(Chunk& chunk);
+
+    private:
+
+        VkDevice                device_             = VK_NULL_HANDLE;
+        VKDeviceMemoryManager&  deviceMemoryMngr_;
+        std::vector<Chunk>      chunks_;
+        std::size_t             chunkIdx_           = 0;
+        VkDeviceSize            chunkSize_          = 0;
+        VkDeviceSize            usedSize_           = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
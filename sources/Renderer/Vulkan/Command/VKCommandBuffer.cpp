@@ -8,6 +8,7 @@
 #include "VKCommandBuffer.h"
 #include "VKCommandQueue.h"
 #include "../VKPhysicalDevice.h"
+#include "../VKDevice.h"
 #include "../VKSwapChain.h"
 #include "../VKTypes.h"
 #include "../Ext/VKExtensionRegistry.h"
@@ -25,10 +26,13 @@
 #include "../Buffer/VKBufferArray.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
 #include <cstddef>
+#include <algorithm>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
@@ -37,8 +41,6 @@ namespace LLGL
 {
 
 
-constexpr std::uint32_t VKCommandBuffer::maxNumCommandBuffers;
-
 // Returns the maximum for a indirect multi draw command
 static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDevice)
 {
@@ -50,23 +52,17 @@ static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDev
 
 VKCommandBuffer::VKCommandBuffer(
     const VKPhysicalDevice&         physicalDevice,
-    VkDevice                        device,
+    VKDevice&                       device,
     VkQueue                         commandQueue,
     const QueueFamilyIndices&       queueFamilyIndices,
     const CommandBufferDescriptor&  desc)
 :
-    device_                 { device                                        },
-    commandQueue_           { commandQueue                                  },
-    commandPool_            { device, vkDestroyCommandPool                  },
-    numCommandBuffers_      { VKCommandBuffer::GetNumVkCommandBuffers(desc) },
-    queuePresentFamily_     { queueFamilyIndices.presentFamily              },
-    maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)       },
-    recordingFenceArray_    { VKPtr<VkFence>{ device, vkDestroyFence },
-                              VKPtr<VkFence>{ device, vkDestroyFence },
-                              VKPtr<VkFence>{ device, vkDestroyFence }      },
-    descriptorSetPoolArray_ { device,
-                              device,
-                              device                                        }
+    device_                 { device                                            },
+    commandQueue_           { commandQueue                                      },
+    queueFamilyIndex_       { queueFamilyIndices.graphicsFamily                 },
+    maxNumNativeBuffers_    { VKCommandBuffer::GetMaxNumVkCommandBuffers(desc)  },
+    queuePresentFamily_     { queueFamilyIndices.presentFamily                  },
+    maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)           }
 {
     /* Translate creation flags */
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
@@ -82,7 +78,8 @@ VKCommandBuffer::VKCommandBuffer(
             if (desc.renderPass != nullptr)
             {
                 auto* renderPassVK = LLGL_CAST(const VKRenderPass*, desc.renderPass);
-                renderPass_ = renderPassVK->GetVkRenderPass();
+                renderPass_             = renderPassVK->GetVkRenderPass();
+                inheritanceRenderPass_  = renderPassVK;
                 usageFlags_ |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
             }
         }
@@ -92,23 +89,51 @@ VKCommandBuffer::VKCommandBuffer(
             usageFlags_ |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     }
 
-    /* Create native command buffer objects */
-    CreateVkCommandPool(queueFamilyIndices.graphicsFamily);
-    CreateVkCommandBuffers();
-    CreateVkRecordingFences();
+    /* Create initial native command buffer objects */
+    const std::uint32_t numNativeBuffers = VKCommandBuffer::GetNumVkCommandBuffers(desc);
+    nativeBuffers_.reserve(std::max(numNativeBuffers, maxNumNativeBuffers_));
+    for_range(i, numNativeBuffers)
+        nativeBuffers_.push_back(CreateNativeCommandBuffer());
 
-    /* Acquire first native command buffer */
-    AcquireNextBuffer();
+    /* Select last native command buffer, so the first encoding starts with the first one */
+    SelectNativeBuffer(nativeBuffers_.size() - 1);
 }
 
 VKCommandBuffer::~VKCommandBuffer()
 {
-    vkFreeCommandBuffers(device_, commandPool_, numCommandBuffers_, commandBufferArray_);
+    // dummy; native command buffers are freed along with their command pools
+}
+
+void VKCommandBuffer::DiscardQueryHeap(const VKQueryHeap& queryHeap)
+{
+    pendingQueryResets_.erase(
+        std::remove_if(
+            pendingQueryResets_.begin(),
+            pendingQueryResets_.end(),
+            [&queryHeap](const QueryRange& range) -> bool
+            {
+                return (range.queryHeap == &queryHeap);
+            }
+        ),
+        pendingQueryResets_.end()
+    );
 }
 
 VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
 {
     VkFence fence = recordingFence_;
+    if (fence != VK_NULL_HANDLE)
+    {
+        /* Mark submission as pending, so secondary command buffers executed by this one wait for the fence before they are reused */
+        NativeSubmission& submission = *(nativeBuffers_[nativeBufferIndex_]->submission);
+        std::lock_guard<std::mutex> guard{ submission.mutex };
+        submission.submitted = true;
+    }
+    else if (multiSubmit_)
+    {
+        /* Only the first submission of a multi-submit command buffer signals the fence, so later submissions must be waited on separately */
+        hasUntrackedSubmissions_ = true;
+    }
     if (multiSubmit_)
         recordingFence_ = VK_NULL_HANDLE;
     return fence;
@@ -118,12 +143,24 @@ VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
 
 void VKCommandBuffer::Begin()
 {
-    /* Use next internal VkCommandBuffer object to reduce latency */
+    /* Use next internal VkCommandBuffer object that is no longer in flight to reduce latency */
     AcquireNextBuffer();
 
-    /* Wait for fence before recording */
-    vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
-    vkResetFences(device_, 1, &recordingFence_);
+    /* Recycle all memory of the native command buffer at once; Secondary command buffers are never submitted, so they have no fence */
+    NativeCommandBuffer& nativeBuffer = *nativeBuffers_[nativeBufferIndex_];
+    if (NativeSubmission* submission = nativeBuffer.submission.get())
+    {
+        std::lock_guard<std::mutex> guard{ submission->mutex };
+        vkResetFences(device_, 1, &recordingFence_);
+        ++submission->generation;
+        submission->submitted = false;
+    }
+    nativeBuffer.executingPrimaries.clear();
+
+    VkResult result = vkResetCommandPool(device_, nativeBuffer.commandPool, 0);
+    VKThrowIfFailed(result, "failed to reset Vulkan command pool");
+
+    descriptorSetPool_->Reset();
 
     /* Initialize inheritance if this is a secondary command buffer */
     const bool isSecondaryCmdBuffer = (bufferLevel_ == VK_COMMAND_BUFFER_LEVEL_SECONDARY);
@@ -141,6 +178,28 @@ void VKCommandBuffer::Begin()
         inheritanceInfo.pipelineStatistics      = 0;
     }
 
+    /* Inherit attachment formats instead of a render pass object with dynamic rendering */
+    VkFormat inheritanceColorFormats[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VkCommandBufferInheritanceRenderingInfoKHR inheritanceRenderingInfo;
+
+    if (isSecondaryCmdBuffer && inheritanceRenderPass_ != nullptr && HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        const std::uint32_t numColorAttachments = inheritanceRenderPass_->GetNumColorAttachments();
+        for_range(i, numColorAttachments)
+            inheritanceColorFormats[i] = inheritanceRenderPass_->GetColorAttachmentDesc(i).format;
+
+        inheritanceRenderingInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+        inheritanceRenderingInfo.pNext                      = nullptr;
+        inheritanceRenderingInfo.flags                      = 0;
+        inheritanceRenderingInfo.viewMask                   = 0;
+        inheritanceRenderingInfo.colorAttachmentCount       = numColorAttachments;
+        inheritanceRenderingInfo.pColorAttachmentFormats    = inheritanceColorFormats;
+        inheritanceRenderingInfo.depthAttachmentFormat      = inheritanceRenderPass_->GetDepthVkFormat();
+        inheritanceRenderingInfo.stencilAttachmentFormat    = inheritanceRenderPass_->GetStencilVkFormat();
+        inheritanceRenderingInfo.rasterizationSamples       = inheritanceRenderPass_->GetSampleCountBits();
+        inheritanceInfo.pNext = &inheritanceRenderingInfo;
+    }
+
     /* Begin recording of current command buffer */
     VkCommandBufferBeginInfo beginInfo;
     {
@@ -149,13 +208,11 @@ void VKCommandBuffer::Begin()
         beginInfo.flags             = usageFlags_;
         beginInfo.pInheritanceInfo  = (isSecondaryCmdBuffer ? &inheritanceInfo : nullptr);
     }
-    VkResult result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
+    result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
     VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
 
-    #if 0//TODO: optimize
-    /* Reset all query pools that were in flight during last encoding */
-    ResetQueryPoolsInFlight();
-    #endif
+    /* Queries are reset when they are written again, so query resets of the previous encoding are no longer required */
+    pendingQueryResets_.clear();
 
     /* Reset record states to default values */
     recordState_                            = RecordState::OutsideRenderPass;
@@ -164,6 +221,7 @@ void VKCommandBuffer::Begin()
     framebufferRenderArea_.extent.width     = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     framebufferRenderArea_.extent.height    = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     hasDynamicScissorRect_                  = false;
+    dynamicGraphicsStateFlags_              = 0;
 }
 
 void VKCommandBuffer::End()
@@ -178,7 +236,13 @@ void VKCommandBuffer::End()
     /* Execute command buffer right after encoding for immediate command buffers */
     if (IsImmediateCmdBuffer())
     {
-        VkResult result = VKSubmitCommandBuffer(commandQueue_, commandBuffer_, GetQueueSubmitFence());
+        /* Queue submissions must be serialized with staging uploads from loader threads */
+        std::lock_guard<std::recursive_mutex> guard{ device_.GetQueueMutex() };
+
+        /* Submit batched staging commands first, so this command buffer observes all previous uploads */
+        device_.FlushStagingCommandBufferForQueue(commandQueue_);
+
+        VkResult result = VKSubmitCommandBuffer(commandQueue_, commandBuffer_, GetQueueSubmitFenceAndFlush());
         VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
     }
 
@@ -188,8 +252,19 @@ void VKCommandBuffer::End()
 void VKCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
     auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, deferredCommandBuffer);
+
+    /* Reset queries the secondary command buffer writes again but cannot reset within its inherited render pass */
+    for (const QueryRange& range : cmdBufferVK.pendingQueryResets_)
+        ResetQueryRange(*range.queryHeap, range.firstQuery, range.numQueries);
+
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
     vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+
+    /* Secondary command buffer must not be recycled before this primary command buffer has been completed */
+    cmdBufferVK.AddExecutingPrimary(nativeBuffers_[nativeBufferIndex_]->submission);
+
+    /* Dynamic states are undefined after executing secondary command buffers */
+    dynamicGraphicsStateFlags_ = 0;
 }
 
 /* ----- Blitting ----- */
@@ -567,6 +642,10 @@ void VKCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
 
     boundPipelineState_->BindHeapDescriptorSet(commandBuffer_, resourceHeapVK.GetVkDescriptorSets()[descriptorSet]);
     resourceHeapVK.SubmitPipelineBarrier(commandBuffer_, descriptorSet);
+
+    /* Storage buffers that are written by a compute shader and then consumed as indirect arguments need another barrier after each dispatch */
+    if (boundPipelineState_->GetBindPoint() == VK_PIPELINE_BIND_POINT_COMPUTE)
+        dispatchWritesIndirectArgs_ = resourceHeapVK.HasIndirectBufferBarrier(descriptorSet);
 }
 
 void VKCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
@@ -597,75 +676,34 @@ void VKCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       swapBufferIndex)
 {
-    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
-    {
-        /* Get Vulkan swap-chain object */
-        auto& swapChainVK = LLGL_CAST(VKSwapChain&, renderTarget);
-
-        /* Store information about framebuffer attachments */
-        boundSwapChain_                 = &swapChainVK;
-        currentColorBuffer_             = swapChainVK.TranslateSwapIndex(swapBufferIndex);
-        renderPass_                     = swapChainVK.GetSwapChainRenderPass().GetVkRenderPass();
-        secondaryRenderPass_            = swapChainVK.GetSecondaryVkRenderPass();
-        framebuffer_                    = swapChainVK.GetVkFramebuffer(currentColorBuffer_);
-        framebufferRenderArea_.extent   = swapChainVK.GetVkExtent();
-        numColorAttachments_            = swapChainVK.GetNumColorAttachments();
-        hasDepthStencilAttachment_      = (swapChainVK.HasDepthAttachment() || swapChainVK.HasStencilAttachment());
-    }
-    else
-    {
-        /* Get Vulkan render target object and store its extent for subsequent commands */
-        auto& renderTargetVK = LLGL_CAST(VKRenderTarget&, renderTarget);
-
-        /* Store information about framebuffer attachments */
-        renderPass_                     = renderTargetVK.GetVkRenderPass();
-        secondaryRenderPass_            = renderTargetVK.GetSecondaryVkRenderPass();
-        framebuffer_                    = renderTargetVK.GetVkFramebuffer();
-        framebufferRenderArea_.extent   = renderTargetVK.GetVkExtent();
-        numColorAttachments_            = renderTargetVK.GetNumColorAttachments();
-        hasDepthStencilAttachment_      = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
-    }
-
-    hasDynamicScissorRect_ = false;
-
-    /* Uninitialized stack memory for clear values */
-    VkClearValue clearValuesVK[LLGL_MAX_NUM_COLOR_ATTACHMENTS * 2 + 1];
-    std::uint32_t numClearValuesVK = 0;
-
-    /* Get native render pass object either from RenderTarget or RenderPass interface */
-    if (renderPass != nullptr)
-    {
-        /* Get native VkRenderPass object */
-        auto* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
-        renderPass_ = renderPassVK->GetVkRenderPass();
-        ConvertRenderPassClearValues(*renderPassVK, numClearValuesVK, clearValuesVK, numClearValues, clearValues);
-    }
-
-    /* Record begin of render pass */
-    VkRenderPassBeginInfo beginInfo;
-    {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.renderPass        = renderPass_;
-        beginInfo.framebuffer       = framebuffer_;
-        beginInfo.renderArea        = framebufferRenderArea_;
-        beginInfo.clearValueCount   = numClearValuesVK;
-        beginInfo.pClearValues      = clearValuesVK;
-    }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    BeginRenderPassWithContents(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex, VK_SUBPASS_CONTENTS_INLINE);
+}
 
-    /* Store new record state */
-    recordState_ = RecordState::InsideRenderPass;
+void VKCommandBuffer::BeginParallelRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    BeginRenderPassWithContents(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
 }
 
 void VKCommandBuffer::EndRenderPass()
 {
     /* Record and of render pass */
-    vkCmdEndRenderPass(commandBuffer_);
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        EndDynamicRendering(*dynamicRenderPass_);
+    else
+        vkCmdEndRenderPass(commandBuffer_);
 
     /* Reset render pass and framebuffer attributes */
-    renderPass_     = VK_NULL_HANDLE;
-    framebuffer_    = VK_NULL_HANDLE;
+    renderPass_                 = VK_NULL_HANDLE;
+    framebuffer_                = VK_NULL_HANDLE;
+    dynamicRenderPass_          = nullptr;
+    dynamicSecondaryRenderPass_ = nullptr;
+    dynamicAttachments_         = nullptr;
+    subpassContents_            = VK_SUBPASS_CONTENTS_INLINE;
 
     /* Store new record state */
     recordState_ = RecordState::OutsideRenderPass;
@@ -799,6 +837,9 @@ void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
             /* Avoid scissor update with each graphics pipeline binding (as long as render pass does not change) */
             hasDynamicScissorRect_ = true;
         }
+
+        /* Set states that are not baked into the native PSO */
+        SetDynamicGraphicsState(graphicsPSO);
     }
 
     /* Keep reference to bound piepline layout (can be null) */
@@ -843,6 +884,18 @@ void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 
     query *= queryHeapVK.GetGroupSize();
 
+    /*
+    Only reset queries that have been written before and whose results have not been reset after they were read.
+    This keeps the results of previous submissions available until the application overwrites them.
+    */
+    if (queryHeapVK.MarkWrittenRange(query, queryHeapVK.GetGroupSize()))
+    {
+        if ((usageFlags_ & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) != 0)
+            AppendPendingQueryReset(&queryHeapVK, query, queryHeapVK.GetGroupSize());
+        else
+            ResetQueryRange(queryHeapVK, query, queryHeapVK.GetGroupSize());
+    }
+
     if (queryHeapVK.GetType() == QueryType::TimeElapsed)
     {
         /* Record first timestamp */
@@ -878,10 +931,6 @@ void VKCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
         /* End query section */
         vkCmdEndQuery(commandBuffer_, queryHeapVK.GetVkQueryPool(), query);
     }
-
-    #if 0//TEST
-    AppendQueryPoolInFlight(&queryHeapVK);
-    #endif
 }
 
 void VKCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
@@ -1056,12 +1105,64 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
         vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
 }
 
+void VKCommandBuffer::DrawIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    if (HasExtension(VKExt::KHR_draw_indirect_count))
+    {
+        FlushDescriptorCache();
+        auto& argsBufferVK  = LLGL_CAST(VKBuffer&, argsBuffer);
+        auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+        vkCmdDrawIndirectCountKHR(
+            commandBuffer_,
+            argsBufferVK.GetVkBuffer(),
+            argsOffset,
+            countBufferVK.GetVkBuffer(),
+            countOffset,
+            std::min(maxNumCommands, maxDrawIndirectCount_),
+            stride
+        );
+    }
+}
+
+void VKCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argsBuffer,
+    std::uint64_t   argsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    if (HasExtension(VKExt::KHR_draw_indirect_count))
+    {
+        FlushDescriptorCache();
+        auto& argsBufferVK  = LLGL_CAST(VKBuffer&, argsBuffer);
+        auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+        vkCmdDrawIndexedIndirectCountKHR(
+            commandBuffer_,
+            argsBufferVK.GetVkBuffer(),
+            argsOffset,
+            countBufferVK.GetVkBuffer(),
+            countOffset,
+            std::min(maxNumCommands, maxDrawIndirectCount_),
+            stride
+        );
+    }
+}
+
 /* ----- Compute ----- */
 
 void VKCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
     FlushDescriptorCache();
     vkCmdDispatch(commandBuffer_, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+    if (dispatchWritesIndirectArgs_)
+        IndirectArgumentsPipelineBarrier();
 }
 
 void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
@@ -1069,6 +1170,8 @@ void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
     FlushDescriptorCache();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
+    if (dispatchWritesIndirectArgs_)
+        IndirectArgumentsPipelineBarrier();
 }
 
 /* ----- Debugging ----- */
@@ -1112,6 +1215,14 @@ bool VKCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
         nativeHandleVK->commandBuffer = commandBuffer_;
         return true;
     }
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Vulkan::CommandBufferStatistics))
+    {
+        auto* statisticsVK = reinterpret_cast<Vulkan::CommandBufferStatistics*>(nativeHandle);
+        statisticsVK->numNativeBuffers      = static_cast<std::uint32_t>(nativeBuffers_.size());
+        statisticsVK->maxNumNativeBuffers   = maxNumNativeBuffers_;
+        statisticsVK->recordingStalls       = numRecordingStalls_;
+        return true;
+    }
     return false;
 }
 
@@ -1120,51 +1231,77 @@ bool VKCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
  * ======= Private: =======
  */
 
-void VKCommandBuffer::CreateVkCommandPool(std::uint32_t queueFamilyIndex)
+VKCommandBuffer::NativeSubmission::NativeSubmission(VkDevice device) :
+    fence { device, vkDestroyFence }
+{
+}
+
+bool VKCommandBuffer::NativeSubmission::IsInFlight(VkDevice device, std::uint64_t generationToCheck)
+{
+    /* A fence is only in flight if it has been submitted since its last reset */
+    std::lock_guard<std::mutex> guard{ mutex };
+    return (generation == generationToCheck && submitted && vkGetFenceStatus(device, fence.Get()) != VK_SUCCESS);
+}
+
+void VKCommandBuffer::NativeSubmission::WaitIfInFlight(VkDevice device, std::uint64_t generationToCheck)
 {
-    /* Create command pool */
-    VkCommandPoolCreateInfo createInfo;
+    std::lock_guard<std::mutex> guard{ mutex };
+    if (generation == generationToCheck && submitted)
     {
-        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        createInfo.pNext            = nullptr;
-        createInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        createInfo.queueFamilyIndex = queueFamilyIndex;
+        VkFence fenceToWait = fence.Get();
+        vkWaitForFences(device, 1, &fenceToWait, VK_TRUE, UINT64_MAX);
     }
-    VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan command pool");
 }
 
-void VKCommandBuffer::CreateVkCommandBuffers()
+VKCommandBuffer::NativeCommandBuffer::NativeCommandBuffer(VkDevice device) :
+    commandPool         { device, vkDestroyCommandPool  },
+    descriptorSetPool   { device                        }
+{
+}
+
+std::unique_ptr<VKCommandBuffer::NativeCommandBuffer> VKCommandBuffer::CreateNativeCommandBuffer()
 {
-    /* Allocate command buffers */
+    auto nativeBuffer = MakeUnique<NativeCommandBuffer>(device_);
+
+    /* Create command pool; Its command buffer is recycled with vkResetCommandPool, so no per-buffer reset flag is required */
+    VkCommandPoolCreateInfo poolCreateInfo;
+    {
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = 0;
+        poolCreateInfo.queueFamilyIndex = queueFamilyIndex_;
+    }
+    VkResult result = vkCreateCommandPool(device_, &poolCreateInfo, nullptr, nativeBuffer->commandPool.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan command pool");
+
+    /* Allocate command buffer */
     VkCommandBufferAllocateInfo allocInfo;
     {
         allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocInfo.pNext                 = nullptr;
-        allocInfo.commandPool           = commandPool_;
+        allocInfo.commandPool           = nativeBuffer->commandPool;
         allocInfo.level                 = bufferLevel_;
-        allocInfo.commandBufferCount    = numCommandBuffers_;
+        allocInfo.commandBufferCount    = 1;
     }
-    VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, commandBufferArray_);
+    result = vkAllocateCommandBuffers(device_, &allocInfo, &(nativeBuffer->commandBuffer));
     VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
-}
 
-void VKCommandBuffer::CreateVkRecordingFences()
-{
-    /* Create all recording fences with their initial state being signaled */
-    VkFenceCreateInfo createInfo;
+    /* Create recording fence with its initial state being signaled; Secondary command buffers are never submitted on their own */
+    if (bufferLevel_ == VK_COMMAND_BUFFER_LEVEL_PRIMARY)
     {
-        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        createInfo.pNext = nullptr;
-        createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-    }
+        nativeBuffer->submission = std::make_shared<NativeSubmission>(device_);
 
-    for_range(i, numCommandBuffers_)
-    {
-        /* Create fence for command buffer recording */
-        VkResult result = vkCreateFence(device_, &createInfo, nullptr, recordingFenceArray_[i].ReleaseAndGetAddressOf());
+        VkFenceCreateInfo fenceCreateInfo;
+        {
+            fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            fenceCreateInfo.pNext = nullptr;
+            fenceCreateInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+        }
+        result = vkCreateFence(device_, &fenceCreateInfo, nullptr, nativeBuffer->submission->fence.ReleaseAndGetAddressOf());
         VKThrowIfFailed(result, "failed to create Vulkan fence");
     }
+
+    return nativeBuffer;
 }
 
 void VKCommandBuffer::ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments)
@@ -1239,25 +1376,305 @@ void VKCommandBuffer::ConvertRenderPassClearValues(
         dstClearValuesCount += renderPass.GetNumColorAttachments();
 }
 
+void VKCommandBuffer::BeginRenderPassWithContents(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex,
+    VkSubpassContents   contents)
+{
+    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
+    {
+        /* Get Vulkan swap-chain object */
+        auto& swapChainVK = LLGL_CAST(VKSwapChain&, renderTarget);
+
+        /* Store information about framebuffer attachments */
+        boundSwapChain_                 = &swapChainVK;
+        currentColorBuffer_             = swapChainVK.TranslateSwapIndex(swapBufferIndex);
+        renderPass_                     = swapChainVK.GetSwapChainRenderPass().GetVkRenderPass();
+        secondaryRenderPass_            = swapChainVK.GetSecondaryVkRenderPass();
+        framebuffer_                    = swapChainVK.GetVkFramebuffer(currentColorBuffer_);
+        dynamicRenderPass_              = &(swapChainVK.GetSwapChainRenderPass());
+        dynamicSecondaryRenderPass_     = &(swapChainVK.GetSecondaryRenderPass());
+        dynamicAttachments_             = &(swapChainVK.GetFramebufferAttachments(currentColorBuffer_));
+        framebufferRenderArea_.extent   = swapChainVK.GetVkExtent();
+        numColorAttachments_            = swapChainVK.GetNumColorAttachments();
+        hasDepthStencilAttachment_      = (swapChainVK.HasDepthAttachment() || swapChainVK.HasStencilAttachment());
+    }
+    else
+    {
+        /* Get Vulkan render target object and store its extent for subsequent commands */
+        auto& renderTargetVK = LLGL_CAST(VKRenderTarget&, renderTarget);
+
+        /* Store information about framebuffer attachments */
+        renderPass_                     = renderTargetVK.GetVkRenderPass();
+        secondaryRenderPass_            = renderTargetVK.GetSecondaryVkRenderPass();
+        framebuffer_                    = renderTargetVK.GetVkFramebuffer();
+        dynamicRenderPass_              = &(renderTargetVK.GetPrimaryRenderPass());
+        dynamicSecondaryRenderPass_     = &(renderTargetVK.GetSecondaryRenderPass());
+        dynamicAttachments_             = &(renderTargetVK.GetFramebufferAttachments());
+        framebufferRenderArea_.extent   = renderTargetVK.GetVkExtent();
+        numColorAttachments_            = renderTargetVK.GetNumColorAttachments();
+        hasDepthStencilAttachment_      = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
+    }
+
+    hasDynamicScissorRect_  = false;
+    subpassContents_        = contents;
+
+    /* Uninitialized stack memory for clear values */
+    VkClearValue clearValuesVK[LLGL_MAX_NUM_COLOR_ATTACHMENTS * 2 + 1];
+    std::uint32_t numClearValuesVK = 0;
+
+    /* Get native render pass object either from RenderTarget or RenderPass interface */
+    if (renderPass != nullptr)
+    {
+        /* Get native VkRenderPass object */
+        auto* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
+        renderPass_         = renderPassVK->GetVkRenderPass();
+        dynamicRenderPass_  = renderPassVK;
+        ConvertRenderPassClearValues(*renderPassVK, numClearValuesVK, clearValuesVK, numClearValues, clearValues);
+    }
+
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        /* Record begin of dynamic rendering with attachment information built on the fly */
+        BeginDynamicRendering(*dynamicRenderPass_, (numClearValuesVK > 0 ? clearValuesVK : nullptr), contents);
+    }
+    else
+    {
+        /* Record begin of render pass */
+        VkRenderPassBeginInfo beginInfo;
+        {
+            beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            beginInfo.pNext             = nullptr;
+            beginInfo.renderPass        = renderPass_;
+            beginInfo.framebuffer       = framebuffer_;
+            beginInfo.renderArea        = framebufferRenderArea_;
+            beginInfo.clearValueCount   = numClearValuesVK;
+            beginInfo.pClearValues      = clearValuesVK;
+        }
+        vkCmdBeginRenderPass(commandBuffer_, &beginInfo, contents);
+    }
+
+    /* Store new record state */
+    recordState_ = RecordState::InsideRenderPass;
+}
+
 void VKCommandBuffer::PauseRenderPass()
 {
-    vkCmdEndRenderPass(commandBuffer_);
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        EndDynamicRendering(*dynamicRenderPass_);
+    else
+        vkCmdEndRenderPass(commandBuffer_);
 }
 
 void VKCommandBuffer::ResumeRenderPass()
 {
-    /* Record begin of render pass */
-    VkRenderPassBeginInfo beginInfo;
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
     {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.renderPass        = secondaryRenderPass_;
-        beginInfo.framebuffer       = framebuffer_;
-        beginInfo.renderArea        = framebufferRenderArea_;
-        beginInfo.clearValueCount   = 0;
-        beginInfo.pClearValues      = nullptr;
+        /* Continue with secondary render pass to load the previous content */
+        dynamicRenderPass_ = dynamicSecondaryRenderPass_;
+        BeginDynamicRendering(*dynamicRenderPass_, nullptr, subpassContents_);
+    }
+    else
+    {
+        /* Record begin of render pass */
+        VkRenderPassBeginInfo beginInfo;
+        {
+            beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            beginInfo.pNext             = nullptr;
+            beginInfo.renderPass        = secondaryRenderPass_;
+            beginInfo.framebuffer       = framebuffer_;
+            beginInfo.renderArea        = framebufferRenderArea_;
+            beginInfo.clearValueCount   = 0;
+            beginInfo.pClearValues      = nullptr;
+        }
+        vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
+    }
+}
+
+static void InitVkRenderingAttachmentInfo(
+    VkRenderingAttachmentInfoKHR&   dst,
+    VkImageView                     imageView,
+    VkImageLayout                   imageLayout,
+    VkAttachmentLoadOp              loadOp,
+    VkAttachmentStoreOp             storeOp,
+    const VkClearValue&             clearValue)
+{
+    dst.sType               = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+    dst.pNext               = nullptr;
+    dst.imageView           = imageView;
+    dst.imageLayout         = imageLayout;
+    dst.resolveMode         = VK_RESOLVE_MODE_NONE_KHR;
+    dst.resolveImageView    = VK_NULL_HANDLE;
+    dst.resolveImageLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+    dst.loadOp              = loadOp;
+    dst.storeOp             = storeOp;
+    dst.clearValue          = clearValue;
+}
+
+void VKCommandBuffer::BeginDynamicRendering(const VKRenderPass& renderPass, const VkClearValue* clearValues, VkSubpassContents contents)
+{
+    LLGL_ASSERT_PTR(dynamicAttachments_);
+    const VKFramebufferAttachments& attachments = *dynamicAttachments_;
+
+    /* Transition attachments from the initial layouts of the render pass into attachment layouts */
+    TransitionDynamicRenderingAttachments(renderPass, true);
+
+    const std::uint64_t     clearValuesMask     = (clearValues != nullptr ? renderPass.GetClearValuesMask() : 0);
+    const std::uint32_t     numColorAttachments = renderPass.GetNumColorAttachments();
+    const bool              hasMultiSampling    = (renderPass.GetSampleCountBits() > VK_SAMPLE_COUNT_1_BIT);
+
+    VkClearValue defaultClearColor;
+    defaultClearColor.color = { { 0.0f, 0.0f, 0.0f, 0.0f } };
+
+    VkClearValue defaultClearDepthStencil;
+    defaultClearDepthStencil.depthStencil = { 1.0f, 0 };
+
+    /* Build color attachment information with optional resolve attachments */
+    VkRenderingAttachmentInfoKHR colorAttachmentsVK[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+
+    for_range(i, numColorAttachments)
+    {
+        const VkAttachmentDescription& attachmentDesc = renderPass.GetColorAttachmentDesc(i);
+        InitVkRenderingAttachmentInfo(
+            colorAttachmentsVK[i],
+            attachments.colorAttachments[i].imageView,
+            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            attachmentDesc.loadOp,
+            attachmentDesc.storeOp,
+            (((clearValuesMask >> i) & 0x1ull) != 0 ? clearValues[i] : defaultClearColor)
+        );
+
+        const VkImageView resolveImageView = attachments.resolveAttachments[i].imageView;
+        if (hasMultiSampling && resolveImageView != VK_NULL_HANDLE)
+        {
+            colorAttachmentsVK[i].resolveMode           = VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+            colorAttachmentsVK[i].resolveImageView      = resolveImageView;
+            colorAttachmentsVK[i].resolveImageLayout    = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+    }
+
+    /* Build depth and stencil attachment information; both refer to the same image view */
+    VkRenderingAttachmentInfoKHR depthAttachmentVK;
+    VkRenderingAttachmentInfoKHR stencilAttachmentVK;
+
+    const bool hasDepthAttachment   = (renderPass.GetDepthVkFormat()   != VK_FORMAT_UNDEFINED);
+    const bool hasStencilAttachment = (renderPass.GetStencilVkFormat() != VK_FORMAT_UNDEFINED);
+
+    if (hasDepthAttachment || hasStencilAttachment)
+    {
+        const VkAttachmentDescription&  attachmentDesc      = renderPass.GetDepthStencilAttachmentDesc();
+        const std::uint8_t              depthStencilIndex   = renderPass.GetDepthStencilIndex();
+        const VkImageView               imageView           = attachments.depthStencilAttachment.imageView;
+        const VkClearValue&             clearValue          = (((clearValuesMask >> depthStencilIndex) & 0x1ull) != 0 ? clearValues[depthStencilIndex] : defaultClearDepthStencil);
+
+        InitVkRenderingAttachmentInfo(
+            depthAttachmentVK,
+            imageView,
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+            attachmentDesc.loadOp,
+            attachmentDesc.storeOp,
+            clearValue
+        );
+        InitVkRenderingAttachmentInfo(
+            stencilAttachmentVK,
+            imageView,
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+            attachmentDesc.stencilLoadOp,
+            attachmentDesc.stencilStoreOp,
+            clearValue
+        );
+    }
+
+    /* Record begin of dynamic rendering */
+    VkRenderingInfoKHR renderingInfo;
+    {
+        renderingInfo.sType                 = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.pNext                 = nullptr;
+        renderingInfo.flags                 = (contents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR : 0);
+        renderingInfo.renderArea            = framebufferRenderArea_;
+        renderingInfo.layerCount            = 1;
+        renderingInfo.viewMask              = 0;
+        renderingInfo.colorAttachmentCount  = numColorAttachments;
+        renderingInfo.pColorAttachments     = colorAttachmentsVK;
+        renderingInfo.pDepthAttachment      = (hasDepthAttachment ? &depthAttachmentVK : nullptr);
+        renderingInfo.pStencilAttachment    = (hasStencilAttachment ? &stencilAttachmentVK : nullptr);
+    }
+    vkCmdBeginRenderingKHR(commandBuffer_, &renderingInfo);
+}
+
+void VKCommandBuffer::EndDynamicRendering(const VKRenderPass& renderPass)
+{
+    vkCmdEndRenderingKHR(commandBuffer_);
+
+    /* Transition attachments into the final layouts of the render pass */
+    TransitionDynamicRenderingAttachments(renderPass, false);
+}
+
+void VKCommandBuffer::TransitionDynamicRenderingAttachments(const VKRenderPass& renderPass, bool beginRendering)
+{
+    const VKFramebufferAttachments& attachments = *dynamicAttachments_;
+
+    constexpr VkPipelineStageFlags attachmentStageMask =
+    (
+        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT   |
+        VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT      |
+        VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT
+    );
+
+    /* Uninitialized stack memory for image barriers */
+    VkImageMemoryBarrier barriers[LLGL_MAX_NUM_COLOR_ATTACHMENTS * 2 + 1];
+    std::uint32_t numBarriers = 0;
+
+    auto AppendBarrier = [&](const VKAttachmentImage& attachment, const VkAttachmentDescription& attachmentDesc, VkImageLayout attachmentLayout, VkAccessFlags attachmentAccess)
+    {
+        if (attachment.image == VK_NULL_HANDLE)
+            return;
+
+        /* Emulate implicit layout transitions of VkRenderPass: initialLayout -> attachment layout -> finalLayout */
+        VkImageMemoryBarrier& barrier = barriers[numBarriers++];
+        {
+            barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.pNext               = nullptr;
+            barrier.srcAccessMask       = (beginRendering ? VK_ACCESS_MEMORY_WRITE_BIT : attachmentAccess);
+            barrier.dstAccessMask       = (beginRendering ? attachmentAccess : VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+            barrier.oldLayout           = (beginRendering ? attachmentDesc.initialLayout : attachmentLayout);
+            barrier.newLayout           = (beginRendering ? attachmentLayout : attachmentDesc.finalLayout);
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image               = attachment.image;
+            barrier.subresourceRange    = attachment.subresource;
+        }
+    };
+
+    const VkAccessFlags colorAccess         = (VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+    const VkAccessFlags depthStencilAccess  = (VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+    const bool          hasMultiSampling    = (renderPass.GetSampleCountBits() > VK_SAMPLE_COUNT_1_BIT);
+
+    for_range(i, renderPass.GetNumColorAttachments())
+    {
+        AppendBarrier(attachments.colorAttachments[i], renderPass.GetColorAttachmentDesc(i), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, colorAccess);
+        if (hasMultiSampling)
+            AppendBarrier(attachments.resolveAttachments[i], renderPass.GetResolveAttachmentDesc(i), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, colorAccess);
+    }
+
+    if (renderPass.HasDepthStencilAttachment())
+        AppendBarrier(attachments.depthStencilAttachment, renderPass.GetDepthStencilAttachmentDesc(), VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, depthStencilAccess);
+
+    if (numBarriers > 0)
+    {
+        vkCmdPipelineBarrier(
+            commandBuffer_,
+            (beginRendering ? VK_PIPELINE_STAGE_ALL_COMMANDS_BIT : attachmentStageMask),
+            (beginRendering ? attachmentStageMask : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT),
+            0,
+            0, nullptr,
+            0, nullptr,
+            numBarriers, barriers
+        );
     }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
 }
 
 bool VKCommandBuffer::IsInsideRenderPass() const
@@ -1265,6 +1682,126 @@ bool VKCommandBuffer::IsInsideRenderPass() const
     return (recordState_ == RecordState::InsideRenderPass);
 }
 
+static bool IsVkStencilOpStateEqual(const VkStencilOpState& lhs, const VkStencilOpState& rhs)
+{
+    return
+    (
+        lhs.failOp      == rhs.failOp       &&
+        lhs.passOp      == rhs.passOp       &&
+        lhs.depthFailOp == rhs.depthFailOp  &&
+        lhs.compareOp   == rhs.compareOp
+    );
+}
+
+static void SetVkStencilOpState(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, const VkStencilOpState& state)
+{
+    vkCmdSetStencilOpEXT(commandBuffer, faceMask, state.failOp, state.passOp, state.depthFailOp, state.compareOp);
+}
+
+void VKCommandBuffer::SetDynamicGraphicsState(const VKGraphicsPSO& graphicsPSO)
+{
+    const std::uint32_t flags = graphicsPSO.GetDynamicStateFlags();
+    const VKDynamicGraphicsState& state = graphicsPSO.GetDynamicState();
+    const VKDynamicGraphicsState& prev = dynamicGraphicsState_;
+
+    /* States that are baked into the native PSO invalidate the previously set values of the same group */
+    const std::uint32_t validFlags = (dynamicGraphicsStateFlags_ & flags);
+
+    auto IsDirty = [validFlags](std::uint32_t group, bool equal) -> bool
+    {
+        return ((validFlags & group) == 0 || !equal);
+    };
+
+    if ((flags & VKDynamicGraphicsState_Rasterizer) != 0)
+    {
+        if (IsDirty(VKDynamicGraphicsState_Rasterizer, prev.cullMode == state.cullMode))
+            vkCmdSetCullModeEXT(commandBuffer_, state.cullMode);
+        if (IsDirty(VKDynamicGraphicsState_Rasterizer, prev.frontFace == state.frontFace))
+            vkCmdSetFrontFaceEXT(commandBuffer_, state.frontFace);
+        if (IsDirty(VKDynamicGraphicsState_Rasterizer, prev.lineWidth == state.lineWidth))
+            vkCmdSetLineWidth(commandBuffer_, state.lineWidth);
+    }
+
+    if ((flags & VKDynamicGraphicsState_Topology) != 0)
+    {
+        if (IsDirty(VKDynamicGraphicsState_Topology, prev.primitiveTopology == state.primitiveTopology))
+            vkCmdSetPrimitiveTopologyEXT(commandBuffer_, state.primitiveTopology);
+    }
+
+    if ((flags & VKDynamicGraphicsState_DepthStencil) != 0)
+    {
+        if (IsDirty(VKDynamicGraphicsState_DepthStencil, prev.depthTestEnable == state.depthTestEnable))
+            vkCmdSetDepthTestEnableEXT(commandBuffer_, state.depthTestEnable);
+        if (IsDirty(VKDynamicGraphicsState_DepthStencil, prev.depthWriteEnable == state.depthWriteEnable))
+            vkCmdSetDepthWriteEnableEXT(commandBuffer_, state.depthWriteEnable);
+        if (IsDirty(VKDynamicGraphicsState_DepthStencil, prev.depthCompareOp == state.depthCompareOp))
+            vkCmdSetDepthCompareOpEXT(commandBuffer_, state.depthCompareOp);
+        if (IsDirty(VKDynamicGraphicsState_DepthStencil, prev.stencilTestEnable == state.stencilTestEnable))
+            vkCmdSetStencilTestEnableEXT(commandBuffer_, state.stencilTestEnable);
+
+        /* Set stencil states for both faces with a single command if they are equal */
+        const bool frontDirty = IsDirty(VKDynamicGraphicsState_DepthStencil, IsVkStencilOpStateEqual(prev.stencilFront, state.stencilFront));
+        const bool backDirty = IsDirty(VKDynamicGraphicsState_DepthStencil, IsVkStencilOpStateEqual(prev.stencilBack, state.stencilBack));
+        if (frontDirty && backDirty && IsVkStencilOpStateEqual(state.stencilFront, state.stencilBack))
+            SetVkStencilOpState(commandBuffer_, VK_STENCIL_FACE_FRONT_AND_BACK, state.stencilFront);
+        else
+        {
+            if (frontDirty)
+                SetVkStencilOpState(commandBuffer_, VK_STENCIL_FACE_FRONT_BIT, state.stencilFront);
+            if (backDirty)
+                SetVkStencilOpState(commandBuffer_, VK_STENCIL_FACE_BACK_BIT, state.stencilBack);
+        }
+
+        if (IsDirty(VKDynamicGraphicsState_DepthStencil, prev.stencilFront.compareMask == state.stencilFront.compareMask))
+            vkCmdSetStencilCompareMask(commandBuffer_, VK_STENCIL_FACE_FRONT_BIT, state.stencilFront.compareMask);
+        if (IsDirty(VKDynamicGraphicsState_DepthStencil, prev.stencilBack.compareMask == state.stencilBack.compareMask))
+            vkCmdSetStencilCompareMask(commandBuffer_, VK_STENCIL_FACE_BACK_BIT, state.stencilBack.compareMask);
+        if (IsDirty(VKDynamicGraphicsState_DepthStencil, prev.stencilFront.writeMask == state.stencilFront.writeMask))
+            vkCmdSetStencilWriteMask(commandBuffer_, VK_STENCIL_FACE_FRONT_BIT, state.stencilFront.writeMask);
+        if (IsDirty(VKDynamicGraphicsState_DepthStencil, prev.stencilBack.writeMask == state.stencilBack.writeMask))
+            vkCmdSetStencilWriteMask(commandBuffer_, VK_STENCIL_FACE_BACK_BIT, state.stencilBack.writeMask);
+    }
+
+    if ((flags & VKDynamicGraphicsState_State2) != 0)
+    {
+        if (IsDirty(VKDynamicGraphicsState_State2, prev.rasterizerDiscardEnable == state.rasterizerDiscardEnable))
+            vkCmdSetRasterizerDiscardEnableEXT(commandBuffer_, state.rasterizerDiscardEnable);
+        if (IsDirty(VKDynamicGraphicsState_State2, prev.depthBiasEnable == state.depthBiasEnable))
+            vkCmdSetDepthBiasEnableEXT(commandBuffer_, state.depthBiasEnable);
+        if (IsDirty(VKDynamicGraphicsState_State2, prev.depthBiasConstantFactor == state.depthBiasConstantFactor &&
+                                                   prev.depthBiasClamp          == state.depthBiasClamp          &&
+                                                   prev.depthBiasSlopeFactor    == state.depthBiasSlopeFactor))
+        {
+            vkCmdSetDepthBias(commandBuffer_, state.depthBiasConstantFactor, state.depthBiasClamp, state.depthBiasSlopeFactor);
+        }
+        if (IsDirty(VKDynamicGraphicsState_State2, prev.primitiveRestartEnable == state.primitiveRestartEnable))
+            vkCmdSetPrimitiveRestartEnableEXT(commandBuffer_, state.primitiveRestartEnable);
+    }
+
+    if ((flags & VKDynamicGraphicsState_PolygonMode) != 0)
+    {
+        if (IsDirty(VKDynamicGraphicsState_PolygonMode, prev.polygonMode == state.polygonMode))
+            vkCmdSetPolygonModeEXT(commandBuffer_, state.polygonMode);
+    }
+
+    if ((flags & VKDynamicGraphicsState_DepthClamp) != 0)
+    {
+        if (IsDirty(VKDynamicGraphicsState_DepthClamp, prev.depthClampEnable == state.depthClampEnable))
+            vkCmdSetDepthClampEnableEXT(commandBuffer_, state.depthClampEnable);
+    }
+
+    /* Static viewports of the PSO are always set since they are likely to differ between PSOs that share the same native PSO */
+    if ((flags & VKDynamicGraphicsState_Viewports) != 0)
+    {
+        const std::vector<VkViewport>& viewports = graphicsPSO.GetStaticViewports();
+        vkCmdSetViewportWithCountEXT(commandBuffer_, static_cast<std::uint32_t>(viewports.size()), viewports.data());
+    }
+
+    /* Store new states as the previously set values */
+    dynamicGraphicsState_       = state;
+    dynamicGraphicsStateFlags_  = flags;
+}
+
 void VKCommandBuffer::BufferPipelineBarrier(
     VkBuffer                buffer,
     VkDeviceSize            offset,
@@ -1289,6 +1826,26 @@ void VKCommandBuffer::BufferPipelineBarrier(
     vkCmdPipelineBarrier(commandBuffer_, srcStageMask, dstStageMask, 0, 0, nullptr, 1, &barrier, 0, nullptr);
 }
 
+void VKCommandBuffer::IndirectArgumentsPipelineBarrier()
+{
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    }
+    vkCmdPipelineBarrier(
+        commandBuffer_,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+        0,
+        1, &barrier,
+        0, nullptr,
+        0, nullptr
+    );
+}
+
 void VKCommandBuffer::FlushDescriptorCache()
 {
     if (descriptorCache_ != nullptr && descriptorCache_->IsInvalidated())
@@ -1300,52 +1857,151 @@ void VKCommandBuffer::FlushDescriptorCache()
 
 void VKCommandBuffer::AcquireNextBuffer()
 {
-    commandBufferIndex_ = (commandBufferIndex_ + 1) % numCommandBuffers_;
-    commandBuffer_      = commandBufferArray_[commandBufferIndex_];
-    recordingFence_     = recordingFenceArray_[commandBufferIndex_].Get();
-    descriptorSetPool_  = &(descriptorSetPoolArray_[commandBufferIndex_]);
-    descriptorSetPool_->Reset();
+    /* Submissions after the first one of a multi-submit command buffer have no fence, so wait for the entire queue before it is recycled */
+    if (hasUntrackedSubmissions_)
+    {
+        std::lock_guard<std::recursive_mutex> guard{ device_.GetQueueMutex() };
+        ++numRecordingStalls_;
+        vkQueueWaitIdle(commandQueue_);
+        hasUntrackedSubmissions_ = false;
+    }
+
+    /* The next native command buffer in the ring is always the oldest one that has been submitted */
+    const std::size_t nextIndex = (nativeBufferIndex_ + 1) % nativeBuffers_.size();
+
+    if (IsNativeBufferInFlight(*nativeBuffers_[nextIndex]))
+    {
+        if (nativeBuffers_.size() < maxNumNativeBuffers_)
+        {
+            /* Insert new native command buffer in front of the oldest one to preserve the submission order of the ring */
+            nativeBuffers_.insert(nativeBuffers_.begin() + nextIndex, CreateNativeCommandBuffer());
+        }
+        else
+        {
+            /* Limit of native command buffers is reached, so wait for the oldest one to be completed */
+            ++numRecordingStalls_;
+            WaitForNativeBuffer(*nativeBuffers_[nextIndex]);
+        }
+    }
+
+    SelectNativeBuffer(nextIndex);
+}
+
+/*
+Secondary command buffers are in flight for as long as any primary command buffer that executed them,
+unless that primary command buffer has been encoded again, which implies its previous submission has completed.
+*/
+bool VKCommandBuffer::IsNativeBufferInFlight(const NativeCommandBuffer& nativeBuffer) const
+{
+    if (NativeSubmission* submission = nativeBuffer.submission.get())
+    {
+        if (submission->IsInFlight(device_, submission->generation))
+            return true;
+    }
+    for (const ExecutingPrimary& primary : nativeBuffer.executingPrimaries)
+    {
+        if (primary.submission->IsInFlight(device_, primary.generation))
+            return true;
+    }
+    return false;
+}
+
+void VKCommandBuffer::WaitForNativeBuffer(const NativeCommandBuffer& nativeBuffer)
+{
+    if (NativeSubmission* submission = nativeBuffer.submission.get())
+        submission->WaitIfInFlight(device_, submission->generation);
+    for (const ExecutingPrimary& primary : nativeBuffer.executingPrimaries)
+        primary.submission->WaitIfInFlight(device_, primary.generation);
+}
+
+void VKCommandBuffer::AddExecutingPrimary(const std::shared_ptr<NativeSubmission>& submission)
+{
+    if (!submission)
+        return;
+
+    std::uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> guard{ submission->mutex };
+        generation = submission->generation;
+    }
+
+    /* Executing the same secondary command buffer multiple times within one primary encoding only requires a single reference */
+    std::vector<ExecutingPrimary>& executingPrimaries = nativeBuffers_[nativeBufferIndex_]->executingPrimaries;
+    for (ExecutingPrimary& primary : executingPrimaries)
+    {
+        if (primary.submission == submission)
+        {
+            primary.generation = generation;
+            return;
+        }
+    }
+    executingPrimaries.push_back(ExecutingPrimary{ submission, generation });
+}
+
+void VKCommandBuffer::SelectNativeBuffer(std::size_t index)
+{
+    NativeCommandBuffer& nativeBuffer = *nativeBuffers_[index];
+    nativeBufferIndex_  = index;
+    commandBuffer_      = nativeBuffer.commandBuffer;
+    recordingFence_     = (nativeBuffer.submission ? nativeBuffer.submission->fence.Get() : VK_NULL_HANDLE);
+    descriptorSetPool_  = &(nativeBuffer.descriptorSetPool);
     context_.Reset(commandBuffer_);
 }
 
 void VKCommandBuffer::ResetBindingStates()
 {
-    boundSwapChain_         = nullptr;
-    boundPipelineLayout_    = nullptr;
-    boundPipelineState_     = nullptr;
-    descriptorCache_        = nullptr;
+    boundSwapChain_             = nullptr;
+    boundPipelineLayout_        = nullptr;
+    boundPipelineState_         = nullptr;
+    descriptorCache_            = nullptr;
+    dispatchWritesIndirectArgs_ = false;
 }
 
-void VKCommandBuffer::ResetQueryPoolsInFlight()
+void VKCommandBuffer::ResetQueryRange(VKQueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries)
 {
-    for_range(i, numQueryHeapsInFlight_)
+    /* vkCmdResetQueryPool must not be recorded inside a render pass */
+    if (IsInsideRenderPass())
     {
-        auto& queryHeapVK = *(queryHeapsInFlight_[0]);
-        vkCmdResetQueryPool(
-            commandBuffer_,
-            queryHeapVK.GetVkQueryPool(),
-            0,
-            queryHeapVK.GetNumQueries()
-        );
+        PauseRenderPass();
+        vkCmdResetQueryPool(commandBuffer_, queryHeap.GetVkQueryPool(), firstQuery, numQueries);
+        ResumeRenderPass();
+    }
+    else
+        vkCmdResetQueryPool(commandBuffer_, queryHeap.GetVkQueryPool(), firstQuery, numQueries);
+}
+
+void VKCommandBuffer::AppendPendingQueryReset(VKQueryHeap* queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    /* Merge with an adjacent or overlapping range of the same query heap, since queries are usually written in sequential order */
+    for (QueryRange& range : pendingQueryResets_)
+    {
+        if (range.queryHeap == queryHeap &&
+            firstQuery <= range.firstQuery + range.numQueries &&
+            range.firstQuery <= firstQuery + numQueries)
+        {
+            const std::uint32_t rangeEnd = std::max(range.firstQuery + range.numQueries, firstQuery + numQueries);
+            range.firstQuery = std::min(range.firstQuery, firstQuery);
+            range.numQueries = rangeEnd - range.firstQuery;
+            return;
+        }
     }
-    numQueryHeapsInFlight_ = 0;
+    pendingQueryResets_.push_back(QueryRange{ queryHeap, firstQuery, numQueries });
 }
 
-void VKCommandBuffer::AppendQueryPoolInFlight(VKQueryHeap* queryHeap)
+std::uint32_t VKCommandBuffer::GetNumVkCommandBuffers(const CommandBufferDescriptor& desc)
 {
-    if (numQueryHeapsInFlight_ >= queryHeapsInFlight_.size())
-        queryHeapsInFlight_.push_back(queryHeap);
+    if ((desc.flags & CommandBufferFlags::MultiSubmit) != 0)
+        return 1u;
     else
-        queryHeapsInFlight_[numQueryHeapsInFlight_] = queryHeap;
-    ++numQueryHeapsInFlight_;
+        return std::max(1u, desc.numNativeBuffers);
 }
 
-std::uint32_t VKCommandBuffer::GetNumVkCommandBuffers(const CommandBufferDescriptor& desc)
+std::uint32_t VKCommandBuffer::GetMaxNumVkCommandBuffers(const CommandBufferDescriptor& desc)
 {
     if ((desc.flags & CommandBufferFlags::MultiSubmit) != 0)
         return 1u;
     else
-        return std::max(1u, std::min(desc.numNativeBuffers, VKCommandBuffer::maxNumCommandBuffers));
+        return std::max(VKCommandBuffer::GetNumVkCommandBuffers(desc), desc.maxNumNativeBuffers);
 }
 
 
@@ -16,7 +16,10 @@
 #include "VKCommandContext.h"
 #include "../RenderState/VKStagingDescriptorSetPool.h"
 #include "../RenderState/VKDescriptorCache.h"
+#include "../RenderState/VKGraphicsPSO.h"
 #include <vector>
+#include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -24,8 +27,10 @@ namespace LLGL
 
 
 class VKPhysicalDevice;
+class VKDevice;
 class VKResourceHeap;
 class VKRenderPass;
+struct VKFramebufferAttachments;
 class VKQueryHeap;
 class VKSwapChain;
 class VKPipelineState;
@@ -41,7 +46,7 @@ class VKCommandBuffer final : public CommandBuffer
 
         VKCommandBuffer(
             const VKPhysicalDevice&         physicalDevice,
-            VkDevice                        device,
+            VKDevice&                       device,
             VkQueue                         commandQueue,
             const QueueFamilyIndices&       queueFamilyIndices,
             const CommandBufferDescriptor&  desc
@@ -73,6 +78,9 @@ class VKCommandBuffer final : public CommandBuffer
             return immediateSubmit_;
         }
 
+        // Removes all query resets this secondary command buffer passes on to its primary command buffer for the specified query heap. Must be called before the query heap is released.
+        void DiscardQueryHeap(const VKQueryHeap& queryHeap);
+
     private:
 
         enum class RecordState
@@ -83,11 +91,54 @@ class VKCommandBuffer final : public CommandBuffer
             ReadyForSubmit,     // after "End"
         };
 
+        // Range of native queries that must be reset before they can be written again.
+        struct QueryRange
+        {
+            VKQueryHeap*    queryHeap;
+            std::uint32_t   firstQuery;
+            std::uint32_t   numQueries;
+        };
+
+        // Submission state of a primary native command buffer. Shared with secondary command buffers it executes, so it outlives the primary command buffer.
+        struct NativeSubmission
+        {
+            NativeSubmission(VkDevice device);
+
+            // Returns true if the fence of the specified generation has been submitted and is not signaled yet.
+            bool IsInFlight(VkDevice device, std::uint64_t generationToCheck);
+
+            // Waits for the fence of the specified generation while holding the mutex, so the fence cannot be reset in between.
+            void WaitIfInFlight(VkDevice device, std::uint64_t generationToCheck);
+
+            std::mutex                  mutex;
+            VKPtr<VkFence>              fence;
+            std::uint64_t               generation          = 0;        // Incremented every time the fence is reset for a new encoding.
+            bool                        submitted           = false;    // True if the fence has been passed to a queue submission since the last reset.
+        };
+
+        // Reference to the submission of a primary native command buffer that executed a secondary native command buffer.
+        struct ExecutingPrimary
+        {
+            std::shared_ptr<NativeSubmission>   submission;
+            std::uint64_t                       generation;
+        };
+
+        // Native command buffer with its own command pool, so it can be recycled with vkResetCommandPool.
+        struct NativeCommandBuffer
+        {
+            NativeCommandBuffer(VkDevice device);
+
+            VKPtr<VkCommandPool>                commandPool;
+            VkCommandBuffer                     commandBuffer       = VK_NULL_HANDLE;
+            std::shared_ptr<NativeSubmission>   submission;                         // Only for primary command buffers.
+            std::vector<ExecutingPrimary>       executingPrimaries;                 // Only for secondary command buffers.
+            VKStagingDescriptorSetPool          descriptorSetPool;
+        };
+
     private:
 
-        void CreateVkCommandPool(std::uint32_t queueFamilyIndex);
-        void CreateVkCommandBuffers();
-        void CreateVkRecordingFences();
+        // Creates a new native command buffer with its own command pool and recording fence.
+        std::unique_ptr<NativeCommandBuffer> CreateNativeCommandBuffer();
 
         void ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments);
 
@@ -99,11 +150,33 @@ class VKCommandBuffer final : public CommandBuffer
             const ClearValue*   srcClearValues
         );
 
+        // Begins a render pass whose content is either recorded inline or by secondary command buffers.
+        void BeginRenderPassWithContents(
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass,
+            std::uint32_t       numClearValues,
+            const ClearValue*   clearValues,
+            std::uint32_t       swapBufferIndex,
+            VkSubpassContents   contents
+        );
+
         void PauseRenderPass();
         void ResumeRenderPass();
 
+        // Begins dynamic rendering (VK_KHR_dynamic_rendering) with the attachment descriptors of the specified render pass.
+        void BeginDynamicRendering(const VKRenderPass& renderPass, const VkClearValue* clearValues, VkSubpassContents contents);
+
+        // Ends dynamic rendering and transitions all attachments into the final layouts of the specified render pass.
+        void EndDynamicRendering(const VKRenderPass& renderPass);
+
+        // Records image barriers for all attachments of the active framebuffer, either before or after dynamic rendering.
+        void TransitionDynamicRenderingAttachments(const VKRenderPass& renderPass, bool beginRendering);
+
         bool IsInsideRenderPass() const;
 
+        // Sets the extended dynamic states of the specified graphics PSO; Only states that differ from the previously set values are recorded.
+        void SetDynamicGraphicsState(const VKGraphicsPSO& graphicsPSO);
+
         void BufferPipelineBarrier(
             VkBuffer                buffer,
             VkDeviceSize            offset,
@@ -116,37 +189,54 @@ class VKCommandBuffer final : public CommandBuffer
 
         void FlushDescriptorCache();
 
-        // Acquires the next native VkCommandBuffer object.
+        // Makes shader writes of the previous dispatch visible to subsequent indirect draw and dispatch commands.
+        void IndirectArgumentsPipelineBarrier();
+
+        // Acquires the next native VkCommandBuffer object that is not in flight. Grows the ring of native buffers if necessary.
         void AcquireNextBuffer();
 
+        // Returns true if the specified native command buffer is still in flight, either by its own submission or by a primary command buffer that executed it.
+        bool IsNativeBufferInFlight(const NativeCommandBuffer& nativeBuffer) const;
+
+        // Waits until the specified native command buffer is no longer in flight.
+        void WaitForNativeBuffer(const NativeCommandBuffer& nativeBuffer);
+
+        // Records that the specified primary native command buffer executes the current secondary native command buffer.
+        void AddExecutingPrimary(const std::shared_ptr<NativeSubmission>& submission);
+
+        // Selects the native command buffer at the specified index as the current one.
+        void SelectNativeBuffer(std::size_t index);
+
         void ResetBindingStates();
 
-        #if 1//TODO: optimize
-        void ResetQueryPoolsInFlight();
-        void AppendQueryPoolInFlight(VKQueryHeap* queryHeap);
-        #endif
+        // Records a reset of the specified range of native queries and interrupts the current render pass if necessary.
+        void ResetQueryRange(VKQueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries);
+
+        // Appends the specified range of native queries to the ranges the primary command buffer must reset before executing this secondary command buffer.
+        void AppendPendingQueryReset(VKQueryHeap* queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries);
 
     private:
 
-        // Returns the number of native Vulkan command buffers used for the specified descriptor.
+        // Returns the initial number of native Vulkan command buffers used for the specified descriptor.
         static std::uint32_t GetNumVkCommandBuffers(const CommandBufferDescriptor& desc);
 
-    private:
+        // Returns the soft limit of native Vulkan command buffers used for the specified descriptor.
+        static std::uint32_t GetMaxNumVkCommandBuffers(const CommandBufferDescriptor& desc);
 
-        static constexpr std::uint32_t maxNumCommandBuffers = 3;
+    private:
 
-        VkDevice                        device_                     = VK_NULL_HANDLE;
+        VKDevice&                       device_;
 
         VkQueue                         commandQueue_               = VK_NULL_HANDLE;
+        std::uint32_t                   queueFamilyIndex_           = 0;
 
-        VKPtr<VkCommandPool>            commandPool_;
+        std::vector<std::unique_ptr<NativeCommandBuffer>> nativeBuffers_; // Ring of native command buffers in submission order
+        std::size_t                     nativeBufferIndex_          = 0;
+        std::uint32_t                   maxNumNativeBuffers_        = 0;
+        std::uint64_t                   numRecordingStalls_         = 0;
 
-        VKPtr<VkFence>                  recordingFenceArray_[maxNumCommandBuffers];
         VkFence                         recordingFence_             = VK_NULL_HANDLE;
-        VkCommandBuffer                 commandBufferArray_[maxNumCommandBuffers];
         VkCommandBuffer                 commandBuffer_              = VK_NULL_HANDLE;
-        std::uint32_t                   commandBufferIndex_         = 0;
-        std::uint32_t                   numCommandBuffers_          = 2;
 
         VKCommandContext                context_;
 
@@ -156,6 +246,7 @@ class VKCommandBuffer final : public CommandBuffer
         VkCommandBufferUsageFlags       usageFlags_                 = 0;
         bool                            immediateSubmit_            = false;
         bool                            multiSubmit_                = false;
+        bool                            hasUntrackedSubmissions_    = false; // multi-submit command buffer has been submitted again without a fence
 
         VKSwapChain*                    boundSwapChain_             = nullptr;
         std::uint32_t                   currentColorBuffer_         = 0;
@@ -163,9 +254,14 @@ class VKCommandBuffer final : public CommandBuffer
         VkRenderPass                    renderPass_                 = VK_NULL_HANDLE; // primary render pass
         VkRenderPass                    secondaryRenderPass_        = VK_NULL_HANDLE; // to pause/resume render pass (load and store content)
         VkFramebuffer                   framebuffer_                = VK_NULL_HANDLE; // active framebuffer handle
+        const VKRenderPass*             dynamicRenderPass_          = nullptr;        // active render pass for dynamic rendering (VK_KHR_dynamic_rendering)
+        const VKRenderPass*             dynamicSecondaryRenderPass_ = nullptr;        // to pause/resume dynamic rendering (load and store content)
+        const VKFramebufferAttachments* dynamicAttachments_         = nullptr;        // active framebuffer attachments for dynamic rendering
+        const VKRenderPass*             inheritanceRenderPass_      = nullptr;        // render pass that is inherited by secondary command buffers
         VkRect2D                        framebufferRenderArea_      = { { 0, 0 }, { 0, 0 } };
         std::uint32_t                   numColorAttachments_        = 0;
         bool                            hasDepthStencilAttachment_  = false;
+        VkSubpassContents               subpassContents_            = VK_SUBPASS_CONTENTS_INLINE; // content of active render pass; secondary command buffers for parallel render passes
 
         std::uint32_t                   queuePresentFamily_         = 0;
 
@@ -174,18 +270,17 @@ class VKCommandBuffer final : public CommandBuffer
         VkPipelineBindPoint             pipelineBindPoint_          = VK_PIPELINE_BIND_POINT_MAX_ENUM;
         const VKPipelineLayout*         boundPipelineLayout_        = nullptr;
         VKPipelineState*                boundPipelineState_         = nullptr;
+        bool                            dispatchWritesIndirectArgs_ = false;          // bound compute resource heap has barriers for storage buffers with BindFlags::IndirectBuffer
+        VKDynamicGraphicsState          dynamicGraphicsState_;                        // last extended dynamic states set on the command buffer
+        std::uint32_t                   dynamicGraphicsStateFlags_  = 0;              // groups of 'dynamicGraphicsState_' that are valid (see VKDynamicGraphicsStateFlags)
 
         std::uint32_t                   maxDrawIndirectCount_       = 0;
 
-        VKStagingDescriptorSetPool      descriptorSetPoolArray_[maxNumCommandBuffers];
         VKStagingDescriptorSetPool*     descriptorSetPool_          = nullptr;
         VKDescriptorCache*              descriptorCache_            = nullptr;
         VKDescriptorSetWriter           descriptorSetWriter_;
 
-        #if 1//TODO: optimize usage of query pools
-        std::vector<VKQueryHeap*>       queryHeapsInFlight_;
-        std::size_t                     numQueryHeapsInFlight_      = 0;
-        #endif
+        std::vector<QueryRange>         pendingQueryResets_;        // Ranges of native queries a secondary command buffer cannot reset within its inherited render pass
 
 };
 
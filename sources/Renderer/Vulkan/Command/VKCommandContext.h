@@ -91,14 +91,15 @@ class VKCommandContext
             VkFormat                format
         );
 
-        // Copies the source buffer into the destination image (numMipLevels must be 1).
+        // Copies the source buffer, starting at the specified buffer offset, into the destination image (numMipLevels must be 1).
         void CopyBufferToImage(
             VkBuffer                    srcBuffer,
             VkImage                     dstImage,
             VkFormat                    format,
             const VkOffset3D&           offset,
             const VkExtent3D&           extent,
-            const TextureSubresource&   subresource
+            const TextureSubresource&   subresource,
+            VkDeviceSize                bufferOffset = 0
         );
 
         void CopyBufferToImage(
@@ -10,7 +10,12 @@
 #include "../RenderState/VKFence.h"
 #include "../RenderState/VKQueryHeap.h"
 #include "../VKCore.h"
+#include "../VKDevice.h"
+#include "../Ext/VKExtensions.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../CheckedCast.h"
+#include <LLGL/Container/SmallVector.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -34,9 +39,10 @@ VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuff
     return vkQueueSubmit(commandQueue, 1, &submitInfo, fence);
 }
 
-VKCommandQueue::VKCommandQueue(VkDevice device, VkQueue queue) :
-    device_ { device },
-    native_ { queue  }
+VKCommandQueue::VKCommandQueue(VKDevice& device, VkQueue queue, const CommandQueueType type) :
+    CommandQueue { type   },
+    device_      { device },
+    native_      { queue  }
 {
 }
 
@@ -47,12 +53,18 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
     auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
     if (!commandBufferVK.IsImmediateCmdBuffer())
     {
+        /* Queue submissions must be serialized with staging uploads from loader threads */
+        std::lock_guard<std::recursive_mutex> guard{ device_.GetQueueMutex() };
+
+        /* Submit batched staging commands first, so this command buffer observes all previous uploads */
+        device_.FlushStagingCommandBufferForQueue(native_);
+
         VkResult result = VKSubmitCommandBuffer(
             native_,
             commandBufferVK.GetVkCommandBuffer(),
             commandBufferVK.GetQueueSubmitFenceAndFlush()
         );
-        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan queue");
     }
 }
 
@@ -74,6 +86,14 @@ bool VKCommandQueue::QueryResult(
 
     VKThrowIfFailed(stateResult, "failed to retrieve results from Vulkan query pool");
 
+    /* Reset queries on the host once their results have been read, so command buffers don't have to reset them before they are written again */
+    if (HasExtension(VKExt::EXT_host_query_reset))
+    {
+        const std::uint32_t groupSize = queryHeapVK.GetGroupSize();
+        vkResetQueryPoolEXT(device_, queryHeapVK.GetVkQueryPool(), firstQuery * groupSize, numQueries * groupSize);
+        queryHeapVK.MarkResetRange(firstQuery * groupSize, numQueries * groupSize);
+    }
+
     return true;
 }
 
@@ -103,8 +123,27 @@ bool VKCommandBuffer::QueryPipelineStatisticsResult(QueryHeap& queryHeap, QueryP
 void VKCommandQueue::Submit(Fence& fence)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetQueueMutex() };
+    device_.FlushStagingCommandBufferForQueue(native_);
+
+    /* Signal the fence's semaphore as well, so other queues can wait for this point on the GPU (see SubmitWait) */
+    VkSemaphore semaphore = fenceVK.SignalSemaphore(device_);
     fenceVK.Reset(device_);
-    vkQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = nullptr;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = &semaphore;
+    }
+    VkResult result = vkQueueSubmit(native_, 1, &submitInfo, fenceVK.GetVkFence());
+    VKThrowIfFailed(result, "failed to submit fence to Vulkan queue");
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -113,9 +152,125 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
     return fenceVK.Wait(device_, timeout);
 }
 
+void VKCommandQueue::SubmitWait(Fence& fence)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+
+    /* Consume the semaphore under the queue lock, so a concurrent Submit(Fence&) cannot replace it in between */
+    std::unique_lock<std::recursive_mutex> guard{ device_.GetQueueMutex() };
+    VkSemaphore semaphore = fenceVK.ConsumeSemaphore();
+    if (semaphore == VK_NULL_HANDLE && fenceVK.GetSignaledValue() > 0)
+    {
+        /* Fence has been signaled with a timeline value (see SubmitSignal) -> wait for that value on the GPU */
+        SubmitWaitTimelineSemaphore(fenceVK.GetTimelineSemaphore(), fenceVK.GetSignaledValue());
+        return;
+    }
+    if (semaphore == VK_NULL_HANDLE)
+    {
+        /* Semaphore signal has already been consumed by another wait -> fall back to waiting on the CPU without blocking other submissions */
+        guard.unlock();
+        fenceVK.Wait(device_, UINT64_MAX);
+        return;
+    }
+
+    /* Let all subsequent submissions to this queue wait on the GPU until the fence's semaphore is signaled */
+    const VkPipelineStageFlags waitStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 1;
+        submitInfo.pWaitSemaphores      = &semaphore;
+        submitInfo.pWaitDstStageMask    = &waitStageMask;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = nullptr;
+    }
+    VkResult result = vkQueueSubmit(native_, 1, &submitInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to submit semaphore wait to Vulkan queue");
+}
+
+void VKCommandQueue::SubmitSignal(Fence& fence, std::uint64_t value)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    VkSemaphore timelineSemaphore = fenceVK.GetTimelineSemaphore();
+    if (timelineSemaphore == VK_NULL_HANDLE)
+    {
+        /* Fall back to binary fence if VK_KHR_timeline_semaphore is not supported */
+        CommandQueue::SubmitSignal(fence, value);
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetQueueMutex() };
+    device_.FlushStagingCommandBufferForQueue(native_);
+
+    VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo;
+    {
+        timelineSubmitInfo.sType                        = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineSubmitInfo.pNext                        = nullptr;
+        timelineSubmitInfo.waitSemaphoreValueCount      = 0;
+        timelineSubmitInfo.pWaitSemaphoreValues         = nullptr;
+        timelineSubmitInfo.signalSemaphoreValueCount    = 1;
+        timelineSubmitInfo.pSignalSemaphoreValues       = &value;
+    }
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = &timelineSubmitInfo;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = nullptr;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = &timelineSemaphore;
+    }
+    VkResult result = vkQueueSubmit(native_, 1, &submitInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to submit timeline semaphore signal to Vulkan queue");
+    fenceVK.SetSignaledValue(value);
+}
+
+bool VKCommandQueue::WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    Fence* fences[] = { &fence };
+    return WaitFenceValues(1, fences, &value, timeout);
+}
+
+bool VKCommandQueue::WaitFenceValues(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, std::uint64_t timeout)
+{
+    if (!HasExtension(VKExt::KHR_timeline_semaphore))
+        return CommandQueue::WaitFenceValues(numFences, fences, values, timeout);
+
+    /* Wait for all timeline semaphores with a single call */
+    SmallVector<VkSemaphore, 4> semaphores;
+    semaphores.reserve(numFences);
+
+    for_range(i, numFences)
+    {
+        auto* fenceVK = LLGL_CAST(VKFence*, fences[i]);
+        semaphores.push_back(fenceVK->GetTimelineSemaphore());
+    }
+
+    VkSemaphoreWaitInfoKHR waitInfo;
+    {
+        waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        waitInfo.pNext          = nullptr;
+        waitInfo.flags          = 0;
+        waitInfo.semaphoreCount = numFences;
+        waitInfo.pSemaphores    = semaphores.data();
+        waitInfo.pValues        = values;
+    }
+    return (vkWaitSemaphoresKHR(device_, &waitInfo, timeout) == VK_SUCCESS);
+}
+
 void VKCommandQueue::WaitIdle()
 {
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetQueueMutex() };
+    device_.FlushStagingCommandBufferForQueue(native_);
     vkQueueWaitIdle(native_);
+    device_.RecycleStagingSubmissions();
 }
 
 
@@ -123,6 +278,35 @@ void VKCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+void VKCommandQueue::SubmitWaitTimelineSemaphore(VkSemaphore timelineSemaphore, std::uint64_t value)
+{
+    const VkPipelineStageFlags waitStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+    VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo;
+    {
+        timelineSubmitInfo.sType                        = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineSubmitInfo.pNext                        = nullptr;
+        timelineSubmitInfo.waitSemaphoreValueCount      = 1;
+        timelineSubmitInfo.pWaitSemaphoreValues         = &value;
+        timelineSubmitInfo.signalSemaphoreValueCount    = 0;
+        timelineSubmitInfo.pSignalSemaphoreValues       = nullptr;
+    }
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = &timelineSubmitInfo;
+        submitInfo.waitSemaphoreCount   = 1;
+        submitInfo.pWaitSemaphores      = &timelineSemaphore;
+        submitInfo.pWaitDstStageMask    = &waitStageMask;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = nullptr;
+    }
+    VkResult result = vkQueueSubmit(native_, 1, &submitInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to submit timeline semaphore wait to Vulkan queue");
+}
+
 VkResult VKCommandQueue::GetQueryResults(
     VKQueryHeap&    queryHeapVK,
     std::uint32_t   firstQuery,
@@ -151,17 +335,7 @@ VkResult VKCommandQueue::GetQueryResults(
     if (queryHeapVK.GetType() == QueryType::TimeElapsed)
     {
         /* Get elapsed time values from difference between start and end timestamps */
-        auto dataByteAligned = reinterpret_cast<std::uint8_t*>(data);
-
-        for (std::uint32_t query = firstQuery; query < firstQuery + numQueries; ++query)
-        {
-            auto stateResult = GetQuerySingleResult(queryHeapVK, query, dataByteAligned, stride, flags);
-            if (stateResult != VK_SUCCESS)
-                return stateResult;
-            dataByteAligned += stride;
-        }
-
-        return VK_SUCCESS;
+        return GetQueryTimeElapsedResults(queryHeapVK, firstQuery, numQueries, data, stride);
     }
     else
     {
@@ -191,62 +365,40 @@ VkResult VKCommandQueue::GetQueryBatchedResults(
     );
 }
 
-VkResult VKCommandQueue::GetQuerySingleResult(
+VkResult VKCommandQueue::GetQueryTimeElapsedResults(
     VKQueryHeap&        queryHeapVK,
-    std::uint32_t       query,
+    std::uint32_t       firstQuery,
+    std::uint32_t       numQueries,
     void*               data,
-    VkDeviceSize        stride,
-    VkQueryResultFlags  flags)
+    VkDeviceSize        stride)
 {
-    VkResult result = VK_NOT_READY;
+    /* Query start and end timestamps of all queries at once without waiting for their availability */
+    SmallVector<std::uint64_t, 64> timestamps;
+    timestamps.resize(numQueries * 2);
 
-    query *= queryHeapVK.GetGroupSize();
+    VkResult result = vkGetQueryPoolResults(
+        device_,
+        queryHeapVK.GetVkQueryPool(),
+        firstQuery * queryHeapVK.GetGroupSize(),
+        numQueries * queryHeapVK.GetGroupSize(),
+        timestamps.size() * sizeof(std::uint64_t),
+        timestamps.data(),
+        sizeof(std::uint64_t),
+        VK_QUERY_RESULT_64_BIT
+    );
 
-    if (queryHeapVK.GetType() == QueryType::TimeElapsed)
+    if (result == VK_SUCCESS)
     {
-        /* Query start and end timestamps */
-        std::uint64_t timestamps[2];
-        result = vkGetQueryPoolResults(
-            device_,
-            queryHeapVK.GetVkQueryPool(),
-            query,
-            queryHeapVK.GetGroupSize(),
-            sizeof(timestamps),
-            timestamps,
-            sizeof(timestamps[0]),
-            VK_QUERY_RESULT_64_BIT
-        );
-
-        if (result == VK_SUCCESS)
+        /* Store difference between timestamps in output buffer */
+        for_range(i, numQueries)
         {
-            /* Store difference between timestamps in output buffer */
-            const auto elapsedTime = (timestamps[1] - timestamps[0]);
+            const std::uint64_t elapsedTime = (timestamps[i*2 + 1] - timestamps[i*2]);
             if (stride == sizeof(std::uint64_t))
-            {
-                auto dst = reinterpret_cast<std::uint64_t*>(data);
-                dst[0] = elapsedTime;
-            }
+                reinterpret_cast<std::uint64_t*>(data)[i] = elapsedTime;
             else
-            {
-                auto dst = reinterpret_cast<std::uint32_t*>(data);
-                dst[0] = static_cast<std::uint32_t>(elapsedTime);
-            }
+                reinterpret_cast<std::uint32_t*>(data)[i] = static_cast<std::uint32_t>(elapsedTime);
         }
     }
-    else
-    {
-        /* Use output buffer directly to store query result */
-        result = vkGetQueryPoolResults(
-            device_,
-            queryHeapVK.GetVkQueryPool(),
-            query,
-            queryHeapVK.GetGroupSize(),
-            static_cast<std::size_t>(stride),
-            data,
-            stride,
-            flags
-        );
-    }
 
     return result;
 }
@@ -20,6 +20,7 @@ namespace LLGL
 {
 
 
+class VKDevice;
 class VKQueryHeap;
 
 // Helper function to submit the specified Vulkan command buffer to a command queue.
@@ -34,10 +35,19 @@ class VKCommandQueue final : public CommandQueue
 
     public:
 
-        VKCommandQueue(VkDevice device, VkQueue queue);
+        VKCommandQueue(VKDevice& device, VkQueue queue, const CommandQueueType type = CommandQueueType::Graphics);
+
+    public:
+
+        void SubmitWait(Fence& fence) override;
+        void SubmitSignal(Fence& fence, std::uint64_t value) override;
+        bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout) override;
+        bool WaitFenceValues(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, std::uint64_t timeout) override;
 
     private:
 
+        void SubmitWaitTimelineSemaphore(VkSemaphore timelineSemaphore, std::uint64_t value);
+
         VkResult GetQueryResults(
             VKQueryHeap&    queryHeapVK,
             std::uint32_t   firstQuery,
@@ -56,17 +66,17 @@ class VKCommandQueue final : public CommandQueue
             VkQueryResultFlags  flags
         );
 
-        VkResult GetQuerySingleResult(
+        VkResult GetQueryTimeElapsedResults(
             VKQueryHeap&        queryHeapVK,
-            std::uint32_t       query,
+            std::uint32_t       firstQuery,
+            std::uint32_t       numQueries,
             void*               data,
-            VkDeviceSize        stride,
-            VkQueryResultFlags  flags
+            VkDeviceSize        stride
         );
 
     private:
 
-        VkDevice    device_ = VK_NULL_HANDLE;
+        VKDevice&   device_;
         VkQueue     native_ = VK_NULL_HANDLE;
 
 };
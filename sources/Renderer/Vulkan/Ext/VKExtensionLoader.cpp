@@ -107,6 +107,64 @@ static bool DECL_LOADVKEXT_PROC(KHR_get_physical_device_properties2)
     return true;
 }
 
+static bool DECL_LOADVKEXT_PROC(KHR_timeline_semaphore)
+{
+    LOAD_VKPROC( vkGetSemaphoreCounterValueKHR );
+    LOAD_VKPROC( vkWaitSemaphoresKHR           );
+    LOAD_VKPROC( vkSignalSemaphoreKHR          );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_dynamic_rendering)
+{
+    LOAD_VKPROC( vkCmdBeginRenderingKHR );
+    LOAD_VKPROC( vkCmdEndRenderingKHR   );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_draw_indirect_count)
+{
+    LOAD_VKPROC( vkCmdDrawIndirectCountKHR         );
+    LOAD_VKPROC( vkCmdDrawIndexedIndirectCountKHR  );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_host_query_reset)
+{
+    LOAD_VKPROC( vkResetQueryPoolEXT );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state)
+{
+    LOAD_VKPROC( vkCmdSetCullModeEXT             );
+    LOAD_VKPROC( vkCmdSetFrontFaceEXT            );
+    LOAD_VKPROC( vkCmdSetPrimitiveTopologyEXT    );
+    LOAD_VKPROC( vkCmdSetViewportWithCountEXT    );
+    LOAD_VKPROC( vkCmdSetScissorWithCountEXT     );
+    LOAD_VKPROC( vkCmdSetDepthTestEnableEXT      );
+    LOAD_VKPROC( vkCmdSetDepthWriteEnableEXT     );
+    LOAD_VKPROC( vkCmdSetDepthCompareOpEXT       );
+    LOAD_VKPROC( vkCmdSetStencilTestEnableEXT    );
+    LOAD_VKPROC( vkCmdSetStencilOpEXT            );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state2)
+{
+    LOAD_VKPROC( vkCmdSetRasterizerDiscardEnableEXT  );
+    LOAD_VKPROC( vkCmdSetDepthBiasEnableEXT          );
+    LOAD_VKPROC( vkCmdSetPrimitiveRestartEnableEXT   );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state3)
+{
+    LOAD_VKPROC( vkCmdSetPolygonModeEXT      );
+    LOAD_VKPROC( vkCmdSetDepthClampEnableEXT );
+    return true;
+}
+
 #undef DECL_LOADVKEXT_PROC_BASE
 #undef DECL_LOADVKEXT_PROC_INSTANCE
 #undef DECL_LOADVKEXT_PROC
@@ -177,11 +235,19 @@ bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& sup
 
     /* Multi-vendor extensions */
     LOAD_VKEXT( KHR_get_physical_device_properties2 );
+    LOAD_VKEXT( KHR_timeline_semaphore              );
+    LOAD_VKEXT( KHR_dynamic_rendering               );
+    LOAD_VKEXT( KHR_draw_indirect_count             );
     LOAD_VKEXT( EXT_debug_marker                    );
     LOAD_VKEXT( EXT_conditional_rendering           );
     LOAD_VKEXT( EXT_transform_feedback              );
+    LOAD_VKEXT( EXT_host_query_reset                );
+    LOAD_VKEXT( EXT_extended_dynamic_state          );
+    LOAD_VKEXT( EXT_extended_dynamic_state2         );
+    LOAD_VKEXT( EXT_extended_dynamic_state3         );
 
     ENABLE_VKEXT( EXT_conservative_rasterization );
+    ENABLE_VKEXT( EXT_descriptor_indexing        );
 
     #undef LOAD_VKEXT
 
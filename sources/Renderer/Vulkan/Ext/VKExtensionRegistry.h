@@ -23,12 +23,20 @@ enum class VKExt
     /* Khronos extensions */
     KHR_maintenance1,
     KHR_get_physical_device_properties2,
+    KHR_timeline_semaphore,
+    KHR_dynamic_rendering,
+    KHR_draw_indirect_count,
 
     /* Multivendor extensions */
     EXT_debug_marker,
     EXT_conditional_rendering,
     EXT_transform_feedback,
     EXT_conservative_rasterization,
+    EXT_host_query_reset,
+    EXT_descriptor_indexing,
+    EXT_extended_dynamic_state,
+    EXT_extended_dynamic_state2,
+    EXT_extended_dynamic_state3,
 
     /* Enumeration entry counter */
     Count,
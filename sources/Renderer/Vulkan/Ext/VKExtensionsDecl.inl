@@ -71,6 +71,50 @@ DECL_VKPROC( vkGetPhysicalDeviceQueueFamilyProperties2KHR       );
 DECL_VKPROC( vkGetPhysicalDeviceMemoryProperties2KHR            );
 DECL_VKPROC( vkGetPhysicalDeviceSparseImageFormatProperties2KHR );
 
+/* VK_KHR_timeline_semaphore */
+
+DECL_VKPROC( vkGetSemaphoreCounterValueKHR );
+DECL_VKPROC( vkWaitSemaphoresKHR           );
+DECL_VKPROC( vkSignalSemaphoreKHR          );
+
+/* VK_KHR_dynamic_rendering */
+
+DECL_VKPROC( vkCmdBeginRenderingKHR );
+DECL_VKPROC( vkCmdEndRenderingKHR   );
+
+/* VK_KHR_draw_indirect_count */
+
+DECL_VKPROC( vkCmdDrawIndirectCountKHR         );
+DECL_VKPROC( vkCmdDrawIndexedIndirectCountKHR  );
+
+/* VK_EXT_host_query_reset */
+
+DECL_VKPROC( vkResetQueryPoolEXT );
+
+/* VK_EXT_extended_dynamic_state */
+
+DECL_VKPROC( vkCmdSetCullModeEXT             );
+DECL_VKPROC( vkCmdSetFrontFaceEXT            );
+DECL_VKPROC( vkCmdSetPrimitiveTopologyEXT    );
+DECL_VKPROC( vkCmdSetViewportWithCountEXT    );
+DECL_VKPROC( vkCmdSetScissorWithCountEXT     );
+DECL_VKPROC( vkCmdSetDepthTestEnableEXT      );
+DECL_VKPROC( vkCmdSetDepthWriteEnableEXT     );
+DECL_VKPROC( vkCmdSetDepthCompareOpEXT       );
+DECL_VKPROC( vkCmdSetStencilTestEnableEXT    );
+DECL_VKPROC( vkCmdSetStencilOpEXT            );
+
+/* VK_EXT_extended_dynamic_state2 */
+
+DECL_VKPROC( vkCmdSetRasterizerDiscardEnableEXT  );
+DECL_VKPROC( vkCmdSetDepthBiasEnableEXT          );
+DECL_VKPROC( vkCmdSetPrimitiveRestartEnableEXT   );
+
+/* VK_EXT_extended_dynamic_state3 */
+
+DECL_VKPROC( vkCmdSetPolygonModeEXT      );
+DECL_VKPROC( vkCmdSetDepthClampEnableEXT );
+
 #undef DECL_VKPROC
 
 
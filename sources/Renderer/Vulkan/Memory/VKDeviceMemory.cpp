@@ -41,17 +41,31 @@ VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t
 
 void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
 {
-    void* data = nullptr;
+    LLGL_ASSERT(size == VK_WHOLE_SIZE || offset + size <= size_);
 
-    VkResult result = vkMapMemory(device, deviceMemory_, offset, size, 0, &data);
-    VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    std::lock_guard<std::mutex> guard{ mapMutex_ };
 
-    return data;
+    /* Map entire device memory chunk only once, since Vulkan does not allow to map the same VkDeviceMemory object multiple times */
+    if (mapCounter_ == 0)
+    {
+        VkResult result = vkMapMemory(device, deviceMemory_, 0, VK_WHOLE_SIZE, 0, &mappedData_);
+        VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    }
+
+    ++mapCounter_;
+
+    return static_cast<char*>(mappedData_) + offset;
 }
 
 void VKDeviceMemory::Unmap(VkDevice device)
 {
-    vkUnmapMemory(device, deviceMemory_);
+    std::lock_guard<std::mutex> guard{ mapMutex_ };
+    LLGL_ASSERT(mapCounter_ > 0, "Vulkan device memory unmapped more often than it was mapped");
+    if (--mapCounter_ == 0)
+    {
+        vkUnmapMemory(device, deviceMemory_);
+        mappedData_ = nullptr;
+    }
 }
 
 VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
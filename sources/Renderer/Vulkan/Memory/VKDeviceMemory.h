@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #ifdef LLGL_DEBUG
 #   include <ostream>
@@ -46,10 +47,16 @@ class VKDeviceMemory
         VKDeviceMemory(const VKDeviceMemory&) = delete;
         VKDeviceMemory& operator = (const VKDeviceMemory&) = delete;
 
-        VKDeviceMemory(VKDeviceMemory&&) = default;
-        VKDeviceMemory& operator = (VKDeviceMemory&&) = default;
+        VKDeviceMemory(VKDeviceMemory&&) = delete;
+        VKDeviceMemory& operator = (VKDeviceMemory&&) = delete;
 
+        /*
+        Maps the specified range of this device memory chunk into CPU memory space.
+        The entire chunk is mapped only once and reference counted, so several regions of the same chunk can be mapped at the same time.
+        */
         void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
+
+        // Decrements the mapping reference counter and unmaps this device memory chunk when it reaches zero.
         void Unmap(VkDevice device);
 
         // Tries to allocate a new block within this device memory chunk, and returns null of failure.
@@ -139,6 +146,10 @@ class VKDeviceMemory
         VkDeviceSize                                        size_                   = 0;
         std::uint32_t                                       memoryTypeIndex_        = 0;
 
+        void*                                               mappedData_             = nullptr;
+        std::uint32_t                                       mapCounter_             = 0;
+        std::mutex                                          mapMutex_;                      // Regions of the same chunk can be mapped on loader threads
+
         VkDeviceSize                                        maxNewBlockSize_        = 0;
         std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  blocks_;
 
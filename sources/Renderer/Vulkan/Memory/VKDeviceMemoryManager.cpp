@@ -37,6 +37,7 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     const VkDeviceSize  allocationSize  = std::max(minAllocationSize_, alignedSize);
     const std::uint32_t memoryTypeIndex = FindMemoryType(memoryTypeBits, properties);
 
+    std::lock_guard<std::mutex> guard{ mutex_ };
     if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
         return chunk->Allocate(size, alignment);
     else
@@ -59,6 +60,7 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
 {
     if (region)
     {
+        std::lock_guard<std::mutex> guard{ mutex_ };
         if (VKDeviceMemory* chunk = region->GetParentChunk())
         {
             /* Release block in chunk */
@@ -17,6 +17,7 @@
 #include "VKDeviceMemoryRegion.h"
 #include <vector>
 #include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -96,6 +97,7 @@ class VKDeviceMemoryManager
         bool                                        reduceFragmentation_    = false;
 
         UnorderedUniquePtrVector<VKDeviceMemory>    chunks_;
+        std::mutex                                  mutex_;                         // Resources can be allocated on loader threads
 
 };
 
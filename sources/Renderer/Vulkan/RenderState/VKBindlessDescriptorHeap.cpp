@@ -0,0 +1,315 @@
+/*
+ * VKBindlessDescriptorHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKBindlessDescriptorHeap.h"
+#include "../VKCore.h"
+#include "../VKPhysicalDevice.h"
+#include "../VKStaticLimits.h"
+#include "../Buffer/VKBuffer.h"
+#include "../Texture/VKTexture.h"
+#include "../Texture/VKSampler.h"
+#include "../../CheckedCast.h"
+#include "../../../Core/Assertion.h"
+#include <LLGL/Constants.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static const VkDescriptorType g_bindlessDescriptorTypes[VKBindlessDescriptorHeap::BindingType_Num] =
+{
+    VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+    VK_DESCRIPTOR_TYPE_SAMPLER,
+    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+};
+
+VKBindlessDescriptorHeap::VKBindlessDescriptorHeap(VkDevice device, const VKPhysicalDevice& physicalDevice) :
+    device_         { device                                  },
+    setLayout_      { device, vkDestroyDescriptorSetLayout    },
+    descriptorPool_ { device, vkDestroyDescriptorPool         }
+{
+    /* Clamp descriptor array sizes to the update-after-bind limits of the device */
+    const VkPhysicalDeviceDescriptorIndexingPropertiesEXT& limits = physicalDevice.GetDescriptorIndexingProperties();
+
+    allocators_[BindingType_Textures].capacity = std::min(
+        LLGL_VK_MAX_NUM_BINDLESS_TEXTURES,
+        std::min(limits.maxPerStageDescriptorUpdateAfterBindSampledImages, limits.maxDescriptorSetUpdateAfterBindSampledImages)
+    );
+    allocators_[BindingType_Samplers].capacity = std::min(
+        LLGL_VK_MAX_NUM_BINDLESS_SAMPLERS,
+        std::min(limits.maxPerStageDescriptorUpdateAfterBindSamplers, limits.maxDescriptorSetUpdateAfterBindSamplers)
+    );
+    allocators_[BindingType_Buffers].capacity = std::min(
+        LLGL_VK_MAX_NUM_BINDLESS_BUFFERS,
+        std::min(limits.maxPerStageDescriptorUpdateAfterBindStorageBuffers, limits.maxDescriptorSetUpdateAfterBindStorageBuffers)
+    );
+
+    /*
+    All descriptor arrays are visible to every shader stage and allocated from a single pool,
+    so their sum must not exceed the per-stage resource limit and the pool limit either
+    */
+    const std::uint64_t maxTotalCapacity = std::min(limits.maxPerStageUpdateAfterBindResources, limits.maxUpdateAfterBindDescriptorsInAllPools);
+
+    std::uint64_t totalCapacity = 0;
+    for_range(i, BindingType_Num)
+        totalCapacity += allocators_[i].capacity;
+
+    if (totalCapacity > maxTotalCapacity)
+    {
+        /* Shrink all descriptor arrays proportionally to fit into the limit */
+        for_range(i, BindingType_Num)
+        {
+            allocators_[i].capacity = static_cast<std::uint32_t>(
+                static_cast<std::uint64_t>(allocators_[i].capacity) * maxTotalCapacity / totalCapacity
+            );
+        }
+    }
+
+    CreateDescriptorSetLayout();
+    CreateDescriptorPool();
+    AllocateDescriptorSet();
+}
+
+std::uint32_t VKBindlessDescriptorHeap::GetOrAllocateIndex(Resource& resource)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Return previously allocated index */
+    auto it = resourceIndices_.find(&resource);
+    if (it != resourceIndices_.end())
+        return it->second.index;
+
+    /* Allocate new index from the free-list of the respective descriptor array */
+    BindingType bindingType;
+    if (!GetBindingType(resource, bindingType))
+        return LLGL_INVALID_BINDLESS_INDEX;
+
+    const std::uint32_t index = allocators_[bindingType].Allocate();
+    if (index == LLGL_INVALID_BINDLESS_INDEX)
+        return LLGL_INVALID_BINDLESS_INDEX;
+
+    WriteDescriptor(resource, bindingType, index);
+    resourceIndices_[&resource] = ResourceIndex{ bindingType, index };
+
+    return index;
+}
+
+void VKBindlessDescriptorHeap::FreeIndex(const Resource& resource)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    auto it = resourceIndices_.find(&resource);
+    if (it != resourceIndices_.end())
+    {
+        allocators_[it->second.bindingType].Free(it->second.index);
+        resourceIndices_.erase(it);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t VKBindlessDescriptorHeap::IndexAllocator::Allocate()
+{
+    if (!freeIndices.empty())
+    {
+        const std::uint32_t index = freeIndices.back();
+        freeIndices.pop_back();
+        return index;
+    }
+    if (numIndices < capacity)
+        return numIndices++;
+    return LLGL_INVALID_BINDLESS_INDEX;
+}
+
+void VKBindlessDescriptorHeap::IndexAllocator::Free(std::uint32_t index)
+{
+    freeIndices.push_back(index);
+}
+
+void VKBindlessDescriptorHeap::CreateDescriptorSetLayout()
+{
+    /* All descriptor arrays can be updated while the descriptor set is bound and may contain unused descriptors */
+    VkDescriptorSetLayoutBinding setLayoutBindings[BindingType_Num];
+    VkDescriptorBindingFlagsEXT bindingFlags[BindingType_Num];
+
+    for_range(i, BindingType_Num)
+    {
+        setLayoutBindings[i].binding            = i;
+        setLayoutBindings[i].descriptorType     = g_bindlessDescriptorTypes[i];
+        setLayoutBindings[i].descriptorCount    = allocators_[i].capacity;
+        setLayoutBindings[i].stageFlags         = VK_SHADER_STAGE_ALL;
+        setLayoutBindings[i].pImmutableSamplers = nullptr;
+
+        bindingFlags[i] =
+        (
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT           |
+            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT         |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT
+        );
+    }
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsInfo;
+    {
+        bindingFlagsInfo.sType          = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+        bindingFlagsInfo.pNext          = nullptr;
+        bindingFlagsInfo.bindingCount   = BindingType_Num;
+        bindingFlagsInfo.pBindingFlags  = bindingFlags;
+    }
+    VkDescriptorSetLayoutCreateInfo createInfo;
+    {
+        createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        createInfo.pNext        = &bindingFlagsInfo;
+        createInfo.flags        = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+        createInfo.bindingCount = BindingType_Num;
+        createInfo.pBindings    = setLayoutBindings;
+    }
+    auto result = vkCreateDescriptorSetLayout(device_, &createInfo, nullptr, setLayout_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor set layout for bindless resources");
+}
+
+void VKBindlessDescriptorHeap::CreateDescriptorPool()
+{
+    VkDescriptorPoolSize poolSizes[BindingType_Num];
+
+    for_range(i, BindingType_Num)
+    {
+        poolSizes[i].type               = g_bindlessDescriptorTypes[i];
+        poolSizes[i].descriptorCount    = allocators_[i].capacity;
+    }
+
+    VkDescriptorPoolCreateInfo poolCreateInfo;
+    {
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+        poolCreateInfo.maxSets          = 1;
+        poolCreateInfo.poolSizeCount    = BindingType_Num;
+        poolCreateInfo.pPoolSizes       = poolSizes;
+    }
+    auto result = vkCreateDescriptorPool(device_, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool for bindless resources");
+}
+
+void VKBindlessDescriptorHeap::AllocateDescriptorSet()
+{
+    VkDescriptorSetLayout setLayout = setLayout_.Get();
+    VkDescriptorSetAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.descriptorPool        = descriptorPool_.Get();
+        allocInfo.descriptorSetCount    = 1;
+        allocInfo.pSetLayouts           = &setLayout;
+    }
+    auto result = vkAllocateDescriptorSets(device_, &allocInfo, &descriptorSet_);
+    VKThrowIfFailed(result, "failed to allocate Vulkan descriptor set for bindless resources");
+}
+
+bool VKBindlessDescriptorHeap::GetBindingType(Resource& resource, BindingType& outBindingType) const
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Texture:
+        {
+            /* Only textures with a default image view can be sampled in shaders */
+            auto& textureVK = LLGL_CAST(VKTexture&, resource);
+            if ((textureVK.GetUsageFlags() & VK_IMAGE_USAGE_SAMPLED_BIT) == 0 || textureVK.GetVkImageView() == VK_NULL_HANDLE)
+                return false;
+            outBindingType = BindingType_Textures;
+            return true;
+        }
+
+        case ResourceType::Sampler:
+        {
+            outBindingType = BindingType_Samplers;
+            return true;
+        }
+
+        case ResourceType::Buffer:
+        {
+            /* Sampled and storage buffers are both mapped to SSBOs */
+            auto& bufferVK = LLGL_CAST(VKBuffer&, resource);
+            if ((bufferVK.GetBindFlags() & (BindFlags::Sampled | BindFlags::Storage)) == 0)
+                return false;
+            outBindingType = BindingType_Buffers;
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+void VKBindlessDescriptorHeap::WriteDescriptor(Resource& resource, BindingType bindingType, std::uint32_t index)
+{
+    VkDescriptorImageInfo   imageInfo   = {};
+    VkDescriptorBufferInfo  bufferInfo  = {};
+
+    VkWriteDescriptorSet writeDesc;
+    {
+        writeDesc.sType             = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDesc.pNext             = nullptr;
+        writeDesc.dstSet            = descriptorSet_;
+        writeDesc.dstBinding        = static_cast<std::uint32_t>(bindingType);
+        writeDesc.dstArrayElement   = index;
+        writeDesc.descriptorCount   = 1;
+        writeDesc.descriptorType    = g_bindlessDescriptorTypes[bindingType];
+        writeDesc.pImageInfo        = nullptr;
+        writeDesc.pBufferInfo       = nullptr;
+        writeDesc.pTexelBufferView  = nullptr;
+    }
+
+    switch (bindingType)
+    {
+        case BindingType_Textures:
+        {
+            auto& textureVK = LLGL_CAST(VKTexture&, resource);
+            imageInfo.sampler       = VK_NULL_HANDLE;
+            imageInfo.imageView     = textureVK.GetVkImageView();
+            imageInfo.imageLayout   = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            writeDesc.pImageInfo    = &imageInfo;
+        }
+        break;
+
+        case BindingType_Samplers:
+        {
+            auto& samplerVK = LLGL_CAST(VKSampler&, resource);
+            imageInfo.sampler       = samplerVK.GetVkSampler();
+            imageInfo.imageView     = VK_NULL_HANDLE;
+            imageInfo.imageLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
+            writeDesc.pImageInfo    = &imageInfo;
+        }
+        break;
+
+        case BindingType_Buffers:
+        {
+            auto& bufferVK = LLGL_CAST(VKBuffer&, resource);
+            bufferInfo.buffer       = bufferVK.GetVkBuffer();
+            bufferInfo.offset       = 0;
+            bufferInfo.range        = VK_WHOLE_SIZE;
+            writeDesc.pBufferInfo   = &bufferInfo;
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    vkUpdateDescriptorSets(device_, 1, &writeDesc, 0, nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,125 @@
+/*
+ * VKBindlessDescriptorHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_BINDLESS_DESCRIPTOR_HEAP_H
+#define LLGL_VK_BINDLESS_DESCRIPTOR_HEAP_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <LLGL/ForwardDecls.h>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKPhysicalDevice;
+
+/*
+Global descriptor set with one update-after-bind descriptor array per resource type (VK_EXT_descriptor_indexing).
+Each texture, sampler, and storage buffer is assigned a stable index into its respective array on first query,
+which is returned to a free-list when the resource is released. All functions are thread-safe.
+*/
+class VKBindlessDescriptorHeap
+{
+
+    public:
+
+        // Binding points of the descriptor arrays within the bindless descriptor set.
+        enum BindingType
+        {
+            BindingType_Textures = 0,
+            BindingType_Samplers,
+            BindingType_Buffers,
+
+            BindingType_Num,
+        };
+
+    public:
+
+        VKBindlessDescriptorHeap(const VKBindlessDescriptorHeap&) = delete;
+        VKBindlessDescriptorHeap& operator = (const VKBindlessDescriptorHeap&) = delete;
+
+        VKBindlessDescriptorHeap(VkDevice device, const VKPhysicalDevice& physicalDevice);
+
+        // Returns the index of the specified resource and writes its descriptor if it has not been allocated yet. Returns LLGL_INVALID_BINDLESS_INDEX on failure.
+        std::uint32_t GetOrAllocateIndex(Resource& resource);
+
+        // Returns the index of the specified resource to the free-list. Must be called before the resource is destroyed.
+        void FreeIndex(const Resource& resource);
+
+        // Returns the native descriptor set layout for the bindless descriptor set.
+        inline VkDescriptorSetLayout GetVkDescriptorSetLayout() const
+        {
+            return setLayout_.Get();
+        }
+
+        // Returns the native bindless descriptor set.
+        inline VkDescriptorSet GetVkDescriptorSet() const
+        {
+            return descriptorSet_;
+        }
+
+    private:
+
+        // Free-list allocator for the indices of a single descriptor array.
+        struct IndexAllocator
+        {
+            std::uint32_t               capacity    = 0;
+            std::uint32_t               numIndices  = 0;    // Number of indices that have been handed out at least once.
+            std::vector<std::uint32_t>  freeIndices;
+
+            std::uint32_t Allocate();
+            void Free(std::uint32_t index);
+        };
+
+        // Allocated index of a resource and the descriptor array it belongs to.
+        struct ResourceIndex
+        {
+            BindingType     bindingType;
+            std::uint32_t   index;
+        };
+
+    private:
+
+        void CreateDescriptorSetLayout();
+        void CreateDescriptorPool();
+        void AllocateDescriptorSet();
+
+        // Determines the descriptor array for the specified resource. Returns false if the resource cannot be accessed as bindless resource.
+        bool GetBindingType(Resource& resource, BindingType& outBindingType) const;
+
+        // Writes the descriptor of the specified resource into its descriptor array.
+        void WriteDescriptor(Resource& resource, BindingType bindingType, std::uint32_t index);
+
+    private:
+
+        VkDevice                                            device_         = VK_NULL_HANDLE;
+        VKPtr<VkDescriptorSetLayout>                        setLayout_;
+        VKPtr<VkDescriptorPool>                             descriptorPool_;
+        VkDescriptorSet                                     descriptorSet_  = VK_NULL_HANDLE;
+
+        std::mutex                                          mutex_;
+        IndexAllocator                                      allocators_[BindingType_Num];
+        std::unordered_map<const Resource*, ResourceIndex>  resourceIndices_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
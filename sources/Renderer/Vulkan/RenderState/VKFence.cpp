@@ -7,6 +7,7 @@
 
 #include "VKFence.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensionRegistry.h"
 
 
 namespace LLGL
@@ -14,7 +15,9 @@ namespace LLGL
 
 
 VKFence::VKFence(VkDevice device) :
-    fence_ { device, vkDestroyFence }
+    fence_             { device, vkDestroyFence     },
+    semaphore_         { device, vkDestroySemaphore },
+    timelineSemaphore_ { device, vkDestroySemaphore }
 {
     VkFenceCreateInfo createInfo;
     {
@@ -24,6 +27,27 @@ VKFence::VKFence(VkDevice device) :
     }
     auto result = vkCreateFence(device, &createInfo, nullptr, fence_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan fence");
+    CreateVkSemaphore(device);
+
+    if (HasExtension(VKExt::KHR_timeline_semaphore))
+    {
+        /* Create timeline semaphore for 64-bit fence values (see CommandQueue::SubmitSignal) */
+        VkSemaphoreTypeCreateInfoKHR typeCreateInfo;
+        {
+            typeCreateInfo.sType            = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+            typeCreateInfo.pNext            = nullptr;
+            typeCreateInfo.semaphoreType    = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+            typeCreateInfo.initialValue     = 0;
+        }
+        VkSemaphoreCreateInfo semaphoreCreateInfo;
+        {
+            semaphoreCreateInfo.sType   = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            semaphoreCreateInfo.pNext   = &typeCreateInfo;
+            semaphoreCreateInfo.flags   = 0;
+        }
+        result = vkCreateSemaphore(device, &semaphoreCreateInfo, nullptr, timelineSemaphore_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore");
+    }
 }
 
 void VKFence::Reset(VkDevice device)
@@ -36,6 +60,48 @@ bool VKFence::Wait(VkDevice device, std::uint64_t timeout)
     return (vkWaitForFences(device, 1, fence_.GetAddressOf(), VK_TRUE, timeout) == VK_SUCCESS);
 }
 
+VkSemaphore VKFence::SignalSemaphore(VkDevice device)
+{
+    /*
+    A binary semaphore must not be signaled twice without a wait in between,
+    so replace the semaphore if its previous signal has never been consumed.
+    The semaphore must not be destroyed while its signal operation is still pending,
+    so wait for the fence of that previous submission first.
+    */
+    if (semaphoreSignaled_)
+    {
+        Wait(device, UINT64_MAX);
+        CreateVkSemaphore(device);
+    }
+    semaphoreSignaled_ = true;
+    return semaphore_;
+}
+
+VkSemaphore VKFence::ConsumeSemaphore()
+{
+    if (!semaphoreSignaled_)
+        return VK_NULL_HANDLE;
+    semaphoreSignaled_ = false;
+    return semaphore_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKFence::CreateVkSemaphore(VkDevice device)
+{
+    VkSemaphoreCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    auto result = vkCreateSemaphore(device, &createInfo, nullptr, semaphore_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan semaphore for fence");
+}
+
 
 } // /namespace LLGL
 
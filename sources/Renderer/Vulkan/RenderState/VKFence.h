@@ -29,6 +29,31 @@ class VKFence final : public Fence
         void Reset(VkDevice device);
         bool Wait(VkDevice device, std::uint64_t timeout);
 
+        // Returns the semaphore that is signaled alongside the fence. A previous signal that has not been waited on is discarded once its submission has completed.
+        // This must be called before the fence is reset for the next submission.
+        VkSemaphore SignalSemaphore(VkDevice device);
+
+        // Returns the semaphore a GPU queue can wait on once, or VK_NULL_HANDLE if its signal has already been consumed.
+        VkSemaphore ConsumeSemaphore();
+
+        // Returns the timeline semaphore or VK_NULL_HANDLE if VK_KHR_timeline_semaphore is not supported.
+        inline VkSemaphore GetTimelineSemaphore() const
+        {
+            return timelineSemaphore_;
+        }
+
+        // Stores the value that was most recently submitted for the timeline semaphore.
+        inline void SetSignaledValue(std::uint64_t value)
+        {
+            signaledValue_ = value;
+        }
+
+        // Returns the value that was most recently submitted for the timeline semaphore or 0 if it has never been signaled.
+        inline std::uint64_t GetSignaledValue() const
+        {
+            return signaledValue_;
+        }
+
         // Returns the native VkFence handle.
         inline VkFence GetVkFence() const
         {
@@ -37,7 +62,15 @@ class VKFence final : public Fence
 
     private:
 
-        VKPtr<VkFence> fence_;
+        void CreateVkSemaphore(VkDevice device);
+
+    private:
+
+        VKPtr<VkFence>      fence_;
+        VKPtr<VkSemaphore>  semaphore_;
+        bool                semaphoreSignaled_  = false;
+        VKPtr<VkSemaphore>  timelineSemaphore_;
+        std::uint64_t       signaledValue_      = 0;
 
 };
 
@@ -9,6 +9,7 @@
 #include "VKPipelineLayout.h"
 #include "VKRenderPass.h"
 #include "VKPipelineCache.h"
+#include "VKGraphicsPipelinePool.h"
 #include "../Ext/VKExtensionRegistry.h"
 #include "../Shader/VKShader.h"
 #include "../VKTypes.h"
@@ -26,6 +27,33 @@ namespace LLGL
 {
 
 
+static std::uint32_t GetDynamicGraphicsStateFlags(const GraphicsPipelineDescriptor& desc, const VKGraphicsPipelineLimits& limits)
+{
+    std::uint32_t flags = 0;
+
+    if (limits.extendedDynamicState && HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        flags |= (VKDynamicGraphicsState_Rasterizer | VKDynamicGraphicsState_Topology | VKDynamicGraphicsState_DepthStencil);
+
+        /* Static viewports are set on the command buffer, so PSOs with the same number of viewports can share the native PSO */
+        if (!desc.viewports.empty())
+            flags |= VKDynamicGraphicsState_Viewports;
+
+        if (limits.extendedDynamicState2 && HasExtension(VKExt::EXT_extended_dynamic_state2))
+            flags |= VKDynamicGraphicsState_State2;
+
+        if (HasExtension(VKExt::EXT_extended_dynamic_state3))
+        {
+            if (limits.extendedDynamicState3PolygonMode)
+                flags |= VKDynamicGraphicsState_PolygonMode;
+            if (limits.extendedDynamicState3DepthClamp)
+                flags |= VKDynamicGraphicsState_DepthClamp;
+        }
+    }
+
+    return flags;
+}
+
 VKGraphicsPSO::VKGraphicsPSO(
     VkDevice                            device,
     const RenderPass*                   defaultRenderPass,
@@ -35,7 +63,8 @@ VKGraphicsPSO::VKGraphicsPSO(
 :
     VKPipelineState    { device, VK_PIPELINE_BIND_POINT_GRAPHICS, GetShadersAsArray(desc), desc.pipelineLayout },
     scissorEnabled_    { desc.rasterizer.scissorTestEnabled                                                    },
-    hasDynamicScissor_ { desc.scissors.empty()                                                                 }
+    hasDynamicScissor_ { desc.scissors.empty()                                                                 },
+    dynamicStateFlags_ { GetDynamicGraphicsStateFlags(desc, limits)                                            }
 {
     /* Get render pass from descriptor or default render pass */
     const RenderPass* renderPass = (desc.renderPass != nullptr ? desc.renderPass : defaultRenderPass);
@@ -273,11 +302,14 @@ static void CreateColorBlendState(
 
 static void CreateDynamicState(
     const GraphicsPipelineDescriptor&   desc,
+    std::uint32_t                       dynamicStateFlags,
     VkPipelineDynamicStateCreateInfo&   createInfo,
     std::vector<VkDynamicState>&        dynamicStatesVK)
 {
     if (desc.viewports.empty())
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_VIEWPORT);
+    else if ((dynamicStateFlags & VKDynamicGraphicsState_Viewports) != 0)
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT_EXT);
     if (desc.scissors.empty())
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_SCISSOR);
     if (desc.blend.blendFactorDynamic)
@@ -285,6 +317,37 @@ static void CreateDynamicState(
     if (desc.stencil.referenceDynamic)
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_REFERENCE);
 
+    /* Append extended dynamic states */
+    if ((dynamicStateFlags & VKDynamicGraphicsState_Rasterizer) != 0)
+    {
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_FRONT_FACE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_LINE_WIDTH);
+    }
+    if ((dynamicStateFlags & VKDynamicGraphicsState_Topology) != 0)
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+    if ((dynamicStateFlags & VKDynamicGraphicsState_DepthStencil) != 0)
+    {
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_OP_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_WRITE_MASK);
+    }
+    if ((dynamicStateFlags & VKDynamicGraphicsState_State2) != 0)
+    {
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT);
+    }
+    if ((dynamicStateFlags & VKDynamicGraphicsState_PolygonMode) != 0)
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_POLYGON_MODE_EXT);
+    if ((dynamicStateFlags & VKDynamicGraphicsState_DepthClamp) != 0)
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT);
+
     createInfo.sType                = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
     createInfo.pNext                = nullptr;
     createInfo.flags                = 0;
@@ -292,6 +355,227 @@ static void CreateDynamicState(
     createInfo.pDynamicStates       = (dynamicStatesVK.empty() ? nullptr : dynamicStatesVK.data());
 }
 
+// Returns the first primitive topology of the same topology class, since only the class must match when the topology is set dynamically.
+static VkPrimitiveTopology GetPrimitiveTopologyClass(VkPrimitiveTopology topology)
+{
+    switch (topology)
+    {
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+            return VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+            return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+            return VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY;
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_WITH_ADJACENCY:
+            return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_WITH_ADJACENCY;
+        default:
+            return topology;
+    }
+}
+
+/*
+Moves all states that are set on the command buffer from the native create-info structures into the output dynamic state.
+The create-info structures are reset to default values, so they only contain the static state that identifies the native PSO.
+*/
+static void ExtractDynamicGraphicsState(
+    std::uint32_t                               dynamicStateFlags,
+    VkPipelineInputAssemblyStateCreateInfo&     inputAssembly,
+    VkPipelineRasterizationStateCreateInfo&     rasterizerState,
+    VkPipelineDepthStencilStateCreateInfo&      depthStencilState,
+    VKDynamicGraphicsState&                     outState)
+{
+    if ((dynamicStateFlags & VKDynamicGraphicsState_Rasterizer) != 0)
+    {
+        outState.cullMode                   = rasterizerState.cullMode;
+        outState.frontFace                  = rasterizerState.frontFace;
+        outState.lineWidth                  = rasterizerState.lineWidth;
+        rasterizerState.cullMode            = VK_CULL_MODE_NONE;
+        rasterizerState.frontFace           = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        rasterizerState.lineWidth           = 1.0f;
+    }
+    if ((dynamicStateFlags & VKDynamicGraphicsState_Topology) != 0)
+    {
+        outState.primitiveTopology          = inputAssembly.topology;
+        inputAssembly.topology              = GetPrimitiveTopologyClass(inputAssembly.topology);
+    }
+    if ((dynamicStateFlags & VKDynamicGraphicsState_DepthStencil) != 0)
+    {
+        outState.depthTestEnable            = depthStencilState.depthTestEnable;
+        outState.depthWriteEnable           = depthStencilState.depthWriteEnable;
+        outState.depthCompareOp             = depthStencilState.depthCompareOp;
+        outState.stencilTestEnable          = depthStencilState.stencilTestEnable;
+        outState.stencilFront               = depthStencilState.front;
+        outState.stencilBack                = depthStencilState.back;
+        depthStencilState.depthTestEnable   = VK_FALSE;
+        depthStencilState.depthWriteEnable  = VK_FALSE;
+        depthStencilState.depthCompareOp    = VK_COMPARE_OP_NEVER;
+        depthStencilState.stencilTestEnable = VK_FALSE;
+
+        /* Only the stencil reference remains part of the static state */
+        const std::uint32_t frontReference = depthStencilState.front.reference;
+        const std::uint32_t backReference = depthStencilState.back.reference;
+        depthStencilState.front             = VkStencilOpState{};
+        depthStencilState.back              = VkStencilOpState{};
+        depthStencilState.front.reference   = frontReference;
+        depthStencilState.back.reference    = backReference;
+    }
+    if ((dynamicStateFlags & VKDynamicGraphicsState_State2) != 0)
+    {
+        outState.rasterizerDiscardEnable        = rasterizerState.rasterizerDiscardEnable;
+        outState.depthBiasEnable                = rasterizerState.depthBiasEnable;
+        outState.depthBiasConstantFactor        = rasterizerState.depthBiasConstantFactor;
+        outState.depthBiasClamp                 = rasterizerState.depthBiasClamp;
+        outState.depthBiasSlopeFactor           = rasterizerState.depthBiasSlopeFactor;
+        outState.primitiveRestartEnable         = inputAssembly.primitiveRestartEnable;
+        rasterizerState.rasterizerDiscardEnable = VK_FALSE;
+        rasterizerState.depthBiasEnable         = VK_FALSE;
+        rasterizerState.depthBiasConstantFactor = 0.0f;
+        rasterizerState.depthBiasClamp          = 0.0f;
+        rasterizerState.depthBiasSlopeFactor    = 0.0f;
+        inputAssembly.primitiveRestartEnable    = VK_FALSE;
+    }
+    if ((dynamicStateFlags & VKDynamicGraphicsState_PolygonMode) != 0)
+    {
+        outState.polygonMode                = rasterizerState.polygonMode;
+        rasterizerState.polygonMode         = VK_POLYGON_MODE_FILL;
+    }
+    if ((dynamicStateFlags & VKDynamicGraphicsState_DepthClamp) != 0)
+    {
+        outState.depthClampEnable           = rasterizerState.depthClampEnable;
+        rasterizerState.depthClampEnable    = VK_FALSE;
+    }
+}
+
+static void AppendStencilOpStateToKey(VKGraphicsPipelineKey& key, const VkStencilOpState& state)
+{
+    key.Append(static_cast<std::uint32_t>(state.failOp));
+    key.Append(static_cast<std::uint32_t>(state.passOp));
+    key.Append(static_cast<std::uint32_t>(state.depthFailOp));
+    key.Append(static_cast<std::uint32_t>(state.compareOp));
+    key.Append(state.compareMask);
+    key.Append(state.writeMask);
+    key.Append(state.reference);
+}
+
+// Serializes all static states of the native PSO create-info into the specified key. Render passes are identified by their attachment formats since compatible render passes can share PSOs.
+static void AppendGraphicsPipelineStateToKey(
+    VKGraphicsPipelineKey&                          key,
+    const VkGraphicsPipelineCreateInfo&             createInfo,
+    const VkPipelineDynamicStateCreateInfo&         dynamicState,
+    const VKRenderPass&                             renderPass)
+{
+    /* Append input assembly and tessellation state */
+    const VkPipelineInputAssemblyStateCreateInfo& inputAssembly = *createInfo.pInputAssemblyState;
+    key.Append(static_cast<std::uint32_t>(inputAssembly.topology));
+    key.Append(inputAssembly.primitiveRestartEnable);
+    key.Append(createInfo.pTessellationState != nullptr ? createInfo.pTessellationState->patchControlPoints : 0u);
+
+    /* Append viewport state; Dynamic viewports and scissors only contribute their count */
+    const VkPipelineViewportStateCreateInfo& viewportState = *createInfo.pViewportState;
+    key.Append(viewportState.viewportCount);
+    key.Append(viewportState.scissorCount);
+
+    bool hasDynamicViewports = false, hasDynamicScissors = false;
+    for_range(i, dynamicState.dynamicStateCount)
+    {
+        const VkDynamicState state = dynamicState.pDynamicStates[i];
+        key.Append(static_cast<std::uint32_t>(state));
+        if (state == VK_DYNAMIC_STATE_VIEWPORT || state == VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT_EXT)
+            hasDynamicViewports = true;
+        else if (state == VK_DYNAMIC_STATE_SCISSOR)
+            hasDynamicScissors = true;
+    }
+
+    if (!hasDynamicViewports && viewportState.pViewports != nullptr)
+    {
+        for_range(i, viewportState.viewportCount)
+        {
+            const VkViewport& viewport = viewportState.pViewports[i];
+            key.Append(viewport.x);
+            key.Append(viewport.y);
+            key.Append(viewport.width);
+            key.Append(viewport.height);
+            key.Append(viewport.minDepth);
+            key.Append(viewport.maxDepth);
+        }
+    }
+    if (!hasDynamicScissors && viewportState.pScissors != nullptr)
+    {
+        for_range(i, viewportState.scissorCount)
+        {
+            const VkRect2D& scissor = viewportState.pScissors[i];
+            key.Append(static_cast<std::uint32_t>(scissor.offset.x));
+            key.Append(static_cast<std::uint32_t>(scissor.offset.y));
+            key.Append(scissor.extent.width);
+            key.Append(scissor.extent.height);
+        }
+    }
+
+    /* Append rasterizer state */
+    const VkPipelineRasterizationStateCreateInfo& rasterizerState = *createInfo.pRasterizationState;
+    key.Append(rasterizerState.depthClampEnable);
+    key.Append(rasterizerState.rasterizerDiscardEnable);
+    key.Append(static_cast<std::uint32_t>(rasterizerState.polygonMode));
+    key.Append(rasterizerState.cullMode);
+    key.Append(static_cast<std::uint32_t>(rasterizerState.frontFace));
+    key.Append(rasterizerState.depthBiasEnable);
+    key.Append(rasterizerState.depthBiasConstantFactor);
+    key.Append(rasterizerState.depthBiasClamp);
+    key.Append(rasterizerState.depthBiasSlopeFactor);
+    key.Append(rasterizerState.lineWidth);
+    key.Append(rasterizerState.pNext != nullptr ? 1u : 0u);
+
+    /* Append multi-sample state */
+    const VkPipelineMultisampleStateCreateInfo& multisampleState = *createInfo.pMultisampleState;
+    key.Append(static_cast<std::uint32_t>(multisampleState.rasterizationSamples));
+    key.Append(multisampleState.pSampleMask != nullptr ? *multisampleState.pSampleMask : ~0u);
+    key.Append(multisampleState.alphaToCoverageEnable);
+
+    /* Append depth-stencil state */
+    const VkPipelineDepthStencilStateCreateInfo& depthStencilState = *createInfo.pDepthStencilState;
+    key.Append(depthStencilState.depthTestEnable);
+    key.Append(depthStencilState.depthWriteEnable);
+    key.Append(static_cast<std::uint32_t>(depthStencilState.depthCompareOp));
+    key.Append(depthStencilState.stencilTestEnable);
+    AppendStencilOpStateToKey(key, depthStencilState.front);
+    AppendStencilOpStateToKey(key, depthStencilState.back);
+
+    /* Append color blend state */
+    const VkPipelineColorBlendStateCreateInfo& colorBlendState = *createInfo.pColorBlendState;
+    key.Append(colorBlendState.logicOpEnable);
+    key.Append(static_cast<std::uint32_t>(colorBlendState.logicOp));
+    key.Append(colorBlendState.attachmentCount);
+    for_range(i, colorBlendState.attachmentCount)
+    {
+        const VkPipelineColorBlendAttachmentState& attachment = colorBlendState.pAttachments[i];
+        key.Append(attachment.blendEnable);
+        key.Append(static_cast<std::uint32_t>(attachment.srcColorBlendFactor));
+        key.Append(static_cast<std::uint32_t>(attachment.dstColorBlendFactor));
+        key.Append(static_cast<std::uint32_t>(attachment.colorBlendOp));
+        key.Append(static_cast<std::uint32_t>(attachment.srcAlphaBlendFactor));
+        key.Append(static_cast<std::uint32_t>(attachment.dstAlphaBlendFactor));
+        key.Append(static_cast<std::uint32_t>(attachment.alphaBlendOp));
+        key.Append(attachment.colorWriteMask);
+    }
+    for (float blendConstant : colorBlendState.blendConstants)
+        key.Append(blendConstant);
+
+    /* Append render pass attachment formats */
+    key.Append(static_cast<std::uint32_t>(renderPass.GetNumColorAttachments()));
+    key.Append(renderPass.HasDepthStencilAttachment() ? 1u : 0u);
+    key.Append(static_cast<std::uint32_t>(renderPass.GetSampleCountBits()));
+    for (const VkAttachmentDescription& attachmentDesc : renderPass.GetAttachmentDescs())
+    {
+        key.Append(static_cast<std::uint32_t>(attachmentDesc.format));
+        key.Append(static_cast<std::uint32_t>(attachmentDesc.samples));
+    }
+}
+
 void VKGraphicsPSO::CreateVkPipeline(
     VkDevice                            device,
     const VKRenderPass&                 renderPass,
@@ -365,13 +649,43 @@ void VKGraphicsPSO::CreateVkPipeline(
     /* Initialize dynamic state */
     std::vector<VkDynamicState> dynamicStatesVK;
     VkPipelineDynamicStateCreateInfo dynamicState;
-    CreateDynamicState(desc, dynamicState, dynamicStatesVK);
+    CreateDynamicState(desc, dynamicStateFlags_, dynamicState, dynamicStatesVK);
+
+    /* Move extended dynamic states out of the static state and keep static viewports to set them on the command buffer */
+    ExtractDynamicGraphicsState(dynamicStateFlags_, inputAssembly, rasterizerState, depthStencilState, dynamicState_);
+
+    if ((dynamicStateFlags_ & VKDynamicGraphicsState_Viewports) != 0)
+    {
+        staticViewports_            = std::move(viewportsVK);
+        viewportState.viewportCount = 0;
+        viewportState.pViewports    = nullptr;
+    }
+
+    /* Describe attachment formats instead of a render pass object with dynamic rendering */
+    const bool hasDynamicRendering = HasExtension(VKExt::KHR_dynamic_rendering);
+
+    VkFormat colorAttachmentFormats[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VkPipelineRenderingCreateInfoKHR renderingCreateInfo;
+
+    if (hasDynamicRendering)
+    {
+        for_range(i, renderPass.GetNumColorAttachments())
+            colorAttachmentFormats[i] = renderPass.GetColorAttachmentDesc(i).format;
+
+        renderingCreateInfo.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        renderingCreateInfo.pNext                   = nullptr;
+        renderingCreateInfo.viewMask                = 0;
+        renderingCreateInfo.colorAttachmentCount    = renderPass.GetNumColorAttachments();
+        renderingCreateInfo.pColorAttachmentFormats = colorAttachmentFormats;
+        renderingCreateInfo.depthAttachmentFormat   = renderPass.GetDepthVkFormat();
+        renderingCreateInfo.stencilAttachmentFormat = renderPass.GetStencilVkFormat();
+    }
 
     /* Create graphics pipeline state object */
     VkGraphicsPipelineCreateInfo createInfo;
     {
         createInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        createInfo.pNext                = nullptr;
+        createInfo.pNext                = (hasDynamicRendering ? &renderingCreateInfo : nullptr);
         createInfo.flags                = 0;
         createInfo.stageCount           = static_cast<std::uint32_t>(shaderStageCreateInfos.size());
         createInfo.pStages              = shaderStageCreateInfos.data();
@@ -385,13 +699,35 @@ void VKGraphicsPSO::CreateVkPipeline(
         createInfo.pColorBlendState     = (&colorBlendState);
         createInfo.pDynamicState        = (!dynamicStatesVK.empty() ? &dynamicState : nullptr);
         createInfo.layout               = GetVkPipelineLayout();
-        createInfo.renderPass           = renderPass.GetVkRenderPass();
+        createInfo.renderPass           = (hasDynamicRendering ? VK_NULL_HANDLE : renderPass.GetVkRenderPass());
         createInfo.subpass              = 0;
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
     }
-    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
-    VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+
+    /* Share native PSO with all PSOs of equivalent static state */
+    VKGraphicsPipelineKey key;
+    {
+        key.pipelineLayout  = GetPipelineLayout();
+        key.shaders[0]      = LLGL_CAST(const VKShader*, desc.vertexShader);
+        key.shaders[1]      = LLGL_CAST(const VKShader*, desc.tessControlShader);
+        key.shaders[2]      = LLGL_CAST(const VKShader*, desc.tessEvaluationShader);
+        key.shaders[3]      = LLGL_CAST(const VKShader*, desc.geometryShader);
+        key.shaders[4]      = LLGL_CAST(const VKShader*, desc.fragmentShader);
+        AppendGraphicsPipelineStateToKey(key, createInfo, dynamicState, renderPass);
+    }
+
+    SetSharedVkPipeline(
+        VKGraphicsPipelinePool::Get().GetOrCreateVkPipeline(
+            device,
+            std::move(key),
+            [device, pipelineCache, &createInfo](VkPipeline* outPipeline)
+            {
+                VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, outPipeline);
+                VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+            }
+        )
+    );
 }
 
 
@@ -10,6 +10,7 @@
 
 
 #include "VKPipelineState.h"
+#include <vector>
 
 
 namespace LLGL
@@ -21,6 +22,45 @@ struct VKGraphicsPipelineLimits
 {
     float lineWidthRange[2];
     float lineWidthGranularity;
+    bool  extendedDynamicState;             // VK_EXT_extended_dynamic_state: Cull mode, front face, topology, viewport count, depth and stencil states.
+    bool  extendedDynamicState2;            // VK_EXT_extended_dynamic_state2: Rasterizer discard, depth bias, and primitive restart.
+    bool  extendedDynamicState3PolygonMode; // VK_EXT_extended_dynamic_state3: Polygon mode.
+    bool  extendedDynamicState3DepthClamp;  // VK_EXT_extended_dynamic_state3: Depth clamp.
+};
+
+// Groups of graphics pipeline states that are set on the command buffer instead of being baked into the native PSO.
+enum VKDynamicGraphicsStateFlags : std::uint32_t
+{
+    VKDynamicGraphicsState_Rasterizer   = (1u << 0),  // Cull mode, front face, line width (VK_EXT_extended_dynamic_state).
+    VKDynamicGraphicsState_Topology     = (1u << 1),  // Primitive topology (VK_EXT_extended_dynamic_state).
+    VKDynamicGraphicsState_DepthStencil = (1u << 2),  // Depth test, depth write, depth compare, stencil test, stencil ops and masks (VK_EXT_extended_dynamic_state).
+    VKDynamicGraphicsState_Viewports    = (1u << 3),  // Static viewports of the PSO set with vkCmdSetViewportWithCountEXT (VK_EXT_extended_dynamic_state).
+    VKDynamicGraphicsState_State2       = (1u << 4),  // Rasterizer discard, depth bias, primitive restart (VK_EXT_extended_dynamic_state2).
+    VKDynamicGraphicsState_PolygonMode  = (1u << 5),  // Polygon mode (VK_EXT_extended_dynamic_state3).
+    VKDynamicGraphicsState_DepthClamp   = (1u << 6),  // Depth clamp (VK_EXT_extended_dynamic_state3).
+};
+
+// Values of the graphics pipeline states that are set on the command buffer. See VKDynamicGraphicsStateFlags.
+struct VKDynamicGraphicsState
+{
+    VkCullModeFlags     cullMode                = VK_CULL_MODE_NONE;
+    VkFrontFace         frontFace               = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    float               lineWidth               = 1.0f;
+    VkPrimitiveTopology primitiveTopology       = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkBool32            depthTestEnable         = VK_FALSE;
+    VkBool32            depthWriteEnable        = VK_FALSE;
+    VkCompareOp         depthCompareOp          = VK_COMPARE_OP_LESS;
+    VkBool32            stencilTestEnable       = VK_FALSE;
+    VkStencilOpState    stencilFront            = {};
+    VkStencilOpState    stencilBack             = {};
+    VkBool32            rasterizerDiscardEnable = VK_FALSE;
+    VkBool32            depthBiasEnable         = VK_FALSE;
+    float               depthBiasConstantFactor = 0.0f;
+    float               depthBiasClamp          = 0.0f;
+    float               depthBiasSlopeFactor    = 0.0f;
+    VkBool32            primitiveRestartEnable  = VK_FALSE;
+    VkPolygonMode       polygonMode             = VK_POLYGON_MODE_FILL;
+    VkBool32            depthClampEnable        = VK_FALSE;
 };
 
 struct GraphicsPipelineDescriptor;
@@ -53,6 +93,24 @@ class VKGraphicsPSO final : public VKPipelineState
             return hasDynamicScissor_;
         }
 
+        // Returns the bitwise OR combination of VKDynamicGraphicsStateFlags entries this PSO sets on the command buffer.
+        inline std::uint32_t GetDynamicStateFlags() const
+        {
+            return dynamicStateFlags_;
+        }
+
+        // Returns the values of the states this PSO sets on the command buffer.
+        inline const VKDynamicGraphicsState& GetDynamicState() const
+        {
+            return dynamicState_;
+        }
+
+        // Returns the static viewports of this PSO. Only used if VKDynamicGraphicsState_Viewports is set.
+        inline const std::vector<VkViewport>& GetStaticViewports() const
+        {
+            return staticViewports_;
+        }
+
     private:
 
         void CreateVkPipeline(
@@ -65,8 +123,11 @@ class VKGraphicsPSO final : public VKPipelineState
 
     private:
 
-        bool scissorEnabled_    = false;
-        bool hasDynamicScissor_ = false;
+        bool                    scissorEnabled_     = false;
+        bool                    hasDynamicScissor_  = false;
+        std::uint32_t           dynamicStateFlags_  = 0;
+        VKDynamicGraphicsState  dynamicState_;
+        std::vector<VkViewport> staticViewports_;
 
 };
 
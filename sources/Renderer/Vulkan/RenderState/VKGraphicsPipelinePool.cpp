@@ -0,0 +1,164 @@
+/*
+ * VKGraphicsPipelinePool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKGraphicsPipelinePool.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/MacroUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+void VKGraphicsPipelineKey::Append(std::uint32_t value)
+{
+    staticState.push_back(value);
+}
+
+void VKGraphicsPipelineKey::Append(float value)
+{
+    std::uint32_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(value), "size of 'float' must be 32 bits");
+    std::memcpy(&bits, &value, sizeof(value));
+    staticState.push_back(bits);
+}
+
+static int CompareGraphicsPipelineKeySWO(const VKGraphicsPipelineKey& lhs, const VKGraphicsPipelineKey& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO( pipelineLayout );
+    for_range(i, VKGraphicsPipelineKey::maxNumShaders)
+    {
+        LLGL_COMPARE_MEMBER_SWO( shaders[i] );
+    }
+    LLGL_COMPARE_MEMBER_SWO( staticState.size() );
+    if (!lhs.staticState.empty())
+        return std::memcmp(lhs.staticState.data(), rhs.staticState.data(), lhs.staticState.size() * sizeof(std::uint32_t));
+    return 0;
+}
+
+VKGraphicsPipelinePool& VKGraphicsPipelinePool::Get()
+{
+    static VKGraphicsPipelinePool instance;
+    return instance;
+}
+
+void VKGraphicsPipelinePool::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    entries_.clear();
+}
+
+VKSharedPipeline VKGraphicsPipelinePool::GetOrCreateVkPipeline(
+    VkDevice                                device,
+    VKGraphicsPipelineKey&&                 key,
+    const std::function<void(VkPipeline*)>& createPipelineCallback)
+{
+    /* Try to find existing pipeline with equivalent static state */
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        std::size_t insertionPos = 0;
+        if (PipelineEntry* entry = FindEntry(key, insertionPos))
+        {
+            if (VKSharedPipeline pipeline = entry->pipeline.lock())
+                return pipeline;
+        }
+    }
+
+    /* Create new native pipeline outside the lock; pipeline compilation is by far the most expensive part */
+    VKSharedPipeline newPipeline = std::make_shared<VKPtr<VkPipeline>>(device, vkDestroyPipeline);
+    createPipelineCallback(newPipeline->ReleaseAndGetAddressOf());
+
+    /* Register new pipeline unless another thread has registered an equivalent pipeline in the meantime */
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Drop entries whose native pipelines have been destroyed with their last PSO, so the pool does not grow with dead keys */
+    RemoveAllFromListIf(
+        entries_,
+        [](const PipelineEntry& entry) -> bool
+        {
+            return entry.pipeline.expired();
+        }
+    );
+
+    std::size_t insertionPos = 0;
+    if (PipelineEntry* entry = FindEntry(key, insertionPos))
+    {
+        if (VKSharedPipeline pipeline = entry->pipeline.lock())
+            return pipeline;
+        entry->pipeline = newPipeline;
+    }
+    else
+    {
+        PipelineEntry newEntry;
+        {
+            newEntry.key        = std::move(key);
+            newEntry.pipeline   = newPipeline;
+        }
+        entries_.insert(entries_.begin() + insertionPos, std::move(newEntry));
+    }
+    return newPipeline;
+}
+
+void VKGraphicsPipelinePool::NotifyReleaseShader(VKShader* shader)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Since shaders are secondary keys, we have to iterate over the entire list */
+    RemoveAllFromListIf(
+        entries_,
+        [shader](const PipelineEntry& entry) -> bool
+        {
+            for (const VKShader* entryShader : entry.key.shaders)
+            {
+                if (entryShader == shader)
+                    return true;
+            }
+            return false;
+        }
+    );
+}
+
+void VKGraphicsPipelinePool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Since pipeline layout is the first key, we can search for the first occurance and then delete all consecutive entries that match the key */
+    RemoveAllConsecutiveFromListIf(
+        entries_,
+        [pipelineLayout](const PipelineEntry& entry) -> bool
+        {
+            return (entry.key.pipelineLayout == pipelineLayout);
+        }
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKGraphicsPipelinePool::PipelineEntry* VKGraphicsPipelinePool::FindEntry(const VKGraphicsPipelineKey& key, std::size_t& insertionPos)
+{
+    return FindInSortedArray<PipelineEntry>(
+        entries_.data(),
+        entries_.size(),
+        [&key](const PipelineEntry& entry) -> int
+        {
+            return CompareGraphicsPipelineKeySWO(key, entry.key);
+        },
+        &insertionPos
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,105 @@
+/*
+ * VKGraphicsPipelinePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_GRAPHICS_PIPELINE_POOL_H
+#define LLGL_VK_GRAPHICS_PIPELINE_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKShader;
+class VKPipelineLayout;
+
+using VKSharedPipeline = std::shared_ptr<VKPtr<VkPipeline>>;
+
+// Key to identify native graphics pipelines with equivalent static state.
+struct VKGraphicsPipelineKey
+{
+    static constexpr std::size_t maxNumShaders = 5;
+
+    const VKPipelineLayout*     pipelineLayout          = nullptr;
+    const VKShader*             shaders[maxNumShaders]  = {};
+    std::vector<std::uint32_t>  staticState;            // Serialized static pipeline state; Dynamic states are excluded.
+
+    // Appends the specified 32-bit value to the serialized static state.
+    void Append(std::uint32_t value);
+
+    // Appends the bit pattern of the specified floating-point value to the serialized static state.
+    void Append(float value);
+};
+
+// Singleton pool to share native Vulkan graphics pipelines between PSOs with equivalent static state.
+class VKGraphicsPipelinePool
+{
+
+    public:
+
+        VKGraphicsPipelinePool(const VKGraphicsPipelinePool&) = delete;
+        VKGraphicsPipelinePool& operator = (const VKGraphicsPipelinePool&) = delete;
+
+        // Returns the instance of this pool.
+        static VKGraphicsPipelinePool& Get();
+
+        // Clear all resource containers of this pool (used by VKRenderSystem).
+        void Clear();
+
+        /*
+        Returns the native pipeline for the specified key or creates a new one with the specified callback.
+        The callback must create the native pipeline and write it to the output parameter.
+        It is invoked without holding the pool lock, so PSOs can be created concurrently on loader threads.
+        */
+        VKSharedPipeline GetOrCreateVkPipeline(
+            VkDevice                                    device,
+            VKGraphicsPipelineKey&&                     key,
+            const std::function<void(VkPipeline*)>&     createPipelineCallback
+        );
+
+        void NotifyReleaseShader(VKShader* shader);
+        void NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout);
+
+    private:
+
+        struct PipelineEntry
+        {
+            VKGraphicsPipelineKey               key;
+            std::weak_ptr<VKPtr<VkPipeline>>    pipeline;   // Weak reference, so the native pipeline is destroyed with the last PSO that uses it.
+        };
+
+    private:
+
+        VKGraphicsPipelinePool() = default;
+
+        // Returns the entry that matches the specified key or null if there is no such entry.
+        PipelineEntry* FindEntry(const VKGraphicsPipelineKey& key, std::size_t& insertionPos);
+
+    private:
+
+        std::vector<PipelineEntry>  entries_;
+        std::mutex                  mutex_;     // PSOs can be created and released on loader threads
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -101,6 +101,7 @@ bool VKPipelineBarrier::Update()
     srcStageMask_ = 0;
     dstStageMask_ = 0;
     memoryBarriers_.clear();
+    hasIndirectBuffers_ = false;
 
     /* Iterate over all bindings and re-generate all barriers */
     for (const ResourceBinding& binding : bindings_)
@@ -111,6 +112,8 @@ bool VKPipelineBarrier::Update()
             {
                 auto bufferVK = LLGL_CAST(VKBuffer*, resource);
                 InsertBufferMemoryBarrier(binding.stageFlags, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, bufferVK->GetVkBuffer());
+                if ((bufferVK->GetBindFlags() & BindFlags::IndirectBuffer) != 0)
+                    hasIndirectBuffers_ = true;
             }
             else
                 InsertMemoryBarrier(binding.stageFlags, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
@@ -43,6 +43,12 @@ class VKPipelineBarrier
         // Updates the internal barrier descritpors and return false if the barrier is no longer active.
         bool Update();
 
+        // Returns true if any of the buffers in this barrier can also be used for indirect arguments, i.e. they were created with BindFlags::IndirectBuffer.
+        inline bool HasIndirectBuffers() const
+        {
+            return hasIndirectBuffers_;
+        }
+
     private:
 
         struct ResourceBinding
@@ -66,6 +72,7 @@ class VKPipelineBarrier
         SmallVector<VkMemoryBarrier, 1u>        memoryBarriers_;
         SmallVector<VkBufferMemoryBarrier, 1u>  bufferBarriers_;
         SmallVector<VkImageMemoryBarrier, 1u>   imageBarriers_;
+        bool                                    hasIndirectBuffers_ = false;
 
 };
 
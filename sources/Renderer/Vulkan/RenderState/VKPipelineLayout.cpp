@@ -7,6 +7,8 @@
 
 #include "VKPipelineLayout.h"
 #include "VKPoolSizeAccumulator.h"
+#include "VKBindlessDescriptorHeap.h"
+#include "VKGraphicsPipelinePool.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include "../VKStaticLimits.h"
@@ -26,7 +28,7 @@ namespace LLGL
 
 VKPtr<VkPipelineLayout> VKPipelineLayout::defaultPipelineLayout_;
 
-VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc) :
+VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc, const VKBindlessDescriptorHeap* bindlessHeap) :
     pipelineLayout_ { device, vkDestroyPipelineLayout          },
     setLayouts_     { { device, vkDestroyDescriptorSetLayout },
                       { device, vkDestroyDescriptorSetLayout },
@@ -50,8 +52,15 @@ VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescript
     if (!desc.staticSamplers.empty())
         CreateStaticDescriptorSet(device, setLayouts_[SetLayoutType_ImmutableSamplers].Get());
 
+    /* Append global descriptor set for bindless resources after all other descriptor sets */
+    if (desc.bindlessSet != LLGL_INVALID_SLOT && bindlessHeap != nullptr)
+    {
+        bindlessSetLayout_      = bindlessHeap->GetVkDescriptorSetLayout();
+        bindlessDescriptorSet_  = bindlessHeap->GetVkDescriptorSet();
+    }
+
     /* Don't create a VkPipelineLayout object if this instance only has push constants as those are part of the permutations for each PSO */
-    if (!desc.heapBindings.empty() || !desc.bindings.empty() || !desc.staticSamplers.empty())
+    if (!desc.heapBindings.empty() || !desc.bindings.empty() || !desc.staticSamplers.empty() || bindlessSetLayout_ != VK_NULL_HANDLE)
     {
         BuildDescriptorSetBindingTables(desc);
         pipelineLayout_ = CreateVkPipelineLayout(device);
@@ -61,6 +70,7 @@ VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescript
 VKPipelineLayout::~VKPipelineLayout()
 {
     VKShaderModulePool::Get().NotifyReleasePipelineLayout(this);
+    VKGraphicsPipelinePool::Get().NotifyReleasePipelineLayout(this);
 }
 
 std::uint32_t VKPipelineLayout::GetNumHeapBindings() const
@@ -195,6 +205,12 @@ bool VKPipelineLayout::GetBindingSlotsAssignment(
         iter    = ConstFieldRangeIterator<BindingSlot>{ bindingTable.srcSlots.data(), bindingTable.srcSlots.size() };
         return true;
     }
+    if (index == layoutTypeOrder_.Count() && bindlessSetLayout_ != VK_NULL_HANDLE)
+    {
+        dstSet  = bindlessBindingTable_.dstSet;
+        iter    = ConstFieldRangeIterator<BindingSlot>{ bindlessBindingTable_.srcSlots.data(), bindlessBindingTable_.srcSlots.size() };
+        return true;
+    }
     return false;
 }
 
@@ -358,8 +374,8 @@ void VKPipelineLayout::CreateImmutableSamplers(VkDevice device, const ArrayView<
 
 VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayout(VkDevice device, const ArrayView<VkPushConstantRange>& pushConstantRanges) const
 {
-    /* Create native Vulkan pipeline layout with up to 3 descriptor sets */
-    SmallVector<VkDescriptorSetLayout, SetLayoutType_Num> setLayoutsVK;
+    /* Create native Vulkan pipeline layout with up to 4 descriptor sets */
+    SmallVector<VkDescriptorSetLayout, SetLayoutType_Num + 1> setLayoutsVK;
 
     for_range(i, SetLayoutType_Num)
     {
@@ -367,6 +383,9 @@ VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayout(VkDevice device
             setLayoutsVK.push_back(setLayouts_[i].Get());
     }
 
+    if (bindlessSetLayout_ != VK_NULL_HANDLE)
+        setLayoutsVK.push_back(bindlessSetLayout_);
+
     VkPipelineLayoutCreateInfo layoutCreateInfo;
     {
         layoutCreateInfo.sType                      = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -464,6 +483,14 @@ void VKPipelineLayout::BuildDescriptorSetBindingTables(const PipelineLayoutDescr
     BuildDescriptorSetBindingSlots(setBindingTables_[SetLayoutType_HeapBindings], desc.heapBindings);
     BuildDescriptorSetBindingSlots(setBindingTables_[SetLayoutType_DynamicBindings], desc.bindings);
     BuildDescriptorSetBindingSlots(setBindingTables_[SetLayoutType_ImmutableSamplers], desc.staticSamplers);
+
+    /* Re-assign the descriptor arrays of bindless resources to the descriptor set after all other sets */
+    if (bindlessSetLayout_ != VK_NULL_HANDLE)
+    {
+        bindlessBindingTable_.dstSet = layoutTypeOrder_.Count();
+        for_range(i, VKBindlessDescriptorHeap::BindingType_Num)
+            bindlessBindingTable_.srcSlots.push_back(BindingSlot{ static_cast<std::uint32_t>(i), desc.bindlessSet });
+    }
 }
 
 template <typename TContainer>
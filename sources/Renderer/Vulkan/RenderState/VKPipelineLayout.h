@@ -25,6 +25,7 @@ namespace LLGL
 
 class VKDescriptorCache;
 class VKPoolSizeAccumulator;
+class VKBindlessDescriptorHeap;
 
 struct VKLayoutBinding
 {
@@ -42,7 +43,7 @@ class VKPipelineLayout final : public PipelineLayout
 
     public:
 
-        VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc);
+        VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc, const VKBindlessDescriptorHeap* bindlessHeap = nullptr);
         ~VKPipelineLayout();
 
         /*
@@ -103,6 +104,18 @@ class VKPipelineLayout final : public PipelineLayout
             return staticDescriptorSet_;
         }
 
+        // Returns the descriptor set binding point for bindless resources.
+        inline std::uint32_t GetBindPointForBindlessResources() const
+        {
+            return bindlessBindingTable_.dstSet;
+        }
+
+        // Returns a Vulkan handle of the global descriptor set for bindless resources. May also be VK_NULL_HANLDE.
+        inline VkDescriptorSet GetBindlessDescriptorSet() const
+        {
+            return bindlessDescriptorSet_;
+        }
+
         // Returns the list of binding points that must be passed to 'VkWriteDescriptorSet' members.
         inline const std::vector<VKLayoutBinding>& GetLayoutHeapBindings() const
         {
@@ -212,6 +225,10 @@ class VKPipelineLayout final : public PipelineLayout
         std::unique_ptr<VKDescriptorCache>  descriptorCache_;
         VkDescriptorSet                     staticDescriptorSet_                = VK_NULL_HANDLE;
 
+        VkDescriptorSetLayout               bindlessSetLayout_                  = VK_NULL_HANDLE;   // Shared with all pipeline layouts; owned by VKBindlessDescriptorHeap.
+        VkDescriptorSet                     bindlessDescriptorSet_              = VK_NULL_HANDLE;
+        DescriptorSetBindingTable           bindlessBindingTable_;
+
         std::vector<VKLayoutBinding>        heapBindings_;
         std::vector<VKLayoutBinding>        bindings_;
         std::vector<VKPtr<VkSampler>>       immutableSamplers_;
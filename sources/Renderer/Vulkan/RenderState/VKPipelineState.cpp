@@ -58,6 +58,22 @@ void VKPipelineState::BindPipelineAndStaticDescriptorSet(VkCommandBuffer command
                 /*pDynamicOffsets*/     nullptr
             );
         }
+
+        /* Bind global descriptor set for bindless resources; it is never rebound when materials change */
+        VkDescriptorSet bindlessDescriptorSet = pipelineLayout_->GetBindlessDescriptorSet();
+        if (bindlessDescriptorSet != VK_NULL_HANDLE)
+        {
+            vkCmdBindDescriptorSets(
+                /*commandBuffer:*/      commandBuffer,
+                /*pipelineBindPoint:*/  GetBindPoint(),
+                /*layout:*/             GetVkPipelineLayout(),
+                /*firstSet:*/           pipelineLayout_->GetBindPointForBindlessResources(),
+                /*descriptorSetCount:*/ 1,
+                /*pDescriptorSets:*/    &bindlessDescriptorSet,
+                /*dynamicOffsetCount:*/ 0,
+                /*pDynamicOffsets*/     nullptr
+            );
+        }
     }
 }
 
@@ -150,6 +166,12 @@ VkPipeline* VKPipelineState::ReleaseAndGetAddressOfVkPipeline()
     return pipeline_.ReleaseAndGetAddressOf();
 }
 
+void VKPipelineState::SetSharedVkPipeline(std::shared_ptr<VKPtr<VkPipeline>>&& sharedPipeline)
+{
+    pipeline_.Release();
+    sharedPipeline_ = std::move(sharedPipeline);
+}
+
 VkPipelineLayout VKPipelineState::GetVkPipelineLayout() const
 {
     if (pipelineLayoutPerm_.Get() != VK_NULL_HANDLE)
@@ -14,6 +14,7 @@
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <vector>
+#include <memory>
 #include <cstdint>
 
 
@@ -54,10 +55,10 @@ class VKPipelineState : public PipelineState
         // Pushes the specified values to the command buffer as push-constants.
         void PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size);
 
-        // Returns the native PSO.
+        // Returns the native PSO. This is either owned by this PSO or shared with other PSOs of equivalent static state.
         inline VkPipeline GetVkPipeline() const
         {
-            return pipeline_.Get();
+            return (sharedPipeline_ ? sharedPipeline_->Get() : pipeline_.Get());
         }
 
         // Returns the pipeline binding point.
@@ -77,6 +78,9 @@ class VKPipelineState : public PipelineState
         // Releases the native PSO and returns its address.
         VkPipeline* ReleaseAndGetAddressOfVkPipeline();
 
+        // Sets the native PSO that is shared with other PSOs. See VKGraphicsPipelinePool.
+        void SetSharedVkPipeline(std::shared_ptr<VKPtr<VkPipeline>>&& sharedPipeline);
+
         // Returns the native Vulkan pipeline layout this PSO was created with or the specified layout if there was no layout specified.
         VkPipelineLayout GetVkPipelineLayout() const;
 
@@ -100,6 +104,7 @@ class VKPipelineState : public PipelineState
     private:
 
         VKPtr<VkPipeline>                   pipeline_;
+        std::shared_ptr<VKPtr<VkPipeline>>  sharedPipeline_;
         VKPtr<VkPipelineLayout>             pipelineLayoutPerm_;
         const VKPipelineLayout*             pipelineLayout_     = nullptr;
         VkPipelineBindPoint                 bindPoint_          = VK_PIPELINE_BIND_POINT_MAX_ENUM;
@@ -8,6 +8,7 @@
 #include "VKQueryHeap.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -72,6 +73,30 @@ VKQueryHeap::VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc) :
     }
     auto result = vkCreateQueryPool(device, &createInfo, nullptr, queryPool_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan query pool");
+
+    /* All queries are reset by the render system after creation */
+    writtenQueries_.resize(numQueries_, false);
+}
+
+bool VKQueryHeap::MarkWrittenRange(std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    std::lock_guard<std::mutex> guard{ writtenQueriesMutex_ };
+    bool needsReset = false;
+    for_range(i, numQueries)
+    {
+        if (writtenQueries_[firstQuery + i])
+            needsReset = true;
+        else
+            writtenQueries_[firstQuery + i] = true;
+    }
+    return needsReset;
+}
+
+void VKQueryHeap::MarkResetRange(std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    std::lock_guard<std::mutex> guard{ writtenQueriesMutex_ };
+    for_range(i, numQueries)
+        writtenQueries_[firstQuery + i] = false;
 }
 
 
@@ -12,6 +12,8 @@
 #include <LLGL/QueryHeap.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -56,6 +58,15 @@ class VKQueryHeap : public QueryHeap
             return hasPredicates_;
         }
 
+        /*
+        Marks the specified range of native queries as written by a command buffer.
+        Returns true if any of these queries has been written before without being reset, i.e. they must be reset before they are written again.
+        */
+        bool MarkWrittenRange(std::uint32_t firstQuery, std::uint32_t numQueries);
+
+        // Marks the specified range of native queries as reset.
+        void MarkResetRange(std::uint32_t firstQuery, std::uint32_t numQueries);
+
     private:
 
         VKPtr<VkQueryPool>  queryPool_;
@@ -64,6 +75,9 @@ class VKQueryHeap : public QueryHeap
         std::uint32_t       numQueries_     = 0;
         bool                hasPredicates_  = false;
 
+        std::vector<bool>   writtenQueries_;        // Native queries that have been written since they were last reset.
+        std::mutex          writtenQueriesMutex_;
+
 };
 
 
@@ -8,6 +8,8 @@
 #include "VKRenderPass.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
+#include "../Ext/VKExtensionRegistry.h"
+#include "../Texture/VKImageUtils.h"
 #include "../../RenderPassUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
@@ -18,6 +20,17 @@ namespace LLGL
 {
 
 
+void VKAttachmentImage::Init(VkImage image, VkImageView imageView, VkFormat format, std::uint32_t mipLevel, std::uint32_t arrayLayer)
+{
+    this->image                     = image;
+    this->imageView                 = imageView;
+    subresource.aspectMask          = VKImageUtils::GetInclusiveVkImageAspect(format);
+    subresource.baseMipLevel        = mipLevel;
+    subresource.levelCount          = 1;
+    subresource.baseArrayLayer      = arrayLayer;
+    subresource.layerCount          = 1;
+}
+
 VKRenderPass::VKRenderPass(VkDevice device) :
     renderPass_ { device, vkDestroyRenderPass }
 {
@@ -29,6 +42,28 @@ VKRenderPass::VKRenderPass(VkDevice device, const RenderPassDescriptor& desc) :
     CreateVkRenderPass(device, desc);
 }
 
+VkFormat VKRenderPass::GetDepthVkFormat() const
+{
+    if (HasDepthStencilAttachment())
+    {
+        const VkFormat format = GetDepthStencilAttachmentDesc().format;
+        if ((VKImageUtils::GetInclusiveVkImageAspect(format) & VK_IMAGE_ASPECT_DEPTH_BIT) != 0)
+            return format;
+    }
+    return VK_FORMAT_UNDEFINED;
+}
+
+VkFormat VKRenderPass::GetStencilVkFormat() const
+{
+    if (HasDepthStencilAttachment())
+    {
+        const VkFormat format = GetDepthStencilAttachmentDesc().format;
+        if ((VKImageUtils::GetInclusiveVkImageAspect(format) & VK_IMAGE_ASPECT_STENCIL_BIT) != 0)
+            return format;
+    }
+    return VK_FORMAT_UNDEFINED;
+}
+
 static void InitColorVkAttachmentDesc(
     VkAttachmentDescription&    dst,
     Format                      format,
@@ -259,13 +294,21 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         subpassDep.dependencyFlags  = 0;
     }
 
+    /* Store attachment descriptors for dynamic rendering */
+    const std::uint32_t attachmentCount = (hasMultiSampling ? numAttachments + numColorAttachments : numAttachments);
+    attachmentDescs_.assign(attachmentDescs, attachmentDescs + attachmentCount);
+
+    /* Native render pass object is not required if render passes are described on the fly with VK_KHR_dynamic_rendering */
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        return;
+
     /* Create swap-chain render pass */
     VkRenderPassCreateInfo createInfo;
     {
         createInfo.sType            = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
         createInfo.pNext            = nullptr;
         createInfo.flags            = 0;
-        createInfo.attachmentCount  = (hasMultiSampling ? numAttachments + numColorAttachments : numAttachments);
+        createInfo.attachmentCount  = attachmentCount;
         createInfo.pAttachments     = attachmentDescs;
         createInfo.subpassCount     = 1;
         createInfo.pSubpasses       = (&subpassDesc);
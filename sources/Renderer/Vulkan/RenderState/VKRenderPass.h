@@ -10,8 +10,10 @@
 
 
 #include <LLGL/RenderPass.h>
+#include <LLGL/Constants.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include <vector>
 #include <cstdint>
 
 
@@ -21,6 +23,28 @@ namespace LLGL
 
 struct RenderPassDescriptor;
 
+// Image and image view of a single framebuffer attachment for dynamic rendering.
+struct VKAttachmentImage
+{
+    VkImage                 image       = VK_NULL_HANDLE;
+    VkImageView             imageView   = VK_NULL_HANDLE;
+    VkImageSubresourceRange subresource = { 0, 0, 1, 0, 1 };
+
+    // Initializes this attachment with all image aspects of the specified format.
+    void Init(VkImage image, VkImageView imageView, VkFormat format, std::uint32_t mipLevel = 0, std::uint32_t arrayLayer = 0);
+};
+
+/*
+Framebuffer attachments for dynamic rendering (VK_KHR_dynamic_rendering).
+This replaces the VkFramebuffer object; the number of attachments is determined by the VKRenderPass that is used to begin rendering.
+*/
+struct VKFramebufferAttachments
+{
+    VKAttachmentImage colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKAttachmentImage resolveAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKAttachmentImage depthStencilAttachment;
+};
+
 class VKRenderPass final : public RenderPass
 {
 
@@ -43,7 +67,13 @@ class VKRenderPass final : public RenderPass
             VkSampleCountFlagBits           sampleCountBits
         );
 
-        // Returns the Vulkan render pass object.
+        // Returns the depth format for dynamic rendering or VK_FORMAT_UNDEFINED if there is no depth attachment.
+        VkFormat GetDepthVkFormat() const;
+
+        // Returns the stencil format for dynamic rendering or VK_FORMAT_UNDEFINED if there is no stencil attachment.
+        VkFormat GetStencilVkFormat() const;
+
+        // Returns the Vulkan render pass object. This is a null handle if dynamic rendering is enabled (VK_KHR_dynamic_rendering).
         inline VkRenderPass GetVkRenderPass() const
         {
             return renderPass_;
@@ -82,15 +112,46 @@ class VKRenderPass final : public RenderPass
             return sampleCountBits_;
         }
 
+        // Returns true if this render pass has a depth-stencil attachment.
+        inline bool HasDepthStencilAttachment() const
+        {
+            return (depthStencilIndex_ != 0xFFu);
+        }
+
+        // Returns the attachment descriptor of the specified color attachment.
+        inline const VkAttachmentDescription& GetColorAttachmentDesc(std::uint32_t index) const
+        {
+            return attachmentDescs_[index];
+        }
+
+        // Returns the attachment descriptor of the specified resolve attachment. Only valid if multi-sampling is enabled.
+        inline const VkAttachmentDescription& GetResolveAttachmentDesc(std::uint32_t index) const
+        {
+            return attachmentDescs_[numColorAttachments_ + (HasDepthStencilAttachment() ? 1 : 0) + index];
+        }
+
+        // Returns the attachment descriptor of the depth-stencil attachment. Only valid if HasDepthStencilAttachment() returns true.
+        inline const VkAttachmentDescription& GetDepthStencilAttachmentDesc() const
+        {
+            return attachmentDescs_[depthStencilIndex_];
+        }
+
+        // Returns all attachment descriptors of this render pass.
+        inline const std::vector<VkAttachmentDescription>& GetAttachmentDescs() const
+        {
+            return attachmentDescs_;
+        }
+
     private:
 
-        VKPtr<VkRenderPass>     renderPass_;
+        VKPtr<VkRenderPass>                     renderPass_;
+        std::vector<VkAttachmentDescription>    attachmentDescs_;   // Copy of attachment descriptors to build rendering info for VK_KHR_dynamic_rendering.
 
-        std::uint64_t           clearValuesMask_        = 0;
-        std::uint8_t            depthStencilIndex_      = 0xFFu;
-        std::uint8_t            numClearValues_         = 0;
-        std::uint8_t            numColorAttachments_    = 0;
-        VkSampleCountFlagBits   sampleCountBits_        = VK_SAMPLE_COUNT_1_BIT;
+        std::uint64_t                           clearValuesMask_        = 0;
+        std::uint8_t                            depthStencilIndex_      = 0xFFu;
+        std::uint8_t                            numClearValues_         = 0;
+        std::uint8_t                            numColorAttachments_    = 0;
+        VkSampleCountFlagBits                   sampleCountBits_        = VK_SAMPLE_COUNT_1_BIT;
 
 };
 
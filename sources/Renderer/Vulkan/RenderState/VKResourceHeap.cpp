@@ -163,6 +163,16 @@ void VKResourceHeap::SubmitPipelineBarrier(VkCommandBuffer commandBuffer, std::u
     }
 }
 
+bool VKResourceHeap::HasIndirectBufferBarrier(std::uint32_t descriptorSet) const
+{
+    if (descriptorSet < barriers_.size())
+    {
+        if (VKPipelineBarrier* barrier = barriers_[descriptorSet].get())
+            return (barrier->IsActive() && barrier->HasIndirectBuffers());
+    }
+    return false;
+}
+
 
 /*
  * ======= Private: =======
@@ -55,6 +55,9 @@ class VKResourceHeap final : public ResourceHeap
         // Inserts a pipeline barrier command into the command buffer if this resource heap requires it.
         void SubmitPipelineBarrier(VkCommandBuffer commandBuffer, std::uint32_t descriptorSet);
 
+        // Returns true if the specified descriptor set has a pipeline barrier for storage buffers that can also be used for indirect arguments.
+        bool HasIndirectBufferBarrier(std::uint32_t descriptorSet) const;
+
         // Returns the native Vulkan descritpor pool.
         inline VkDescriptorPool GetVkDescriptorPool() const
         {
@@ -7,6 +7,7 @@
 
 #include "VKShader.h"
 #include "VKShaderModulePool.h"
+#include "../RenderState/VKGraphicsPipelinePool.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
 #include "../../../Core/CoreUtils.h"
@@ -57,6 +58,7 @@ VKShader::VKShader(VkDevice device, const ShaderDescriptor& desc) :
 VKShader::~VKShader()
 {
     VKShaderModulePool::Get().NotifyReleaseShader(this);
+    VKGraphicsPipelinePool::Get().NotifyReleaseShader(this);
 }
 
 const Report* VKShader::GetReport() const
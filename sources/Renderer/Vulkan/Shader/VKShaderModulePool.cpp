@@ -23,11 +23,14 @@ VKShaderModulePool& VKShaderModulePool::Get()
 
 void VKShaderModulePool::Clear()
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     permutations_.clear();
 }
 
 VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Try to find existing pair of shader/pipeline-layout */
     const auto* shaderPtr = &shader;
     const auto* pipelineLayoutPtr = &pipelineLayout;
@@ -69,6 +72,8 @@ VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader
 
 void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Since shader is the second key, we have to iterate over the entire list */
     RemoveAllFromListIf(
         permutations_,
@@ -81,6 +86,8 @@ void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
 
 void VKShaderModulePool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Since pipeline layout is the first key, we can search for the first occurance and then delete all consecutive entries that match the key */
     RemoveAllConsecutiveFromListIf(
         permutations_,
@@ -12,6 +12,7 @@
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -58,7 +59,8 @@ class VKShaderModulePool
 
     private:
 
-        std::vector<ShaderModulePermutation> permutations_;
+        std::vector<ShaderModulePermutation>    permutations_;
+        std::mutex                              mutex_;         // Shaders can be released on loader threads
 
 };
 
@@ -66,16 +66,20 @@ void VKDeviceImage::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memo
 }
 
 void VKDeviceImage::CreateVkImage(
-    VkDevice                device,
-    VkImageType             imageType,
-    VkFormat                format,
-    const VkExtent3D&       extent,
-    std::uint32_t           numMipLevels,
-    std::uint32_t           numArrayLayers,
-    VkImageCreateFlags      createFlags,
-    VkSampleCountFlagBits   sampleCountBits,
-    VkImageUsageFlags       usageFlags)
+    VkDevice                        device,
+    VkImageType                     imageType,
+    VkFormat                        format,
+    const VkExtent3D&               extent,
+    std::uint32_t                   numMipLevels,
+    std::uint32_t                   numArrayLayers,
+    VkImageCreateFlags              createFlags,
+    VkSampleCountFlagBits           sampleCountBits,
+    VkImageUsageFlags               usageFlags,
+    const ArrayView<std::uint32_t>& queueFamilyIndices)
 {
+    /* Share image between queue families if it can be accessed by dedicated compute or transfer queues */
+    const bool isConcurrent = (queueFamilyIndices.size() > 1);
+
     /* Create image object */
     VkImageCreateInfo createInfo;
     {
@@ -90,9 +94,9 @@ void VKDeviceImage::CreateVkImage(
         createInfo.samples                  = sampleCountBits;
         createInfo.tiling                   = VK_IMAGE_TILING_OPTIMAL;
         createInfo.usage                    = usageFlags;
-        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE; // only used by graphics queue
-        createInfo.queueFamilyIndexCount    = 0;
-        createInfo.pQueueFamilyIndices      = nullptr;
+        createInfo.sharingMode              = (isConcurrent ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE);
+        createInfo.queueFamilyIndexCount    = (isConcurrent ? static_cast<std::uint32_t>(queueFamilyIndices.size()) : 0u);
+        createInfo.pQueueFamilyIndices      = (isConcurrent ? queueFamilyIndices.data() : nullptr);
         createInfo.initialLayout            = VK_IMAGE_LAYOUT_UNDEFINED; // must be UNDEFINED or PREINITIALIZED
     }
     VkResult result = vkCreateImage(device, &createInfo, nullptr, image_.ReleaseAndGetAddressOf());
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Texture.h>
+#include <LLGL/Container/ArrayView.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <cstdint>
@@ -43,15 +44,16 @@ class VKDeviceImage
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
 
         void CreateVkImage(
-            VkDevice                device,
-            VkImageType             imageType,
-            VkFormat                format,
-            const VkExtent3D&       extent,
-            std::uint32_t           numMipLevels,
-            std::uint32_t           numArrayLayers,
-            VkImageCreateFlags      createFlags,
-            VkSampleCountFlagBits   sampleCountBits,
-            VkImageUsageFlags       usageFlags
+            VkDevice                        device,
+            VkImageType                     imageType,
+            VkFormat                        format,
+            const VkExtent3D&               extent,
+            std::uint32_t                   numMipLevels,
+            std::uint32_t                   numArrayLayers,
+            VkImageCreateFlags              createFlags,
+            VkSampleCountFlagBits           sampleCountBits,
+            VkImageUsageFlags               usageFlags,
+            const ArrayView<std::uint32_t>& queueFamilyIndices  = {}
         );
 
         void ReleaseVkImage();
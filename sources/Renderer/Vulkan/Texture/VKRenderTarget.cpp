@@ -13,6 +13,7 @@
 #include "../../../Core/CoreUtils.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include <vector>
 #include <algorithm>
 #include <LLGL/Utils/ForRange.h>
@@ -219,7 +220,7 @@ VkImageView VKRenderTarget::CreateAttachmentImageView(
     return imageViews_.back().Get();
 }
 
-VkImageView VKRenderTarget::CreateColorBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format)
+VKColorBuffer& VKRenderTarget::CreateColorBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format)
 {
     /* Create new color buffer with sampling information */
     auto colorBuffer = MakeUnique<VKColorBuffer>(deviceMemoryMngr.GetVkDevice());
@@ -228,16 +229,14 @@ VkImageView VKRenderTarget::CreateColorBuffer(VKDeviceMemoryManager& deviceMemor
     }
     colorBuffers_.push_back(std::move(colorBuffer));
 
-    return colorBuffers_.back()->GetVkImageView();
+    return *colorBuffers_.back();
 }
 
-VkImageView VKRenderTarget::CreateDepthStencilBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format)
+VKDepthStencilBuffer& VKRenderTarget::CreateDepthStencilBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format)
 {
     /* Create depth-stencil buffer */
     depthStencilBuffer_.Create(deviceMemoryMngr, GetResolution(), GetDepthStencilVkFormat(format), sampleCountBits_);
-
-    /* Add depth-stencil image view to attachments */
-    return depthStencilBuffer_.GetVkImageView();
+    return depthStencilBuffer_;
 }
 
 void VKRenderTarget::CreateFramebuffer(
@@ -263,11 +262,16 @@ void VKRenderTarget::CreateFramebuffer(
             auto& textureVK = LLGL_CAST(VKTexture&, *texture);
             const Format colorFormat = GetAttachmentFormat(colorAttachment);
             attachmentImageViews[i] = CreateAttachmentImageView(device, textureVK, colorFormat, colorAttachment);
+            framebufferAttachments_.colorAttachments[i].Init(
+                textureVK.GetVkImage(), attachmentImageViews[i], VKTypes::Map(colorFormat), colorAttachment.mipLevel, colorAttachment.arrayLayer
+            );
         }
         else
         {
             /* Create internal color buffer */
-            attachmentImageViews[i] = CreateColorBuffer(deviceMemoryMngr, colorAttachment.format);
+            VKColorBuffer& colorBuffer = CreateColorBuffer(deviceMemoryMngr, colorAttachment.format);
+            attachmentImageViews[i] = colorBuffer.GetVkImageView();
+            framebufferAttachments_.colorAttachments[i].Init(colorBuffer.GetVkImage(), attachmentImageViews[i], VKTypes::Map(colorAttachment.format));
         }
     }
 
@@ -281,11 +285,16 @@ void VKRenderTarget::CreateFramebuffer(
             /* Use attachment texture for depth-stencil view */
             auto& textureVK = LLGL_CAST(VKTexture&, *texture);
             attachmentImageViews[numColorAttachments_] = CreateAttachmentImageView(device, textureVK, depthStencilFormat_, depthStencilAttachment);
+            framebufferAttachments_.depthStencilAttachment.Init(
+                textureVK.GetVkImage(), attachmentImageViews[numColorAttachments_], VKTypes::Map(depthStencilFormat_), depthStencilAttachment.mipLevel, depthStencilAttachment.arrayLayer
+            );
         }
         else
         {
             /* Create internal depth-stencil buffer */
-            attachmentImageViews[numColorAttachments_] = CreateDepthStencilBuffer(deviceMemoryMngr, depthStencilFormat_);
+            VKDepthStencilBuffer& depthStencilBuffer = CreateDepthStencilBuffer(deviceMemoryMngr, depthStencilFormat_);
+            attachmentImageViews[numColorAttachments_] = depthStencilBuffer.GetVkImageView();
+            framebufferAttachments_.depthStencilAttachment.Init(depthStencilBuffer.GetVkImage(), attachmentImageViews[numColorAttachments_], VKTypes::Map(depthStencilFormat_));
         }
     }
 
@@ -302,11 +311,19 @@ void VKRenderTarget::CreateFramebuffer(
                 /* Use attachment texture for color buffer view */
                 auto& textureVK = LLGL_CAST(VKTexture&, *texture);
                 const Format colorFormat = GetAttachmentFormat(resolveAttachment);
-                attachmentImageViews[attachmentCount++] = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
+                attachmentImageViews[attachmentCount] = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
+                framebufferAttachments_.resolveAttachments[i].Init(
+                    textureVK.GetVkImage(), attachmentImageViews[attachmentCount], VKTypes::Map(colorFormat), resolveAttachment.mipLevel, resolveAttachment.arrayLayer
+                );
+                ++attachmentCount;
             }
         }
     }
 
+    /* Image views are passed to vkCmdBeginRenderingKHR directly if dynamic rendering is enabled */
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        return;
+
     /* Create framebuffer object */
     const Extent2D resolution = GetResolution();
     VkFramebufferCreateInfo createInfo;
@@ -62,6 +62,24 @@ class VKRenderTarget final : public RenderTarget
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
+        // Returns the primary render pass of this render target.
+        inline const VKRenderPass& GetPrimaryRenderPass() const
+        {
+            return *renderPass_;
+        }
+
+        // Returns the secondary render pass of this render target.
+        inline const VKRenderPass& GetSecondaryRenderPass() const
+        {
+            return secondaryRenderPass_;
+        }
+
+        // Returns the framebuffer attachments for dynamic rendering (VK_KHR_dynamic_rendering).
+        inline const VKFramebufferAttachments& GetFramebufferAttachments() const
+        {
+            return framebufferAttachments_;
+        }
+
         // Returns the render target resolution as VkExtent2D.
         inline VkExtent2D GetVkExtent() const
         {
@@ -87,8 +105,8 @@ class VKRenderTarget final : public RenderTarget
             const AttachmentDescriptor& attachmentDesc
         );
 
-        VkImageView CreateColorBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format);
-        VkImageView CreateDepthStencilBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format);
+        VKColorBuffer& CreateColorBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format);
+        VKDepthStencilBuffer& CreateDepthStencilBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format);
 
         void CreateFramebuffer(
             VkDevice                        device,
@@ -103,6 +121,7 @@ class VKRenderTarget final : public RenderTarget
         Extent2D                        resolution_;
 
         VKPtr<VkFramebuffer>            framebuffer_;
+        VKFramebufferAttachments        framebufferAttachments_;                        // Replaces 'framebuffer_' for dynamic rendering
         const VKRenderPass*             renderPass_             = nullptr;
         VKRenderPass                    defaultRenderPass_;
         VKRenderPass                    secondaryRenderPass_;
@@ -30,9 +30,10 @@ static VKSwizzleFormat MapToVKSwizzleFormat(const Format format)
 }
 
 VKTexture::VKTexture(
-    VkDevice                    device,
-    VKDeviceMemoryManager&      deviceMemoryMngr,
-    const TextureDescriptor&    desc)
+    VkDevice                        device,
+    VKDeviceMemoryManager&          deviceMemoryMngr,
+    const TextureDescriptor&        desc,
+    const ArrayView<std::uint32_t>& queueFamilyIndices)
 :
     Texture        { desc.type, desc.bindFlags         },
     image_         { device                            },
@@ -41,7 +42,7 @@ VKTexture::VKTexture(
     swizzleFormat_ { MapToVKSwizzleFormat(desc.format) }
 {
     /* Create Vulkan image and allocate memory region */
-    CreateImage(device, desc);
+    CreateImage(device, desc, queueFamilyIndices);
     image_.AllocateMemoryRegion(deviceMemoryMngr);
 }
 
@@ -442,7 +443,7 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
     return usageFlags;
 }
 
-void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
+void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc, const ArrayView<std::uint32_t>& queueFamilyIndices)
 {
     /* Setup texture parameters */
     VkImageType imageType = GetVkImageType(desc.type);
@@ -463,7 +464,8 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
         numArrayLayers_,
         GetVkImageCreateFlags(desc),
         sampleCountBits_,
-        usageFlags_
+        usageFlags_,
+        queueFamilyIndices
     );
 }
 
@@ -41,9 +41,10 @@ class VKTexture final : public Texture
     public:
 
         VKTexture(
-            VkDevice                    device,
-            VKDeviceMemoryManager&      deviceMemoryMngr,
-            const TextureDescriptor&    desc
+            VkDevice                        device,
+            VKDeviceMemoryManager&          deviceMemoryMngr,
+            const TextureDescriptor&        desc,
+            const ArrayView<std::uint32_t>& queueFamilyIndices  = {}
         );
 
     public:
@@ -145,7 +146,7 @@ class VKTexture final : public Texture
 
     private:
 
-        void CreateImage(VkDevice device, const TextureDescriptor& desc);
+        void CreateImage(VkDevice device, const TextureDescriptor& desc, const ArrayView<std::uint32_t>& queueFamilyIndices);
 
     private:
 
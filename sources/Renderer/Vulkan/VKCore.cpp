@@ -293,6 +293,20 @@ QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFla
     return indices;
 }
 
+std::uint32_t VKFindDedicatedQueueFamily(VkPhysicalDevice device, const VkQueueFlags requiredFlags, const VkQueueFlags excludedFlags)
+{
+    const std::vector<VkQueueFamilyProperties> queueFamilies = VKQueryQueueFamilyProperties(device);
+
+    for_range(i, queueFamilies.size())
+    {
+        const VkQueueFamilyProperties& family = queueFamilies[i];
+        if (family.queueCount > 0 && (family.queueFlags & requiredFlags) == requiredFlags && (family.queueFlags & excludedFlags) == 0)
+            return static_cast<std::uint32_t>(i);
+    }
+
+    return QueueFamilyIndices::invalidIndex;
+}
+
 VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const VkFormat* candidates, std::size_t numCandidates, VkImageTiling tiling, VkFormatFeatureFlags features)
 {
     for_range(i, numCandidates)
@@ -31,25 +31,44 @@ VKDevice::VKDevice() :
 }
 
 VKDevice::VKDevice(VKDevice&& device) :
-    device_             { std::move(device.device_)      },
-    queueFamilyIndices_ { device.queueFamilyIndices_     },
-    graphicsQueue_      { device.graphicsQueue_          },
-    commandPool_        { std::move(device.commandPool_) }
+    device_                  { std::move(device.device_)                  },
+    queueFamilyIndices_      { device.queueFamilyIndices_                 },
+    graphicsQueue_           { device.graphicsQueue_                      },
+    commandPool_             { std::move(device.commandPool_)             },
+    stagingCommandBuffer_    { device.stagingCommandBuffer_               },
+    stagingSubmissions_      { std::move(device.stagingSubmissions_)      },
+    computeFamily_           { device.computeFamily_                      },
+    transferFamily_          { device.transferFamily_                     },
+    computeQueue_            { device.computeQueue_                       },
+    transferQueue_           { device.transferQueue_                      },
+    concurrentQueueFamilies_ { std::move(device.concurrentQueueFamilies_) }
 {
+    device.stagingCommandBuffer_ = VK_NULL_HANDLE;
 }
 
 VKDevice& VKDevice::operator = (VKDevice&& device)
 {
-    device_             = std::move(device.device_);
-    queueFamilyIndices_ = device.queueFamilyIndices_;
-    graphicsQueue_      = device.graphicsQueue_;
-    commandPool_        = std::move(device.commandPool_);
+    device_                         = std::move(device.device_);
+    queueFamilyIndices_             = device.queueFamilyIndices_;
+    graphicsQueue_                  = device.graphicsQueue_;
+    commandPool_                    = std::move(device.commandPool_);
+    stagingCommandBuffer_           = device.stagingCommandBuffer_;
+    device.stagingCommandBuffer_    = VK_NULL_HANDLE;
+    stagingSubmissions_             = std::move(device.stagingSubmissions_);
+    computeFamily_                  = device.computeFamily_;
+    transferFamily_                 = device.transferFamily_;
+    computeQueue_                   = device.computeQueue_;
+    transferQueue_                  = device.transferQueue_;
+    concurrentQueueFamilies_        = std::move(device.concurrentQueueFamilies_);
     return *this;
 }
 
 void VKDevice::WaitIdle()
 {
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+    FlushStagingCommandBuffer();
     vkDeviceWaitIdle(device_);
+    RecycleStagingSubmissions();
 }
 
 // Device-only layers are deprecated -> set 'enabledLayerCount' and 'ppEnabledLayerNames' members to zero during device creation.
@@ -58,14 +77,21 @@ void VKDevice::CreateLogicalDevice(
     VkPhysicalDevice                physicalDevice,
     const VkPhysicalDeviceFeatures* features,
     const char* const*              extensions,
-    std::uint32_t                   numExtensions)
+    std::uint32_t                   numExtensions,
+    const void*                     featuresChain)
 {
     /* Initialize queue create description */
     queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
 
-    SmallVector<VkDeviceQueueCreateInfo, 2> queueCreateInfos;
+    /* Find queue families that are dedicated to compute and transfer commands, e.g. to run async compute or uploads next to the graphics queue */
+    computeFamily_  = VKFindDedicatedQueueFamily(physicalDevice, VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+    transferFamily_ = VKFindDedicatedQueueFamily(physicalDevice, VK_QUEUE_TRANSFER_BIT, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
 
-    auto AddQueueFamily = [&queueCreateInfos](std::uint32_t family, float queuePriority)
+    SmallVector<VkDeviceQueueCreateInfo, 4> queueCreateInfos;
+
+    static const float queuePriority = 1.0f;
+
+    auto AddQueueFamily = [&queueCreateInfos](std::uint32_t family)
     {
         VkDeviceQueueCreateInfo info;
         {
@@ -79,18 +105,22 @@ void VKDevice::CreateLogicalDevice(
         queueCreateInfos.push_back(info);
     };
 
-    constexpr float queuePriority = 1.0f;
-
-    AddQueueFamily(queueFamilyIndices_.graphicsFamily, queuePriority);
+    AddQueueFamily(queueFamilyIndices_.graphicsFamily);
 
     if (queueFamilyIndices_.graphicsFamily != queueFamilyIndices_.presentFamily)
-        AddQueueFamily(queueFamilyIndices_.presentFamily, queuePriority);
+        AddQueueFamily(queueFamilyIndices_.presentFamily);
+
+    if (computeFamily_ != QueueFamilyIndices::invalidIndex)
+        AddQueueFamily(computeFamily_);
+
+    if (transferFamily_ != QueueFamilyIndices::invalidIndex)
+        AddQueueFamily(transferFamily_);
 
     /* Create logical device */
     VkDeviceCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pNext                    = nullptr;
+        createInfo.pNext                    = featuresChain;
         createInfo.flags                    = 0;
         createInfo.queueCreateInfoCount     = static_cast<std::uint32_t>(queueCreateInfos.size());
         createInfo.pQueueCreateInfos        = queueCreateInfos.data();
@@ -106,6 +136,24 @@ void VKDevice::CreateLogicalDevice(
     /* Query device graphics queue */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
 
+    /* Query dedicated device queues; resources are shared concurrently between all used queue families */
+    if (computeFamily_ != QueueFamilyIndices::invalidIndex || transferFamily_ != QueueFamilyIndices::invalidIndex)
+    {
+        concurrentQueueFamilies_.push_back(queueFamilyIndices_.graphicsFamily);
+
+        if (computeFamily_ != QueueFamilyIndices::invalidIndex)
+        {
+            vkGetDeviceQueue(device_, computeFamily_, 0, &computeQueue_);
+            concurrentQueueFamilies_.push_back(computeFamily_);
+        }
+
+        if (transferFamily_ != QueueFamilyIndices::invalidIndex)
+        {
+            vkGetDeviceQueue(device_, transferFamily_, 0, &transferQueue_);
+            concurrentQueueFamilies_.push_back(transferFamily_);
+        }
+    }
+
     /* Create default command pool */
     commandPool_ = CreateCommandPool();
 }
@@ -145,6 +193,11 @@ VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
 
 VkCommandBuffer VKDevice::AllocCommandBuffer(bool begin)
 {
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    /* Submit pending staging commands first, so the new command buffer observes all previous uploads */
+    FlushStagingCommandBuffer();
+
     VkCommandBuffer cmdBuffer = VK_NULL_HANDLE;
 
     /* Allocate new primary level command buffer via staging command pool */
@@ -178,6 +231,8 @@ VkCommandBuffer VKDevice::AllocCommandBuffer(bool begin)
 
 void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
 {
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
     /* End command buffer record */
     VkResult result = vkEndCommandBuffer(cmdBuffer);
     VKThrowIfFailed(result, "failed to end recording Vulkan command buffer");
@@ -204,6 +259,122 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
         vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
 }
 
+VkCommandBuffer VKDevice::GetStagingCommandBuffer()
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+    if (stagingCommandBuffer_ == VK_NULL_HANDLE)
+        stagingCommandBuffer_ = AllocCommandBuffer();
+    return stagingCommandBuffer_;
+}
+
+bool VKDevice::FlushStagingCommandBuffer()
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+    if (stagingCommandBuffer_ == VK_NULL_HANDLE)
+        return false;
+
+    /* Reset handle before submission, since AllocCommandBuffer would otherwise flush it recursively */
+    VkCommandBuffer cmdBuffer = stagingCommandBuffer_;
+    stagingCommandBuffer_ = VK_NULL_HANDLE;
+
+    /*
+    Make all staging commands visible to every command that is submitted to the graphics queue afterwards.
+    This orders the uploads with subsequent submissions on the GPU, so the CPU does not have to wait for them.
+    */
+    VkMemoryBarrier memoryBarrier;
+    {
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        memoryBarrier.dstAccessMask = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+    }
+    vkCmdPipelineBarrier(
+        cmdBuffer,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0, // VkDependencyFlags
+        1, &memoryBarrier,
+        0, nullptr,
+        0, nullptr
+    );
+
+    VkResult result = vkEndCommandBuffer(cmdBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan staging command buffer");
+
+    /* Submit with a fence that is only polled to recycle the command buffer and staging memory */
+    StagingSubmission submission{ cmdBuffer, VKPtr<VkFence>{ device_, vkDestroyFence } };
+
+    VkFenceCreateInfo fenceCreateInfo;
+    {
+        fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceCreateInfo.pNext = nullptr;
+        fenceCreateInfo.flags = 0;
+    }
+    result = vkCreateFence(device_, &fenceCreateInfo, nullptr, submission.fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for staging commands");
+
+    VkSubmitInfo submitInfo = {};
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = (&cmdBuffer);
+    }
+    result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, submission.fence);
+    VKThrowIfFailed(result, "failed to submit Vulkan staging commands");
+
+    stagingSubmissions_.push_back(std::move(submission));
+
+    return true;
+}
+
+void VKDevice::FlushStagingCommandBufferForQueue(VkQueue queue)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+    FlushStagingCommandBuffer();
+
+    /* Barriers only order commands within the same queue, so other queues must wait for the uploads on the CPU */
+    if (queue != graphicsQueue_)
+        WaitForStagingSubmissions();
+}
+
+bool VKDevice::RecycleStagingSubmissions()
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    /* Release all submissions whose fence has been signaled */
+    auto it = std::remove_if(
+        stagingSubmissions_.begin(),
+        stagingSubmissions_.end(),
+        [this](StagingSubmission& submission) -> bool
+        {
+            if (vkGetFenceStatus(device_, submission.fence) != VK_SUCCESS)
+                return false;
+            vkFreeCommandBuffers(device_, commandPool_, 1, &(submission.commandBuffer));
+            return true;
+        }
+    );
+    stagingSubmissions_.erase(it, stagingSubmissions_.end());
+
+    return stagingSubmissions_.empty();
+}
+
+void VKDevice::WaitForStagingSubmissions()
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+    if (!stagingSubmissions_.empty())
+    {
+        SmallVector<VkFence, 4> fences;
+        fences.reserve(stagingSubmissions_.size());
+        for (const StagingSubmission& submission : stagingSubmissions_)
+            fences.push_back(submission.fence);
+
+        VkResult result = vkWaitForFences(device_, static_cast<std::uint32_t>(fences.size()), fences.data(), VK_TRUE, ULLONG_MAX);
+        VKThrowIfFailed(result, "failed to wait for Vulkan staging commands");
+
+        RecycleStagingSubmissions();
+    }
+}
+
 void VKDevice::CopyBuffer(
     VkBuffer        srcBuffer,
     VkBuffer        dstBuffer,
@@ -211,6 +382,9 @@ void VKDevice::CopyBuffer(
     VkDeviceSize    srcOffset,
     VkDeviceSize    dstOffset)
 {
+    /* Command pool must be locked while recording */
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
     VkCommandBuffer cmdBuffer = AllocCommandBuffer();
     {
         VkBufferCopy region;
@@ -272,6 +446,30 @@ void VKDevice::FlushMappedBuffer(VKDeviceBuffer& buffer, VkDeviceSize size, VkDe
     }
 }
 
+/* ----- Handles ----- */
+
+VkQueue VKDevice::GetDedicatedVkQueue(const CommandQueueType type) const
+{
+    switch (type)
+    {
+        case CommandQueueType::Graphics:    return graphicsQueue_;
+        case CommandQueueType::Compute:     return computeQueue_;
+        case CommandQueueType::Transfer:    return transferQueue_;
+    }
+    return VK_NULL_HANDLE;
+}
+
+std::uint32_t VKDevice::GetDedicatedQueueFamily(const CommandQueueType type) const
+{
+    switch (type)
+    {
+        case CommandQueueType::Graphics:    return queueFamilyIndices_.graphicsFamily;
+        case CommandQueueType::Compute:     return computeFamily_;
+        case CommandQueueType::Transfer:    return transferFamily_;
+    }
+    return QueueFamilyIndices::invalidIndex;
+}
+
 
 } // /namespace LLGL
 
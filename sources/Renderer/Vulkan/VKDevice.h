@@ -10,10 +10,15 @@
 
 
 #include <LLGL/TextureFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include <LLGL/Container/SmallVector.h>
 #include "Vulkan.h"
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "Buffer/VKDeviceBuffer.h"
+#include <mutex>
+#include <vector>
 
 
 namespace LLGL
@@ -39,7 +44,8 @@ class VKDevice
             VkPhysicalDevice                physicalDevice,
             const VkPhysicalDeviceFeatures* features,
             const char* const*              extensions,
-            std::uint32_t                   numExtensions
+            std::uint32_t                   numExtensions,
+            const void*                     featuresChain   = nullptr
         );
 
         void LoadLogicalDeviceWeakRef(VkPhysicalDevice physicalDevice, VkDevice device);
@@ -53,9 +59,36 @@ class VKDevice
 
         /* ----- Queue ----- */
 
+        // Allocates a new command buffer for a one-time submission. Pending staging commands are flushed first to preserve the order of uploads.
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true);
 
+        /* ----- Staging commands ----- */
+
+        // Returns the command buffer that batches staging commands (such as texture uploads) and allocates it on demand.
+        VkCommandBuffer GetStagingCommandBuffer();
+
+        /*
+        Submits the pending staging commands to the graphics queue without waiting for their completion. Returns false if there were no pending commands.
+        Subsequent submissions to the graphics queue observe all staging commands, since they end with a full memory barrier.
+        */
+        bool FlushStagingCommandBuffer();
+
+        // Submits the pending staging commands for a submission to the specified queue. Waits for their completion if the queue is not the graphics queue.
+        void FlushStagingCommandBufferForQueue(VkQueue queue);
+
+        // Releases the command buffers of all staging submissions the device has completed. Returns true if no staging submission is in flight anymore.
+        bool RecycleStagingSubmissions();
+
+        // Blocks until all submitted staging commands have been completed.
+        void WaitForStagingSubmissions();
+
+        // Returns true if there are pending staging commands that have not been submitted yet.
+        inline bool HasPendingStagingCommands() const
+        {
+            return (stagingCommandBuffer_ != VK_NULL_HANDLE);
+        }
+
         /* ----- Buffer/Image operatons ----- */
 
         void CopyBuffer(
@@ -102,18 +135,60 @@ class VKDevice
             return graphicsQueue_;
         }
 
+        // Returns the native VkQueue handle for the specified queue type or VK_NULL_HANDLE if the device has no dedicated queue family for that type.
+        VkQueue GetDedicatedVkQueue(const CommandQueueType type) const;
+
+        // Returns the queue family index for the specified queue type or QueueFamilyIndices::invalidIndex if the device has no dedicated queue family for that type.
+        std::uint32_t GetDedicatedQueueFamily(const CommandQueueType type) const;
+
+        // Returns the unique queue family indices resources must be shared with. This is empty if only the graphics queue is used.
+        inline ArrayView<std::uint32_t> GetConcurrentQueueFamilies() const
+        {
+            return concurrentQueueFamilies_;
+        }
+
         // Returns the native VkCommandPool handle.
         inline const VKPtr<VkCommandPool>& GetVkCommandPool() const
         {
             return commandPool_;
         }
 
+        /*
+        Returns the mutex that serializes access to the graphics queue, the command pool, and the staging command buffer.
+        This must be locked while recording into the staging command buffer, since resources can be created on loader threads.
+        */
+        inline std::recursive_mutex& GetQueueMutex()
+        {
+            return queueMutex_;
+        }
+
+    private:
+
+        // Staging command buffer that has been submitted but might still be in flight.
+        struct StagingSubmission
+        {
+            VkCommandBuffer commandBuffer;
+            VKPtr<VkFence>  fence;
+        };
+
     private:
 
         VKPtr<VkDevice>         device_;
         QueueFamilyIndices      queueFamilyIndices_;
-        VkQueue                 graphicsQueue_      = VK_NULL_HANDLE;
+        VkQueue                 graphicsQueue_          = VK_NULL_HANDLE;
         VKPtr<VkCommandPool>    commandPool_;
+        VkCommandBuffer         stagingCommandBuffer_   = VK_NULL_HANDLE;
+        std::vector<StagingSubmission>
+                                stagingSubmissions_;
+
+        std::uint32_t           computeFamily_          = QueueFamilyIndices::invalidIndex;
+        std::uint32_t           transferFamily_         = QueueFamilyIndices::invalidIndex;
+        VkQueue                 computeQueue_           = VK_NULL_HANDLE;
+        VkQueue                 transferQueue_          = VK_NULL_HANDLE;
+        SmallVector<std::uint32_t, 3>
+                                concurrentQueueFamilies_;
+
+        std::recursive_mutex    queueMutex_;
 
 };
 
@@ -189,6 +189,7 @@ static std::vector<Format> GetCompressedVKTextureFormatsS3TC()
         Format::BC3UNorm, Format::BC3UNorm_sRGB,
         Format::BC4UNorm, Format::BC4SNorm,
         Format::BC5UNorm, Format::BC5SNorm,
+        Format::BC7UNorm, Format::BC7UNorm_sRGB,
     };
 }
 
@@ -268,6 +269,8 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.features.hasPipelineStatistics             = (features_.pipelineStatisticsQuery != VK_FALSE);
     caps.features.hasRenderCondition                = SupportsExtension(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
     caps.features.hasPipelineCaching                = true;
+    caps.features.hasBindlessResources              = SupportsBindlessResources();
+    caps.features.hasIndirectDrawCount              = SupportsExtension(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -306,6 +309,12 @@ void VKPhysicalDevice::QueryDeviceProperties(
     pipelineLimits.lineWidthRange[1]    = limits.lineWidthRange[1];
     pipelineLimits.lineWidthGranularity = limits.lineWidthGranularity;
 
+    /* Store which graphics pipeline states can be set dynamically on the command buffer */
+    pipelineLimits.extendedDynamicState             = (extDynamicStateFeatures_.extendedDynamicState != VK_FALSE);
+    pipelineLimits.extendedDynamicState2            = (pipelineLimits.extendedDynamicState && extDynamicState2Features_.extendedDynamicState2 != VK_FALSE);
+    pipelineLimits.extendedDynamicState3PolygonMode = (pipelineLimits.extendedDynamicState && extDynamicState3Features_.extendedDynamicState3PolygonMode != VK_FALSE);
+    pipelineLimits.extendedDynamicState3DepthClamp  = (pipelineLimits.extendedDynamicState && extDynamicState3Features_.extendedDynamicState3DepthClampEnable != VK_FALSE);
+
     /*
     TODO: extension limits
     - VkPhysicalDeviceTransformFeedbackFeaturesEXT
@@ -325,11 +334,96 @@ VKDevice VKPhysicalDevice::CreateLogicalDevice(VkDevice customLogicalDevice)
     }
     else
     {
+        /* Enable timeline semaphores; this feature is mandatory for devices that support VK_KHR_timeline_semaphore */
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures = {};
+        const void* featuresChain = nullptr;
+
+        if (SupportsExtension(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+        {
+            timelineSemaphoreFeatures.sType             = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+            timelineSemaphoreFeatures.pNext             = nullptr;
+            timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+            featuresChain = &timelineSemaphoreFeatures;
+        }
+
+        /* Enable host query reset; this feature is mandatory for devices that support VK_EXT_host_query_reset */
+        VkPhysicalDeviceHostQueryResetFeaturesEXT hostQueryResetFeatures = {};
+
+        if (SupportsExtension(VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME))
+        {
+            hostQueryResetFeatures.sType            = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES_EXT;
+            hostQueryResetFeatures.pNext            = const_cast<void*>(featuresChain);
+            hostQueryResetFeatures.hostQueryReset   = VK_TRUE;
+            featuresChain = &hostQueryResetFeatures;
+        }
+
+        /* Enable descriptor indexing features for bindless resources */
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures = {};
+
+        if (SupportsBindlessResources())
+        {
+            descriptorIndexingFeatures.sType                                         = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+            descriptorIndexingFeatures.pNext                                         = const_cast<void*>(featuresChain);
+            descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing     = VK_TRUE;
+            descriptorIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing    = VK_TRUE;
+            descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind  = VK_TRUE;
+            descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+            descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending     = VK_TRUE;
+            descriptorIndexingFeatures.descriptorBindingPartiallyBound               = VK_TRUE;
+            descriptorIndexingFeatures.runtimeDescriptorArray                        = VK_TRUE;
+            featuresChain = &descriptorIndexingFeatures;
+        }
+
+        /* Enable dynamic rendering; this feature is mandatory for devices that support VK_KHR_dynamic_rendering */
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures = {};
+
+        if (SupportsExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+        {
+            dynamicRenderingFeatures.sType              = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+            dynamicRenderingFeatures.pNext              = const_cast<void*>(featuresChain);
+            dynamicRenderingFeatures.dynamicRendering   = VK_TRUE;
+            featuresChain = &dynamicRenderingFeatures;
+        }
+
+        /* Enable extended dynamic states to reduce the number of graphics pipeline permutations */
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extDynamicStateFeatures = {};
+
+        if (extDynamicStateFeatures_.extendedDynamicState != VK_FALSE)
+        {
+            extDynamicStateFeatures.sType                   = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+            extDynamicStateFeatures.pNext                   = const_cast<void*>(featuresChain);
+            extDynamicStateFeatures.extendedDynamicState    = VK_TRUE;
+            featuresChain = &extDynamicStateFeatures;
+        }
+
+        VkPhysicalDeviceExtendedDynamicState2FeaturesEXT extDynamicState2Features = {};
+
+        if (extDynamicState2Features_.extendedDynamicState2 != VK_FALSE)
+        {
+            extDynamicState2Features.sType                  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+            extDynamicState2Features.pNext                  = const_cast<void*>(featuresChain);
+            extDynamicState2Features.extendedDynamicState2  = VK_TRUE;
+            featuresChain = &extDynamicState2Features;
+        }
+
+        VkPhysicalDeviceExtendedDynamicState3FeaturesEXT extDynamicState3Features = {};
+
+        if (extDynamicState3Features_.extendedDynamicState3PolygonMode != VK_FALSE ||
+            extDynamicState3Features_.extendedDynamicState3DepthClampEnable != VK_FALSE)
+        {
+            extDynamicState3Features.sType                                  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+            extDynamicState3Features.pNext                                  = const_cast<void*>(featuresChain);
+            extDynamicState3Features.extendedDynamicState3PolygonMode       = extDynamicState3Features_.extendedDynamicState3PolygonMode;
+            extDynamicState3Features.extendedDynamicState3DepthClampEnable  = extDynamicState3Features_.extendedDynamicState3DepthClampEnable;
+            featuresChain = &extDynamicState3Features;
+        }
+
         device.CreateLogicalDevice(
             physicalDevice_,
             &features_,
             enabledExtensionNames_.data(),
-            static_cast<std::uint32_t>(enabledExtensionNames_.size())
+            static_cast<std::uint32_t>(enabledExtensionNames_.size()),
+            featuresChain
         );
     }
     return device;
@@ -340,6 +434,20 @@ std::uint32_t VKPhysicalDevice::FindMemoryType(std::uint32_t memoryTypeBits, VkM
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
 }
 
+bool VKPhysicalDevice::SupportsBindlessResources() const
+{
+    return
+    (
+        descriptorIndexingFeatures_.shaderSampledImageArrayNonUniformIndexing       != VK_FALSE &&
+        descriptorIndexingFeatures_.shaderStorageBufferArrayNonUniformIndexing      != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingSampledImageUpdateAfterBind    != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingStorageBufferUpdateAfterBind   != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingUpdateUnusedWhilePending       != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingPartiallyBound                 != VK_FALSE &&
+        descriptorIndexingFeatures_.runtimeDescriptorArray                          != VK_FALSE
+    );
+}
+
 bool VKPhysicalDevice::SupportsExtension(const char* extension) const
 {
     auto it = std::find_if(
@@ -394,6 +502,14 @@ void VKPhysicalDevice::QueryDeviceInfo()
         vkGetPhysicalDeviceProperties(physicalDevice_, &properties_);
         vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
     }
+
+    /* Query descriptor indexing features with Vulkan 1.1 since the device extension functions have not been loaded yet */
+    if (properties_.apiVersion >= VK_API_VERSION_1_1 && SupportsExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+        QueryDescriptorIndexingFeatures();
+
+    /* Query extended dynamic state features the same way */
+    if (properties_.apiVersion >= VK_API_VERSION_1_1)
+        QueryExtendedDynamicStateFeatures();
 }
 
 void VKPhysicalDevice::QueryDeviceFeaturesWithExtensions()
@@ -453,6 +569,64 @@ void VKPhysicalDevice::QueryDeviceMemoryPropertiesWithExtensions()
     vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
 }
 
+void VKPhysicalDevice::QueryDescriptorIndexingFeatures()
+{
+    descriptorIndexingFeatures_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+    descriptorIndexingFeatures_.pNext = nullptr;
+
+    VkPhysicalDeviceFeatures2 featuresExt = {};
+    {
+        featuresExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        featuresExt.pNext = &descriptorIndexingFeatures_;
+    }
+    vkGetPhysicalDeviceFeatures2(physicalDevice_, &featuresExt);
+    descriptorIndexingFeatures_.pNext = nullptr;
+
+    descriptorIndexingProps_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+    descriptorIndexingProps_.pNext = nullptr;
+
+    VkPhysicalDeviceProperties2 propertiesExt = {};
+    {
+        propertiesExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        propertiesExt.pNext = &descriptorIndexingProps_;
+    }
+    vkGetPhysicalDeviceProperties2(physicalDevice_, &propertiesExt);
+    descriptorIndexingProps_.pNext = nullptr;
+}
+
+void VKPhysicalDevice::QueryExtendedDynamicStateFeatures()
+{
+    VkPhysicalDeviceFeatures2 featuresExt = {};
+    featuresExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+
+    /* Only chain feature structures of supported extensions; the structures of the other extensions remain zero-initialized */
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+    {
+        extDynamicStateFeatures_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+        extDynamicStateFeatures_.pNext = featuresExt.pNext;
+        featuresExt.pNext = &extDynamicStateFeatures_;
+    }
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME))
+    {
+        extDynamicState2Features_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+        extDynamicState2Features_.pNext = featuresExt.pNext;
+        featuresExt.pNext = &extDynamicState2Features_;
+    }
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME))
+    {
+        extDynamicState3Features_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+        extDynamicState3Features_.pNext = featuresExt.pNext;
+        featuresExt.pNext = &extDynamicState3Features_;
+    }
+
+    if (featuresExt.pNext != nullptr)
+        vkGetPhysicalDeviceFeatures2(physicalDevice_, &featuresExt);
+
+    extDynamicStateFeatures_.pNext  = nullptr;
+    extDynamicState2Features_.pNext = nullptr;
+    extDynamicState3Features_.pNext = nullptr;
+}
+
 
 } // /namespace LLGL
 
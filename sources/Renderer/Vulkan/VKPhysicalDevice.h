@@ -87,6 +87,15 @@ class VKPhysicalDevice
             return enabledExtensionNames_;
         }
 
+        // Returns the descriptor indexing properties of the physical device. Only valid if SupportsBindlessResources() returns true.
+        inline const VkPhysicalDeviceDescriptorIndexingPropertiesEXT& GetDescriptorIndexingProperties() const
+        {
+            return descriptorIndexingProps_;
+        }
+
+        // Returns true if the physical device supports all descriptor indexing features that are required for bindless resources.
+        bool SupportsBindlessResources() const;
+
     private:
 
         // Helper struct to compare ANSI-C strings in a strict-weak-order (SWO)
@@ -106,6 +115,8 @@ class VKPhysicalDevice
         void QueryDeviceFeaturesWithExtensions();
         void QueryDevicePropertiesWithExtensions();
         void QueryDeviceMemoryPropertiesWithExtensions();
+        void QueryDescriptorIndexingFeatures();
+        void QueryExtendedDynamicStateFeatures();
 
     private:
 
@@ -122,6 +133,11 @@ class VKPhysicalDevice
 
         // Extension specific
         VkPhysicalDeviceConservativeRasterizationPropertiesEXT  conservRasterProps_         = {};
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT           descriptorIndexingFeatures_ = {};
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT         descriptorIndexingProps_    = {};
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT         extDynamicStateFeatures_    = {};
+        VkPhysicalDeviceExtendedDynamicState2FeaturesEXT        extDynamicState2Features_   = {};
+        VkPhysicalDeviceExtendedDynamicState3FeaturesEXT        extDynamicState3Features_   = {};
 
 };
 
@@ -21,10 +21,13 @@
 #include "VKInitializers.h"
 #include "RenderState/VKPredicateQueryHeap.h"
 #include "RenderState/VKComputePSO.h"
+#include "RenderState/VKGraphicsPipelinePool.h"
 #include "Shader/VKShaderModulePool.h"
 #include "../../Platform/Debug.h"
 #include <LLGL/ImageFlags.h>
 #include <limits>
+#include <algorithm>
+#include <string.h>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
@@ -76,12 +79,28 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
         (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
     );
+
+    /* Create pool of persistently mapped staging buffers for texture uploads */
+    constexpr VkDeviceSize stagingChunkSize = 4*1024*1024;
+    stagingBufferPool_ = MakeUnique<VKStagingBufferPool>(device_, *deviceMemoryMngr_, stagingChunkSize);
+
+    /* Create global descriptor set for bindless resources */
+    if (physicalDevice_.SupportsBindlessResources() && HasExtension(VKExt::EXT_descriptor_indexing))
+        bindlessHeap_ = MakeUnique<VKBindlessDescriptorHeap>(device_, physicalDevice_);
+    else if (GetRenderingCaps().features.hasBindlessResources)
+    {
+        /* Descriptor indexing is not available for custom logical devices (see CreateLogicalDevice) */
+        RenderingCapabilities caps = GetRenderingCaps();
+        caps.features.hasBindlessResources = false;
+        SetRenderingCaps(caps);
+    }
 }
 
 VKRenderSystem::~VKRenderSystem()
 {
     device_.WaitIdle();
     VKShaderModulePool::Get().Clear();
+    VKGraphicsPipelinePool::Get().Clear();
     VKPipelineLayout::ReleaseDefault();
 }
 
@@ -89,7 +108,7 @@ VKRenderSystem::~VKRenderSystem()
 
 SwapChain* VKRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
-    return swapChains_.emplace<VKSwapChain>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface);
+    return swapChains_.emplace<VKSwapChain>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, device_.GetQueueMutex(), swapChainDesc, surface);
 }
 
 void VKRenderSystem::Release(SwapChain& swapChain)
@@ -104,11 +123,31 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* VKRenderSystem::GetDedicatedCommandQueue(const CommandQueueType type)
+{
+    switch (type)
+    {
+        case CommandQueueType::Graphics:    return commandQueue_.get();
+        case CommandQueueType::Compute:     return computeQueue_.get();
+        case CommandQueueType::Transfer:    return transferQueue_.get();
+    }
+    return nullptr;
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices(), commandBufferDesc);
+    /* Record into a command pool of the dedicated queue family if there is one, otherwise fall back to the graphics queue */
+    QueueFamilyIndices queueFamilyIndices = device_.GetQueueFamilyIndices();
+    VkQueue queue = device_.GetDedicatedVkQueue(commandBufferDesc.queueType);
+
+    if (queue != VK_NULL_HANDLE)
+        queueFamilyIndices.graphicsFamily = device_.GetDedicatedQueueFamily(commandBufferDesc.queueType);
+    else
+        queue = device_.GetVkQueue();
+
+    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, queue, queueFamilyIndices, commandBufferDesc);
 }
 
 void VKRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -141,7 +180,7 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const v
     VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, bufferDesc.size);
 
     /* Create primary buffer object */
-    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
+    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc, device_.GetConcurrentQueueFamilies());
 
     /* Allocate device memory */
     VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(
@@ -177,6 +216,8 @@ void VKRenderSystem::Release(Buffer& buffer)
 {
     /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    if (bindlessHeap_)
+        bindlessHeap_->FreeIndex(buffer);
     bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     buffers_.erase(&buffer);
@@ -295,87 +336,113 @@ static VkImageLayout FindOptimalInitialVkImageLayout(Format format, long bindFla
     return VK_IMAGE_LAYOUT_UNDEFINED;
 }
 
+// Returns true if the source image must be converted into the format of the destination texture.
+static bool IsImageConversionRequired(const ImageView& srcImageView, const FormatAttributes& formatAttribs)
+{
+    return
+    (
+        formatAttribs.bitSize > 0 &&
+        (formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
+        (srcImageView.format != formatAttribs.format || srcImageView.dataType != formatAttribs.dataType)
+    );
+}
+
+// Returns the alignment of buffer offsets for image copies, i.e. a multiple of 4 and the texel block size (see VkBufferImageCopy::bufferOffset).
+static VkDeviceSize GetStagingImageAlignment(const FormatAttributes& formatAttribs)
+{
+    const VkDeviceSize blockSize = std::max<VkDeviceSize>(1, formatAttribs.bitSize / 8);
+    VkDeviceSize alignment = blockSize;
+    while (alignment % 4 != 0)
+        alignment += blockSize;
+    return alignment;
+}
+
+// Writes the source image into mapped staging memory and converts it into the texture format within the same pass if required.
+static void WriteImageToStagingRegion(
+    const VKStagingBufferRegion&    stagingRegion,
+    VkDeviceSize                    stagingSize,
+    const ImageView&                srcImageView,
+    std::uint32_t                   numTexels,
+    const FormatAttributes&         formatAttribs,
+    bool                            isConversionRequired)
+{
+    if (isConversionRequired)
+    {
+        const ImageView         srcTexelsView{ srcImageView.format, srcImageView.dataType, srcImageView.data, GetMemoryFootprint(srcImageView.format, srcImageView.dataType, numTexels) };
+        const MutableImageView  dstTexelsView{ formatAttribs.format, formatAttribs.dataType, stagingRegion.data, static_cast<std::size_t>(stagingSize) };
+        ConvertImageBuffer(srcTexelsView, dstTexelsView, LLGL_MAX_THREAD_COUNT);
+    }
+    else
+        ::memcpy(stagingRegion.data, srcImageView.data, static_cast<std::size_t>(stagingSize));
+}
+
 Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
     /* Determine size of image for staging buffer */
-    const std::uint32_t imageSize       = NumMipTexels(textureDesc, 0);
-    const std::size_t   initialDataSize = GetMemoryFootprint(textureDesc.format, imageSize);
+    const std::uint32_t     imageSize       = NumMipTexels(textureDesc, 0);
+    const std::size_t       initialDataSize = GetMemoryFootprint(textureDesc.format, imageSize);
+    const FormatAttributes& formatAttribs   = GetFormatAttribs(textureDesc.format);
 
     /* Set up initial image data */
-    const void* initialData = nullptr;
+    ImageView initialImageView;
     DynamicByteArray intermediateData;
+    bool isConversionRequired = false;
 
     if (initialImage != nullptr)
     {
-        /* Check if image data must be converted */
-        const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
-        if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
-        {
-            /* Convert image format (will be null if no conversion is necessary) */
-            intermediateData = ConvertImageBuffer(*initialImage, formatAttribs.format, formatAttribs.dataType, LLGL_MAX_THREAD_COUNT);
-        }
-
-        if (intermediateData)
+        isConversionRequired = IsImageConversionRequired(*initialImage, formatAttribs);
+        if (isConversionRequired)
         {
-            /*
-            Validate that source image data was large enough so conversion is valid,
-            then use temporary image buffer as source for initial data
-            */
+            /* Validate that source image data is large enough so conversion is valid */
             const std::size_t srcImageDataSize = GetMemoryFootprint(initialImage->format, initialImage->dataType, imageSize);
             RenderSystem::AssertImageDataSize(initialImage->dataSize, srcImageDataSize);
-            initialData = intermediateData.get();
         }
         else
         {
-            /*
-            Validate that image data is large enough,
-            then use input data as source for initial data
-            */
+            /* Validate that image data is large enough */
             RenderSystem::AssertImageDataSize(initialImage->dataSize, initialDataSize);
-            initialData = initialImage->data;
         }
+        initialImageView = *initialImage;
     }
     else if ((textureDesc.miscFlags & MiscFlags::NoInitialData) == 0)
     {
         /* Allocate default image data */
-        const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
         if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
             intermediateData = GenerateImageBuffer(formatAttribs.format, formatAttribs.dataType, imageSize, textureDesc.clearValue.color);
         else
             intermediateData = DynamicByteArray{ initialDataSize, UninitializeTag{} };
 
-        initialData = intermediateData.get();
+        initialImageView.data       = intermediateData.get();
+        initialImageView.dataSize   = initialDataSize;
     }
 
     /* Create device texture */
-    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, textureDesc, device_.GetConcurrentQueueFamilies());
 
-    if (initialData != nullptr)
-    {
-        /* Create staging buffer */
-        VkBufferCreateInfo stagingCreateInfo;
-        BuildVkBufferCreateInfo(
-            stagingCreateInfo,
-            initialDataSize,
-            VK_BUFFER_USAGE_TRANSFER_SRC_BIT
-        );
+    /* Staging memory and the shared command context are serialized with the graphics queue, since textures can be created on loader threads */
+    std::lock_guard<std::recursive_mutex> queueGuard{ device_.GetQueueMutex() };
 
-        VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, initialDataSize);
+    if (initialImageView.data != nullptr)
+    {
+        /* Write initial data directly into persistently mapped staging memory and convert it in the same pass if required */
+        const VKStagingBufferRegion stagingRegion = AllocStagingRegion(initialDataSize, GetStagingImageAlignment(formatAttribs));
+        WriteImageToStagingRegion(stagingRegion, initialDataSize, initialImageView, imageSize, formatAttribs, isConversionRequired);
 
-        /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state; this is submitted with the next batch */
+        BeginStagingCommands();
         {
             const TextureSubresource subresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() };
 
             textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
 
             context_.CopyBufferToImage(
-                stagingBuffer.GetVkBuffer(),
+                stagingRegion.buffer,
                 textureVK->GetVkImage(),
                 textureVK->GetVkFormat(),
                 VkOffset3D{ 0, 0, 0 },
                 textureVK->GetVkExtent(),
-                subresource
+                subresource,
+                stagingRegion.offset
             );
 
             textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, true);
@@ -391,10 +458,6 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
                 );
             }
         }
-        FlushCommandBuffer(cmdBuffer);
-
-        /* Release staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
     }
     else
     {
@@ -402,11 +465,10 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
         if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
         {
-            VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+            BeginStagingCommands();
             {
                 textureVK->TransitionImageLayout(context_, initialLayout, true);
             }
-            FlushCommandBuffer(cmdBuffer);
         }
     }
 
@@ -418,8 +480,15 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void VKRenderSystem::Release(Texture& texture)
 {
+    /* Submit batched uploads that might still refer to this texture and wait until the device has completed them */
+    std::lock_guard<std::recursive_mutex> queueGuard{ device_.GetQueueMutex() };
+    device_.FlushStagingCommandBuffer();
+    device_.WaitForStagingSubmissions();
+
     /* Release device memory region, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    if (bindlessHeap_)
+        bindlessHeap_->FreeIndex(texture);
     deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
     textures_.erase(&texture);
 }
@@ -433,72 +502,49 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
     const Extent3D&             extent          = textureRegion.extent;
     const TextureSubresource&   subresource     = textureRegion.subresource;
     const Format                format          = VKTypes::Unmap(textureVK.GetVkFormat());
+    const FormatAttributes&     formatAttribs   = GetFormatAttribs(format);
 
     VkImage                     image           = textureVK.GetVkImage();
     const std::uint32_t         imageSize       = extent.width * extent.height * extent.depth * subresource.numArrayLayers;
-    const void*                 imageData       = nullptr;
     const VkDeviceSize          imageDataSize   = static_cast<VkDeviceSize>(GetMemoryFootprint(format, imageSize));
 
     /* Check if image data must be converted */
-    DynamicByteArray intermediateData;
-
-    const auto& formatAttribs = GetFormatAttribs(format);
-    if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
+    const bool isConversionRequired = IsImageConversionRequired(srcImageView, formatAttribs);
+    if (isConversionRequired)
     {
-        /* Convert image format (will be null if no conversion is necessary) */
-        intermediateData = ConvertImageBuffer(srcImageView, formatAttribs.format, formatAttribs.dataType, LLGL_MAX_THREAD_COUNT);
-    }
-
-    if (intermediateData)
-    {
-        /*
-        Validate that source image data was large enough so conversion is valid,
-        then use temporary image buffer as source for initial data
-        */
+        /* Validate that source image data is large enough so conversion is valid */
         const std::size_t srcImageDataSize = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, imageSize);
         RenderSystem::AssertImageDataSize(srcImageView.dataSize, srcImageDataSize);
-        imageData = intermediateData.get();
     }
     else
     {
-        /*
-        Validate that image data is large enough,
-        then use input data as source for initial data
-        */
+        /* Validate that image data is large enough */
         RenderSystem::AssertImageDataSize(srcImageView.dataSize, static_cast<std::size_t>(imageDataSize));
-        imageData = srcImageView.data;
     }
 
-    /* Create staging buffer */
-    VkBufferCreateInfo stagingCreateInfo;
-    BuildVkBufferCreateInfo(
-        stagingCreateInfo,
-        imageDataSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(bufferDesc.cpuAccessFlags)
-    );
+    std::lock_guard<std::recursive_mutex> queueGuard{ device_.GetQueueMutex() };
 
-    VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, imageData, imageDataSize);
+    /* Write image data directly into persistently mapped staging memory and convert it in the same pass if required */
+    const VKStagingBufferRegion stagingRegion = AllocStagingRegion(imageDataSize, GetStagingImageAlignment(formatAttribs));
+    WriteImageToStagingRegion(stagingRegion, imageDataSize, srcImageView, imageSize, formatAttribs, isConversionRequired);
 
-    /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-    VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+    /* Copy staging buffer into hardware texture; this is submitted with the next batch */
+    BeginStagingCommands();
     {
         VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource, true);
 
         context_.CopyBufferToImage(
-            stagingBuffer.GetVkBuffer(),
+            stagingRegion.buffer,
             image,
             textureVK.GetVkFormat(),
             VkOffset3D{ offset.x, offset.y, offset.z },
             VkExtent3D{ extent.width, extent.height, extent.depth },
-            subresource
+            subresource,
+            stagingRegion.offset
         );
 
         textureVK.TransitionImageLayout(context_, oldLayout, subresource, true);
     }
-    FlushCommandBuffer(cmdBuffer);
-
-    /* Release staging buffer */
-    stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
 }
 
 void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
@@ -522,6 +568,7 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     VKDeviceBuffer stagingBuffer = CreateStagingBuffer(stagingCreateInfo);
 
     /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
+    std::unique_lock<std::recursive_mutex> queueLock{ device_.GetQueueMutex() };
     VkCommandBuffer cmdBuffer = AllocCommandBuffer();
     {
         VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, subresource, true);
@@ -538,6 +585,7 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
         textureVK.TransitionImageLayout(context_, oldLayout, subresource, true);
     }
     FlushCommandBuffer(cmdBuffer);
+    queueLock.unlock();
 
     /* Map staging buffer to CPU memory space */
     if (VKDeviceMemoryRegion* region = stagingBuffer.GetMemoryRegion())
@@ -566,6 +614,8 @@ Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 
 void VKRenderSystem::Release(Sampler& sampler)
 {
+    if (bindlessHeap_)
+        bindlessHeap_->FreeIndex(sampler);
     samplers_.erase(&sampler);
 }
 
@@ -628,7 +678,7 @@ void VKRenderSystem::Release(Shader& shader)
 
 PipelineLayout* VKRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<VKPipelineLayout>(device_, pipelineLayoutDesc);
+    return pipelineLayouts_.emplace<VKPipelineLayout>(device_, pipelineLayoutDesc, bindlessHeap_.get());
 }
 
 void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -676,14 +726,31 @@ void VKRenderSystem::Release(PipelineState& pipelineState)
 
 QueryHeap* VKRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapDesc)
 {
+    VKQueryHeap* queryHeapVK = nullptr;
     if (queryHeapDesc.renderCondition)
-        return queryHeaps_.emplace<VKPredicateQueryHeap>(device_, *deviceMemoryMngr_, queryHeapDesc);
+        queryHeapVK = queryHeaps_.emplace<VKPredicateQueryHeap>(device_, *deviceMemoryMngr_, queryHeapDesc);
+    else
+        queryHeapVK = queryHeaps_.emplace<VKQueryHeap>(device_, queryHeapDesc);
+
+    /* Reset all queries before their first use; Command buffers reset them again only when they are written a second time */
+    if (HasExtension(VKExt::EXT_host_query_reset))
+        vkResetQueryPoolEXT(device_, queryHeapVK->GetVkQueryPool(), 0, queryHeapVK->GetNumQueries());
     else
-        return queryHeaps_.emplace<VKQueryHeap>(device_, queryHeapDesc);
+    {
+        std::lock_guard<std::recursive_mutex> queueGuard{ device_.GetQueueMutex() };
+        vkCmdResetQueryPool(device_.GetStagingCommandBuffer(), queryHeapVK->GetVkQueryPool(), 0, queryHeapVK->GetNumQueries());
+    }
+
+    return queryHeapVK;
 }
 
 void VKRenderSystem::Release(QueryHeap& queryHeap)
 {
+    /* Primary command buffers must not reset the queries of this heap on behalf of their secondary command buffers after it has been released */
+    auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
+    for (const auto& commandBuffer : commandBuffers_)
+        commandBuffer->DiscardQueryHeap(queryHeapVK);
+
     queryHeaps_.erase(&queryHeap);
 }
 
@@ -699,6 +766,34 @@ void VKRenderSystem::Release(Fence& fence)
     fences_.erase(&fence);
 }
 
+/* ----- Loader threads ----- */
+
+bool VKRenderSystem::BeginLoaderThread()
+{
+    /* Vulkan objects can be created on any thread; shared state is serialized with the queue mutex of the device */
+    return true;
+}
+
+void VKRenderSystem::FlushLoaderThread()
+{
+    /* Submit staging commands of this loader thread, so its resources can be used by command buffers that are submitted afterwards */
+    device_.FlushStagingCommandBuffer();
+}
+
+void VKRenderSystem::EndLoaderThread()
+{
+    device_.FlushStagingCommandBuffer();
+}
+
+/* ----- Bindless resources ----- */
+
+std::uint32_t VKRenderSystem::GetBindlessIndex(Resource& resource)
+{
+    if (bindlessHeap_)
+        return bindlessHeap_->GetOrAllocateIndex(resource);
+    return LLGL_INVALID_BINDLESS_INDEX;
+}
+
 /* ----- Extensions ----- */
 
 bool VKRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -914,6 +1009,30 @@ bool VKRenderSystem::PickPhysicalDevice(long preferredDeviceFlags, VkPhysicalDev
     return true;
 }
 
+/*
+Returns true if the specified device extension is only usable when LLGL enables its device features itself (see VKPhysicalDevice::CreateLogicalDevice).
+Vulkan provides no way to query which features a logical device was created with, so these extensions must not be used with a custom logical device.
+*/
+static bool IsExtensionWithDeviceFeatures(const char* extensionName)
+{
+    const char* extensionsWithFeatures[] =
+    {
+        VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+        VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
+        VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME,
+        VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+        VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME,
+        VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME,
+        VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME,
+    };
+    for (const char* name : extensionsWithFeatures)
+    {
+        if (::strcmp(name, extensionName) == 0)
+            return true;
+    }
+    return false;
+}
+
 void VKRenderSystem::CreateLogicalDevice(VkDevice customLogicalDevice)
 {
     /* Create logical device with all supported physical device feature */
@@ -922,8 +1041,26 @@ void VKRenderSystem::CreateLogicalDevice(VkDevice customLogicalDevice)
     /* Create command queue interface */
     commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
 
+    /* Create interfaces for dedicated compute and transfer queues if the device provides separate queue families */
+    if (VkQueue computeQueue = device_.GetDedicatedVkQueue(CommandQueueType::Compute))
+        computeQueue_ = MakeUnique<VKCommandQueue>(device_, computeQueue, CommandQueueType::Compute);
+    if (VkQueue transferQueue = device_.GetDedicatedVkQueue(CommandQueueType::Transfer))
+        transferQueue_ = MakeUnique<VKCommandQueue>(device_, transferQueue, CommandQueueType::Transfer);
+
     /* Load Vulkan device extensions */
-    VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
+    if (customLogicalDevice != VK_NULL_HANDLE)
+    {
+        /* Keep the render pass based code paths etc. for custom logical devices, since their device features cannot be verified */
+        std::vector<const char*> extensionNames;
+        for (const char* name : physicalDevice_.GetExtensionNames())
+        {
+            if (!IsExtensionWithDeviceFeatures(name))
+                extensionNames.push_back(name);
+        }
+        VKLoadDeviceExtensions(device_, extensionNames);
+    }
+    else
+        VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
 }
 
 bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const
@@ -984,6 +1121,37 @@ void VKRenderSystem::FlushCommandBuffer(VkCommandBuffer commandBuffer)
     device_.FlushCommandBuffer(commandBuffer);
 }
 
+VKStagingBufferRegion VKRenderSystem::AllocStagingRegion(VkDeviceSize size, VkDeviceSize alignment)
+{
+    /* Submit current batch if it would exceed a single chunk, so the staging memory can be recycled sooner */
+    if (device_.HasPendingStagingCommands() && stagingBufferPool_->GetUsedSize() - stagingBatchOffset_ + size > stagingBufferPool_->GetChunkSize())
+        device_.FlushStagingCommandBuffer();
+
+    if (!device_.HasPendingStagingCommands())
+    {
+        /*
+        Recycle staging memory once the device has completed all previous uploads.
+        Otherwise, the pool grows until it holds too many uploads in flight, at which point we wait for the device.
+        */
+        constexpr VkDeviceSize maxNumChunksInFlight = 4;
+        if (device_.RecycleStagingSubmissions())
+            stagingBufferPool_->Reset();
+        else if (stagingBufferPool_->GetUsedSize() + size > stagingBufferPool_->GetChunkSize() * maxNumChunksInFlight)
+        {
+            device_.WaitForStagingSubmissions();
+            stagingBufferPool_->Reset();
+        }
+        stagingBatchOffset_ = stagingBufferPool_->GetUsedSize();
+    }
+
+    return stagingBufferPool_->Allocate(size, alignment);
+}
+
+void VKRenderSystem::BeginStagingCommands()
+{
+    context_.Reset(device_.GetStagingCommandBuffer());
+}
+
 
 } // /namespace LLGL
 
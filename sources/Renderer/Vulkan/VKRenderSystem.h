@@ -22,6 +22,7 @@
 
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
+#include "Buffer/VKStagingBufferPool.h"
 
 #include "Shader/VKShader.h"
 
@@ -36,6 +37,7 @@
 #include "RenderState/VKPipelineCache.h"
 #include "RenderState/VKGraphicsPSO.h"
 #include "RenderState/VKResourceHeap.h"
+#include "RenderState/VKBindlessDescriptorHeap.h"
 
 #include <string>
 #include <memory>
@@ -60,6 +62,14 @@ class VKRenderSystem final : public RenderSystem
         VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~VKRenderSystem();
 
+        CommandQueue* GetDedicatedCommandQueue(const CommandQueueType type) override;
+
+        bool BeginLoaderThread() override;
+        void EndLoaderThread() override;
+        void FlushLoaderThread() override;
+
+        std::uint32_t GetBindlessIndex(Resource& resource) override;
+
     private:
 
         void CreateInstance(const RendererConfigurationVulkan* config);
@@ -80,6 +90,12 @@ class VKRenderSystem final : public RenderSystem
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer commandBuffer);
 
+        // Allocates a region of persistently mapped staging memory. Submits the current batch of staging commands first if it has grown too large.
+        VKStagingBufferRegion AllocStagingRegion(VkDeviceSize size, VkDeviceSize alignment);
+
+        // Resets the command context to record into the batched staging command buffer of the device.
+        void BeginStagingCommands();
+
     private:
 
         /* ----- Common objects ----- */
@@ -94,6 +110,9 @@ class VKRenderSystem final : public RenderSystem
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        std::unique_ptr<VKStagingBufferPool>    stagingBufferPool_;
+        VkDeviceSize                            stagingBatchOffset_     = 0; // Used size of the staging pool when the current batch started.
+        std::unique_ptr<VKBindlessDescriptorHeap> bindlessHeap_; // Only created if bindless resources are supported.
 
         VKGraphicsPipelineLimits                gfxPipelineLimits_;
 
@@ -101,14 +120,16 @@ class VKRenderSystem final : public RenderSystem
 
         HWObjectContainer<VKSwapChain>          swapChains_;
         HWObjectInstance<VKCommandQueue>        commandQueue_;
+        HWObjectInstance<VKCommandQueue>        computeQueue_;
+        HWObjectInstance<VKCommandQueue>        transferQueue_;
         HWObjectContainer<VKCommandBuffer>      commandBuffers_;
-        HWObjectContainer<VKBuffer>             buffers_;
+        ConcurrentHWObjectContainer<VKBuffer>   buffers_;
         HWObjectContainer<VKBufferArray>        bufferArrays_;
-        HWObjectContainer<VKTexture>            textures_;
-        HWObjectContainer<VKSampler>            samplers_;
+        ConcurrentHWObjectContainer<VKTexture>  textures_;
+        ConcurrentHWObjectContainer<VKSampler>  samplers_;
         HWObjectContainer<VKRenderPass>         renderPasses_;
         HWObjectContainer<VKRenderTarget>       renderTargets_;
-        HWObjectContainer<VKShader>             shaders_;
+        ConcurrentHWObjectContainer<VKShader>   shaders_;
         HWObjectContainer<VKPipelineLayout>     pipelineLayouts_;
         HWObjectContainer<VKPipelineCache>      pipelineCaches_;
         HWObjectContainer<VKPipelineState>      pipelineStates_;
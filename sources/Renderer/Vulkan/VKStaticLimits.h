@@ -12,6 +12,11 @@
 // Maximum number of Vulkan shader stages per pipeline state object (PSO).
 #define LLGL_VK_MAX_NUM_PSO_SHADER_STAGES (5u)
 
+// Maximum number of descriptors per resource type in the bindless descriptor set. Clamped to the device limits.
+#define LLGL_VK_MAX_NUM_BINDLESS_TEXTURES   (65536u)
+#define LLGL_VK_MAX_NUM_BINDLESS_SAMPLERS   (2048u)
+#define LLGL_VK_MAX_NUM_BINDLESS_BUFFERS    (65536u)
+
 
 #endif
 
@@ -11,6 +11,7 @@
 #include "Command/VKCommandContext.h"
 #include "Memory/VKDeviceMemoryManager.h"
 #include "Texture/VKImageUtils.h"
+#include "Ext/VKExtensionRegistry.h"
 #include "../TextureUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Exception.h"
@@ -53,6 +54,7 @@ VKSwapChain::VKSwapChain(
     VkPhysicalDevice                physicalDevice,
     VkDevice                        device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
+    std::recursive_mutex&           queueMutex,
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface)
 :
@@ -74,6 +76,7 @@ VKSwapChain::VKSwapChain(
     secondaryRenderPass_     { device                          },
     depthStencilBuffer_      { device                          },
     colorBuffers_            { device, device, device          },
+    queueMutex_              { queueMutex                      },
     imageAvailableSemaphore_ { NullVkSemaphore(device_),
                                NullVkSemaphore(device_),
                                NullVkSemaphore(device_)        },
@@ -118,6 +121,10 @@ void VKSwapChain::Present()
         submitInfo.signalSemaphoreCount = 1;
         submitInfo.pSignalSemaphores    = signalSemaphores;
     }
+
+    /* Queue submissions must be serialized with staging uploads from loader threads */
+    std::unique_lock<std::recursive_mutex> queueLock{ queueMutex_ };
+
     VkResult result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFences_[currentFrameInFlight_]);
     VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
 
@@ -134,6 +141,7 @@ void VKSwapChain::Present()
         presentInfo.pResults            = nullptr;
     }
     result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+    queueLock.unlock();
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
     /* Move to next frame */
@@ -289,7 +297,10 @@ bool VKSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
         swapChainExtent_.height != resolution.height)
     {
         /* Wait until graphics queue is idle before resources are destroyed and recreated */
-        vkQueueWaitIdle(graphicsQueue_);
+        {
+            std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+            vkQueueWaitIdle(graphicsQueue_);
+        }
 
         /* Recreate presenting semaphores and Vulkan surface */
         CreatePresentSemaphoresAndFences();
@@ -552,8 +563,27 @@ void VKSwapChain::CreateSwapChainFramebuffers()
     }
 
     /* Create all framebuffers for the swap-chain */
+    const bool hasDynamicRendering = HasExtension(VKExt::KHR_dynamic_rendering);
+
     for_range(i, numColorBuffers_)
     {
+        /* Store attachments for dynamic rendering */
+        VKFramebufferAttachments& dynamicAttachments = swapChainAttachments_[i];
+        if (HasMultiSampling())
+        {
+            dynamicAttachments.colorAttachments[0].Init(colorBuffers_[i].GetVkImage(), colorBuffers_[i].GetVkImageView(), swapChainFormat_.format);
+            dynamicAttachments.resolveAttachments[0].Init(swapChainImages_[i], swapChainImageViews_[i], swapChainFormat_.format);
+        }
+        else
+            dynamicAttachments.colorAttachments[0].Init(swapChainImages_[i], swapChainImageViews_[i], swapChainFormat_.format);
+
+        if (HasDepthStencilBuffer())
+            dynamicAttachments.depthStencilAttachment.Init(depthStencilBuffer_.GetVkImage(), depthStencilBuffer_.GetVkImageView(), depthStencilFormat_);
+
+        /* Image views are passed to vkCmdBeginRenderingKHR directly if dynamic rendering is enabled */
+        if (hasDynamicRendering)
+            continue;
+
         /* Update image view in Vulkan descriptor */
         if (HasMultiSampling())
         {
@@ -19,6 +19,7 @@
 #include "Texture/VKColorBuffer.h"
 #include <memory>
 #include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -39,6 +40,7 @@ class VKSwapChain final : public SwapChain
             VkPhysicalDevice                physicalDevice,
             VkDevice                        device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
+            std::recursive_mutex&           queueMutex,
             const SwapChainDescriptor&      desc,
             const std::shared_ptr<Surface>& surface
         );
@@ -70,6 +72,12 @@ class VKSwapChain final : public SwapChain
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
+        // Returns the secondary render pass object.
+        inline const VKRenderPass& GetSecondaryRenderPass() const
+        {
+            return secondaryRenderPass_;
+        }
+
         // Returns the actual swap buffer index.
         std::uint32_t TranslateSwapIndex(std::uint32_t swapBufferIndex) const;
 
@@ -79,6 +87,12 @@ class VKSwapChain final : public SwapChain
             return swapChainFramebuffers_[swapBufferIndex].Get();
         }
 
+        // Returns the framebuffer attachments for dynamic rendering (VK_KHR_dynamic_rendering).
+        inline const VKFramebufferAttachments& GetFramebufferAttachments(std::uint32_t swapBufferIndex) const
+        {
+            return swapChainAttachments_[swapBufferIndex];
+        }
+
         // Returns the swap-chain resolution as VkExtent2D.
         inline const VkExtent2D& GetVkExtent() const
         {
@@ -154,6 +168,7 @@ class VKSwapChain final : public SwapChain
         VkImage                 swapChainImages_[maxNumColorBuffers];
         VKPtr<VkImageView>      swapChainImageViews_[maxNumColorBuffers];
         VKPtr<VkFramebuffer>    swapChainFramebuffers_[maxNumColorBuffers];
+        VKFramebufferAttachments swapChainAttachments_[maxNumColorBuffers];     // Replaces 'swapChainFramebuffers_' for dynamic rendering
 
         std::uint32_t           numColorBuffers_                            = 2;
         std::uint32_t           currentColorBuffer_                         = 0; // determined by vkAcquireNextImageKHR
@@ -167,6 +182,7 @@ class VKSwapChain final : public SwapChain
 
         VkQueue                 graphicsQueue_                              = VK_NULL_HANDLE;
         VkQueue                 presentQueue_                               = VK_NULL_HANDLE;
+        std::recursive_mutex&   queueMutex_;                                            // See VKDevice::GetQueueMutex
 
         VKPtr<VkSemaphore>      imageAvailableSemaphore_[maxNumFramesInFlight];
         VKPtr<VkSemaphore>      renderFinishedSemaphore_[maxNumFramesInFlight];
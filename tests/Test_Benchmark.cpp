@@ -0,0 +1,588 @@
+/*
+ * Test_Benchmark.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Microbenchmarks for the CPU-side overhead of the LLGL API.
+By default, all benchmarks run against the Null renderer so they only measure the frontend, the debug layer, and the common utilities.
+Each render system benchmark runs without the debug layer, with the debug layer, and with the debug layer and validation sampling.
+The results are written as JSON to stdout or to the output file.
+
+Usage: Test_Benchmark [MODULE] [-n ITERATIONS] [-s SAMPLING_INTERVAL] [-b OVERHEAD_BUDGET] [-o OUTPUT_FILE]
+A sampling interval of 0 or 1 disables the benchmarks with validation sampling.
+The overhead budget (in percent, 5 by default) is the maximum overhead the debug layer may add to recording a frame with the configured validation sampling.
+The process returns 2 if the budget is exceeded. Since the Null renderer does not do any work per command, the budget is only meaningful for hardware renderers.
+*/
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/VertexFormat.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+struct BenchmarkConfig
+{
+    std::string     moduleName  = "Null";
+    std::uint32_t   iterations  = 10000;
+    std::uint32_t   numRuns     = 5;
+    std::string     outputFile;
+    std::uint32_t   samplingInterval = 16;
+    double          overheadBudget  = 5.0; // Maximum overhead (in percent) of the debug layer for recording a frame
+};
+
+struct BenchmarkResult
+{
+    std::string     name;
+    int             debugLayer  = -1; // -1 if independent of the render system
+    std::uint32_t   sampling    = 1;  // Validation sampling interval of the debug layer
+    const char*     unit        = "ns/op";
+    double          value       = 0.0;
+};
+
+static BenchmarkConfig              g_config;
+static std::vector<BenchmarkResult> g_results;
+
+// Returns the elapsed time (in nanoseconds) between the two timer ticks.
+static double ElapsedNanoseconds(std::uint64_t startTick, std::uint64_t endTick)
+{
+    return static_cast<double>(endTick - startTick) * 1.0e9 / static_cast<double>(LLGL::Timer::Frequency());
+}
+
+// Runs the specified function several times and returns the minimal elapsed time (in nanoseconds) the function reported.
+template <typename TFunc>
+static double MeasureMinNanoseconds(TFunc func)
+{
+    double minElapsed = 0.0;
+    for (std::uint32_t run = 0; run < g_config.numRuns; ++run)
+    {
+        const double elapsed = func();
+        if (run == 0 || elapsed < minElapsed)
+            minElapsed = elapsed;
+    }
+    return minElapsed;
+}
+
+// Runs the specified function and returns the minimal elapsed time (in nanoseconds) for a single invocation of it.
+template <typename TFunc>
+static double MeasureNanosecondsPerOp(TFunc func)
+{
+    return MeasureMinNanoseconds(
+        [&func]() -> double
+        {
+            const std::uint64_t startTick = LLGL::Timer::Tick();
+            {
+                for (std::uint32_t i = 0; i < g_config.iterations; ++i)
+                    func(i);
+            }
+            const std::uint64_t endTick = LLGL::Timer::Tick();
+            return ElapsedNanoseconds(startTick, endTick);
+        }
+    ) / static_cast<double>(g_config.iterations);
+}
+
+static double NanosecondsPerOpToMegabytesPerSecond(double nanoseconds, std::size_t bytesPerOp)
+{
+    return (nanoseconds > 0.0 ? static_cast<double>(bytesPerOp) * 1.0e3 / nanoseconds : 0.0);
+}
+
+static void AddResult(const char* name, int debugLayer, const char* unit, double value, std::uint32_t sampling = 1)
+{
+    BenchmarkResult result;
+    {
+        result.name         = name;
+        result.debugLayer   = debugLayer;
+        result.sampling     = sampling;
+        result.unit         = unit;
+        result.value        = value;
+    }
+    g_results.push_back(result);
+    std::cerr << name;
+    if (debugLayer == 1)
+    {
+        if (sampling > 1)
+            std::cerr << " (debug layer, sampling 1/" << sampling << ")";
+        else
+            std::cerr << " (debug layer)";
+    }
+    std::cerr << ": " << value << ' ' << unit << std::endl;
+}
+
+
+/*
+ * Render system benchmarks
+ */
+
+class RenderSystemBenchmark
+{
+
+    public:
+
+        RenderSystemBenchmark(bool debugLayer, std::uint32_t samplingInterval = 1) :
+            debugLayer_         { debugLayer       },
+            samplingInterval_   { samplingInterval }
+        {
+            // Only fully validate every N-th command to measure the overhead of a sampled debug layer
+            LLGL::ValidationSampling sampling;
+            {
+                sampling.interval = samplingInterval;
+            }
+            debugger_.SetValidationSampling(sampling);
+
+            // Load render system module with or without debug layer
+            LLGL::RenderSystemDescriptor rendererDesc = g_config.moduleName;
+            {
+                rendererDesc.debugger = (debugLayer ? &debugger_ : nullptr);
+            }
+            renderer_ = LLGL::RenderSystem::Load(rendererDesc);
+            if (!renderer_)
+                throw std::runtime_error("failed to load render system module: " + g_config.moduleName);
+
+            commandQueue_ = renderer_->GetCommandQueue();
+            commandBuffer_ = renderer_->CreateCommandBuffer();
+
+            // Create render target to record draw commands into
+            LLGL::TextureDescriptor colorDesc;
+            {
+                colorDesc.bindFlags     = LLGL::BindFlags::ColorAttachment;
+                colorDesc.format        = LLGL::Format::RGBA8UNorm;
+                colorDesc.extent        = { 64, 64, 1 };
+                colorDesc.mipLevels     = 1;
+            }
+            colorTexture_ = renderer_->CreateTexture(colorDesc);
+
+            LLGL::RenderTargetDescriptor renderTargetDesc;
+            {
+                renderTargetDesc.resolution             = { 64, 64 };
+                renderTargetDesc.colorAttachments[0]    = colorTexture_;
+            }
+            renderTarget_ = renderer_->CreateRenderTarget(renderTargetDesc);
+
+            // Create vertex buffer for a single triangle
+            LLGL::VertexFormat vertexFormat;
+            vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+            const float vertices[] = { 0.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f };
+
+            LLGL::BufferDescriptor vertexBufferDesc;
+            {
+                vertexBufferDesc.size           = sizeof(vertices);
+                vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+                vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+            }
+            vertexBuffer_ = renderer_->CreateBuffer(vertexBufferDesc, vertices);
+
+            // Create constant buffer for resource bindings
+            LLGL::BufferDescriptor bufferDesc;
+            {
+                bufferDesc.size         = 256;
+                bufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+            }
+            const std::uint8_t constants[256] = {};
+            constantBuffer_ = renderer_->CreateBuffer(bufferDesc, constants);
+
+            // Create two graphics PSOs to alternate between
+            pipelineLayout_ = renderer_->CreatePipelineLayout(LLGL::Parse("cbuffer(Scene@0):vert:frag"));
+
+            // Null renderer does not compile shaders, so the source is only a placeholder
+            LLGL::ShaderDescriptor vertShaderDesc{ LLGL::ShaderType::Vertex, "void main() {}" };
+            {
+                vertShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+                vertShaderDesc.vertex.inputAttribs  = vertexFormat.attributes;
+            }
+            vertexShader_ = renderer_->CreateShader(vertShaderDesc);
+
+            LLGL::ShaderDescriptor fragShaderDesc{ LLGL::ShaderType::Fragment, "void main() {}" };
+            {
+                fragShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+            }
+            fragmentShader_ = renderer_->CreateShader(fragShaderDesc);
+
+            for (LLGL::PipelineState*& pso : pipelineStates_)
+            {
+                LLGL::GraphicsPipelineDescriptor psoDesc;
+                {
+                    psoDesc.pipelineLayout      = pipelineLayout_;
+                    psoDesc.vertexShader        = vertexShader_;
+                    psoDesc.fragmentShader      = fragmentShader_;
+                    psoDesc.renderPass          = renderTarget_->GetRenderPass();
+                    psoDesc.rasterizer.cullMode = (&pso == &pipelineStates_[0] ? LLGL::CullMode::Back : LLGL::CullMode::Front);
+                }
+                pso = renderer_->CreatePipelineState(psoDesc);
+            }
+        }
+
+        void Run()
+        {
+            RunRecordDraw();
+            RunRecordSetResource();
+            RunRecordSetPipelineState();
+            RunRecordFrame();
+            RunSubmit();
+            RunCreateBuffer();
+            RunCreateTexture();
+        }
+
+    private:
+
+        // Begins recording a render pass with all states that are required for draw commands.
+        void BeginRenderPass(LLGL::CommandBuffer& cmdBuffer)
+        {
+            cmdBuffer.Begin();
+            cmdBuffer.BeginRenderPass(*renderTarget_);
+            cmdBuffer.SetViewport(renderTarget_->GetResolution());
+            cmdBuffer.SetVertexBuffer(*vertexBuffer_);
+            cmdBuffer.SetPipelineState(*pipelineStates_[0]);
+            cmdBuffer.SetResource(0, *constantBuffer_);
+        }
+
+        void EndRenderPass(LLGL::CommandBuffer& cmdBuffer)
+        {
+            cmdBuffer.EndRenderPass();
+            cmdBuffer.End();
+        }
+
+        // Measures the elapsed time of the specified recording function within a render pass, excluding Begin and End.
+        template <typename TFunc>
+        double MeasureRecordingNanosecondsPerOp(TFunc func)
+        {
+            return MeasureMinNanoseconds(
+                [this, &func]() -> double
+                {
+                    BeginRenderPass(*commandBuffer_);
+                    const std::uint64_t startTick = LLGL::Timer::Tick();
+                    {
+                        for (std::uint32_t i = 0; i < g_config.iterations; ++i)
+                            func(i);
+                    }
+                    const std::uint64_t endTick = LLGL::Timer::Tick();
+                    EndRenderPass(*commandBuffer_);
+                    return ElapsedNanoseconds(startTick, endTick);
+                }
+            ) / static_cast<double>(g_config.iterations);
+        }
+
+        void RunRecordDraw()
+        {
+            const double ns = MeasureRecordingNanosecondsPerOp(
+                [this](std::uint32_t /*i*/)
+                {
+                    commandBuffer_->Draw(3, 0);
+                }
+            );
+            AddResult("RecordDraw", debugLayer_, "ns/op", ns, samplingInterval_);
+        }
+
+        void RunRecordSetResource()
+        {
+            const double ns = MeasureRecordingNanosecondsPerOp(
+                [this](std::uint32_t /*i*/)
+                {
+                    commandBuffer_->SetResource(0, *constantBuffer_);
+                }
+            );
+            AddResult("RecordSetResource", debugLayer_, "ns/op", ns, samplingInterval_);
+        }
+
+        void RunRecordSetPipelineState()
+        {
+            const double ns = MeasureRecordingNanosecondsPerOp(
+                [this](std::uint32_t i)
+                {
+                    commandBuffer_->SetPipelineState(*pipelineStates_[i & 1u]);
+                }
+            );
+            AddResult("RecordSetPipelineState", debugLayer_, "ns/op", ns, samplingInterval_);
+        }
+
+        // Measures a typical frame that binds a new PSO every 8 draws and a resource for each draw. Reports the time per draw.
+        void RunRecordFrame()
+        {
+            const double ns = MeasureRecordingNanosecondsPerOp(
+                [this](std::uint32_t i)
+                {
+                    if (i % 8 == 0)
+                        commandBuffer_->SetPipelineState(*pipelineStates_[(i / 8) & 1u]);
+                    commandBuffer_->SetResource(0, *constantBuffer_);
+                    commandBuffer_->Draw(3, 0);
+                }
+            );
+            AddResult("RecordFrame", debugLayer_, "ns/draw", ns, samplingInterval_);
+        }
+
+        void RunSubmit()
+        {
+            // Record a small command buffer once and submit it repeatedly
+            LLGL::CommandBuffer* cmdBuffer = renderer_->CreateCommandBuffer(LLGL::CommandBufferFlags::MultiSubmit);
+            {
+                BeginRenderPass(*cmdBuffer);
+                cmdBuffer->Draw(3, 0);
+                EndRenderPass(*cmdBuffer);
+            }
+            const double ns = MeasureMinNanoseconds(
+                [this, cmdBuffer]() -> double
+                {
+                    const std::uint64_t startTick = LLGL::Timer::Tick();
+                    {
+                        for (std::uint32_t i = 0; i < g_config.iterations; ++i)
+                            commandQueue_->Submit(*cmdBuffer);
+                        commandQueue_->WaitIdle();
+                    }
+                    const std::uint64_t endTick = LLGL::Timer::Tick();
+                    return ElapsedNanoseconds(startTick, endTick);
+                }
+            ) / static_cast<double>(g_config.iterations);
+            renderer_->Release(*cmdBuffer);
+            AddResult("Submit", debugLayer_, "submits/s", (ns > 0.0 ? 1.0e9 / ns : 0.0), samplingInterval_);
+        }
+
+        void RunCreateBuffer()
+        {
+            LLGL::BufferDescriptor bufferDesc;
+            {
+                bufferDesc.size         = 1024;
+                bufferDesc.bindFlags    = LLGL::BindFlags::VertexBuffer;
+            }
+            const double ns = MeasureNanosecondsPerOp(
+                [this, &bufferDesc](std::uint32_t /*i*/)
+                {
+                    LLGL::Buffer* buffer = renderer_->CreateBuffer(bufferDesc);
+                    renderer_->Release(*buffer);
+                }
+            );
+            AddResult("CreateBuffer", debugLayer_, "ns/op", ns, samplingInterval_);
+        }
+
+        void RunCreateTexture()
+        {
+            LLGL::TextureDescriptor textureDesc;
+            {
+                textureDesc.format      = LLGL::Format::RGBA8UNorm;
+                textureDesc.extent      = { 64, 64, 1 };
+            }
+            const double ns = MeasureNanosecondsPerOp(
+                [this, &textureDesc](std::uint32_t /*i*/)
+                {
+                    LLGL::Texture* texture = renderer_->CreateTexture(textureDesc);
+                    renderer_->Release(*texture);
+                }
+            );
+            AddResult("CreateTexture", debugLayer_, "ns/op", ns, samplingInterval_);
+        }
+
+    private:
+
+        bool                        debugLayer_         = false;
+        std::uint32_t               samplingInterval_   = 1;
+        LLGL::RenderingDebugger     debugger_;
+        LLGL::RenderSystemPtr       renderer_;
+
+        LLGL::CommandQueue*         commandQueue_       = nullptr;
+        LLGL::CommandBuffer*        commandBuffer_      = nullptr;
+
+        LLGL::Texture*              colorTexture_       = nullptr;
+        LLGL::RenderTarget*         renderTarget_       = nullptr;
+        LLGL::Buffer*               vertexBuffer_       = nullptr;
+        LLGL::Buffer*               constantBuffer_     = nullptr;
+        LLGL::PipelineLayout*       pipelineLayout_     = nullptr;
+        LLGL::Shader*               vertexShader_       = nullptr;
+        LLGL::Shader*               fragmentShader_     = nullptr;
+        LLGL::PipelineState*        pipelineStates_[2]  = {};
+
+};
+
+
+/*
+ * Utility benchmarks
+ */
+
+static void RunConvertImageBuffer()
+{
+    // Convert RGBA8 image into RGBA32F image on a single thread
+    const std::uint32_t numTexels = 256 * 256;
+
+    std::vector<std::uint8_t> srcData(numTexels * 4);
+    for (std::size_t i = 0; i < srcData.size(); ++i)
+        srcData[i] = static_cast<std::uint8_t>(i * 7);
+
+    std::vector<float> dstData(numTexels * 4);
+
+    const LLGL::ImageView srcImageView{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, srcData.data(), srcData.size() };
+    const LLGL::MutableImageView dstImageView{ LLGL::ImageFormat::RGBA, LLGL::DataType::Float32, dstData.data(), dstData.size() * sizeof(float) };
+
+    const std::uint32_t iterations = std::max(1u, g_config.iterations / 1000u);
+    const double ns = MeasureMinNanoseconds(
+        [&]() -> double
+        {
+            const std::uint64_t startTick = LLGL::Timer::Tick();
+            {
+                for (std::uint32_t i = 0; i < iterations; ++i)
+                    LLGL::ConvertImageBuffer(srcImageView, dstImageView, 1);
+            }
+            const std::uint64_t endTick = LLGL::Timer::Tick();
+            return ElapsedNanoseconds(startTick, endTick);
+        }
+    ) / static_cast<double>(iterations);
+
+    AddResult("ConvertImageBuffer", -1, "MB/s", NanosecondsPerOpToMegabytesPerSecond(ns, srcData.size()));
+}
+
+static void RunParse()
+{
+    const char* source = "heap{cbuffer(Scene@1):vert:frag, texture(colorMap@2):frag, sampler(linearSampler@3):frag}, cbuffer(Model@4):vert";
+    const std::size_t sourceSize = std::strlen(source);
+
+    const double ns = MeasureNanosecondsPerOp(
+        [source, sourceSize](std::uint32_t /*i*/)
+        {
+            LLGL::PipelineLayoutDescriptor layoutDesc = LLGL::Parse(LLGL::StringView{ source, sourceSize });
+            (void)layoutDesc;
+        }
+    );
+
+    AddResult("Parse", -1, "MB/s", NanosecondsPerOpToMegabytesPerSecond(ns, sourceSize));
+}
+
+
+/*
+ * JSON output
+ */
+
+// Returns the result with the specified name and debug layer configuration or null if there is no such result.
+static const BenchmarkResult* FindResult(const char* name, int debugLayer, std::uint32_t sampling)
+{
+    for (const BenchmarkResult& result : g_results)
+    {
+        if (result.name == name && result.debugLayer == debugLayer && result.sampling == sampling)
+            return &result;
+    }
+    return nullptr;
+}
+
+// Adds the overhead of the debug layer for recording a frame and returns false if it exceeds the budget.
+static bool CheckDebugLayerOverhead()
+{
+    const std::uint32_t     sampling    = (g_config.samplingInterval > 1 ? g_config.samplingInterval : 1);
+    const BenchmarkResult*  baseline    = FindResult("RecordFrame", 0, 1);
+    const BenchmarkResult*  debugLayer  = FindResult("RecordFrame", 1, sampling);
+
+    if (baseline == nullptr || debugLayer == nullptr || !(baseline->value > 0.0))
+        return true;
+
+    const double overhead = (debugLayer->value - baseline->value) * 100.0 / baseline->value;
+    AddResult("RecordFrameOverhead", 1, "%", overhead, sampling);
+
+    if (overhead > g_config.overheadBudget)
+    {
+        std::cerr << "debug layer overhead for recording a frame (" << overhead << "%) exceeds budget of " << g_config.overheadBudget << '%' << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static void WriteResultsJSON(std::ostream& stream)
+{
+    stream << "{\n";
+    stream << "  \"module\": \"" << g_config.moduleName << "\",\n";
+    stream << "  \"iterations\": " << g_config.iterations << ",\n";
+    stream << "  \"runs\": " << g_config.numRuns << ",\n";
+    stream << "  \"overheadBudget\": " << g_config.overheadBudget << ",\n";
+    stream << "  \"results\": [\n";
+
+    for (std::size_t i = 0; i < g_results.size(); ++i)
+    {
+        const BenchmarkResult& result = g_results[i];
+        stream << "    { \"name\": \"" << result.name << '\"';
+        if (result.debugLayer >= 0)
+            stream << ", \"debugLayer\": " << (result.debugLayer != 0 ? "true" : "false");
+        if (result.debugLayer == 1)
+            stream << ", \"validationSampling\": " << result.sampling;
+        stream << ", \"unit\": \"" << result.unit << "\", \"value\": " << result.value << " }";
+        stream << (i + 1 < g_results.size() ? ",\n" : "\n");
+    }
+
+    stream << "  ]\n";
+    stream << "}\n";
+}
+
+static void ParseArguments(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)
+            g_config.iterations = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "-s" && i + 1 < argc)
+            g_config.samplingInterval = static_cast<std::uint32_t>(std::max(0, std::atoi(argv[++i])));
+        else if (arg == "-b" && i + 1 < argc)
+            g_config.overheadBudget = std::max(0.0, std::atof(argv[++i]));
+        else if (arg == "-o" && i + 1 < argc)
+            g_config.outputFile = argv[++i];
+        else
+            g_config.moduleName = arg;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    bool withinBudget = true;
+
+    try
+    {
+        ParseArguments(argc, argv);
+
+        // Open output file before running the benchmarks, so an invalid path is reported right away
+        std::ofstream file;
+        if (!g_config.outputFile.empty())
+        {
+            file.open(g_config.outputFile);
+            if (!file.good())
+                throw std::runtime_error("failed to open output file: " + g_config.outputFile);
+        }
+
+        for (bool debugLayer : { false, true })
+        {
+            RenderSystemBenchmark benchmark{ debugLayer };
+            benchmark.Run();
+        }
+
+        // Run debug layer benchmarks again with validation sampling
+        if (g_config.samplingInterval > 1)
+        {
+            RenderSystemBenchmark benchmark{ true, g_config.samplingInterval };
+            benchmark.Run();
+        }
+
+        withinBudget = CheckDebugLayerOverhead();
+
+        RunConvertImageBuffer();
+        RunParse();
+
+        if (g_config.outputFile.empty())
+            WriteResultsJSON(std::cout);
+        else
+        {
+            WriteResultsJSON(file);
+
+            file.close();
+            if (file.fail())
+                throw std::runtime_error("failed to write output file: " + g_config.outputFile);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return (withinBudget ? 0 : 2);
+}
+
@@ -108,6 +108,31 @@ void Test_Resize()
     SaveImagePNG(img1, "Output/img1-resize-smaller.png");
 }
 
+void Test_Resample()
+{
+    const LLGL::Image img1 = LoadImage("Media/Textures/Grid10x10.png", LLGL::ImageFormat::RGBA);
+
+    const LLGL::ResampleFilter filters[] =
+    {
+        LLGL::ResampleFilter::Box,
+        LLGL::ResampleFilter::Bilinear,
+        LLGL::ResampleFilter::Bicubic,
+        LLGL::ResampleFilter::Lanczos3,
+    };
+    const char* filterNames[] = { "box", "bilinear", "bicubic", "lanczos3" };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        LLGL::Image imgSmaller = img1;
+        imgSmaller.Resample(LLGL::Extent3D{ 100, 100, 1 }, filters[i], true, LLGL_MAX_THREAD_COUNT);
+        SaveImagePNG(imgSmaller, std::string("Output/img1-resample-smaller-") + filterNames[i] + ".png");
+
+        LLGL::Image imgLarger = img1;
+        imgLarger.Resample(LLGL::Extent3D{ 1000, 700, 1 }, filters[i], true, LLGL_MAX_THREAD_COUNT);
+        SaveImagePNG(imgLarger, std::string("Output/img1-resample-larger-") + filterNames[i] + ".png");
+    }
+}
+
 int main(int argc, char* argv[])
 {
     try
@@ -115,6 +140,7 @@ int main(int argc, char* argv[])
         Test_PixelOperations();
         Test_Blit();
         Test_Resize();
+        Test_Resample();
     }
     catch (const std::exception& e)
     {
@@ -311,6 +311,8 @@ unsigned TestbedContext::RunAllTests()
 
     // Run all command buffer tests
     RUN_TEST( CommandBufferSubmit         );
+    RUN_TEST( CommandQueueDedicated       );
+    RUN_TEST( FenceValues                 );
 
     // Run all resource tests
     RUN_TEST( BufferWriteAndRead          );
@@ -320,14 +322,19 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( BufferCopy                  );
     RUN_TEST( TextureTypes                );
     RUN_TEST( TextureWriteAndRead         );
+    RUN_TEST( TextureReadAsync            );
     RUN_TEST( TextureCopy                 );
     RUN_TEST( TextureToBufferCopy         );
     RUN_TEST( BufferToTextureCopy         );
     RUN_TEST( RenderTargetNoAttachments   );
     RUN_TEST( RenderTarget1Attachment     );
     RUN_TEST( RenderTargetNAttachments    );
+    RUN_TEST( FrameGraph                  );
+    RUN_TEST( TextureStreaming            );
+    RUN_TEST( ResourceLoading             );
     RUN_TEST( MipMaps                     );
     RUN_TEST( PipelineCaching             );
+    RUN_TEST( PipelineDeferredStatus      );
 
     // Run all rendering tests
     RUN_TEST( DepthBuffer                 );
@@ -337,11 +344,14 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( DualSourceBlending          );
     RUN_TEST( CommandBufferMultiThreading );
     RUN_TEST( CommandBufferSecondary      );
+    RUN_TEST( ParallelRenderPass          );
     RUN_TEST( TriangleStripCutOff         );
     RUN_TEST( TextureViews                );
     RUN_TEST( Uniforms                    );
     RUN_TEST( ShadowMapping               );
     RUN_TEST( ViewportAndScissor          );
+    RUN_TEST( DrawIndirectCount           );
+    RUN_TEST( IndirectDrawCuller          );
 
     #undef RUN_TEST
 
@@ -383,6 +393,8 @@ unsigned TestbedContext::RunRendererIndependentTests(int argc, char* argv[])
     RUN_TEST( ContainerUTF8String );
     RUN_TEST( ParseUtil );
     RUN_TEST( ImageConversions );
+    RUN_TEST( ImageCompressionBC1 );
+    RUN_TEST( ImageCompressionBC7 );
 
     #undef RUN_TEST
 
@@ -1452,6 +1464,11 @@ static ColorRGBub GetHeatMapColor(int diff, int scale = 1)
 }
 
 TestbedContext::DiffResult TestbedContext::DiffImages(const std::string& name, int threshold, unsigned tolerance, int scale)
+{
+    return DiffImagesWithReference(name, name, threshold, tolerance, scale);
+}
+
+TestbedContext::DiffResult TestbedContext::DiffImagesWithReference(const std::string& name, const std::string& refName, int threshold, unsigned tolerance, int scale)
 {
     // Load input images and validate they have the same dimensions
     std::vector<ColorRGBub> pixelsA, pixelsB;
@@ -1462,7 +1479,7 @@ TestbedContext::DiffResult TestbedContext::DiffImages(const std::string& name, i
     const std::string refPath       = "Reference/";
     const std::string diffPath      = opt.outputDir + moduleName + "/";
 
-    if (!LoadImage(pixelsA, extentA, refPath + name + ".Ref.png", opt.verbose))
+    if (!LoadImage(pixelsA, extentA, refPath + refName + ".Ref.png", opt.verbose))
         return DiffErrorLoadRefFailed;
     if (!LoadImage(pixelsB, extentB, resultPath + name + ".Result.png", opt.verbose))
         return DiffErrorLoadResultFailed;
@@ -326,6 +326,9 @@ class TestbedContext
         // Creates a heat-map image from the two input filenames and returns the highest difference pixel value. A negative value indicates an error.
         DiffResult DiffImages(const std::string& name, int threshold = 1, unsigned tolerance = 0, int scale = 1);
 
+        // Same as DiffImages() but compares the result image against the reference image of another name, e.g. for tests that render the same scene.
+        DiffResult DiffImagesWithReference(const std::string& name, const std::string& refName, int threshold = 1, unsigned tolerance = 0, int scale = 1);
+
         void RecordTestResult(TestResult result, const char* name);
 
     private:
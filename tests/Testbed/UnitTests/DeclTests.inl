@@ -23,6 +23,8 @@ DECL_RITEST( ContainerSmallVector );
 DECL_RITEST( ContainerUTF8String );
 DECL_RITEST( ParseUtil );
 DECL_RITEST( ImageConversions );
+DECL_RITEST( ImageCompressionBC1 );
+DECL_RITEST( ImageCompressionBC7 );
 
 #undef DECL_RITEST
 
@@ -41,7 +43,10 @@ DECL_RITEST( ImageConversions );
 // Command buffer tests
 DECL_TEST( CommandBufferSubmit );
 DECL_TEST( CommandBufferSecondary );
+DECL_TEST( ParallelRenderPass );
 DECL_TEST( CommandBufferMultiThreading );
+DECL_TEST( CommandQueueDedicated );
+DECL_TEST( FenceValues );
 
 // Resource tests
 DECL_TEST( BufferWriteAndRead );
@@ -53,12 +58,17 @@ DECL_TEST( BufferToTextureCopy );
 DECL_TEST( TextureCopy );
 DECL_TEST( TextureToBufferCopy );
 DECL_TEST( TextureWriteAndRead );
+DECL_TEST( TextureReadAsync );
 DECL_TEST( TextureTypes );
 DECL_TEST( RenderTargetNoAttachments );
 DECL_TEST( RenderTarget1Attachment );
 DECL_TEST( RenderTargetNAttachments );
+DECL_TEST( FrameGraph );
+DECL_TEST( TextureStreaming );
+DECL_TEST( ResourceLoading );
 DECL_TEST( MipMaps );
 DECL_TEST( PipelineCaching );
+DECL_TEST( PipelineDeferredStatus );
 
 // Rendering tests
 DECL_TEST( DepthBuffer );
@@ -71,6 +81,8 @@ DECL_TEST( TextureViews );
 DECL_TEST( Uniforms );
 DECL_TEST( ShadowMapping );
 DECL_TEST( ViewportAndScissor );
+DECL_TEST( DrawIndirectCount );
+DECL_TEST( IndirectDrawCuller );
 
 #undef DECL_TEST
 
@@ -0,0 +1,130 @@
+/*
+ * TestCommandQueueDedicated.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/TypeNames.h>
+
+
+/*
+Writes a buffer on each dedicated compute and transfer command queue and synchronizes it with the graphics command queue via a fence.
+The dedicated queue is fed from a worker thread while the main thread keeps submitting to the graphics queue,
+so the shared submission timeline of the debug layer is accessed concurrently.
+*/
+DEF_TEST( CommandQueueDedicated )
+{
+    constexpr std::uint32_t numSubmissions = 64;
+
+    const CommandQueueType queueTypes[] = { CommandQueueType::Compute, CommandQueueType::Transfer };
+
+    bool anyDedicatedQueue = false;
+
+    for (CommandQueueType queueType : queueTypes)
+    {
+        CommandQueue* dedicatedQueue = renderer->GetDedicatedCommandQueue(queueType);
+        if (dedicatedQueue == nullptr)
+            continue;
+
+        anyDedicatedQueue = true;
+
+        if (dedicatedQueue->GetType() != queueType)
+        {
+            Log::Errorf("Mismatch between type of dedicated command queue (%s) and requested type (%s)\n", ToString(dedicatedQueue->GetType()), ToString(queueType));
+            return TestResult::FailedMismatch;
+        }
+
+        // Create buffer that is written on the dedicated queue and another one that is written on the graphics queue at the same time
+        const std::uint32_t initialData[4] = {};
+
+        BufferDescriptor bufDesc;
+        {
+            bufDesc.size        = sizeof(initialData);
+            bufDesc.bindFlags   = BindFlags::CopyDst;
+        }
+        CREATE_BUFFER(dedicatedBuf, bufDesc, "dedicatedBuf{size=16}", initialData);
+        CREATE_BUFFER(graphicsBuf, bufDesc, "graphicsBuf{size=16}", initialData);
+
+        // Record command buffer for the dedicated queue once and submit it multiple times
+        const std::uint32_t expectedData[4] = { 0x12345678, 0xABCDEF01, 0xABCDEF01, 0xABCDEF01 };
+
+        CommandBufferDescriptor cmdBufferDesc;
+        {
+            cmdBufferDesc.debugName = (queueType == CommandQueueType::Compute ? "ComputeCmdBuffer" : "TransferCmdBuffer");
+            cmdBufferDesc.flags     = CommandBufferFlags::MultiSubmit;
+            cmdBufferDesc.queueType = queueType;
+        }
+        CommandBuffer* dedicatedCmdBuffer = renderer->CreateCommandBuffer(cmdBufferDesc);
+
+        dedicatedCmdBuffer->Begin();
+        {
+            dedicatedCmdBuffer->FillBuffer(*dedicatedBuf, 0, expectedData[1], sizeof(expectedData));
+            dedicatedCmdBuffer->UpdateBuffer(*dedicatedBuf, 0, &expectedData[0], sizeof(std::uint32_t));
+        }
+        dedicatedCmdBuffer->End();
+
+        // Submit to dedicated queue on a worker thread and to the graphics queue on the main thread
+        std::thread worker
+        {
+            [dedicatedQueue, dedicatedCmdBuffer]()
+            {
+                for_range(i, numSubmissions)
+                    dedicatedQueue->Submit(*dedicatedCmdBuffer);
+            }
+        };
+
+        for_range(i, numSubmissions)
+        {
+            cmdBuffer->Begin();
+            {
+                cmdBuffer->FillBuffer(*graphicsBuf, 0, i, sizeof(initialData));
+            }
+            cmdBuffer->End();
+        }
+
+        worker.join();
+
+        // Let the graphics queue wait for the dedicated queue, so waiting for the graphics queue also synchronizes the dedicated queue
+        Fence* fence = renderer->CreateFence();
+        dedicatedQueue->Submit(*fence);
+        cmdQueue->SubmitWait(*fence);
+        cmdQueue->WaitIdle();
+
+        std::uint32_t dedicatedData[4] = {};
+        renderer->ReadBuffer(*dedicatedBuf, 0, dedicatedData, sizeof(dedicatedData));
+
+        std::uint32_t graphicsData[4] = {};
+        renderer->ReadBuffer(*graphicsBuf, 0, graphicsData, sizeof(graphicsData));
+
+        renderer->Release(*fence);
+        renderer->Release(*dedicatedCmdBuffer);
+        renderer->Release(*dedicatedBuf);
+        renderer->Release(*graphicsBuf);
+
+        if (::memcmp(dedicatedData, expectedData, sizeof(expectedData)) != 0)
+        {
+            Log::Errorf(
+                "Mismatch between data of buffer written on %s queue [0x%08X, 0x%08X, 0x%08X, 0x%08X] and expected data [0x%08X, 0x%08X, 0x%08X, 0x%08X]\n",
+                ToString(queueType),
+                dedicatedData[0], dedicatedData[1], dedicatedData[2], dedicatedData[3],
+                expectedData[0], expectedData[1], expectedData[2], expectedData[3]
+            );
+            return TestResult::FailedMismatch;
+        }
+
+        const std::uint32_t lastFillValue = numSubmissions - 1;
+        if (graphicsData[0] != lastFillValue || graphicsData[3] != lastFillValue)
+        {
+            Log::Errorf(
+                "Mismatch between data of buffer written on graphics queue [0x%08X, ..., 0x%08X] and last fill value 0x%08X\n",
+                graphicsData[0], graphicsData[3], lastFillValue
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    return (anyDedicatedQueue ? TestResult::Passed : TestResult::Skipped);
+}
+
@@ -0,0 +1,179 @@
+/*
+ * TestDrawIndirectCount.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/IndirectArguments.h>
+#include <cstddef>
+#include <Gauss/Translate.h>
+
+
+/*
+Records DrawIndirectCount and DrawIndexedIndirectCount once and submits the same command buffer with different values in the count buffer.
+The count buffer is written after the command buffer has been recorded, so backends must read it when the command is executed, not when it is encoded.
+The framebuffer is only compared for backends that rasterize, i.e. all except the Null backend.
+*/
+DEF_TEST( DrawIndirectCount )
+{
+    if (!caps.features.hasIndirectDrawCount)
+        return TestResult::Skipped;
+
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    // Create argument buffer with one indexed and one non-indexed draw command
+    struct IndirectArgs
+    {
+        DrawIndexedIndirectArguments    indexedArgs;
+        DrawIndirectArguments           args;
+    }
+    indirectArgs;
+    {
+        indirectArgs.indexedArgs.numIndices     = mesh.numIndices;
+        indirectArgs.indexedArgs.numInstances   = 1;
+        indirectArgs.indexedArgs.firstIndex     = 0;
+        indirectArgs.indexedArgs.vertexOffset   = 0;
+        indirectArgs.indexedArgs.firstInstance  = 0;
+        indirectArgs.args.numVertices           = 0;
+        indirectArgs.args.numInstances          = 1;
+        indirectArgs.args.firstVertex           = 0;
+        indirectArgs.args.firstInstance         = 0;
+    }
+
+    BufferDescriptor argsBufDesc;
+    {
+        argsBufDesc.size        = sizeof(indirectArgs);
+        argsBufDesc.bindFlags   = BindFlags::IndirectBuffer;
+    }
+    CREATE_BUFFER(argsBuf, argsBufDesc, "argsBuf{size=36}", &indirectArgs);
+
+    // Create count buffer that is initialized with zero and written again after the command buffer has been recorded
+    const std::uint32_t initialCount = 0;
+
+    BufferDescriptor countBufDesc;
+    {
+        countBufDesc.size       = sizeof(std::uint32_t);
+        countBufDesc.bindFlags  = BindFlags::IndirectBuffer | BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(countBuf, countBufDesc, "countBuf{size=4}", &initialCount);
+
+    // Create graphics PSO
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.depth.testEnabled   = true;
+        psoDesc.depth.writeEnabled  = true;
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    if (const Report* report = pso->GetReport())
+    {
+        if (report->HasErrors())
+        {
+            Log::Errorf("PSO creation failed:\n%s", report->GetText());
+            return TestResult::FailedErrors;
+        }
+    }
+
+    // Update scene constants with a white cube in front of the camera
+    sceneConstants = SceneConstants{};
+
+    Gs::Matrix4f vMatrix;
+    vMatrix.LoadIdentity();
+    Gs::Translate(vMatrix, Gs::Vector3f{ 0, 0, -3 });
+    vMatrix.MakeInverse();
+
+    sceneConstants.vpMatrix = projection * vMatrix;
+    sceneConstants.wMatrix.LoadIdentity();
+    Gs::Translate(sceneConstants.wMatrix, Gs::Vector3f{ 0, 0, 2 });
+
+    // Record deferred command buffer once
+    Texture* readbackTex = nullptr;
+
+    CommandBuffer* deferredCmdBuffer = renderer->CreateCommandBuffer();
+
+    deferredCmdBuffer->Begin();
+    {
+        deferredCmdBuffer->UpdateBuffer(*sceneCbuffer, 0, &sceneConstants, sizeof(sceneConstants));
+        deferredCmdBuffer->BeginRenderPass(*swapChain);
+        {
+            deferredCmdBuffer->Clear(ClearFlags::ColorDepth);
+            deferredCmdBuffer->SetViewport(opt.resolution);
+            deferredCmdBuffer->SetPipelineState(*pso);
+            deferredCmdBuffer->SetResource(0, *sceneCbuffer);
+            deferredCmdBuffer->SetVertexBuffer(*meshBuffer);
+            deferredCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+            deferredCmdBuffer->DrawIndexedIndirectCount(*argsBuf, offsetof(IndirectArgs, indexedArgs), *countBuf, 0, 1, sizeof(IndirectArgs));
+            deferredCmdBuffer->DrawIndirectCount(*argsBuf, offsetof(IndirectArgs, args), *countBuf, 0, 1, sizeof(IndirectArgs));
+            readbackTex = CaptureFramebuffer(*deferredCmdBuffer, swapChain->GetColorFormat(), opt.resolution);
+        }
+        deferredCmdBuffer->EndRenderPass();
+    }
+    deferredCmdBuffer->End();
+
+    // Submits the recorded command buffer with the specified draw count and returns the color at the center of the framebuffer
+    auto SubmitWithCount = [&](std::uint32_t count, std::uint8_t (&outColor)[4]) -> void
+    {
+        renderer->WriteBuffer(*countBuf, 0, &count, sizeof(count));
+
+        cmdQueue->Submit(*deferredCmdBuffer);
+        cmdQueue->WaitIdle();
+
+        const TextureRegion centerRegion{ Offset3D{ static_cast<std::int32_t>(opt.resolution.width/2), static_cast<std::int32_t>(opt.resolution.height/2), 0 }, Extent3D{ 1, 1, 1 } };
+        renderer->ReadTexture(*readbackTex, centerRegion, MutableImageView{ ImageFormat::RGBA, DataType::UInt8, outColor, sizeof(outColor) });
+    };
+
+    std::uint8_t colorWithoutDraw[4] = {};
+    std::uint8_t colorWithDraw[4] = {};
+
+    SubmitWithCount(0, colorWithoutDraw);
+    SubmitWithCount(1, colorWithDraw);
+
+    // Evaluate framebuffer colors; The Null backend does not rasterize anything
+    TestResult result = TestResult::Passed;
+
+    if (renderer->GetRendererID() != RendererID::Null)
+    {
+        auto IsBlack = [](const std::uint8_t (&color)[4]) -> bool
+        {
+            return (color[0] == 0 && color[1] == 0 && color[2] == 0);
+        };
+
+        if (!IsBlack(colorWithoutDraw))
+        {
+            Log::Errorf(
+                "Mismatch between framebuffer color (%u, %u, %u) and clear color (0, 0, 0) for draw count 0\n",
+                colorWithoutDraw[0], colorWithoutDraw[1], colorWithoutDraw[2]
+            );
+            result = TestResult::FailedMismatch;
+        }
+
+        if (IsBlack(colorWithDraw))
+        {
+            Log::Errorf("Mismatch between framebuffer color (0, 0, 0) and cube color for draw count 1; count buffer was not read at execution time\n");
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Release resources
+    renderer->Release(*readbackTex);
+    renderer->Release(*deferredCmdBuffer);
+    renderer->Release(*pso);
+    renderer->Release(*countBuf);
+    renderer->Release(*argsBuf);
+
+    return result;
+}
+
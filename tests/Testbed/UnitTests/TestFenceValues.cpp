@@ -0,0 +1,101 @@
+/*
+ * TestFenceValues.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Signals a fence with increasing values via SubmitSignal and waits for them via WaitFenceValue and WaitFenceValues:
+waiting for a signaled value, for a value that has already been reached, and for a future value that is signaled by another thread.
+*/
+DEF_TEST( FenceValues )
+{
+    // Create buffer that is written before the fence is signaled
+    const std::uint32_t initialData[4] = {};
+
+    BufferDescriptor bufDesc;
+    {
+        bufDesc.size        = sizeof(initialData);
+        bufDesc.bindFlags   = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(buf, bufDesc, "buf{size=16}", initialData);
+
+    CommandBuffer* deferredCmdBuffer = renderer->CreateCommandBuffer();
+
+    const std::uint32_t fillValue = 0xFE7CE001;
+
+    deferredCmdBuffer->Begin();
+    {
+        deferredCmdBuffer->FillBuffer(*buf, 0, fillValue, sizeof(initialData));
+    }
+    deferredCmdBuffer->End();
+
+    Fence* fence = renderer->CreateFence();
+
+    TestResult result = TestResult::Passed;
+
+    auto ExpectWaitResult = [&result](bool actual, bool expected, const char* description) -> void
+    {
+        if (actual != expected)
+        {
+            Log::Errorf("Mismatch between result of %s (%s) and expected result (%s)\n", description, (actual ? "true" : "false"), (expected ? "true" : "false"));
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    // Signal value 1 after the command buffer and wait for it
+    cmdQueue->Submit(*deferredCmdBuffer);
+    cmdQueue->SubmitSignal(*fence, 1);
+
+    ExpectWaitResult(cmdQueue->WaitFenceValue(*fence, 1, ~0ull), true, "waiting for signaled fence value 1");
+
+    std::uint32_t bufData[4] = {};
+    renderer->ReadBuffer(*buf, 0, bufData, sizeof(bufData));
+
+    if (bufData[0] != fillValue || bufData[3] != fillValue)
+    {
+        Log::Errorf(
+            "Mismatch between buffer data [0x%08X, ..., 0x%08X] and fill value 0x%08X after waiting for fence value\n",
+            bufData[0], bufData[3], fillValue
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Values that have already been reached must not block
+    cmdQueue->SubmitSignal(*fence, 2);
+
+    ExpectWaitResult(cmdQueue->WaitFenceValue(*fence, 2, ~0ull), true, "waiting for signaled fence value 2");
+    ExpectWaitResult(cmdQueue->WaitFenceValue(*fence, 1, 0), true, "polling already reached fence value 1");
+
+    Fence* fences[] = { fence, fence };
+    const std::uint64_t values[] = { 1, 2 };
+    ExpectWaitResult(cmdQueue->WaitFenceValues(2, fences, values, 0), true, "polling already reached fence values 1 and 2");
+
+    // Future values must time out until they are signaled
+    ExpectWaitResult(cmdQueue->WaitFenceValue(*fence, 3, 0), false, "polling future fence value 3");
+
+    std::thread signalThread
+    {
+        [this, fence]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            cmdQueue->SubmitSignal(*fence, 3);
+        }
+    };
+
+    ExpectWaitResult(cmdQueue->WaitFenceValue(*fence, 3, ~0ull), true, "waiting for future fence value 3 signaled by another thread");
+
+    signalThread.join();
+
+    // Release resources
+    renderer->Release(*fence);
+    renderer->Release(*deferredCmdBuffer);
+    renderer->Release(*buf);
+
+    return result;
+}
+
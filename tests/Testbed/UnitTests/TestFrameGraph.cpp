@@ -0,0 +1,128 @@
+/*
+ * TestFrameGraph.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/FrameGraph.h>
+#include <vector>
+
+
+DEF_TEST( FrameGraph )
+{
+    // Create output texture the frame graph renders into
+    TextureDescriptor colorDesc;
+    {
+        colorDesc.type      = TextureType::Texture2D;
+        colorDesc.bindFlags = BindFlags::ColorAttachment | BindFlags::Sampled;
+        colorDesc.format    = Format::RGBA8UNorm;
+        colorDesc.extent    = Extent3D{ 128, 128, 1 };
+        colorDesc.mipLevels = 1;
+    }
+    CREATE_TEXTURE(output, colorDesc, "output{rgba8,128x128}", nullptr);
+
+    TextureDescriptor depthDesc;
+    {
+        depthDesc.type      = TextureType::Texture2D;
+        depthDesc.bindFlags = BindFlags::DepthStencilAttachment;
+        depthDesc.format    = Format::D32Float;
+        depthDesc.extent    = Extent3D{ 128, 128, 1 };
+        depthDesc.mipLevels = 1;
+    }
+
+    FrameGraph frameGraph{ *renderer };
+
+    std::vector<FrameGraphPass> executedPasses;
+    FrameGraphPass              numPasses       = 0;
+
+    auto AddRecordedPass = [&frameGraph, &executedPasses, &numPasses](const char* name) -> FrameGraphPass
+    {
+        const FrameGraphPass pass = numPasses++;
+        return frameGraph.AddPass(
+            name,
+            [&executedPasses, pass](CommandBuffer& /*commandBuffer*/, const FrameGraph& /*frameGraph*/)
+            {
+                executedPasses.push_back(pass);
+            }
+        );
+    };
+
+    // Declare frame: "debug" pass output is never consumed, "albedo" and "blur" have non-overlapping lifetimes
+    const FrameGraphResource albedo      = frameGraph.CreateTexture("albedo", colorDesc);
+    const FrameGraphResource depth       = frameGraph.CreateTexture("depth", depthDesc);
+    const FrameGraphResource lighting    = frameGraph.CreateTexture("lighting", colorDesc);
+    const FrameGraphResource debug       = frameGraph.CreateTexture("debug", colorDesc);
+    const FrameGraphResource blur        = frameGraph.CreateTexture("blur", colorDesc);
+    const FrameGraphResource finalOutput = frameGraph.ImportTexture("output", *output);
+
+    const FrameGraphPass gbufferPass = AddRecordedPass("gbuffer");
+    frameGraph.AddWrite(gbufferPass, albedo);
+    frameGraph.AddWrite(gbufferPass, depth, FrameGraphAccess::DepthStencilAttachment);
+
+    const FrameGraphPass lightingPass = AddRecordedPass("lighting");
+    frameGraph.AddRead(lightingPass, albedo);
+    frameGraph.AddRead(lightingPass, depth);
+    frameGraph.AddWrite(lightingPass, lighting);
+
+    const FrameGraphPass debugPass = AddRecordedPass("debug");
+    frameGraph.AddRead(debugPass, lighting);
+    frameGraph.AddWrite(debugPass, debug);
+
+    const FrameGraphPass blurPass = AddRecordedPass("blur");
+    frameGraph.AddRead(blurPass, lighting);
+    frameGraph.AddWrite(blurPass, blur);
+
+    const FrameGraphPass finalPass = AddRecordedPass("final");
+    frameGraph.AddRead(finalPass, blur);
+    frameGraph.AddWrite(finalPass, finalOutput);
+
+    if (!frameGraph.Compile())
+    {
+        const Report* report = frameGraph.GetReport();
+        Log::Errorf("Failed to compile frame graph:\n%s", (report != nullptr ? report->GetText() : ""));
+        return TestResult::FailedErrors;
+    }
+
+    // Execute frame graph and validate order of executed passes
+    cmdBuffer->Begin();
+    {
+        frameGraph.Execute(*cmdBuffer);
+    }
+    cmdBuffer->End();
+
+    const std::vector<FrameGraphPass> expectedPasses = { gbufferPass, lightingPass, blurPass, finalPass };
+    if (executedPasses != expectedPasses || !frameGraph.IsPassCulled(debugPass))
+    {
+        Log::Errorf("Mismatch between executed frame graph passes (%u) and expected passes (%u)\n",
+            static_cast<unsigned>(executedPasses.size()), static_cast<unsigned>(expectedPasses.size()));
+        return TestResult::FailedMismatch;
+    }
+
+    // Validate transient textures were aliased: "albedo" and "blur" share the same texture, "lighting" overlaps with both
+    if (frameGraph.GetTexture(albedo) != frameGraph.GetTexture(blur) ||
+        frameGraph.GetTexture(albedo) == frameGraph.GetTexture(lighting))
+    {
+        Log::Errorf("Mismatch between aliased frame graph textures\n");
+        return TestResult::FailedMismatch;
+    }
+
+    const FrameGraphStatistics stats = frameGraph.GetStatistics();
+    const std::uint64_t colorSize = 128u * 128u * 4u;
+    const std::uint64_t depthSize = 128u * 128u * 4u;
+
+    if (stats.numTransientTextures != 4 ||
+        stats.numPhysicalTextures  != 3 ||
+        stats.transientMemory      != colorSize * 3 + depthSize ||
+        stats.physicalMemory       != colorSize * 2 + depthSize)
+    {
+        Log::Errorf(
+            "Mismatch between frame graph statistics (transient = %u, physical = %u, memory = %" PRIu64 " -> %" PRIu64 ") and expected values\n",
+            stats.numTransientTextures, stats.numPhysicalTextures, stats.transientMemory, stats.physicalMemory
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    return TestResult::Passed;
+}
@@ -0,0 +1,312 @@
+/*
+ * TestImageCompression.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <cmath>
+
+
+/*
+Compresses a synthetic RGBA8 image into BC1 with each compression quality, decompresses it again with DecompressImageBufferToRGBA8UNorm,
+and compares the color channels against the original image. The decompressor only evaluates the 4-color mode with reduced endpoint precision,
+so the error bounds account for both the BC1 quantization and the decompressor's own loss of precision.
+*/
+DEF_RITEST( ImageCompressionBC1 )
+{
+    constexpr std::uint32_t width       = 64;
+    constexpr std::uint32_t height      = 32;
+    constexpr int           maxError    = 32;
+    constexpr double        maxRMSE     = 10.0;
+
+    // Generate opaque image with smooth gradients in the left half and solid 8x8 tiles in the right half
+    std::vector<std::uint8_t> srcImage(width * height * 4);
+
+    for_range(y, height)
+    {
+        for_range(x, width)
+        {
+            std::uint8_t* texel = &srcImage[(y * width + x) * 4];
+            if (x < width/2)
+            {
+                texel[0] = static_cast<std::uint8_t>(x * 8);
+                texel[1] = static_cast<std::uint8_t>(y * 8);
+                texel[2] = static_cast<std::uint8_t>((x + y) * 4);
+            }
+            else
+            {
+                const std::uint32_t tile = (y / 8) * (width / 8) + (x / 8);
+                texel[0] = static_cast<std::uint8_t>(tile * 37);
+                texel[1] = static_cast<std::uint8_t>(tile * 91);
+                texel[2] = static_cast<std::uint8_t>(tile * 53);
+            }
+            texel[3] = 0xFF;
+        }
+    }
+
+    const ImageView srcImageView{ ImageFormat::RGBA, DataType::UInt8, srcImage.data(), srcImage.size() };
+    const Extent2D  extent{ width, height };
+
+    auto TestRoundTrip = [&](CompressionQuality quality, const char* qualityName, unsigned threadCount) -> TestResult
+    {
+        // Compress image and validate block count
+        DynamicByteArray compressedData = CompressImageBuffer(srcImageView, extent, ImageFormat::BC1, quality, threadCount);
+
+        const std::size_t expectedSize = (width / 4) * (height / 4) * 8;
+        if (compressedData.size() != expectedSize)
+        {
+            Log::Errorf(
+                "Mismatch between BC1 compressed image size (%u bytes) and expected size (%u bytes) for quality %s\n",
+                static_cast<unsigned>(compressedData.size()), static_cast<unsigned>(expectedSize), qualityName
+            );
+            return TestResult::FailedMismatch;
+        }
+
+        // Decompress image again
+        const ImageView compressedImageView{ ImageFormat::BC1, DataType::UInt8, compressedData.get(), compressedData.size() };
+        DynamicByteArray dstImage = DecompressImageBufferToRGBA8UNorm(compressedImageView, extent, threadCount);
+
+        if (dstImage.size() != srcImage.size())
+        {
+            Log::Errorf("Failed to decompress BC1 image for quality %s\n", qualityName);
+            return TestResult::FailedErrors;
+        }
+
+        // Compare color channels against original image; Alpha is ignored since the image is opaque
+        const std::uint8_t* dstTexels = reinterpret_cast<const std::uint8_t*>(dstImage.get());
+
+        double squaredErrorSum = 0.0;
+
+        for_range(i, width * height)
+        {
+            for_range(c, 3)
+            {
+                const int srcValue  = static_cast<int>(srcImage[i * 4 + c]);
+                const int dstValue  = static_cast<int>(dstTexels[i * 4 + c]);
+                const int error     = std::abs(srcValue - dstValue);
+                if (error > maxError)
+                {
+                    Log::Errorf(
+                        "Mismatch between BC1 round-trip texel [%u,%u] channel %u (%d) and original value (%d) for quality %s; error exceeds %d\n",
+                        static_cast<unsigned>(i % width), static_cast<unsigned>(i / width), static_cast<unsigned>(c), dstValue, srcValue, qualityName, maxError
+                    );
+                    return TestResult::FailedMismatch;
+                }
+                squaredErrorSum += static_cast<double>(error * error);
+            }
+        }
+
+        const double rmse = std::sqrt(squaredErrorSum / static_cast<double>(width * height * 3));
+        if (rmse > maxRMSE)
+        {
+            Log::Errorf("Mismatch between BC1 round-trip RMSE (%.2f) and expected bound (%.2f) for quality %s\n", rmse, maxRMSE, qualityName);
+            return TestResult::FailedMismatch;
+        }
+
+        if (opt.verbose)
+        {
+            const std::string threadCountStr = (threadCount == LLGL_MAX_THREAD_COUNT ? std::string("Max") : std::to_string(threadCount));
+            Log::Printf("BC1 round-trip RMSE for quality %s (threads: %s): %.2f\n", qualityName, threadCountStr.c_str(), rmse);
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_ROUND_TRIP(QUALITY)                                                                        \
+        {                                                                                                   \
+            TestResult result = TestRoundTrip(CompressionQuality::QUALITY, #QUALITY, 0);                    \
+            if (result == TestResult::Passed)                                                               \
+                result = TestRoundTrip(CompressionQuality::QUALITY, #QUALITY, LLGL_MAX_THREAD_COUNT);       \
+            if (result != TestResult::Passed)                                                               \
+                return result;                                                                              \
+        }
+
+    TEST_ROUND_TRIP(Fast);
+    TEST_ROUND_TRIP(Default);
+    TEST_ROUND_TRIP(High);
+
+    #undef TEST_ROUND_TRIP
+
+    return TestResult::Passed;
+}
+
+// Decodes a BC7 block in mode 6 into 16 RGBA8 texels. Returns false if the block is encoded in any other mode.
+static bool DecodeBC7Mode6Block(const std::uint8_t* block, std::uint8_t (&texels)[16][4])
+{
+    static const int weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    std::uint32_t bitOffset = 0;
+
+    auto ReadBits = [block, &bitOffset](std::uint32_t numBits) -> int
+    {
+        int value = 0;
+        for_range(i, numBits)
+        {
+            const std::uint32_t pos = bitOffset + i;
+            value |= ((block[pos / 8] >> (pos % 8)) & 1) << i;
+        }
+        bitOffset += numBits;
+        return value;
+    };
+
+    if (ReadBits(7) != (1 << 6))
+        return false;
+
+    int endpoints[2][4];
+    for_range(c, 4)
+    {
+        endpoints[0][c] = ReadBits(7);
+        endpoints[1][c] = ReadBits(7);
+    }
+
+    const int pBit0 = ReadBits(1);
+    const int pBit1 = ReadBits(1);
+
+    for_range(i, 16)
+    {
+        const int weight = weights[ReadBits(i == 0 ? 3 : 4)];
+        for_range(c, 4)
+        {
+            const int value0 = (endpoints[0][c] << 1) | pBit0;
+            const int value1 = (endpoints[1][c] << 1) | pBit1;
+            texels[i][c] = static_cast<std::uint8_t>((value0 * (64 - weight) + value1 * weight + 32) >> 6);
+        }
+    }
+
+    return true;
+}
+
+/*
+Compresses a synthetic RGBA8 image into BC7 with each compression quality and decodes it again with a local mode 6 decoder,
+since DecompressImageBufferToRGBA8UNorm only supports BC1. All four channels are compared against the original image.
+*/
+DEF_RITEST( ImageCompressionBC7 )
+{
+    constexpr std::uint32_t width       = 64;
+    constexpr std::uint32_t height      = 32;
+    constexpr int           maxError    = 24;
+    constexpr double        maxRMSE     = 6.0;
+
+    // Generate image with smooth gradients in the left half and solid 8x8 tiles in the right half; alpha varies in both halves
+    std::vector<std::uint8_t> srcImage(width * height * 4);
+
+    for_range(y, height)
+    {
+        for_range(x, width)
+        {
+            std::uint8_t* texel = &srcImage[(y * width + x) * 4];
+            if (x < width/2)
+            {
+                texel[0] = static_cast<std::uint8_t>(x * 8);
+                texel[1] = static_cast<std::uint8_t>(y * 8);
+                texel[2] = static_cast<std::uint8_t>((x + y) * 4);
+                texel[3] = static_cast<std::uint8_t>(255 - y * 6);
+            }
+            else
+            {
+                const std::uint32_t tile = (y / 8) * (width / 8) + (x / 8);
+                texel[0] = static_cast<std::uint8_t>(tile * 37);
+                texel[1] = static_cast<std::uint8_t>(tile * 91);
+                texel[2] = static_cast<std::uint8_t>(tile * 53);
+                texel[3] = static_cast<std::uint8_t>(tile * 17);
+            }
+        }
+    }
+
+    const ImageView srcImageView{ ImageFormat::RGBA, DataType::UInt8, srcImage.data(), srcImage.size() };
+    const Extent2D  extent{ width, height };
+
+    auto TestRoundTrip = [&](CompressionQuality quality, const char* qualityName, unsigned threadCount) -> TestResult
+    {
+        // Compress image and validate block count
+        DynamicByteArray compressedData = CompressImageBuffer(srcImageView, extent, ImageFormat::BC7, quality, threadCount);
+
+        const std::uint32_t numBlocksX      = width / 4;
+        const std::uint32_t numBlocksY      = height / 4;
+        const std::size_t   expectedSize    = numBlocksX * numBlocksY * 16;
+
+        if (compressedData.size() != expectedSize)
+        {
+            Log::Errorf(
+                "Mismatch between BC7 compressed image size (%u bytes) and expected size (%u bytes) for quality %s\n",
+                static_cast<unsigned>(compressedData.size()), static_cast<unsigned>(expectedSize), qualityName
+            );
+            return TestResult::FailedMismatch;
+        }
+
+        // Decode each block and compare all channels against original image
+        const std::uint8_t* blocks = reinterpret_cast<const std::uint8_t*>(compressedData.get());
+
+        double squaredErrorSum = 0.0;
+
+        for_range(blockY, numBlocksY)
+        {
+            for_range(blockX, numBlocksX)
+            {
+                std::uint8_t texels[16][4];
+                if (!DecodeBC7Mode6Block(blocks + (blockY * numBlocksX + blockX) * 16, texels))
+                {
+                    Log::Errorf("Failed to decode BC7 block [%u,%u] in mode 6 for quality %s\n", blockX, blockY, qualityName);
+                    return TestResult::FailedErrors;
+                }
+
+                for_range(i, 16u)
+                {
+                    const std::uint32_t x = blockX * 4 + i % 4;
+                    const std::uint32_t y = blockY * 4 + i / 4;
+                    for_range(c, 4)
+                    {
+                        const int srcValue  = static_cast<int>(srcImage[(y * width + x) * 4 + c]);
+                        const int dstValue  = static_cast<int>(texels[i][c]);
+                        const int error     = std::abs(srcValue - dstValue);
+                        if (error > maxError)
+                        {
+                            Log::Errorf(
+                                "Mismatch between BC7 round-trip texel [%u,%u] channel %u (%d) and original value (%d) for quality %s; error exceeds %d\n",
+                                x, y, static_cast<unsigned>(c), dstValue, srcValue, qualityName, maxError
+                            );
+                            return TestResult::FailedMismatch;
+                        }
+                        squaredErrorSum += static_cast<double>(error * error);
+                    }
+                }
+            }
+        }
+
+        const double rmse = std::sqrt(squaredErrorSum / static_cast<double>(width * height * 4));
+        if (rmse > maxRMSE)
+        {
+            Log::Errorf("Mismatch between BC7 round-trip RMSE (%.2f) and expected bound (%.2f) for quality %s\n", rmse, maxRMSE, qualityName);
+            return TestResult::FailedMismatch;
+        }
+
+        if (opt.verbose)
+        {
+            const std::string threadCountStr = (threadCount == LLGL_MAX_THREAD_COUNT ? std::string("Max") : std::to_string(threadCount));
+            Log::Printf("BC7 round-trip RMSE for quality %s (threads: %s): %.2f\n", qualityName, threadCountStr.c_str(), rmse);
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_ROUND_TRIP(QUALITY)                                                                        \
+        {                                                                                                   \
+            TestResult result = TestRoundTrip(CompressionQuality::QUALITY, #QUALITY, 0);                    \
+            if (result == TestResult::Passed)                                                               \
+                result = TestRoundTrip(CompressionQuality::QUALITY, #QUALITY, LLGL_MAX_THREAD_COUNT);       \
+            if (result != TestResult::Passed)                                                               \
+                return result;                                                                              \
+        }
+
+    TEST_ROUND_TRIP(Fast);
+    TEST_ROUND_TRIP(Default);
+    TEST_ROUND_TRIP(High);
+
+    #undef TEST_ROUND_TRIP
+
+    return TestResult::Passed;
+}
+
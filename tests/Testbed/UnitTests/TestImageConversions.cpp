@@ -153,6 +153,44 @@ DEF_RITEST( ImageConversions )
         TEST_CONVERSION("VanGogh-starry_night.jpg");
     }
 
+    // Convert padded rows where neither the source nor the destination size is a multiple of the texel size
+    {
+        constexpr std::uint32_t rowLength       = 3;
+        constexpr std::uint32_t numRows         = 3;
+        constexpr std::uint32_t srcRowStride    = 11;
+        constexpr std::uint32_t dstRowStride    = 13;
+
+        std::uint8_t srcData[(numRows - 1) * srcRowStride + rowLength * 3];
+        std::uint8_t dstData[(numRows - 1) * dstRowStride + rowLength * 4] = {};
+
+        for_range(i, sizeof(srcData))
+            srcData[i] = static_cast<std::uint8_t>(i);
+
+        const ImageView         srcImageView{ ImageFormat::RGB, DataType::UInt8, srcData, sizeof(srcData) };
+        const MutableImageView  dstImageView{ ImageFormat::RGBA, DataType::UInt8, dstData, sizeof(dstData) };
+        ConvertImageBuffer(srcImageView, srcRowStride, dstImageView, dstRowStride, rowLength);
+
+        for_range(y, numRows)
+        {
+            for_range(x, rowLength)
+            {
+                for_range(c, 3)
+                {
+                    const int p0 = static_cast<int>(dstData[y * dstRowStride + x * 4 + c]);
+                    const int p1 = static_cast<int>(srcData[y * srcRowStride + x * 3 + c]);
+                    if (p0 != p1)
+                    {
+                        Log::Errorf(
+                            "Mismatch between strided pixel [%u,%u] component [%u] (%d) and source pixel (%d)\n",
+                            static_cast<unsigned>(x), static_cast<unsigned>(y), static_cast<unsigned>(c), p0, p1
+                        );
+                        return TestResult::FailedMismatch;
+                    }
+                }
+            }
+        }
+    }
+
     return TestResult::Passed;
 }
 
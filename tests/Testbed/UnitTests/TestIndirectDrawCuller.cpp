@@ -0,0 +1,207 @@
+/*
+ * TestIndirectDrawCuller.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/IndirectDrawCuller.h>
+#include <algorithm>
+
+
+/*
+Culls four objects against an axis-aligned box frustum and reads back the number of visible objects.
+Then culls two objects inside the frustum against a constant Hi-Z texture, behind which only one of them is occluded.
+Backends without compute shaders (i.e. the Null backend) must still reset the count buffer, so the subsequent Draw command draws nothing.
+*/
+DEF_TEST( IndirectDrawCuller )
+{
+    const bool isNullRenderer = (renderer->GetRendererID() == RendererID::Null);
+
+    if (!caps.features.hasIndirectDrawCount || !(caps.features.hasComputeShaders || isNullRenderer))
+        return TestResult::Skipped;
+
+    auto HasShadingLanguage = [this](ShadingLanguage language) -> bool
+    {
+        const std::vector<ShadingLanguage>& languages = caps.shadingLanguages;
+        return (std::find(languages.begin(), languages.end(), language) != languages.end());
+    };
+
+    // Use built-in culling shader if available; The Null backend accepts any shader source
+    Shader* customShader = nullptr;
+
+    if (!HasShadingLanguage(ShadingLanguage::GLSL_430) && !HasShadingLanguage(ShadingLanguage::HLSL_5_0))
+    {
+        if (!isNullRenderer)
+            return TestResult::Skipped;
+
+        ShaderDescriptor shaderDesc;
+        {
+            shaderDesc.debugName    = "IndirectDrawCuller.NullShader";
+            shaderDesc.type         = ShaderType::Compute;
+            shaderDesc.sourceType   = ShaderSourceType::CodeString;
+            shaderDesc.source       = "void main() {}";
+        }
+        customShader = renderer->CreateShader(shaderDesc);
+    }
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    // Create culler with objects inside, outside, and on the boundary of the frustum
+    constexpr std::uint32_t numObjects = 4;
+
+    IndirectDrawCullerDescriptor cullerDesc;
+    {
+        cullerDesc.maxNumObjects    = numObjects;
+        cullerDesc.computeShader    = customShader;
+    }
+    IndirectDrawCuller culler{ *renderer, cullerDesc };
+
+    const float spheres[numObjects][4] =
+    {
+        { 0.0f,  0.0f, 0.0f, 0.5f }, // inside
+        { 5.0f,  0.0f, 0.0f, 0.5f }, // outside
+        { 1.2f,  0.0f, 0.0f, 0.5f }, // intersecting
+        { 0.0f, -3.0f, 0.0f, 1.0f }, // outside
+    };
+    constexpr std::uint32_t numVisibleObjects = 2;
+
+    IndirectDrawCullerObject objects[numObjects];
+    for_range(i, numObjects)
+    {
+        ::memcpy(objects[i].boundingSphere, spheres[i], sizeof(spheres[i]));
+        objects[i].drawArgs.numIndices      = mesh.numIndices;
+        objects[i].drawArgs.numInstances    = 1;
+    }
+    culler.WriteObjects(0, numObjects, objects);
+
+    // Invalidate count buffer to ensure the culling pass resets it
+    const std::uint32_t invalidCount = 0xDEADBEEF;
+    renderer->WriteBuffer(*culler.GetDrawCountBuffer(), 0, &invalidCount, sizeof(invalidCount));
+
+    // Cull objects against the box [-1, 1]^3 with inward facing plane normals
+    const float frustumPlanes[6][4] =
+    {
+        {  1.0f,  0.0f,  0.0f, 1.0f },
+        { -1.0f,  0.0f,  0.0f, 1.0f },
+        {  0.0f,  1.0f,  0.0f, 1.0f },
+        {  0.0f, -1.0f,  0.0f, 1.0f },
+        {  0.0f,  0.0f,  1.0f, 1.0f },
+        {  0.0f,  0.0f, -1.0f, 1.0f },
+    };
+
+    cmdBuffer->Begin();
+    {
+        culler.Cull(*cmdBuffer, frustumPlanes, numObjects);
+        cmdBuffer->BeginRenderPass(*swapChain);
+        {
+            cmdBuffer->SetViewport(opt.resolution);
+            cmdBuffer->SetVertexBuffer(*meshBuffer);
+            cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+            culler.Draw(*cmdBuffer);
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+
+    // Read number of visible objects
+    std::uint32_t drawCount = invalidCount;
+    renderer->ReadBuffer(*culler.GetDrawCountBuffer(), 0, &drawCount, sizeof(drawCount));
+
+    const std::uint32_t expectedDrawCount = (caps.features.hasComputeShaders ? numVisibleObjects : 0);
+
+    TestResult result = TestResult::Passed;
+
+    if (drawCount != expectedDrawCount)
+    {
+        Log::Errorf("Mismatch between number of culled objects (%u) and expected number of visible objects (%u)\n", drawCount, expectedDrawCount);
+        result = TestResult::FailedMismatch;
+    }
+
+    // Create 4x4 Hi-Z texture with a constant depth in all MIP levels
+    constexpr std::uint32_t hiZSize     = 4;
+    constexpr std::uint32_t hiZNumMips  = 3;
+    constexpr float         hiZDepth    = 0.9f;
+
+    TextureDescriptor hiZTextureDesc;
+    {
+        hiZTextureDesc.debugName    = "IndirectDrawCuller.HiZ";
+        hiZTextureDesc.type         = TextureType::Texture2D;
+        hiZTextureDesc.bindFlags    = BindFlags::Sampled;
+        hiZTextureDesc.format       = Format::R32Float;
+        hiZTextureDesc.extent       = { hiZSize, hiZSize, 1 };
+        hiZTextureDesc.mipLevels    = hiZNumMips;
+    }
+    Texture* hiZTexture = renderer->CreateTexture(hiZTextureDesc);
+
+    const std::vector<float> hiZTexels(hiZSize * hiZSize, hiZDepth);
+    for_range(mip, hiZNumMips)
+    {
+        const Extent3D mipExtent = hiZTexture->GetMipExtent(mip);
+        const TextureRegion region{ TextureSubresource{ 0, mip }, Offset3D{}, mipExtent };
+        const ImageView hiZImage{ ImageFormat::R, DataType::Float32, hiZTexels.data(), mipExtent.width * mipExtent.height * sizeof(float) };
+        renderer->WriteTexture(*hiZTexture, region, hiZImage);
+    }
+
+    // Cull one object in front of and one object behind the Hi-Z depth; The depth is the same for both clipping ranges [0, 1] and [-1, 1]
+    constexpr std::uint32_t numOcclusionObjects = 2;
+
+    IndirectDrawCullerDescriptor occlusionCullerDesc;
+    {
+        occlusionCullerDesc.maxNumObjects   = numOcclusionObjects;
+        occlusionCullerDesc.computeShader   = customShader;
+        occlusionCullerDesc.hiZTexture      = hiZTexture;
+    }
+    IndirectDrawCuller occlusionCuller{ *renderer, occlusionCullerDesc };
+
+    const float occlusionSpheres[numOcclusionObjects][4] =
+    {
+        { 0.0f, 0.0f, 0.10f, 0.05f }, // in front of Hi-Z depth
+        { 0.0f, 0.0f, 0.95f, 0.02f }, // behind Hi-Z depth
+    };
+    constexpr std::uint32_t numUnoccludedObjects = 1;
+
+    for_range(i, numOcclusionObjects)
+        ::memcpy(objects[i].boundingSphere, occlusionSpheres[i], sizeof(occlusionSpheres[i]));
+    occlusionCuller.WriteObjects(0, numOcclusionObjects, objects);
+
+    renderer->WriteBuffer(*occlusionCuller.GetDrawCountBuffer(), 0, &invalidCount, sizeof(invalidCount));
+
+    // Identity view-projection, so clip space equals the object space of the spheres
+    const float viewProjection[4][4] =
+    {
+        { 1.0f, 0.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 0.0f, 0.0f, 1.0f },
+    };
+
+    cmdBuffer->Begin();
+    {
+        occlusionCuller.Cull(*cmdBuffer, frustumPlanes, viewProjection, numOcclusionObjects);
+    }
+    cmdBuffer->End();
+
+    std::uint32_t occlusionDrawCount = invalidCount;
+    renderer->ReadBuffer(*occlusionCuller.GetDrawCountBuffer(), 0, &occlusionDrawCount, sizeof(occlusionDrawCount));
+
+    const std::uint32_t expectedOcclusionDrawCount = (caps.features.hasComputeShaders ? numUnoccludedObjects : 0);
+
+    if (occlusionDrawCount != expectedOcclusionDrawCount)
+    {
+        Log::Errorf(
+            "Mismatch between number of occlusion culled objects (%u) and expected number of unoccluded objects (%u)\n",
+            occlusionDrawCount, expectedOcclusionDrawCount
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    renderer->Release(*hiZTexture);
+
+    if (customShader != nullptr)
+        renderer->Release(*customShader);
+
+    return result;
+}
+
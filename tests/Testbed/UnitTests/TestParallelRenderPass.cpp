@@ -0,0 +1,209 @@
+/*
+ * TestParallelRenderPass.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/ParallelRenderPass.h>
+#include <Gauss/Translate.h>
+#include <Gauss/Rotate.h>
+#include <Gauss/Scale.h>
+#include <thread>
+
+
+/*
+Renders the same scene as the CommandBufferSecondary test, but all meshes are encoded by secondary command buffers
+on worker threads within a parallel render pass. Hence, the result is compared against the reference image of that test.
+One of the meshes uses a vertex buffer that is created on a loader thread and bound for the first time on a worker thread.
+*/
+DEF_TEST( ParallelRenderPass )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned  numEncoders     = 3;
+    constexpr int       diffThreshold   = 1;
+    constexpr unsigned  diffTolerance   = 1;
+
+    // Create render pass that clears the swap-chain, since only secondary command buffers can be executed within a parallel render pass
+    RenderPassDescriptor renderPassDesc;
+    {
+        renderPassDesc.colorAttachments[0].format   = swapChain->GetColorFormat();
+        renderPassDesc.colorAttachments[0].loadOp   = AttachmentLoadOp::Clear;
+        renderPassDesc.colorAttachments[0].storeOp  = AttachmentStoreOp::Store;
+        renderPassDesc.depthAttachment.format       = swapChain->GetDepthStencilFormat();
+        renderPassDesc.depthAttachment.loadOp       = AttachmentLoadOp::Clear;
+        renderPassDesc.depthAttachment.storeOp      = AttachmentStoreOp::Store;
+    }
+    RenderPass* renderPass = renderer->CreateRenderPass(renderPassDesc);
+
+    // Create graphics PSO
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = renderPass;
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.depth.testEnabled   = true;
+        psoDesc.depth.writeEnabled  = true;
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    // Create scene buffers with the same transformations as in the CommandBufferSecondary test
+    struct ModelTransform
+    {
+        Gs::Vector3f    origin;
+        Gs::Vector3f    scale;
+        Gs::Vector3f    color;
+        float           pitch;
+        float           yaw;
+    };
+
+    const ModelTransform transforms[numEncoders] =
+    {
+        ModelTransform{ Gs::Vector3f{ -2.0f, +1.0f, 4.0f }, Gs::Vector3f{ 0.5f, 1.5f, 0.5f }, Gs::Vector3f{ 1.0f, 0.6f, 0.6f }, 45.0f, 30.0f },
+        ModelTransform{ Gs::Vector3f{  0.0f,  0.0f, 4.0f }, Gs::Vector3f{ 0.5f, 0.5f, 0.5f }, Gs::Vector3f{ 0.6f, 1.0f, 0.6f },  0.0f, 35.0f },
+        ModelTransform{ Gs::Vector3f{ +1.5f, -0.5f, 4.0f }, Gs::Vector3f{ 0.4f, 0.5f, 0.6f }, Gs::Vector3f{ 0.6f, 0.6f, 1.0f }, 15.0f, 20.0f },
+    };
+
+    sceneConstants          = {};
+    sceneConstants.vpMatrix = projection;
+
+    Buffer* sceneBuffers[numEncoders] = {};
+
+    for_range(i, numEncoders)
+    {
+        const ModelTransform& transform = transforms[i];
+
+        sceneConstants.solidColor = Gs::Vector4f{ transform.color, 1.0f };
+
+        sceneConstants.wMatrix.LoadIdentity();
+        Gs::Translate(sceneConstants.wMatrix, transform.origin);
+        Gs::RotateFree(sceneConstants.wMatrix, Gs::Vector3f{ 1.0f, 0.0f, 0.0f }, transform.pitch);
+        Gs::RotateFree(sceneConstants.wMatrix, Gs::Vector3f{ 0.0f, 1.0f, 0.0f }, transform.yaw);
+        Gs::Scale(sceneConstants.wMatrix, transform.scale);
+
+        BufferDescriptor sceneBufferDesc;
+        {
+            sceneBufferDesc.size        = sizeof(SceneConstants);
+            sceneBufferDesc.bindFlags   = BindFlags::ConstantBuffer;
+        }
+        sceneBuffers[i] = renderer->CreateBuffer(sceneBufferDesc, &sceneConstants);
+    }
+
+    // Create a copy of the mesh buffer on a loader thread (if supported), so its vertex buffer is bound for the first time by a worker thread
+    const std::uint64_t meshBufferSize = meshBuffer->GetDesc().size;
+    std::vector<char> meshBufferData(static_cast<std::size_t>(meshBufferSize));
+    renderer->ReadBuffer(*meshBuffer, 0, meshBufferData.data(), meshBufferSize);
+
+    BufferDescriptor workerMeshBufferDesc;
+    {
+        workerMeshBufferDesc.debugName      = "WorkerMeshBuffer";
+        workerMeshBufferDesc.size           = meshBufferSize;
+        workerMeshBufferDesc.bindFlags      = BindFlags::VertexBuffer | BindFlags::IndexBuffer;
+        workerMeshBufferDesc.vertexAttribs  = vertexFormats[VertFmtStd].attributes;
+    }
+    Buffer* workerMeshBuffer = nullptr;
+
+    std::thread loaderThread(
+        [this, &workerMeshBufferDesc, &meshBufferData, &workerMeshBuffer]() -> void
+        {
+            if (renderer->BeginLoaderThread())
+            {
+                workerMeshBuffer = renderer->CreateBuffer(workerMeshBufferDesc, meshBufferData.data());
+                renderer->EndLoaderThread();
+            }
+        }
+    );
+    loaderThread.join();
+
+    if (workerMeshBuffer == nullptr)
+        workerMeshBuffer = renderer->CreateBuffer(workerMeshBufferDesc, meshBufferData.data());
+
+    // Create readback texture
+    const Extent2D resolution = swapChain->GetResolution();
+
+    TextureDescriptor readbackTexDesc;
+    {
+        readbackTexDesc.bindFlags       = BindFlags::CopyDst;
+        readbackTexDesc.format          = swapChain->GetColorFormat();
+        readbackTexDesc.extent.width    = resolution.width;
+        readbackTexDesc.extent.height   = resolution.height;
+        readbackTexDesc.miscFlags       = MiscFlags::NoInitialData;
+        readbackTexDesc.mipLevels       = 1;
+    }
+    Texture* readbackTex = renderer->CreateTexture(readbackTexDesc);
+
+    // Encode one mesh per worker thread; Each encoder must set its entire state, since nothing is inherited from the primary command buffer
+    ParallelRenderPassEncoder parallelPass{ *renderer, *renderPass, numEncoders };
+
+    auto EncodeMeshWorker = [pso, resolution](CommandBuffer* encoder, Buffer* vertexBuffer, const IndexedTriangleMesh& mesh, Buffer* sceneBuffer) -> void
+    {
+        encoder->SetViewport(resolution);
+        encoder->SetVertexBuffer(*vertexBuffer);
+        encoder->SetIndexBuffer(*vertexBuffer, Format::R32UInt, mesh.indexBufferOffset);
+        encoder->SetPipelineState(*pso);
+        encoder->SetResource(0, *sceneBuffer);
+        encoder->DrawIndexed(mesh.numIndices, 0);
+    };
+
+    const TextureRegion texRegion{ Offset3D{}, readbackTexDesc.extent };
+    const ClearValue clearValues[2] = {};
+
+    cmdBuffer->Begin();
+    {
+        parallelPass.Begin(*cmdBuffer, *swapChain, 2, clearValues);
+        {
+            // The first encoder binds the mesh buffer that has never been bound on the rendering thread
+            std::thread workers[numEncoders];
+            for_range(i, numEncoders)
+            {
+                Buffer* vertexBuffer = (i == 0 ? workerMeshBuffer : meshBuffer);
+                workers[i] = std::thread(EncodeMeshWorker, parallelPass.GetEncoder(i), vertexBuffer, std::cref(models[ModelCube]), sceneBuffers[i]);
+            }
+            for (std::thread& worker : workers)
+                worker.join();
+        }
+        parallelPass.End();
+        cmdBuffer->CopyTextureFromFramebuffer(*readbackTex, texRegion, Offset2D{});
+    }
+    cmdBuffer->End();
+
+    // Read result from readback texture
+    std::vector<ColorRGBub> readbackImage;
+    readbackImage.resize(resolution.width * resolution.height);
+
+    MutableImageView dstImageView;
+    {
+        dstImageView.format     = ImageFormat::RGB;
+        dstImageView.dataType   = DataType::UInt8;
+        dstImageView.data       = readbackImage.data();
+        dstImageView.dataSize   = readbackImage.size() * sizeof(ColorRGBub);
+    }
+    renderer->ReadTexture(*readbackTex, texRegion, dstImageView);
+
+    const std::string readbackImageName = "ParallelRenderPass";
+    SaveColorImage(readbackImage, resolution, readbackImageName);
+
+    // Compare against the reference image of the CommandBufferSecondary test instead of a separate copy, since both render the same scene
+    const DiffResult diff = DiffImagesWithReference(readbackImageName, "SecondaryCommandBuffer", diffThreshold, diffTolerance);
+
+    // Release resources
+    for_range(i, numEncoders)
+        renderer->Release(*sceneBuffers[i]);
+
+    renderer->Release(*workerMeshBuffer);
+    renderer->Release(*readbackTex);
+    renderer->Release(*pso);
+    renderer->Release(*renderPass);
+
+    return diff.Evaluate("parallel render pass");
+}
+
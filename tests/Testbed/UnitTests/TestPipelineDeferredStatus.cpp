@@ -0,0 +1,79 @@
+/*
+ * TestPipelineDeferredStatus.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Binds a new PSO for the first time within a deferred command buffer.
+Backends that query the link status lazily (e.g. OpenGL with GL_KHR_parallel_shader_compile) finalize the PSO when the command is executed,
+so the PSO must be ready and its report must be free of errors after the command buffer has been submitted.
+*/
+DEF_TEST( PipelineDeferredStatus )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Create graphics PSO without querying its report
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.depth.testEnabled   = true;
+        psoDesc.depth.writeEnabled  = true;
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    // Bind PSO for the first time in a deferred command buffer
+    CommandBuffer* deferredCmdBuffer = renderer->CreateCommandBuffer();
+
+    deferredCmdBuffer->Begin();
+    {
+        deferredCmdBuffer->BeginRenderPass(*swapChain);
+        {
+            deferredCmdBuffer->SetViewport(swapChain->GetResolution());
+            deferredCmdBuffer->SetPipelineState(*pso);
+        }
+        deferredCmdBuffer->EndRenderPass();
+    }
+    deferredCmdBuffer->End();
+
+    cmdQueue->Submit(*deferredCmdBuffer);
+    cmdQueue->WaitIdle();
+
+    // Evaluate PSO status after first use
+    TestResult result = TestResult::Passed;
+
+    if (!pso->IsReady())
+    {
+        Log::Errorf("PSO is not ready after it has been bound\n");
+        result = TestResult::FailedErrors;
+    }
+
+    if (const Report* report = pso->GetReport())
+    {
+        if (report->HasErrors())
+        {
+            Log::Errorf("PSO report has errors after it has been bound:\n%s", report->GetText());
+            result = TestResult::FailedErrors;
+        }
+    }
+
+    // Release resources
+    renderer->Release(*deferredCmdBuffer);
+    renderer->Release(*pso);
+
+    return result;
+}
+
+
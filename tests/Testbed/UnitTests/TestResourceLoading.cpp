@@ -0,0 +1,261 @@
+/*
+ * TestResourceLoading.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ResourceLoader.h>
+#include <LLGL/Utils/ForRange.h>
+#include <vector>
+
+
+DEF_TEST( ResourceLoading )
+{
+    constexpr std::uint32_t numLoaderThreads    = 4;
+    constexpr std::uint32_t numJobs             = 64;
+    constexpr std::uint32_t numBuffersPerJob    = 16;
+    constexpr std::uint32_t numTexturesPerJob   = 16;
+    constexpr std::uint32_t numSamplersPerJob   = 8;
+    constexpr std::uint32_t numShadersPerJob    = 4;
+
+    // Each job owns a separate range of resources, so no synchronization is required between the jobs
+    struct LoadedResources
+    {
+        Buffer*     buffers [numBuffersPerJob];
+        Texture*    textures[numTexturesPerJob];
+        Sampler*    samplers[numSamplersPerJob];
+        Shader*     shaders [numShadersPerJob];
+    };
+
+    std::vector<LoadedResources> resources(numJobs, LoadedResources{});
+
+    // Shaders are only created for backends that accept this GLSL source as is
+    const bool hasGLSLShaders = (renderer->GetRendererID() == RendererID::OpenGL || renderer->GetRendererID() == RendererID::Null);
+
+    auto MakeBufferValue = [](std::uint32_t job, std::uint32_t index) -> std::uint32_t
+    {
+        return ((job << 16) | index);
+    };
+
+    auto MakeTexel = [](std::uint32_t job, std::uint32_t index) -> ColorRGBAub
+    {
+        return ColorRGBAub{ static_cast<std::uint8_t>(job), static_cast<std::uint8_t>(index), 0xAB, 0xCD };
+    };
+
+    auto LoadResources = [&](RenderSystem& loader, std::uint32_t job)
+    {
+        LoadedResources& entry = resources[job];
+
+        for_range(i, numBuffersPerJob)
+        {
+            const std::uint32_t initialData[4] = { MakeBufferValue(job, i), 1, 2, 3 };
+            BufferDescriptor bufferDesc;
+            {
+                bufferDesc.size             = sizeof(initialData);
+                bufferDesc.bindFlags        = (i % 2 == 0 ? BindFlags::VertexBuffer : BindFlags::ConstantBuffer);
+                bufferDesc.cpuAccessFlags   = CPUAccessFlags::Read;
+            }
+            entry.buffers[i] = loader.CreateBuffer(bufferDesc, initialData);
+        }
+
+        for_range(i, numTexturesPerJob)
+        {
+            const ColorRGBAub texels[4*4] =
+            {
+                MakeTexel(job, i), MakeTexel(job, i), MakeTexel(job, i), MakeTexel(job, i),
+                MakeTexel(job, i), MakeTexel(job, i), MakeTexel(job, i), MakeTexel(job, i),
+                MakeTexel(job, i), MakeTexel(job, i), MakeTexel(job, i), MakeTexel(job, i),
+                MakeTexel(job, i), MakeTexel(job, i), MakeTexel(job, i), MakeTexel(job, i),
+            };
+            const ImageView initialImage{ ImageFormat::RGBA, DataType::UInt8, texels, sizeof(texels) };
+            TextureDescriptor textureDesc;
+            {
+                textureDesc.type        = TextureType::Texture2D;
+                textureDesc.format      = Format::RGBA8UNorm;
+                textureDesc.extent      = Extent3D{ 4, 4, 1 };
+                textureDesc.mipLevels   = 1;
+            }
+            entry.textures[i] = loader.CreateTexture(textureDesc, &initialImage);
+        }
+
+        for_range(i, numSamplersPerJob)
+        {
+            SamplerDescriptor samplerDesc;
+            {
+                samplerDesc.maxAnisotropy = 1 + i;
+            }
+            entry.samplers[i] = loader.CreateSampler(samplerDesc);
+        }
+
+        if (hasGLSLShaders)
+        {
+            for_range(i, numShadersPerJob)
+            {
+                const char* shaderSource =
+                    "#version 330 core\n"
+                    "void main() { gl_Position = vec4(0.0); }\n";
+                ShaderDescriptor shaderDesc;
+                {
+                    shaderDesc.type         = ShaderType::Vertex;
+                    shaderDesc.source       = shaderSource;
+                    shaderDesc.sourceType   = ShaderSourceType::CodeString;
+                }
+                entry.shaders[i] = loader.CreateShader(shaderDesc);
+            }
+        }
+
+        // Resources that are never handed over can be released on the loader thread
+        BufferDescriptor scratchBufferDesc;
+        {
+            scratchBufferDesc.size      = 256;
+            scratchBufferDesc.bindFlags = BindFlags::Storage;
+        }
+        if (Buffer* scratchBuffer = loader.CreateBuffer(scratchBufferDesc))
+            loader.Release(*scratchBuffer);
+    };
+
+    // Enqueue all jobs and create additional resources on this thread while the loader threads are busy
+    ResourceLoaderDescriptor loaderDesc;
+    {
+        loaderDesc.numLoaderThreads = numLoaderThreads;
+    }
+    ResourceLoader loader{ *renderer, loaderDesc };
+
+    if (opt.verbose && !loader.IsAsynchronous())
+        Log::Printf("Renderer does not support loader threads; resources are loaded synchronously\n");
+
+    std::vector<ResourceLoadTicket> tickets;
+    tickets.reserve(numJobs);
+
+    for_range(job, numJobs)
+    {
+        tickets.push_back(
+            loader.Enqueue(
+                [&LoadResources, job](RenderSystem& renderSystem)
+                {
+                    LoadResources(renderSystem, job);
+                }
+            )
+        );
+
+        BufferDescriptor renderThreadBufferDesc;
+        {
+            renderThreadBufferDesc.size         = 64;
+            renderThreadBufferDesc.bindFlags    = BindFlags::ConstantBuffer;
+        }
+        if (Buffer* renderThreadBuffer = renderer->CreateBuffer(renderThreadBufferDesc))
+            renderer->Release(*renderThreadBuffer);
+    }
+
+    // Tickets are completed at the latest when the loader is idle
+    loader.WaitIdle();
+
+    for_range(job, numJobs)
+    {
+        if (!loader.IsComplete(tickets[job]))
+        {
+            Log::Errorf("Resource loading job %u is incomplete after waiting for the resource loader\n", job);
+            return TestResult::FailedErrors;
+        }
+    }
+
+    // Validate initial data of all loaded resources on the rendering thread
+    TestResult result = TestResult::Passed;
+
+    for_range(job, numJobs)
+    {
+        LoadedResources& entry = resources[job];
+
+        for_range(i, numBuffersPerJob)
+        {
+            if (entry.buffers[i] == nullptr)
+            {
+                Log::Errorf("Failed to create buffer %u in resource loading job %u\n", i, job);
+                return TestResult::FailedErrors;
+            }
+
+            std::uint32_t value = 0;
+            renderer->ReadBuffer(*entry.buffers[i], 0, &value, sizeof(value));
+            if (value != MakeBufferValue(job, i))
+            {
+                Log::Errorf("Mismatch between buffer %u of job %u (0x%08X) and expected value (0x%08X)\n", i, job, value, MakeBufferValue(job, i));
+                result = TestResult::FailedMismatch;
+            }
+        }
+
+        for_range(i, numTexturesPerJob)
+        {
+            if (entry.textures[i] == nullptr)
+            {
+                Log::Errorf("Failed to create texture %u in resource loading job %u\n", i, job);
+                return TestResult::FailedErrors;
+            }
+
+            ColorRGBAub texel;
+            const MutableImageView dstImage{ ImageFormat::RGBA, DataType::UInt8, &texel, sizeof(texel) };
+            renderer->ReadTexture(*entry.textures[i], TextureRegion{ Offset3D{ 3, 2, 0 }, Extent3D{ 1, 1, 1 } }, dstImage);
+            if (texel != MakeTexel(job, i))
+            {
+                const ColorRGBAub expected = MakeTexel(job, i);
+                Log::Errorf(
+                    "Mismatch between texture %u of job %u (%u, %u, %u, %u) and expected texel (%u, %u, %u, %u)\n",
+                    i, job, texel.r, texel.g, texel.b, texel.a, expected.r, expected.g, expected.b, expected.a
+                );
+                result = TestResult::FailedMismatch;
+            }
+        }
+
+        for_range(i, numSamplersPerJob)
+        {
+            if (entry.samplers[i] == nullptr)
+            {
+                Log::Errorf("Failed to create sampler %u in resource loading job %u\n", i, job);
+                return TestResult::FailedErrors;
+            }
+        }
+
+        if (hasGLSLShaders)
+        {
+            for_range(i, numShadersPerJob)
+            {
+                if (entry.shaders[i] == nullptr || (entry.shaders[i]->GetReport() != nullptr && entry.shaders[i]->GetReport()->HasErrors()))
+                {
+                    Log::Errorf("Failed to create shader %u in resource loading job %u\n", i, job);
+                    return TestResult::FailedErrors;
+                }
+            }
+        }
+
+        if (result != TestResult::Passed && !opt.greedy)
+            break;
+    }
+
+    // Release all loaded resources on the rendering thread
+    for (LoadedResources& entry : resources)
+    {
+        for (Buffer* buffer : entry.buffers)
+        {
+            if (buffer != nullptr)
+                renderer->Release(*buffer);
+        }
+        for (Texture* texture : entry.textures)
+        {
+            if (texture != nullptr)
+                renderer->Release(*texture);
+        }
+        for (Sampler* sampler : entry.samplers)
+        {
+            if (sampler != nullptr)
+                renderer->Release(*sampler);
+        }
+        for (Shader* shader : entry.shaders)
+        {
+            if (shader != nullptr)
+                renderer->Release(*shader);
+        }
+    }
+
+    return result;
+}
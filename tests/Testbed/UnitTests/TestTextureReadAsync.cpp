@@ -0,0 +1,94 @@
+/*
+ * TestTextureReadAsync.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include "Testset.h"
+
+
+/*
+Requests an asynchronous texture readback, overwrites the texture afterwards, and resolves the request.
+The resolved image data must reflect the texture content at the time of the request, regardless of whether
+the backend reads the texture asynchronously or falls back to a synchronous read.
+*/
+DEF_TEST( TextureReadAsync )
+{
+    static std::vector<ColorRGBAub> initialColors = Testset::GenerateColorsRgbaUb(16);
+
+    const std::size_t dataSize = initialColors.size() * sizeof(ColorRGBAub);
+
+    // Generate different image data to overwrite the texture with
+    std::vector<ColorRGBAub> updatedColors(initialColors.size());
+    for_range(i, initialColors.size())
+    {
+        for_range(c, 4)
+            updatedColors[i][c] = static_cast<std::uint8_t>(~initialColors[i][c]);
+    }
+
+    // Create texture with initial image data
+    TextureDescriptor texDesc;
+    {
+        texDesc.type            = TextureType::Texture2D;
+        texDesc.bindFlags       = BindFlags::CopySrc | BindFlags::CopyDst;
+        texDesc.format          = Format::RGBA8UNorm;
+        texDesc.extent.width    = 4;
+        texDesc.extent.height   = 4;
+        texDesc.mipLevels       = 1;
+    }
+    ImageView initialImage{ ImageFormat::RGBA, DataType::UInt8, initialColors.data(), dataSize };
+
+    Texture* tex = nullptr;
+    TestResult result = CreateTexture(texDesc, "tex2D{4wh}:{async-read}", &tex, &initialImage);
+    if (result != TestResult::Passed)
+        return result;
+
+    // Request readback and overwrite texture before the request is resolved
+    const TextureRegion region{ TextureSubresource{ 0, 0 }, Offset3D{ 0, 0, 0 }, Extent3D{ 4, 4, 1 } };
+    const std::uint64_t requestID = renderer->RequestTextureRead(*tex, region);
+
+    if (requestID == 0)
+    {
+        Log::Errorf("Failed to request texture readback\n");
+        renderer->Release(*tex);
+        return TestResult::FailedErrors;
+    }
+
+    renderer->WriteTexture(*tex, region, ImageView{ ImageFormat::RGBA, DataType::UInt8, updatedColors.data(), dataSize });
+
+    // Resolve request and wait for the GPU
+    std::vector<ColorRGBAub> outputColors(initialColors.size(), ColorRGBAub{ 0xFF, 0xFF, 0xFF, 0xFF });
+    const MutableImageView dstImage{ ImageFormat::RGBA, DataType::UInt8, outputColors.data(), dataSize };
+
+    if (!renderer->ResolveTextureRead(requestID, dstImage, true))
+    {
+        Log::Errorf("Failed to resolve texture readback request\n");
+        result = TestResult::FailedErrors;
+    }
+    else if (::memcmp(initialColors.data(), outputColors.data(), dataSize) != 0)
+    {
+        const std::string inputDataStr = TestbedContext::FormatByteArray(initialColors.data(), dataSize, 4);
+        const std::string outputDataStr = TestbedContext::FormatByteArray(outputColors.data(), dataSize, 4);
+        Log::Errorf(
+            "Mismatch between resolved texture readback and texture content at time of request:\n"
+            " -> Expected: [%s]\n"
+            " -> Actual:   [%s]\n",
+            inputDataStr.c_str(), outputDataStr.c_str()
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Resolved requests must be released
+    if (renderer->ResolveTextureRead(requestID, dstImage, true))
+    {
+        Log::Errorf("Texture readback request was not released after it has been resolved\n");
+        result = TestResult::FailedErrors;
+    }
+
+    renderer->Release(*tex);
+
+    return result;
+}
+
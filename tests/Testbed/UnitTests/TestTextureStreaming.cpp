@@ -0,0 +1,170 @@
+/*
+ * TestTextureStreaming.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/TextureStreamer.h>
+#include <LLGL/Utils/ForRange.h>
+
+
+DEF_TEST( TextureStreaming )
+{
+    // Each texel encodes its MIP-map level, texture handle, and coordinate, so copied MIP-maps can be validated after reallocation
+    auto MakeTexel = [](std::uint32_t mipLevel, StreamingTexture texture, std::uint32_t x, std::uint32_t y) -> ColorRGBAub
+    {
+        return ColorRGBAub
+        {
+            static_cast<std::uint8_t>(mipLevel),
+            static_cast<std::uint8_t>(texture),
+            static_cast<std::uint8_t>(x & 0xFF),
+            static_cast<std::uint8_t>(y & 0xFF)
+        };
+    };
+
+    auto LoadMip = [&MakeTexel](StreamingTexture texture, std::uint32_t mipLevel, const Extent3D& extent, DynamicByteArray& outData) -> bool
+    {
+        outData = DynamicByteArray{ extent.width * extent.height * sizeof(ColorRGBAub), UninitializeTag{} };
+        ColorRGBAub* texels = reinterpret_cast<ColorRGBAub*>(outData.get());
+        for_range(y, extent.height)
+        {
+            for_range(x, extent.width)
+                texels[y * extent.width + x] = MakeTexel(mipLevel, texture, x, y);
+        }
+        return true;
+    };
+
+    // Budget fits both MIP-map tails, one fully resident texture, and one additional 64x64 MIP-map
+    const std::uint64_t mipSizes[4] = { 256u*256u*4u, 128u*128u*4u, 64u*64u*4u, 0 };
+    const std::uint64_t tailSize    = (32u*32u + 16u*16u + 8u*8u + 4u*4u + 2u*2u + 1u) * 4u;
+
+    TextureStreamerDescriptor streamerDesc;
+    {
+        streamerDesc.memoryBudget           = tailSize * 2 + mipSizes[0] + mipSizes[1] + mipSizes[2] * 2;
+        streamerDesc.maxUploadSizePerFrame  = mipSizes[1];
+        streamerDesc.mipTailSize            = 32;
+        streamerDesc.numLoaderThreads       = 0;
+    }
+    TextureStreamer streamer{ *renderer, LoadMip, streamerDesc };
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type        = TextureType::Texture2D;
+        texDesc.bindFlags   = BindFlags::Sampled;
+        texDesc.format      = Format::RGBA8UNorm;
+        texDesc.extent      = Extent3D{ 256, 256, 1 };
+    }
+    const StreamingTexture texA = streamer.Register(texDesc);
+    const StreamingTexture texB = streamer.Register(texDesc);
+
+    if (texA == LLGL_INVALID_STREAMING_TEXTURE || texB == LLGL_INVALID_STREAMING_TEXTURE)
+    {
+        Log::Errorf("Failed to register streaming textures\n");
+        return TestResult::FailedErrors;
+    }
+
+    auto UpdateStreamer = [this, &streamer](int numFrames)
+    {
+        for_range(i, numFrames)
+        {
+            cmdBuffer->Begin();
+            {
+                streamer.Update(*cmdBuffer);
+            }
+            cmdBuffer->End();
+        }
+    };
+
+    auto ExpectResidentMips = [&streamer](const char* step, std::uint32_t expectedA, std::uint32_t expectedB) -> TestResult
+    {
+        const std::uint32_t residentA = streamer.GetResidentMipLevel(0);
+        const std::uint32_t residentB = streamer.GetResidentMipLevel(1);
+        if (residentA != expectedA || residentB != expectedB)
+        {
+            Log::Errorf(
+                "Mismatch between resident MIP-maps after %s (A = %u, B = %u) and expected MIP-maps (A = %u, B = %u)\n",
+                step, residentA, residentB, expectedA, expectedB
+            );
+            return TestResult::FailedMismatch;
+        }
+        return TestResult::Passed;
+    };
+
+    // Only the MIP-map tails are resident after registration
+    TestResult result = ExpectResidentMips("registration", 3, 3);
+    if (result != TestResult::Passed)
+        return result;
+
+    // Stream in texture A; MIP-maps are loaded from coarse to fine, one per frame due to the upload limit
+    streamer.RequestMipLevel(texA, 0, 2.0f);
+    UpdateStreamer(1);
+    if ((result = ExpectResidentMips("first update", 2, 3)) != TestResult::Passed)
+        return result;
+
+    UpdateStreamer(2);
+    if ((result = ExpectResidentMips("streaming in texture A", 0, 3)) != TestResult::Passed)
+        return result;
+
+    // Texture B has lower priority and can only use the remaining budget
+    streamer.RequestMipLevel(texB, 0, 1.0f);
+    UpdateStreamer(3);
+    if ((result = ExpectResidentMips("streaming in texture B with lower priority", 0, 2)) != TestResult::Passed)
+        return result;
+
+    // Once texture A no longer needs its finer MIP-maps, they are evicted for texture B
+    streamer.RequestMipLevel(texA, 3, 2.0f);
+    UpdateStreamer(3);
+    if ((result = ExpectResidentMips("evicting texture A", 2, 0)) != TestResult::Passed)
+        return result;
+
+    const TextureStreamerStatistics stats = streamer.GetStatistics();
+    if (stats.residentMemory > streamerDesc.memoryBudget || stats.numTextures != 2)
+    {
+        Log::Errorf("Texture streamer exceeded memory budget (%" PRIu64 " > %" PRIu64 ")\n", stats.residentMemory, streamerDesc.memoryBudget);
+        return TestResult::FailedMismatch;
+    }
+
+    // Validate texels of the uploaded MIP-map and of a MIP-map that has been copied across reallocations
+    auto ValidateTexels = [this, &streamer, &MakeTexel](StreamingTexture texture, std::uint32_t mipLevel) -> TestResult
+    {
+        const std::uint32_t localMip = mipLevel - streamer.GetResidentMipLevel(texture);
+        const Offset3D      offset{ 5, 7, 0 };
+        ColorRGBAub         texels[2];
+
+        MutableImageView dstImage;
+        {
+            dstImage.format     = ImageFormat::RGBA;
+            dstImage.dataType   = DataType::UInt8;
+            dstImage.data       = texels;
+            dstImage.dataSize   = sizeof(texels);
+        }
+        renderer->ReadTexture(*streamer.GetTexture(texture), TextureRegion{ TextureSubresource{ 0, localMip }, offset, Extent3D{ 2, 1, 1 } }, dstImage);
+
+        for_range(i, 2)
+        {
+            const ColorRGBAub expected = MakeTexel(mipLevel, texture, static_cast<std::uint32_t>(offset.x) + i, static_cast<std::uint32_t>(offset.y));
+            if (texels[i] != expected)
+            {
+                Log::Errorf(
+                    "Mismatch between streamed texel of texture %u [MIP %u] (%u, %u, %u, %u) and expected texel (%u, %u, %u, %u)\n",
+                    texture, mipLevel,
+                    texels[i].r, texels[i].g, texels[i].b, texels[i].a,
+                    expected.r, expected.g, expected.b, expected.a
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+        return TestResult::Passed;
+    };
+
+    if ((result = ValidateTexels(texB, 0)) != TestResult::Passed)
+        return result;
+    if ((result = ValidateTexels(texB, 2)) != TestResult::Passed)
+        return result;
+    if ((result = ValidateTexels(texA, 3)) != TestResult::Passed)
+        return result;
+
+    return TestResult::Passed;
+}
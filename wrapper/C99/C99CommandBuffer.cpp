@@ -10,6 +10,7 @@
 #include <LLGL/Utils/ForRange.h>
 #include "C99Internal.h"
 #include "../../sources/Core/Assertion.h"
+#include <string.h>
 
 
 // namespace LLGL {
@@ -272,6 +273,16 @@ LLGL_C_EXPORT void llglDrawIndexedIndirectExt(LLGLBuffer buffer, uint64_t offset
     g_CurrentCmdBuf->DrawIndexedIndirect(LLGL_REF(Buffer, buffer), offset, numCommands, stride);
 }
 
+LLGL_C_EXPORT void llglDrawIndirectCount(LLGLBuffer argsBuffer, uint64_t argsOffset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawIndirectCount(LLGL_REF(Buffer, argsBuffer), argsOffset, LLGL_REF(Buffer, countBuffer), countOffset, maxNumCommands, stride);
+}
+
+LLGL_C_EXPORT void llglDrawIndexedIndirectCount(LLGLBuffer argsBuffer, uint64_t argsOffset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawIndexedIndirectCount(LLGL_REF(Buffer, argsBuffer), argsOffset, LLGL_REF(Buffer, countBuffer), countOffset, maxNumCommands, stride);
+}
+
 LLGL_C_EXPORT void llglDispatch(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ)
 {
     g_CurrentCmdBuf->Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
@@ -302,6 +313,217 @@ LLGL_C_EXPORT bool llglGetNativeHandle(void* nativeHandle, size_t nativeHandleSi
     return g_CurrentCmdBuf->GetNativeHandle(nativeHandle, nativeHandleSize);
 }
 
+static float ReadStreamFloat(const uint32_t* words)
+{
+    float value;
+    ::memcpy(&value, words, sizeof(value));
+    return value;
+}
+
+static uint64_t ReadStreamUInt64(const uint32_t* words)
+{
+    return (static_cast<uint64_t>(words[1]) << 32) | static_cast<uint64_t>(words[0]);
+}
+
+template <typename T>
+static T& ReadStreamObject(const uint32_t* words)
+{
+    T* obj = reinterpret_cast<T*>(static_cast<uintptr_t>(ReadStreamUInt64(words)));
+    LLGL_ASSERT_PTR(obj);
+    return *obj;
+}
+
+// Returns the number of payload words that are required for the specified inline data size in bytes.
+static uint32_t GetStreamDataWordCount(uint32_t dataSize)
+{
+    return (dataSize + 3u) / 4u;
+}
+
+LLGL_C_EXPORT void llglExecuteCommandStream(const uint32_t* words, size_t numWords)
+{
+    LLGL_ASSERT(g_CurrentCmdBuf != NULL);
+    LLGL_ASSERT(words != NULL || numWords == 0);
+
+    CommandBuffer* cmdBuffer = g_CurrentCmdBuf;
+
+    for (const uint32_t* wordsEnd = words + numWords; words < wordsEnd;)
+    {
+        /* Decode record header and validate payload size against remaining stream */
+        const uint32_t  header      = *words++;
+        const uint32_t  opcode      = (header & 0xFFFFu);
+        const uint32_t  payloadSize = (header >> 16);
+        const uint32_t* args        = words;
+
+        LLGL_ASSERT(payloadSize <= static_cast<size_t>(wordsEnd - words), "command stream record exceeds stream size");
+        words += payloadSize;
+
+        switch (opcode)
+        {
+            case LLGLCommandStreamOpcodeSetViewport:
+            {
+                LLGL_ASSERT(payloadSize == 6);
+                cmdBuffer->SetViewport(
+                    Viewport
+                    {
+                        ReadStreamFloat(&args[0]), ReadStreamFloat(&args[1]),
+                        ReadStreamFloat(&args[2]), ReadStreamFloat(&args[3]),
+                        ReadStreamFloat(&args[4]), ReadStreamFloat(&args[5])
+                    }
+                );
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetScissor:
+            {
+                LLGL_ASSERT(payloadSize == 4);
+                cmdBuffer->SetScissor(
+                    Scissor
+                    {
+                        static_cast<int32_t>(args[0]), static_cast<int32_t>(args[1]),
+                        static_cast<int32_t>(args[2]), static_cast<int32_t>(args[3])
+                    }
+                );
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetVertexBuffer:
+            {
+                LLGL_ASSERT(payloadSize == 2);
+                cmdBuffer->SetVertexBuffer(ReadStreamObject<Buffer>(&args[0]));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetIndexBuffer:
+            {
+                LLGL_ASSERT(payloadSize == 2);
+                cmdBuffer->SetIndexBuffer(ReadStreamObject<Buffer>(&args[0]));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetIndexBufferExt:
+            {
+                LLGL_ASSERT(payloadSize == 5);
+                cmdBuffer->SetIndexBuffer(ReadStreamObject<Buffer>(&args[0]), static_cast<Format>(args[2]), ReadStreamUInt64(&args[3]));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetResourceHeap:
+            {
+                LLGL_ASSERT(payloadSize == 3);
+                cmdBuffer->SetResourceHeap(ReadStreamObject<ResourceHeap>(&args[0]), args[2]);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetResource:
+            {
+                LLGL_ASSERT(payloadSize == 3);
+                cmdBuffer->SetResource(args[0], ReadStreamObject<Resource>(&args[1]));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetPipelineState:
+            {
+                LLGL_ASSERT(payloadSize == 2);
+                cmdBuffer->SetPipelineState(ReadStreamObject<PipelineState>(&args[0]));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetBlendFactor:
+            {
+                LLGL_ASSERT(payloadSize == 4);
+                const float color[4] =
+                {
+                    ReadStreamFloat(&args[0]), ReadStreamFloat(&args[1]),
+                    ReadStreamFloat(&args[2]), ReadStreamFloat(&args[3])
+                };
+                cmdBuffer->SetBlendFactor(color);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetStencilReference:
+            {
+                LLGL_ASSERT(payloadSize == 2);
+                cmdBuffer->SetStencilReference(args[0], static_cast<StencilFace>(args[1]));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetUniforms:
+            {
+                LLGL_ASSERT(payloadSize >= 2);
+                const uint32_t dataSize = args[1];
+                LLGL_ASSERT(payloadSize == 2 + GetStreamDataWordCount(dataSize));
+                cmdBuffer->SetUniforms(args[0], &args[2], dataSize);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeUpdateBuffer:
+            {
+                LLGL_ASSERT(payloadSize >= 5);
+                const uint32_t dataSize = args[4];
+                LLGL_ASSERT(payloadSize == 5 + GetStreamDataWordCount(dataSize));
+                LLGL_ASSERT(dataSize <= UINT16_MAX);
+                cmdBuffer->UpdateBuffer(ReadStreamObject<Buffer>(&args[0]), ReadStreamUInt64(&args[2]), &args[5], static_cast<uint16_t>(dataSize));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDraw:
+            {
+                LLGL_ASSERT(payloadSize == 2);
+                cmdBuffer->Draw(args[0], args[1]);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDrawIndexed:
+            {
+                LLGL_ASSERT(payloadSize == 3);
+                cmdBuffer->DrawIndexed(args[0], args[1], static_cast<int32_t>(args[2]));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDrawInstanced:
+            {
+                LLGL_ASSERT(payloadSize == 4);
+                cmdBuffer->DrawInstanced(args[0], args[1], args[2], args[3]);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDrawIndexedInstanced:
+            {
+                LLGL_ASSERT(payloadSize == 5);
+                cmdBuffer->DrawIndexedInstanced(args[0], args[1], args[2], static_cast<int32_t>(args[3]), args[4]);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDrawIndirect:
+            {
+                LLGL_ASSERT(payloadSize == 6);
+                cmdBuffer->DrawIndirect(ReadStreamObject<Buffer>(&args[0]), ReadStreamUInt64(&args[2]), args[4], args[5]);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDrawIndexedIndirect:
+            {
+                LLGL_ASSERT(payloadSize == 6);
+                cmdBuffer->DrawIndexedIndirect(ReadStreamObject<Buffer>(&args[0]), ReadStreamUInt64(&args[2]), args[4], args[5]);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDispatch:
+            {
+                LLGL_ASSERT(payloadSize == 3);
+                cmdBuffer->Dispatch(args[0], args[1], args[2]);
+            }
+            break;
+
+            default:
+            {
+                LLGL_TRAP("unknown command stream opcode: %u", opcode);
+            }
+            break;
+        }
+    }
+}
+
 
 // } /namespace LLGL
 
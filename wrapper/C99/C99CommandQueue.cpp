@@ -39,6 +39,23 @@ LLGL_C_EXPORT bool llglWaitFence(LLGLFence fence, uint64_t timeout)
     return g_CurrentCmdQueue->WaitFence(LLGL_REF(Fence, fence), timeout);
 }
 
+LLGL_C_EXPORT void llglSubmitFenceSignal(LLGLFence fence, uint64_t value)
+{
+    g_CurrentCmdQueue->SubmitSignal(LLGL_REF(Fence, fence), value);
+}
+
+LLGL_C_EXPORT bool llglWaitFenceValue(LLGLFence fence, uint64_t value, uint64_t timeout)
+{
+    return g_CurrentCmdQueue->WaitFenceValue(LLGL_REF(Fence, fence), value, timeout);
+}
+
+LLGL_C_EXPORT bool llglWaitFenceValues(uint32_t numFences, const LLGLFence* fences, const uint64_t* values, uint64_t timeout)
+{
+    LLGL_ASSERT_PTR(fences);
+    LLGL_ASSERT_PTR(values);
+    return g_CurrentCmdQueue->WaitFenceValues(numFences, reinterpret_cast<Fence* const*>(fences), values, timeout);
+}
+
 LLGL_C_EXPORT void llglWaitIdle()
 {
     g_CurrentCmdQueue->WaitIdle();
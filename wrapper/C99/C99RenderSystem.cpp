@@ -328,6 +328,20 @@ LLGL_C_EXPORT void llglReadTexture(LLGLTexture texture, const LLGLTextureRegion*
     g_CurrentRenderSystem->ReadTexture(LLGL_REF(Texture, texture), *reinterpret_cast<const TextureRegion*>(textureRegion), *reinterpret_cast<const MutableImageView*>(dstImageView));
 }
 
+LLGL_C_EXPORT uint64_t llglRequestTextureRead(LLGLTexture texture, const LLGLTextureRegion* textureRegion)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(textureRegion);
+    return g_CurrentRenderSystem->RequestTextureRead(LLGL_REF(Texture, texture), *reinterpret_cast<const TextureRegion*>(textureRegion));
+}
+
+LLGL_C_EXPORT bool llglResolveTextureRead(uint64_t requestID, const LLGLMutableImageView* dstImageView, bool wait)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(dstImageView);
+    return g_CurrentRenderSystem->ResolveTextureRead(requestID, *reinterpret_cast<const MutableImageView*>(dstImageView), wait);
+}
+
 LLGL_C_EXPORT LLGLSampler llglCreateSampler(const LLGLSamplerDescriptor* samplerDesc)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
@@ -499,6 +513,8 @@ static void ConvertPipelineLayoutDesc(PipelineLayoutDescriptor& dst, const LLGLP
     dst.uniforms.resize(src.numUniforms);
     for_range(i, src.numUniforms)
         ConvertUniformDesc(dst.uniforms[i], src.uniforms[i]);
+
+    dst.bindlessSet = src.bindlessSet;
 }
 
 LLGL_C_EXPORT LLGLPipelineLayout llglCreatePipelineLayout(const LLGLPipelineLayoutDescriptor* pipelineLayoutDesc)
@@ -36,6 +36,16 @@ LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger)
     return LLGL_PTR(RenderingDebugger, debugger)->GetTimeRecording();
 }
 
+LLGL_C_EXPORT bool llglBeginDebuggerTrace(LLGLRenderingDebugger debugger, const char* filename)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->BeginTrace(filename);
+}
+
+LLGL_C_EXPORT void llglEndDebuggerTrace(LLGLRenderingDebugger debugger)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->EndTrace();
+}
+
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile)
 {
     LLGL_ASSERT_PTR(outFrameProfile);
@@ -145,6 +145,11 @@ LLGL_C_EXPORT LLGLShaderType llglGetShaderType(LLGLShader shader)
     return static_cast<LLGLShaderType>(LLGL_PTR(Shader, shader)->GetType());
 }
 
+LLGL_C_EXPORT bool llglIsShaderReady(LLGLShader shader)
+{
+    return LLGL_PTR(Shader, shader)->IsReady();
+}
+
 
 // } /namespace LLGL
 
@@ -291,6 +291,8 @@ LLGL_STATIC_ASSERT_ENUM(Format, BC4UNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, BC4SNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, BC5UNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, BC5SNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, BC7UNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, BC7UNorm_sRGB);
 
 LLGL_STATIC_ASSERT_ENUM(ImageFormat, Alpha);
 LLGL_STATIC_ASSERT_ENUM(ImageFormat, R);
@@ -309,6 +311,7 @@ LLGL_STATIC_ASSERT_ENUM(ImageFormat, BC2);
 LLGL_STATIC_ASSERT_ENUM(ImageFormat, BC3);
 LLGL_STATIC_ASSERT_ENUM(ImageFormat, BC4);
 LLGL_STATIC_ASSERT_ENUM(ImageFormat, BC5);
+LLGL_STATIC_ASSERT_ENUM(ImageFormat, BC7);
 
 LLGL_STATIC_ASSERT_ENUM(DataType, Undefined);
 LLGL_STATIC_ASSERT_ENUM(DataType, Int8);
@@ -805,6 +808,7 @@ LLGL_STATIC_ASSERT_SIZE(CommandBufferDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, debugName);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, flags);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, numNativeBuffers);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, maxNumNativeBuffers);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, minStagingPoolSize);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, renderPass);
 
@@ -904,6 +908,8 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasLogicOp);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineCaching);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineStatistics);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderCondition);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasBindlessResources);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasIndirectDrawCount);
 
 LLGL_STATIC_ASSERT_SIZE(RenderingLimits);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, lineWidthRange);
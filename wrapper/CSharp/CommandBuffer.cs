@@ -51,6 +51,23 @@ namespace LLGL
             NativeLLGL.Execute(deferredCommandBuffer.Native);
         }
 
+        /// <summary>
+        /// Executes all commands that have been recorded into the specified command stream with a single native call.
+        /// </summary>
+        public void Execute(CommandStream commandStream)
+        {
+            if (commandStream.Length > 0)
+            {
+                unsafe
+                {
+                    fixed (int* wordsPtr = commandStream.Words)
+                    {
+                        NativeLLGL.ExecuteCommandStream(wordsPtr, new IntPtr(commandStream.Length));
+                    }
+                }
+            }
+        }
+
         public void UpdateBuffer(Buffer dstBuffer, long dstOffset, byte[] data)
         {
             unsafe
@@ -355,6 +372,16 @@ namespace LLGL
             NativeLLGL.DrawIndexedIndirectExt(buffer.Native, offset, numCommands, stride);
         }
 
+        public void DrawIndirectCount(Buffer argsBuffer, long argsOffset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride)
+        {
+            NativeLLGL.DrawIndirectCount(argsBuffer.Native, argsOffset, countBuffer.Native, countOffset, maxNumCommands, stride);
+        }
+
+        public void DrawIndexedIndirectCount(Buffer argsBuffer, long argsOffset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride)
+        {
+            NativeLLGL.DrawIndexedIndirectCount(argsBuffer.Native, argsOffset, countBuffer.Native, countOffset, maxNumCommands, stride);
+        }
+
         public void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
         {
             NativeLLGL.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
@@ -64,6 +64,39 @@ namespace LLGL
             return NativeLLGL.WaitFence(fence.Native, timeout);
         }
 
+        public void SubmitSignal(Fence fence, long value)
+        {
+            NativeLLGL.SubmitFenceSignal(fence.Native, value);
+        }
+
+        public bool WaitFenceValue(Fence fence, long value, long timeout)
+        {
+            return NativeLLGL.WaitFenceValue(fence.Native, value, timeout);
+        }
+
+        public bool WaitFenceValues(Fence[] fences, long[] values, long timeout)
+        {
+            if (fences.Length != values.Length)
+            {
+                throw new ArgumentException("Number of fence values does not match number of fences", "values");
+            }
+            var nativeFences = new NativeLLGL.Fence[fences.Length];
+            for (int i = 0; i < fences.Length; ++i)
+            {
+                nativeFences[i] = fences[i].Native;
+            }
+            unsafe
+            {
+                fixed (NativeLLGL.Fence* nativeFencesPtr = nativeFences)
+                {
+                    fixed (long* valuesPtr = values)
+                    {
+                        return NativeLLGL.WaitFenceValues(fences.Length, nativeFencesPtr, valuesPtr, timeout);
+                    }
+                }
+            }
+        }
+
         public void WaitIdle()
         {
             NativeLLGL.WaitIdle();
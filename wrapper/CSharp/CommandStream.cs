@@ -0,0 +1,313 @@
+/*
+ * CommandStream.cs
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+using System;
+
+namespace LLGL
+{
+    /// <summary>
+    /// Packed stream of command buffer commands that is submitted with a single native call via CommandBuffer.Execute(CommandStream).
+    /// The recorded objects are referenced by their native handles only, i.e. they must be kept alive until the stream has been executed.
+    /// </summary>
+    public sealed class CommandStream
+    {
+        // Must be kept in sync with LLGLCommandStreamOpcode in <LLGL-C/CommandBuffer.h>
+        private enum Opcode
+        {
+            SetViewport,
+            SetScissor,
+            SetVertexBuffer,
+            SetIndexBuffer,
+            SetIndexBufferExt,
+            SetResourceHeap,
+            SetResource,
+            SetPipelineState,
+            SetBlendFactor,
+            SetStencilReference,
+            SetUniforms,
+            UpdateBuffer,
+            Draw,
+            DrawIndexed,
+            DrawInstanced,
+            DrawIndexedInstanced,
+            DrawIndirect,
+            DrawIndexedIndirect,
+            Dispatch,
+        }
+
+        private int[] words;
+        private int length = 0;
+
+        public CommandStream(int capacity = 1024)
+        {
+            words = new int[Math.Max(capacity, 16)];
+        }
+
+        internal int[] Words
+        {
+            get
+            {
+                return words;
+            }
+        }
+
+        /// <summary>
+        /// Returns the number of 32-bit words that have been recorded into this stream.
+        /// </summary>
+        public int Length
+        {
+            get
+            {
+                return length;
+            }
+        }
+
+        /// <summary>
+        /// Resets this stream without releasing its memory so it can be recorded again.
+        /// </summary>
+        public void Clear()
+        {
+            length = 0;
+        }
+
+        public void SetViewport(Viewport viewport)
+        {
+            BeginRecord(Opcode.SetViewport, 6);
+            WriteFloat(viewport.X);
+            WriteFloat(viewport.Y);
+            WriteFloat(viewport.Width);
+            WriteFloat(viewport.Height);
+            WriteFloat(viewport.MinDepth);
+            WriteFloat(viewport.MaxDepth);
+        }
+
+        public void SetScissor(Scissor scissor)
+        {
+            BeginRecord(Opcode.SetScissor, 4);
+            words[length++] = scissor.X;
+            words[length++] = scissor.Y;
+            words[length++] = scissor.Width;
+            words[length++] = scissor.Height;
+        }
+
+        public void SetVertexBuffer(Buffer buffer)
+        {
+            BeginRecord(Opcode.SetVertexBuffer, 2);
+            unsafe
+            {
+                WriteHandle(buffer.Native.ptr);
+            }
+        }
+
+        public void SetIndexBuffer(Buffer buffer)
+        {
+            BeginRecord(Opcode.SetIndexBuffer, 2);
+            unsafe
+            {
+                WriteHandle(buffer.Native.ptr);
+            }
+        }
+
+        public void SetIndexBuffer(Buffer buffer, Format format, long offset)
+        {
+            BeginRecord(Opcode.SetIndexBufferExt, 5);
+            unsafe
+            {
+                WriteHandle(buffer.Native.ptr);
+            }
+            words[length++] = (int)format;
+            WriteLong(offset);
+        }
+
+        public void SetResourceHeap(ResourceHeap resourceHeap, int descriptorSet = 0)
+        {
+            BeginRecord(Opcode.SetResourceHeap, 3);
+            unsafe
+            {
+                WriteHandle(resourceHeap.Native.ptr);
+            }
+            words[length++] = descriptorSet;
+        }
+
+        public void SetResource(int descriptor, Resource resource)
+        {
+            BeginRecord(Opcode.SetResource, 3);
+            words[length++] = descriptor;
+            unsafe
+            {
+                WriteHandle(resource.NativeBase.ptr);
+            }
+        }
+
+        public void SetPipelineState(PipelineState pipelineState)
+        {
+            BeginRecord(Opcode.SetPipelineState, 2);
+            unsafe
+            {
+                WriteHandle(pipelineState.Native.ptr);
+            }
+        }
+
+        public void SetBlendFactor(Color color)
+        {
+            BeginRecord(Opcode.SetBlendFactor, 4);
+            WriteFloat(color.R);
+            WriteFloat(color.G);
+            WriteFloat(color.B);
+            WriteFloat(color.A);
+        }
+
+        public void SetStencilReference(int reference, StencilFace stencilFace = StencilFace.FrontAndBack)
+        {
+            BeginRecord(Opcode.SetStencilReference, 2);
+            words[length++] = reference;
+            words[length++] = (int)stencilFace;
+        }
+
+        public void SetUniforms(int first, byte[] data)
+        {
+            BeginRecord(Opcode.SetUniforms, 2 + GetDataWordCount(data.Length));
+            words[length++] = first;
+            words[length++] = data.Length;
+            WriteData(data);
+        }
+
+        public void UpdateBuffer(Buffer dstBuffer, long dstOffset, byte[] data)
+        {
+            if (data.Length > ushort.MaxValue)
+            {
+                throw new ArgumentException("data size for UpdateBuffer in command stream must not exceed 65535 bytes");
+            }
+            BeginRecord(Opcode.UpdateBuffer, 5 + GetDataWordCount(data.Length));
+            unsafe
+            {
+                WriteHandle(dstBuffer.Native.ptr);
+            }
+            WriteLong(dstOffset);
+            words[length++] = data.Length;
+            WriteData(data);
+        }
+
+        public void Draw(int numVertices, int firstVertex)
+        {
+            BeginRecord(Opcode.Draw, 2);
+            words[length++] = numVertices;
+            words[length++] = firstVertex;
+        }
+
+        public void DrawIndexed(int numIndices, int firstIndex, int vertexOffset = 0)
+        {
+            BeginRecord(Opcode.DrawIndexed, 3);
+            words[length++] = numIndices;
+            words[length++] = firstIndex;
+            words[length++] = vertexOffset;
+        }
+
+        public void DrawInstanced(int numVertices, int firstVertex, int numInstances, int firstInstance = 0)
+        {
+            BeginRecord(Opcode.DrawInstanced, 4);
+            words[length++] = numVertices;
+            words[length++] = firstVertex;
+            words[length++] = numInstances;
+            words[length++] = firstInstance;
+        }
+
+        public void DrawIndexedInstanced(int numIndices, int numInstances, int firstIndex, int vertexOffset = 0, int firstInstance = 0)
+        {
+            BeginRecord(Opcode.DrawIndexedInstanced, 5);
+            words[length++] = numIndices;
+            words[length++] = numInstances;
+            words[length++] = firstIndex;
+            words[length++] = vertexOffset;
+            words[length++] = firstInstance;
+        }
+
+        public void DrawIndirect(Buffer buffer, long offset, int numCommands = 1, int stride = 16)
+        {
+            BeginRecord(Opcode.DrawIndirect, 6);
+            unsafe
+            {
+                WriteHandle(buffer.Native.ptr);
+            }
+            WriteLong(offset);
+            words[length++] = numCommands;
+            words[length++] = stride;
+        }
+
+        public void DrawIndexedIndirect(Buffer buffer, long offset, int numCommands = 1, int stride = 20)
+        {
+            BeginRecord(Opcode.DrawIndexedIndirect, 6);
+            unsafe
+            {
+                WriteHandle(buffer.Native.ptr);
+            }
+            WriteLong(offset);
+            words[length++] = numCommands;
+            words[length++] = stride;
+        }
+
+        public void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
+        {
+            BeginRecord(Opcode.Dispatch, 3);
+            words[length++] = numWorkGroupsX;
+            words[length++] = numWorkGroupsY;
+            words[length++] = numWorkGroupsZ;
+        }
+
+        private static int GetDataWordCount(int dataSize)
+        {
+            return (dataSize + 3) / 4;
+        }
+
+        // Writes the record header and ensures the stream has enough capacity for the payload.
+        private void BeginRecord(Opcode opcode, int numWords)
+        {
+            if (numWords > ushort.MaxValue)
+            {
+                throw new ArgumentException("payload of command stream record must not exceed 65535 words");
+            }
+            int requiredLength = length + 1 + numWords;
+            if (requiredLength > words.Length)
+            {
+                Array.Resize(ref words, Math.Max(requiredLength, words.Length * 2));
+            }
+            words[length++] = (int)opcode | (numWords << 16);
+        }
+
+        private void WriteFloat(float value)
+        {
+            words[length++] = BitConverter.ToInt32(BitConverter.GetBytes(value), 0);
+        }
+
+        private void WriteLong(long value)
+        {
+            words[length++] = (int)(value & 0xFFFFFFFFL);
+            words[length++] = (int)(value >> 32);
+        }
+
+        private unsafe void WriteHandle(void* ptr)
+        {
+            WriteLong((long)ptr);
+        }
+
+        private void WriteData(byte[] data)
+        {
+            int numWords = GetDataWordCount(data.Length);
+            if (numWords > 0)
+            {
+                words[length + numWords - 1] = 0;
+            }
+            System.Buffer.BlockCopy(data, 0, words, length * 4, data.Length);
+            length += numWords;
+        }
+    }
+}
+
+
+
+
+// ================================================================================
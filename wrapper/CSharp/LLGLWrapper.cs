@@ -53,6 +53,13 @@ namespace LLGL
         Back,
     }
 
+    public enum CommandQueueType
+    {
+        Graphics,
+        Compute,
+        Transfer,
+    }
+
     public enum Format
     {
         Undefined,
@@ -134,6 +141,8 @@ namespace LLGL
         BC4SNorm,
         BC5UNorm,
         BC5SNorm,
+        BC7UNorm,
+        BC7UNorm_sRGB,
     }
 
     public enum ImageFormat
@@ -155,6 +164,7 @@ namespace LLGL
         BC3,
         BC4,
         BC5,
+        BC7,
     }
 
     public enum DataType
@@ -1095,11 +1105,13 @@ namespace LLGL
 
     public class CommandBufferDescriptor
     {
-        public AnsiString         DebugName { get; set; }          = null;
-        public CommandBufferFlags Flags { get; set; }              = 0;
-        public int                NumNativeBuffers { get; set; }   = 2;
-        public long               MinStagingPoolSize { get; set; } = (0xFFFF+1);
-        public RenderPass         RenderPass { get; set; }         = null;
+        public AnsiString         DebugName { get; set; }           = null;
+        public CommandBufferFlags Flags { get; set; }               = 0;
+        public int                NumNativeBuffers { get; set; }    = 2;
+        public int                MaxNumNativeBuffers { get; set; } = 8;
+        public long               MinStagingPoolSize { get; set; }  = (0xFFFF+1);
+        public RenderPass         RenderPass { get; set; }          = null;
+        public CommandQueueType   QueueType { get; set; }           = CommandQueueType.Graphics;
 
         internal NativeLLGL.CommandBufferDescriptor Native
         {
@@ -1112,13 +1124,15 @@ namespace LLGL
                     {
                         native.debugName = debugNamePtr;
                     }
-                    native.flags              = (int)Flags;
-                    native.numNativeBuffers   = NumNativeBuffers;
-                    native.minStagingPoolSize = MinStagingPoolSize;
+                    native.flags               = (int)Flags;
+                    native.numNativeBuffers    = NumNativeBuffers;
+                    native.maxNumNativeBuffers = MaxNumNativeBuffers;
+                    native.minStagingPoolSize  = MinStagingPoolSize;
                     if (RenderPass != null)
                     {
                         native.renderPass = RenderPass.Native;
                     }
+                    native.queueType           = QueueType;
                 }
                 return native;
             }
@@ -1177,8 +1191,12 @@ namespace LLGL
 
     public class ProfileTimeRecord
     {
-        public AnsiString Annotation { get; set; }  = "";
-        public long       ElapsedTime { get; set; } = 0;
+        public AnsiString Annotation { get; set; }    = "";
+        public long       ElapsedTime { get; set; }   = 0;
+        public long       CpuTicksStart { get; set; } = 0;
+        public long       CpuTicksEnd { get; set; }   = 0;
+        public int        ThreadID { get; set; }      = 0;
+        public int        NestingLevel { get; set; }  = 0;
 
         public ProfileTimeRecord() { }
 
@@ -1199,6 +1217,10 @@ namespace LLGL
                         native.annotation = annotationPtr;
                     }
                     native.elapsedTime = ElapsedTime;
+                    native.cpuTicksStart = CpuTicksStart;
+                    native.cpuTicksEnd = CpuTicksEnd;
+                    native.threadID = ThreadID;
+                    native.nestingLevel = NestingLevel;
                 }
                 return native;
             }
@@ -1206,8 +1228,12 @@ namespace LLGL
             {
                 unsafe
                 {
-                    Annotation  = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
-                    ElapsedTime = value.elapsedTime;
+                    Annotation    = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    ElapsedTime   = value.elapsedTime;
+                    CpuTicksStart = value.cpuTicksStart;
+                    CpuTicksEnd   = value.cpuTicksEnd;
+                    ThreadID      = value.threadID;
+                    NestingLevel  = value.nestingLevel;
                 }
             }
         }
@@ -1344,6 +1370,8 @@ namespace LLGL
         public bool HasPipelineCaching { get; set; }           = false;
         public bool HasPipelineStatistics { get; set; }        = false;
         public bool HasRenderCondition { get; set; }           = false;
+        public bool HasBindlessResources { get; set; }         = false;
+        public bool HasIndirectDrawCount { get; set; }         = false;
 
         public RenderingFeatures() { }
 
@@ -1383,6 +1411,8 @@ namespace LLGL
                 HasPipelineCaching           = value.hasPipelineCaching;
                 HasPipelineStatistics        = value.hasPipelineStatistics;
                 HasRenderCondition           = value.hasRenderCondition;
+                HasBindlessResources         = value.hasBindlessResources;
+                HasIndirectDrawCount         = value.hasIndirectDrawCount;
             }
         }
     }
@@ -2891,6 +2921,7 @@ namespace LLGL
                 }
             }
         }
+        public int                       BindlessSet { get; set; }    = -1;
 
         internal NativeLLGL.PipelineLayoutDescriptor Native
         {
@@ -2935,6 +2966,7 @@ namespace LLGL
                             native.uniforms = uniformsPtr;
                         }
                     }
+                    native.bindlessSet = BindlessSet;
                 }
                 return native;
             }
@@ -3426,11 +3458,13 @@ namespace LLGL
 
         public unsafe struct CommandBufferDescriptor
         {
-            public byte*      debugName;          /* = null */
-            public int        flags;              /* = 0 */
-            public int        numNativeBuffers;   /* = 2 */
-            public long       minStagingPoolSize; /* = (0xFFFF+1) */
-            public RenderPass renderPass;         /* = null */
+            public byte*            debugName;           /* = null */
+            public int              flags;               /* = 0 */
+            public int              numNativeBuffers;    /* = 2 */
+            public int              maxNumNativeBuffers; /* = 8 */
+            public long             minStagingPoolSize;  /* = (0xFFFF+1) */
+            public RenderPass       renderPass;          /* = null */
+            public CommandQueueType queueType;           /* = CommandQueueType.Graphics */
         }
 
         public unsafe struct DispatchIndirectArguments
@@ -3454,8 +3488,12 @@ namespace LLGL
 
         public unsafe struct ProfileTimeRecord
         {
-            public byte* annotation;  /* = "" */
-            public long  elapsedTime; /* = 0 */
+            public byte* annotation;    /* = "" */
+            public long  elapsedTime;   /* = 0 */
+            public long  cpuTicksStart; /* = 0 */
+            public long  cpuTicksEnd;   /* = 0 */
+            public int   threadID;      /* = 0 */
+            public int   nestingLevel;  /* = 0 */
         }
 
         public unsafe struct ProfileCommandQueueRecord
@@ -3571,6 +3609,10 @@ namespace LLGL
             public bool hasPipelineStatistics;        /* = false */
             [MarshalAs(UnmanagedType.I1)]
             public bool hasRenderCondition;           /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasBindlessResources;         /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasIndirectDrawCount;         /* = false */
         }
 
         public unsafe struct RenderingLimits
@@ -4027,6 +4069,7 @@ namespace LLGL
             public StaticSamplerDescriptor* staticSamplers;
             public IntPtr                   numUniforms;
             public UniformDescriptor*       uniforms;
+            public int                      bindlessSet;       /* = -1 */
         }
 
         public unsafe struct GraphicsPipelineDescriptor
@@ -4326,6 +4369,12 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglDrawIndexedIndirectExt", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawIndexedIndirectExt(Buffer buffer, long offset, int numCommands, int stride);
 
+        [DllImport(DllName, EntryPoint="llglDrawIndirectCount", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndirectCount(Buffer argsBuffer, long argsOffset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride);
+
+        [DllImport(DllName, EntryPoint="llglDrawIndexedIndirectCount", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndexedIndirectCount(Buffer argsBuffer, long argsOffset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride);
+
         [DllImport(DllName, EntryPoint="llglDispatch", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ);
 
@@ -4345,6 +4394,9 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetNativeHandle(void* nativeHandle, IntPtr nativeHandleSize);
 
+        [DllImport(DllName, EntryPoint="llglExecuteCommandStream", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ExecuteCommandStream(int* words, IntPtr numWords);
+
         [DllImport(DllName, EntryPoint="llglSubmitCommandBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SubmitCommandBuffer(CommandBuffer commandBuffer);
 
@@ -4359,6 +4411,17 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool WaitFence(Fence fence, long timeout);
 
+        [DllImport(DllName, EntryPoint="llglSubmitFenceSignal", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SubmitFenceSignal(Fence fence, long value);
+
+        [DllImport(DllName, EntryPoint="llglWaitFenceValue", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool WaitFenceValue(Fence fence, long value, long timeout);
+
+        [DllImport(DllName, EntryPoint="llglWaitFenceValues", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool WaitFenceValues(int numFences, Fence* fences, long* values, long timeout);
+
         [DllImport(DllName, EntryPoint="llglWaitIdle", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void WaitIdle();
 
@@ -4443,6 +4506,10 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetPipelineStateReport", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Report GetPipelineStateReport(PipelineState pipelineState);
 
+        [DllImport(DllName, EntryPoint="llglIsPipelineStateReady", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool IsPipelineStateReady(PipelineState pipelineState);
+
         [DllImport(DllName, EntryPoint="llglGetQueryHeapType", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe QueryType GetQueryHeapType(QueryHeap queryHeap);
 
@@ -4459,6 +4526,13 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetDebuggerTimeRecording(RenderingDebugger debugger);
 
+        [DllImport(DllName, EntryPoint="llglBeginDebuggerTrace", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool BeginDebuggerTrace(RenderingDebugger debugger, [MarshalAs(UnmanagedType.LPStr)] string filename);
+
+        [DllImport(DllName, EntryPoint="llglEndDebuggerTrace", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void EndDebuggerTrace(RenderingDebugger debugger);
+
         [DllImport(DllName, EntryPoint="llglFlushDebuggerProfile", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void FlushDebuggerProfile(RenderingDebugger debugger, ref FrameProfile outFrameProfile);
 
@@ -4544,6 +4618,13 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglReadTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ReadTexture(Texture texture, ref TextureRegion textureRegion, ref MutableImageView dstImageView);
 
+        [DllImport(DllName, EntryPoint="llglRequestTextureRead", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe long RequestTextureRead(Texture texture, ref TextureRegion textureRegion);
+
+        [DllImport(DllName, EntryPoint="llglResolveTextureRead", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool ResolveTextureRead(long requestID, ref MutableImageView dstImageView, [MarshalAs(UnmanagedType.I1)] bool wait);
+
         [DllImport(DllName, EntryPoint="llglCreateSampler", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Sampler CreateSampler(ref SamplerDescriptor samplerDesc);
 
@@ -4686,6 +4767,10 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetShaderType", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe ShaderType GetShaderType(Shader shader);
 
+        [DllImport(DllName, EntryPoint="llglIsShaderReady", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool IsShaderReady(Shader shader);
+
         [DllImport(DllName, EntryPoint="llglGetSurfaceNativeHandle", CallingConvention=CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetSurfaceNativeHandle(Surface surface, void* nativeHandle, IntPtr nativeHandleSize);
@@ -261,6 +261,20 @@ namespace LLGL
             }
         }
 
+        public long RequestTextureRead(Texture texture, TextureRegion textureRegion)
+        {
+            return NativeLLGL.RequestTextureRead(texture.Native, ref textureRegion);
+        }
+
+        public bool ResolveTextureRead(long requestID, MutableImageView dstImageView, bool wait = false)
+        {
+            unsafe
+            {
+                var nativeDstImageView = dstImageView.Native;
+                return NativeLLGL.ResolveTextureRead(requestID, ref nativeDstImageView, wait);
+            }
+        }
+
         public Sampler CreateSampler(SamplerDescriptor samplerDesc)
         {
             var nativeSamplerDesc = samplerDesc.Native;
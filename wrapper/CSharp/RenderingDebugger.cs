@@ -36,6 +36,16 @@ namespace LLGL
             }
         }
 
+        public bool BeginTrace(string filename)
+        {
+            return NativeLLGL.BeginDebuggerTrace(Native, filename);
+        }
+
+        public void EndTrace()
+        {
+            NativeLLGL.EndDebuggerTrace(Native);
+        }
+
         public FrameProfile FlushProfile()
         {
             var nativeFrameProfile = new NativeLLGL.FrameProfile();
@@ -59,6 +59,14 @@ namespace LLGL
             }
         }
 
+        public bool IsReady
+        {
+            get
+            {
+                return NativeLLGL.IsShaderReady(Native);
+            }
+        }
+
         public ShaderReflection Reflect()
         {
             var nativeReflection = new NativeLLGL.ShaderReflection();